@@ -24,6 +24,7 @@
 
   CHANGE HISTORY:
 
+    18 October 2026 -- keep track of checks that were not evaluated
     15 March 2017 -- read files compressed with "native LAS 1.4 extension" of LASzip
     27 April 2013 -- adapted from the LASlib library for the ASPRS LASvalidator
 
@@ -122,6 +123,17 @@ public:
       warnings = 0;
       warning_num = 0;
     }
+    if (unevaluated_num)
+    {
+      U32 i;
+      for (i = 0; i < unevaluated_num; i++)
+      {
+        free(unevaluated[i]);
+      }
+      free(unevaluated);
+      unevaluated = 0;
+      unevaluated_num = 0;
+    }
     memset((void*)this, 0, sizeof(LASerror));
   };
 
@@ -149,6 +161,18 @@ public:
     }
   };
 
+  void add_unevaluated(const CHAR* check, const CHAR* note)
+  {
+    if (check)
+    {
+      unevaluated = (CHAR**)realloc(unevaluated, sizeof(CHAR*)*(unevaluated_num+2));
+      unevaluated[unevaluated_num] = strdup(check);
+      unevaluated_num++;
+      unevaluated[unevaluated_num] = strdup(note);
+      unevaluated_num++;
+    }
+  };
+
   // keep track of fails and warnings
 
   U32 fail_num;
@@ -156,6 +180,11 @@ public:
 
   U32 warning_num;
   CHAR** warnings;
+
+  // and of the checks that were not evaluated (e.g. when the points were not read)
+
+  U32 unevaluated_num;
+  CHAR** unevaluated;
 };
 
 class LASquantizer
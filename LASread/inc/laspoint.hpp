@@ -31,6 +31,8 @@
   
   CHANGE HISTORY:
   
+    18 October 2026 -- LASpointBatch stores blocks of points column by column
+    18 October 2026 -- restored the LAS 1.4 field layout that the item readers write
      4 January 2020 -- bug fix for LAS 1.4 points with extra bytes (point types 6-10)
     30 September 2018 -- bug fix for LAS 1.4 points with RGB color (point type 7)
      5 September 2015 -- fixed alignment bug for GPS time for new LAS 1.4 points
@@ -67,17 +69,17 @@ public:
   inline U16 get_intensity() const { return intensity; };
   inline U8 get_return_number() const { return return_number; };
   inline U8 get_number_of_returns() const { return number_of_returns; };
-  inline U8 get_extended_return_number() const { return extended_return_number; };
-  inline U8 get_extended_number_of_returns() const { return extended_number_of_returns; };
-  inline U8 get_number_of_returns_of_given_pulse() const { return number_of_returns_of_given_pulse; };
+  inline U8 get_extended_return_number() const { return return_number; }; // (same 4 bits for all point types)
+  inline U8 get_extended_number_of_returns() const { return number_of_returns; }; // (same 4 bits for all point types)
+  inline U8 get_number_of_returns_of_given_pulse() const { return number_of_returns; };
   inline U8 get_classification_flags() const { return classification_flags; };
   inline U8 get_scanner_channel() const { return scanner_channel; };
   inline U8 get_scan_direction_flag() const { return scan_direction_flag; };
   inline U8 get_edge_of_flight_line() const { return edge_of_flight_line; };
   inline U8 get_classification() const { return classification; };
-  inline U8 get_extended_classification() const { return extended_classification; };
+  inline U8 get_extended_classification() const { return classification; }; // (all 8 bits for point types 6 - 10)
   inline U8 get_user_data() const { return user_data; };
-  inline U8 get_extended_point_type() { return extended_point_type; };
+  inline U8 get_extended_point_type() const { return (U8)are_las14; };
   inline I16 get_scan_angle() const { return scan_angle; }; // (raw = not scaled by 0.006)
   inline U16 get_point_source_ID() const { return point_source_ID; };
   inline I8 get_scan_angle_rank() const { return scan_angle_rank; };
@@ -153,30 +155,23 @@ public:
   I32 Y;
   I32 Z;
   U16 intensity;
+  // all item readers write the first 32 bytes in this (LAS 1.4) layout so the
+  // fields must stay as they are. older point types get converted to it.
+
   U8 return_number : 4;
-  U8 number_of_returns : 3;
-  U8 number_of_returns_of_given_pulse : 4;
+  U8 number_of_returns : 4;
   U8 classification_flags : 4;
   U8 scanner_channel : 2;  // LAS 1.4, point types 6 - 10 only
   U8 scan_direction_flag : 1;
   U8 edge_of_flight_line : 1;
   U8 classification;
   U8 user_data;
-  U8 extended_point_type : 2;
   I16 scan_angle;
   U16 point_source_ID;
   I8 scan_angle_rank;
 
   U8 gps_time_change;      // LAS 1.4, point types 6 - 10 only
 
-  // LAS 1.4 only
-  I16 extended_scan_angle;
-  U8 extended_scanner_channel : 2;
-  U8 extended_classification_flags : 4;
-  U8 extended_classification;
-  U8 extended_return_number : 4;
-  U8 extended_number_of_returns : 4;
-
   F64 gps_time;
 
   U16 rgbi[4];
@@ -213,4 +208,76 @@ public:
   LASitem* items;
 };
 
+// a block of points stored as one array per attribute so that checks can run
+// over each attribute in a tight loop. columns that the point type does not
+// have are not allocated (their value is zero for every point)
+
+class LASpointBatch
+{
+public:
+  U32 capacity;
+  U32 number;
+
+  I32* X;
+  I32* Y;
+  I32* Z;
+  U16* intensity;
+  U8* return_number;
+  U8* number_of_returns;
+  U8* classification;
+  I8* scan_angle_rank;
+  I16* scan_angle;
+  U16* point_source_ID;
+  F64* gps_time;           // only if have_gps_time
+  U16* R;                  // only if have_rgb
+  U16* G;                  // only if have_rgb
+  U16* B;                  // only if have_rgb
+  U16* I;                  // only if have_nir
+  U8* wave_packet_index;   // only if have_wave_packet
+
+  BOOL have_gps_time;
+  BOOL have_rgb;
+  BOOL have_nir;
+  BOOL have_wave_packet;
+
+  const LASquantizer* quantizer;
+
+  // allocates the columns for the type of the point (after it was initialized)
+
+  BOOL init(const LASpoint* point, const U32 capacity);
+
+  // appends the point to the batch. the caller makes sure it is not full
+
+  inline void add(const LASpoint* point)
+  {
+    X[number] = point->X;
+    Y[number] = point->Y;
+    Z[number] = point->Z;
+    intensity[number] = point->intensity;
+    return_number[number] = point->return_number;
+    number_of_returns[number] = point->number_of_returns;
+    classification[number] = point->classification;
+    scan_angle_rank[number] = point->scan_angle_rank;
+    scan_angle[number] = point->scan_angle;
+    point_source_ID[number] = point->point_source_ID;
+    if (have_gps_time) gps_time[number] = point->gps_time;
+    if (have_rgb)
+    {
+      R[number] = point->rgbi[0];
+      G[number] = point->rgbi[1];
+      B[number] = point->rgbi[2];
+    }
+    if (have_nir) I[number] = point->rgbi[3];
+    if (have_wave_packet) wave_packet_index[number] = point->get_wave_packet_index();
+    number++;
+  };
+
+  inline BOOL is_full() const { return (number == capacity); };
+
+  void clean();
+
+  LASpointBatch();
+  ~LASpointBatch();
+};
+
 #endif
@@ -24,6 +24,14 @@
   
   CHANGE HISTORY:
   
+    18 October 2026 -- optionally without the end-of-file warning
+    18 October 2026 -- how long open() took to load the VLRs and EVLRs
+    18 October 2026 -- check the chunk table and chunk headers of LAZ files without decoding
+    18 October 2026 -- optionally decompress only some layers of LAS 1.4 points
+    18 October 2026 -- read blocks of points into a LASpointBatch
+    18 October 2026 -- optionally read from a memory-mapped file
+    18 October 2026 -- number of stored points for range-parallel reading of LAS
+    18 October 2026 -- access to the chunk table for chunk-parallel reading
     27 April 2013 -- adapted from the LASzip library for the ASPRS LASvalidator
   
 ===============================================================================
@@ -33,6 +41,7 @@
 
 #include "lasheader.hpp"
 #include "laspoint.hpp"
+#include "laszip_decompress_selective_v3.hpp"
 
 #include <cstdio>
 
@@ -55,7 +64,10 @@ public:
   I64 npoints;
   I64 p_count;
 
-  BOOL open(const char* file_name, U32 io_buffer_size=65536);
+  // seconds (of a monotonic clock) that open() spent loading VLRs and EVLRs
+  F64 vlrs_seconds;
+
+  BOOL open(const char* file_name, U32 io_buffer_size=65536, BOOL use_mmap=FALSE, U32 decompress_selective=LASZIP_DECOMPRESS_SELECTIVE_ALL);
   BOOL open(FILE* file);
   BOOL open(istream& stream);
 
@@ -72,6 +84,36 @@ public:
   BOOL seek(const I64 p_index);
   BOOL read_point();
 
+  // a point that cannot be read prints an end-of-file warning unless quiet
+  // (e.g. for readers of ranges of the points of which only some are reported)
+  void set_quiet(BOOL quiet) { this->quiet = quiet; };
+
+  // reads up to n points (at most the capacity of the batch) into the columns
+  // of the batch. fewer than n are returned at the end of the points or when
+  // a point could not be read. the batch must be initialized with the point.
+  // the points are still decoded one by one with read_point() and each is
+  // then copied into the columns, so only the consumers of the batch loop
+  // over contiguous arrays.
+  U32 read_points(U32 n, LASpointBatch* batch);
+
+  // chunks of LAZ files with a complete chunk table can be read in parallel
+  // by several LASreaders. must be called before the first read_point().
+  U32 get_number_chunks();
+  I64 get_chunk_first_point(const U32 chunk) const;
+
+  // structural checks of LAZ files that decode no points. check_chunk_table()
+  // compares the chunk table with the file size and the point count and
+  // check_chunks() the headers of the chunks in [first,end) with the chunk
+  // table. get_error() says what failed. no points can be read afterwards.
+  BOOL check_chunk_table();
+  BOOL check_chunks(const U32 first, const U32 end);
+  const CHAR* get_error() const;
+
+  // the uncompressed points of LAS files can be read in parallel in ranges of
+  // records by several LASreaders. this is how many complete records the file
+  // stores (at most npoints). must be called before the first read_point().
+  I64 get_number_stored_points();
+
   inline F64 get_x() const { return point.get_x(); };
   inline F64 get_y() const { return point.get_y(); };
   inline F64 get_z() const { return point.get_z(); };
@@ -82,10 +124,11 @@ public:
   ~LASreader();
 
 private:
-  BOOL open(ByteStreamIn* stream);
+  BOOL open(ByteStreamIn* stream, U32 decompress_selective=LASZIP_DECOMPRESS_SELECTIVE_ALL);
   FILE* file;
   ByteStreamIn* stream;
   LASreadPoint* reader;
+  BOOL quiet;
 };
 
 #endif
@@ -24,6 +24,9 @@
   
   CHANGE HISTORY:
   
+    18 October 2026 -- add the LAS and LAZ files of (recursively walked) directories largest first
+    18 October 2026 -- file names in one string arena, a hash set for unique, and lists of files
+    18 October 2026 -- optionally open files as memory-mapped streams
     27 April 2013 -- adapted from the LASlib library for the ASPRS LASvalidator
   
 ===============================================================================
@@ -41,27 +44,49 @@ class LASreadOpener
 {
 public:
   const char* get_path() const;
+  const char* get_path(U32 number) const;
   const char* get_file_name() const;
+  const char* get_file_name(U32 number) const;
   BOOL add_file_name(const char* file_name, BOOL unique=FALSE);
+  BOOL add_list_of_files(const char* list_of_files, BOOL unique=FALSE);
+  BOOL add_directory(const char* directory, BOOL recursive=FALSE, BOOL unique=TRUE);
+  void set_extensions(const char* extensions);
+  void add_exclude(const char* pattern);
   U32 get_file_name_number() const;
   BOOL parse(const int argc, char * const argv[]);
   BOOL is_active() const;
   U32 get_format() const;
+  void set_mmap(const BOOL use_mmap) { this->use_mmap = use_mmap; };
+  void set_decompress_selective(const U32 decompress_selective) { this->decompress_selective = decompress_selective; };
   LASreader* open(U32 file_name_current);
   LASwaveformreader* open_waveform(const LASheader* lasheader);
   void reset();
   LASreadOpener();
   ~LASreadOpener();
 private:
-#ifdef _WIN32
   BOOL add_file_name_single(const char* file_name, BOOL unique=FALSE);
-#endif
+  BOOL add_file_name_hash(U32 number);
+  BOOL is_excluded(const char* name, const char* path) const;
+  BOOL has_extension(const char* name) const;
   I32 io_ibuffer_size;
-  char** file_names;
+  BOOL use_mmap;
+  U32 decompress_selective;
+  // all file names are stored back-to-back in one arena and found by offset
+  char* file_name_arena;
+  U64 file_name_arena_size;
+  U64 file_name_arena_allocated;
+  U64* file_name_offsets;
   char* file_name;
   U32 file_name_number;
   U32 file_name_allocated;
   U32 file_name_current;
+  // open addressing hash set of the file names (number + 1, 0 is empty)
+  U32* file_name_hash;
+  U32 file_name_hash_size;
+  // the extensions (e.g. "las,laz") and the wild cards that directories are filtered with
+  char* extensions;
+  char** excludes;
+  U32 exclude_number;
 };
 
 #endif
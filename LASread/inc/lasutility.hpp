@@ -24,6 +24,11 @@
   
   CHANGE HISTORY:
   
+    18 October 2026 -- LASsummary can merge partial summaries of parallel reads
+    18 October 2026 -- LASsummary no longer shares the buffers of the first point
+    18 October 2026 -- vectorized column kernels for adding a LASpointBatch
+    18 October 2026 -- LASinventory can add a LASpointBatch column by column
+    18 October 2026 -- LASinventory can merge partial inventories of parallel reads
     27 April 2013 -- adapted from the LASzip library for the ASPRS LASvalidator
   
 ===============================================================================
@@ -71,6 +76,8 @@ public:
   I64 xyz_fluff_1000[3];
   U32 wave_packet_index_mask[8];
   BOOL add(const LASpoint* point);
+  BOOL add(const LASpointBatch* batch);
+  BOOL merge(const LASinventory& inventory);
   BOOL has_fluff() const { return has_fluff(0) || has_fluff(1) || has_fluff(2); };
   BOOL has_fluff(U32 i) const { return (number_of_point_records && (number_of_point_records == xyz_fluff_10[i])); };
   BOOL has_serious_fluff() const { return has_serious_fluff(0) || has_serious_fluff(1) || has_serious_fluff(2); };
@@ -112,6 +119,9 @@ public:
   I64 xyz_fluff_1000[3];
   I64 xyz_fluff_10000[3];
   BOOL add(const LASpoint* point);
+  // adds a summary of the points that follow those of this summary. counts,
+  // minima, and maxima are the same as if all points had been added here
+  BOOL merge(const LASsummary& summary);
   BOOL has_fluff() const { return has_fluff(0) || has_fluff(1) || has_fluff(2); };
   BOOL has_fluff(U32 i) const { return (number_of_point_records && ((min.get_XYZ())[i] != (max.get_XYZ())[i]) && (number_of_point_records == xyz_fluff_10[i])); };
   BOOL has_serious_fluff() const { return has_serious_fluff(0) || has_serious_fluff(1) || has_serious_fluff(2); };
@@ -71,6 +71,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 ArithmeticModel::ArithmeticModel(U32 symbols, BOOL compress)
 {
@@ -99,30 +100,50 @@ I32 ArithmeticModel::init(U32* table)
       while (symbols > (1U << (table_bits + 2))) ++table_bits;
       table_size  = 1 << table_bits;
       table_shift = DM__LengthShift - table_bits;
-      distribution = new U32[2*symbols+table_size+2];
+      model_size = 2*symbols+table_size+2;
+      distribution = new U32[2*model_size];
       decoder_table = distribution + 2 * symbols;
     }
     else // small alphabet: no table needed
     {                                  
       decoder_table = 0;
       table_size = table_shift = 0;
-      distribution = new U32[2*symbols];
+      model_size = 2*symbols;
+      distribution = new U32[2*model_size];
     }
     if (distribution == 0)
     {
       return -1; // "cannot allocate model memory");
     }
     symbol_count = distribution + symbols;
+    // the second half keeps the initial state of the model
+    initial = distribution + model_size;
+    has_initial = FALSE;
   }
 
-  total_count = 0;
-  update_cycle = symbols;
   if (table)
+  {
+    total_count = 0;
+    update_cycle = symbols;
     for (U32 k = 0; k < symbols; k++) symbol_count[k] = table[k];
+    update();
+  }
+  else if (has_initial)
+  {
+    // a model is reset at the start of every chunk. copying the initial
+    // state is much cheaper than recomputing distribution and table
+    memcpy(distribution, initial, model_size*sizeof(U32));
+    total_count = symbols;
+  }
   else
+  {
+    total_count = 0;
+    update_cycle = symbols;
     for (U32 k = 0; k < symbols; k++) symbol_count[k] = 1;
-
-  update();
+    update();
+    memcpy(initial, distribution, model_size*sizeof(U32));
+    has_initial = TRUE;
+  }
   symbols_until_update = update_cycle = (symbols + 6) >> 1;
 
   return 0;
@@ -25,6 +25,7 @@
   
   CHANGE HISTORY:
   
+    18 October 2026 -- reset models at each chunk start by copying their initial state
     11 April 2019 -- 1024 AC_BUFFER_SIZE to 4096 for propagate_carry() overflow
     10 January 2011 -- licensing change for LGPL release and liblas integration
     8 December 2010 -- unified framework for all entropy coders
@@ -68,6 +69,8 @@ private:
   U32 * distribution, * symbol_count, * decoder_table;
   U32 total_count, update_cycle, symbols_until_update;
   U32 symbols, last_symbol, table_size, table_shift;
+  U32 * initial, model_size;
+  BOOL has_initial;
   BOOL compress;
   friend class ArithmeticEncoder;
   friend class ArithmeticDecoder;
@@ -0,0 +1,192 @@
+/*
+===============================================================================
+
+  FILE:  bytestreamin_mmap.hpp
+
+  CONTENTS:
+
+    Class for memory-mapped input streams with endian handling. The file is
+    mapped once and all reads are bounds-checked pointer bumps through the
+    mapped memory (see ByteStreamInArray) instead of calls into the C library.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created to read LAS and LAZ files without a libc call per field
+
+===============================================================================
+*/
+#ifndef BYTE_STREAM_IN_MMAP_HPP
+#define BYTE_STREAM_IN_MMAP_HPP
+
+#include "bytestreamin_array.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+class ByteStreamInMMapFile
+{
+public:
+  ByteStreamInMMapFile();
+/* map the entire file read-only                             */
+  BOOL map(const char* file_name);
+/* release the mapping                                       */
+  void unmap();
+/* destructor                                                */
+  ~ByteStreamInMMapFile();
+  const U8* data;
+  I64 size;
+private:
+#ifdef _WIN32
+  HANDLE file;
+  HANDLE mapping;
+#endif
+};
+
+class ByteStreamInMMapLE : public ByteStreamInArrayLE
+{
+public:
+  ByteStreamInMMapLE() {};
+/* map the file and read from the mapped memory              */
+  BOOL open(const char* file_name);
+/* destructor                                                */
+  ~ByteStreamInMMapLE() {};
+private:
+  ByteStreamInMMapFile mmap_file;
+};
+
+class ByteStreamInMMapBE : public ByteStreamInArrayBE
+{
+public:
+  ByteStreamInMMapBE() {};
+/* map the file and read from the mapped memory              */
+  BOOL open(const char* file_name);
+/* destructor                                                */
+  ~ByteStreamInMMapBE() {};
+private:
+  ByteStreamInMMapFile mmap_file;
+};
+
+inline ByteStreamInMMapFile::ByteStreamInMMapFile()
+{
+  data = 0;
+  size = 0;
+#ifdef _WIN32
+  file = INVALID_HANDLE_VALUE;
+  mapping = 0;
+#endif
+}
+
+inline BOOL ByteStreamInMMapFile::map(const char* file_name)
+{
+  unmap();
+#ifdef _WIN32
+  file = CreateFileA(file_name, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    return FALSE;
+  }
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file, &file_size) || (file_size.QuadPart == 0))
+  {
+    unmap();
+    return FALSE;
+  }
+  mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (mapping == 0)
+  {
+    unmap();
+    return FALSE;
+  }
+  data = (const U8*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (data == 0)
+  {
+    unmap();
+    return FALSE;
+  }
+  size = file_size.QuadPart;
+#else
+  int fd = ::open(file_name, O_RDONLY);
+  if (fd == -1)
+  {
+    return FALSE;
+  }
+  struct stat file_stat;
+  if ((fstat(fd, &file_stat) != 0) || (file_stat.st_size == 0))
+  {
+    close(fd);
+    return FALSE;
+  }
+  void* address = mmap(0, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // the mapping stays valid after the file descriptor is closed
+  close(fd);
+  if (address == MAP_FAILED)
+  {
+    return FALSE;
+  }
+  madvise(address, (size_t)file_stat.st_size, MADV_SEQUENTIAL);
+  data = (const U8*)address;
+  size = file_stat.st_size;
+#endif
+  return TRUE;
+}
+
+inline void ByteStreamInMMapFile::unmap()
+{
+#ifdef _WIN32
+  if (data) UnmapViewOfFile(data);
+  if (mapping) CloseHandle(mapping);
+  if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+  file = INVALID_HANDLE_VALUE;
+  mapping = 0;
+#else
+  if (data) munmap((void*)data, (size_t)size);
+#endif
+  data = 0;
+  size = 0;
+}
+
+inline ByteStreamInMMapFile::~ByteStreamInMMapFile()
+{
+  unmap();
+}
+
+inline BOOL ByteStreamInMMapLE::open(const char* file_name)
+{
+  if (!mmap_file.map(file_name))
+  {
+    return FALSE;
+  }
+  return init(mmap_file.data, mmap_file.size);
+}
+
+inline BOOL ByteStreamInMMapBE::open(const char* file_name)
+{
+  if (!mmap_file.map(file_name))
+  {
+    return FALSE;
+  }
+  return init(mmap_file.data, mmap_file.size);
+}
+
+#endif
@@ -8320,7 +8320,7 @@ bool GeoProjectionConverter::to_lon_lat_ele(const double* point, double& longitu
     switch (source_projection->type)
     {
     case GEO_PROJECTION_UTM:
-      UTMtoLL(point[0], point[1], latitude, longitude, ellipsoid, (const GeoProjectionParametersUTM*)source_projection);
+      UTMtoLL(coordinates2meter*point[0], coordinates2meter*point[1], latitude, longitude, ellipsoid, (const GeoProjectionParametersUTM*)source_projection);
       break;
     case GEO_PROJECTION_LCC:
       LCCtoLL(coordinates2meter*point[0], coordinates2meter*point[1], latitude, longitude, ellipsoid, (const GeoProjectionParametersLCC*)source_projection);
@@ -8356,6 +8356,449 @@ bool GeoProjectionConverter::to_lon_lat_ele(const double* point, double& longitu
   return false;
 }
 
+// the array conversions below compute everything that does not depend on the
+// point once per call and then run one straight loop per projection. they use
+// the same series as the scalar functions but evaluate them with Horner's rule
+// and get sin() and cos() of the multiple angles from one sin() and cos() so
+// that each point needs only two or six (TM) trigonometric calls and a square
+// root. the results agree with the scalar functions to within 1e-9 degrees
+
+static void UTMtoLL_array(const double* x, const double* y, size_t n, const double coordinates2meter, double* latitude, double* longitude, const GeoProjectionEllipsoid* ellipsoid, const GeoProjectionParametersUTM* utm)
+{
+  const double k0 = 0.9996;
+  const double a = ellipsoid->equatorial_radius;
+  const double e2 = ellipsoid->eccentricity_squared;
+  const double ep2 = ellipsoid->eccentricity_prime_squared;
+  const double e1 = ellipsoid->eccentricity_e1;
+  const double mu_scale = 1.0/(k0*a*(1-e2/4-3*e2*e2/64-5*e2*e2*e2/256));
+  const double phi2 = 3*e1/2-27*e1*e1*e1/32;
+  const double phi4 = 21*e1*e1/16-55*e1*e1*e1*e1/32;
+  const double phi6 = 151*e1*e1*e1/96;
+  const double one_minus_e2 = 1-e2;
+  const double inverse_a_k0 = 1.0/(a*k0);
+  const double false_northing = (utm->utm_northern_hemisphere ? 0.0 : 10000000.0);
+  const double long_origin = utm->utm_long_origin;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    double mu = (coordinates2meter*y[i] - false_northing)*mu_scale;
+    double s2 = sin(2*mu);
+    double c2 = cos(2*mu);
+    double s4 = 2*s2*c2;
+    double c4 = 1-2*s2*s2;
+    double s6 = s4*c2+c4*s2;
+    double phi1 = mu + phi2*s2 + phi4*s4 + phi6*s6;
+
+    double s = sin(phi1);
+    double c = cos(phi1);
+    double t = s/c;
+    double w = 1-e2*s*s;
+    double sqrt_w = sqrt(w);
+    double T1 = t*t;
+    double C1 = ep2*c*c;
+    double D = (coordinates2meter*x[i] - 500000.0)*sqrt_w*inverse_a_k0;   // x/(N1*k0)
+    double D2 = D*D;
+
+    double lat = phi1 - (t*w/one_minus_e2)*D2*(0.5 - D2*((5+3*T1+10*C1-4*C1*C1-9*ep2)/24 - D2*(61+90*T1+298*C1+45*T1*T1-252*ep2-3*C1*C1)/720));
+    double lon = D*(1 - D2*((1+2*T1+C1)/6 - D2*(5-2*C1+28*T1-3*C1*C1+8*ep2+24*T1*T1)/120))/c;
+
+    latitude[i] = lat*rad2deg;
+    longitude[i] = lon*rad2deg + long_origin;
+  }
+}
+
+static void LLtoUTM_array(const double* latitude, const double* longitude, size_t n, const double meter2coordinates, double* x, double* y, const GeoProjectionEllipsoid* ellipsoid, const GeoProjectionParametersUTM* utm)
+{
+  const double k0 = 0.9996;
+  const double a = ellipsoid->equatorial_radius;
+  const double e2 = ellipsoid->eccentricity_squared;
+  const double ep2 = ellipsoid->eccentricity_prime_squared;
+  const double m0 = a*(1-e2/4-3*e2*e2/64-5*e2*e2*e2/256);
+  const double m2 = a*(3*e2/8+3*e2*e2/32+45*e2*e2*e2/1024);
+  const double m4 = a*(15*e2*e2/256+45*e2*e2*e2/1024);
+  const double m6 = a*(35*e2*e2*e2/3072);
+  const double long_origin = ((utm->utm_zone_number - 1)*6 - 180 + 3)*deg2rad;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    // make sure the longitude is between -180.00 .. 179.9
+    double long_temp = (longitude[i]+180)-int((longitude[i]+180)/360)*360-180;
+    double lat = latitude[i]*deg2rad;
+
+    double s = sin(lat);
+    double c = cos(lat);
+    double t = s/c;
+    double N = a/sqrt(1-e2*s*s);
+    double T = t*t;
+    double C = ep2*c*c;
+    double A = c*(long_temp*deg2rad-long_origin);
+    double A2 = A*A;
+
+    double s2 = 2*s*c;
+    double c2 = (c-s)*(c+s);
+    double s4 = 2*s2*c2;
+    double c4 = 1-2*s2*s2;
+    double s6 = s4*c2+c4*s2;
+    double M = m0*lat - m2*s2 + m4*s4 - m6*s6;
+
+    double easting = k0*N*A*(1 + A2*((1-T+C)/6 + A2*(5-18*T+T*T+72*C-58*ep2)/120)) + 500000.0;
+    double northing = k0*(M + N*t*A2*(0.5 + A2*((5-T+9*C+4*C*C)/24 + A2*(61-58*T+T*T+600*C-330*ep2)/720)));
+    northing += (latitude[i] < 0 ? 10000000.0 : 0.0); // offset for southern hemisphere
+
+    x[i] = meter2coordinates*easting;
+    y[i] = meter2coordinates*northing;
+  }
+}
+
+// the meridional distance of latitude for the sine and cosine of twice of it
+
+static inline double tm_meridional_distance(const double latitude, const double s2, const double c2, const GeoProjectionParametersTM* tm)
+{
+  double s4 = 2*s2*c2;
+  double c4 = 1-2*s2*s2;
+  double s6 = s4*c2+c4*s2;
+  double s8 = 2*s4*c4;
+  return tm->tm_ap*latitude - tm->tm_bp*s2 + tm->tm_cp*s4 - tm->tm_dp*s6 + tm->tm_ep*s8;
+}
+
+static void TMtoLL_array(const double* x, const double* y, size_t n, const double coordinates2meter, double* latitude, double* longitude, const GeoProjectionEllipsoid* ellipsoid, const GeoProjectionParametersTM* tm)
+{
+  const double a = ellipsoid->equatorial_radius;
+  const double e2 = ellipsoid->eccentricity_squared;
+  const double ep2 = ellipsoid->eccentricity_prime_squared;
+  const double k = tm->tm_scale_factor;
+  const double tmdo = tm_meridional_distance(tm->tm_lat_origin_radian, sin(2*tm->tm_lat_origin_radian), cos(2*tm->tm_lat_origin_radian), tm);
+  const double sr0 = a*(1-e2);
+  const double inverse_sr0 = 1.0/sr0;
+  const double inverse_a = 1.0/a;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    double tmd = tmdo + (coordinates2meter*y[i] - tm->tm_false_northing_meter)/k;
+
+    // footpoint latitude
+    double ftphi = tmd*inverse_sr0;
+    for (int j = 0; j < 5; j++)
+    {
+      double s2 = sin(2*ftphi);
+      double c2 = cos(2*ftphi);
+      double w = 1-e2*(1-c2)/2;
+      ftphi += (tmd - tm_meridional_distance(ftphi, s2, c2, tm))*w*sqrt(w)*inverse_sr0;
+    }
+
+    double s = sin(ftphi);
+    double c = cos(ftphi);
+    double t = s/c;
+    double w = 1-e2*s*s;
+    double sqrt_w = sqrt(w);
+    double inverse_sr = w*sqrt_w*inverse_sr0;  // radius of curvature in the meridian
+    double u = sqrt_w*inverse_a/k;             // radius of curvature in the prime vertical times k
+    double u2 = u*u;
+    double tan2 = t*t;
+    double tan4 = tan2*tan2;
+    double tan6 = tan4*tan2;
+    double eta = ep2*c*c;
+    double eta2 = eta*eta;
+    double eta3 = eta2*eta;
+    double eta4 = eta3*eta;
+    double de = coordinates2meter*x[i] - tm->tm_false_easting_meter;
+    if (fabs(de) < 0.0001) de = 0.0;
+    double de2 = de*de;
+
+    double t11 = (5.e0 + 3.e0*tan2 + eta - 4.e0*eta2 - 9.e0*tan2*eta)/24.e0;
+    double t12 = (61.e0 + 90.e0*tan2 + 46.e0*eta + 45.e0*tan4 - 252.e0*tan2*eta - 3.e0*eta2 + 100.e0*eta3 - 66.e0*tan2*eta2 - 90.e0*tan4*eta + 88.e0*eta4 + 225.e0*tan4*eta2 + 84.e0*tan2*eta3 - 192.e0*tan2*eta4)/720.e0;
+    double t13 = (1385.e0 + 3633.e0*tan2 + 4095.e0*tan4 + 1575.e0*tan6)/40320.e0;
+    double Latitude = ftphi - (t*inverse_sr*u/k)*de2*(0.5 - de2*u2*(t11 - de2*u2*(t12 - de2*u2*t13)));
+
+    double t15 = (1.e0 + 2.e0*tan2 + eta)/6.e0;
+    double t16 = (5.e0 + 6.e0*eta + 28.e0*tan2 - 3.e0*eta2 + 8.e0*tan2*eta + 24.e0*tan4 - 4.e0*eta3 + 4.e0*tan2*eta2 + 24.e0*tan2*eta3)/120.e0;
+    double t17 = (61.e0 + 662.e0*tan2 + 1320.e0*tan4 + 720.e0*tan6)/5040.e0;
+    double dlam = (de*u/c)*(1 - de2*u2*(t15 - de2*u2*(t16 - de2*u2*t17)));
+
+    double Longitude = tm->tm_long_meridian_radian + dlam;
+    while (Latitude > PI_OVER_2)
+    {
+      Latitude = PI - Latitude;
+      Longitude += PI;
+      if (Longitude > PI)
+        Longitude -= TWO_PI;
+    }
+    while (Latitude < -PI_OVER_2)
+    {
+      Latitude = - (Latitude + PI);
+      Longitude += PI;
+      if (Longitude > PI)
+        Longitude -= TWO_PI;
+    }
+    if (Longitude > TWO_PI)
+      Longitude -= TWO_PI;
+    if (Longitude < -PI)
+      Longitude += TWO_PI;
+
+    latitude[i] = rad2deg*Latitude;
+    longitude[i] = rad2deg*Longitude;
+  }
+}
+
+static void LLtoTM_array(const double* latitude, const double* longitude, size_t n, const double meter2coordinates, double* x, double* y, const GeoProjectionEllipsoid* ellipsoid, const GeoProjectionParametersTM* tm)
+{
+  const double a = ellipsoid->equatorial_radius;
+  const double e2 = ellipsoid->eccentricity_squared;
+  const double ep2 = ellipsoid->eccentricity_prime_squared;
+  const double k = tm->tm_scale_factor;
+  const double tmdo = tm_meridional_distance(tm->tm_lat_origin_radian, sin(2*tm->tm_lat_origin_radian), cos(2*tm->tm_lat_origin_radian), tm);
+
+  for (size_t i = 0; i < n; i++)
+  {
+    double Latitude = latitude[i]*deg2rad;
+    double Longitude = longitude[i]*deg2rad;
+    if (Longitude > PI) Longitude -= TWO_PI;
+    double dlam = Longitude - tm->tm_long_meridian_radian;
+    if (dlam > PI)
+      dlam -= TWO_PI;
+    if (dlam < -PI)
+      dlam += TWO_PI;
+    if (fabs(dlam) < 2.e-10)
+      dlam = 0.0;
+    double dlam2 = dlam*dlam;
+
+    double s = sin(Latitude);
+    double c = cos(Latitude);
+    double t = s/c;
+    double c2 = c*c;
+    double tan2 = t*t;
+    double tan4 = tan2*tan2;
+    double tan6 = tan4*tan2;
+    double eta = ep2*c2;
+    double eta2 = eta*eta;
+    double eta3 = eta2*eta;
+    double eta4 = eta3*eta;
+    double snk = k*a/sqrt(1-e2*s*s);  // radius of curvature in the prime vertical times k
+    double tmd = tm_meridional_distance(Latitude, 2*s*c, (c-s)*(c+s), tm);
+
+    double t1 = (tmd - tmdo)*k;
+    double t2 = 1.e0/2.e0;
+    double t3 = c2*(5.e0 - tan2 + 9.e0*eta + 4.e0*eta2)/24.e0;
+    double t4 = c2*c2*(61.e0 - 58.e0*tan2 + tan4 + 270.e0*eta - 330.e0*tan2*eta + 445.e0*eta2 + 324.e0*eta3 - 680.e0*tan2*eta2 + 88.e0*eta4 - 600.e0*tan2*eta3 - 192.e0*tan2*eta4)/720.e0;
+    double t5 = c2*c2*c2*(1385.e0 - 3111.e0*tan2 + 543.e0*tan4 - tan6)/40320.e0;
+    double northing = tm->tm_false_northing_meter + t1 + snk*s*c*dlam2*(t2 + dlam2*(t3 + dlam2*(t4 + dlam2*t5)));
+
+    double t7 = c2*(1.e0 - tan2 + eta)/6.e0;
+    double t8 = c2*c2*(5.e0 - 18.e0*tan2 + tan4 + 14.e0*eta - 58.e0*tan2*eta + 13.e0*eta2 + 4.e0*eta3 - 64.e0*tan2*eta2 - 24.e0*tan2*eta3)/120.e0;
+    double t9 = c2*c2*c2*(61.e0 - 479.e0*tan2 + 179.e0*tan4 - tan6)/5040.e0;
+    double easting = tm->tm_false_easting_meter + snk*c*dlam*(1.e0 + dlam2*(t7 + dlam2*(t8 + dlam2*t9)));
+
+    x[i] = meter2coordinates*easting;
+    y[i] = meter2coordinates*northing;
+  }
+}
+
+static void LCCtoLL_array(const double* x, const double* y, size_t n, const double coordinates2meter, double* latitude, double* longitude, const GeoProjectionEllipsoid* ellipsoid, const GeoProjectionParametersLCC* lcc)
+{
+  const double e = ellipsoid->eccentricity;
+  const double half_e = e/2.0;
+  const double inverse_n = 1.0/lcc->lcc_n;
+  const double inverse_aF = 1.0/lcc->lcc_aF;
+  const double sign = (lcc->lcc_n < 0.0 ? -1.0 : 1.0);
+
+  for (size_t i = 0; i < n; i++)
+  {
+    double dx = sign*(coordinates2meter*x[i] - lcc->lcc_false_easting_meter);
+    double rho0_MINUS_dy = sign*(lcc->lcc_rho0 - (coordinates2meter*y[i] - lcc->lcc_false_northing_meter));
+    double rho = sign*sqrt(dx*dx + rho0_MINUS_dy*rho0_MINUS_dy);
+
+    if (rho != 0.0)
+    {
+      double theta = atan2(dx, rho0_MINUS_dy);
+      double t = pow(rho*inverse_aF, inverse_n);
+      double PHI = PI_OVER_2 - 2.0*atan(t);
+      double tempPHI = 0.0;
+      while (fabs(PHI - tempPHI) > 4.85e-10)
+      {
+        double es_sin = e*sin(PHI);
+        tempPHI = PHI;
+        PHI = PI_OVER_2 - 2.0*atan(t*pow((1.0 - es_sin)/(1.0 + es_sin), half_e));
+      }
+      double LatDegree = PHI;
+      double LongDegree = theta*inverse_n + lcc->lcc_long_meridian_radian;
+
+      if (fabs(LatDegree) < 2.0e-7)  /* force tiny lat to 0 */
+        LatDegree = 0.0;
+      else if (LatDegree > PI_OVER_2) /* force distorted lat to 90, -90 degrees */
+        LatDegree = 90.0;
+      else if (LatDegree < -PI_OVER_2)
+        LatDegree = -90.0;
+      else
+        LatDegree = rad2deg*LatDegree;
+
+      if (fabs(LongDegree) < 2.0e-7)  /* force tiny long to 0 */
+        LongDegree = 0.0;
+      else if (LongDegree > PI) /* force distorted long to 180, -180 degrees */
+        LongDegree = 180.0;
+      else if (LongDegree < -PI)
+        LongDegree = -180.0;
+      else
+        LongDegree = rad2deg*LongDegree;
+
+      latitude[i] = LatDegree;
+      longitude[i] = LongDegree;
+    }
+    else
+    {
+      latitude[i] = (lcc->lcc_n > 0.0 ? 90.0 : -90.0);
+      longitude[i] = lcc->lcc_long_meridian_degree;
+    }
+  }
+}
+
+static bool LLtoLCC_array(const double* latitude, const double* longitude, size_t n, const double meter2coordinates, double* x, double* y, const GeoProjectionEllipsoid* ellipsoid, const GeoProjectionParametersLCC* lcc)
+{
+  const double e = ellipsoid->eccentricity;
+  const double half_e = e/2.0;
+  bool projected = true;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    double rho = 0.0;
+    double Latitude = latitude[i]*deg2rad;
+
+    if (fabs(fabs(Latitude) - PI_OVER_2) > 1.0e-10)
+    {
+      double es_sin = e*sin(Latitude);
+      double t = tan(PI_OVER_4 - Latitude/2)/pow((1.0 - es_sin)/(1.0 + es_sin), half_e);
+      rho = lcc->lcc_aF*pow(t, lcc->lcc_n);
+    }
+    else if ((Latitude*lcc->lcc_n) <= 0)
+    {
+      // the pole opposite of the cone cannot be projected
+      projected = false;
+    }
+
+    double theta = lcc->lcc_n*(longitude[i]*deg2rad - lcc->lcc_long_meridian_radian);
+
+    x[i] = meter2coordinates*(rho*sin(theta) + lcc->lcc_false_easting_meter);
+    y[i] = meter2coordinates*(lcc->lcc_rho0 - rho*cos(theta) + lcc->lcc_false_northing_meter);
+  }
+  return projected;
+}
+
+bool GeoProjectionConverter::to_lat_long(const double* x, const double* y, size_t n, double* latitude, double* longitude) const
+{
+  if (source_projection == 0)
+  {
+    return false;
+  }
+
+  size_t i;
+  double point[3];
+  double elevation_in_meter;
+
+  switch (source_projection->type)
+  {
+  case GEO_PROJECTION_UTM:
+    UTMtoLL_array(x, y, n, coordinates2meter, latitude, longitude, ellipsoid, (const GeoProjectionParametersUTM*)source_projection);
+    break;
+  case GEO_PROJECTION_LCC:
+    LCCtoLL_array(x, y, n, coordinates2meter, latitude, longitude, ellipsoid, (const GeoProjectionParametersLCC*)source_projection);
+    break;
+  case GEO_PROJECTION_TM:
+    TMtoLL_array(x, y, n, coordinates2meter, latitude, longitude, ellipsoid, (const GeoProjectionParametersTM*)source_projection);
+    break;
+  case GEO_PROJECTION_LONG_LAT:
+    for (i = 0; i < n; i++)
+    {
+      longitude[i] = x[i];
+      latitude[i] = y[i];
+    }
+    break;
+  case GEO_PROJECTION_LAT_LONG:
+    for (i = 0; i < n; i++)
+    {
+      longitude[i] = y[i];
+      latitude[i] = x[i];
+    }
+    break;
+  default:
+    // ECEF needs the elevation and the others are rare
+    point[2] = 0.0;
+    for (i = 0; i < n; i++)
+    {
+      point[0] = x[i];
+      point[1] = y[i];
+      to_lon_lat_ele(point, longitude[i], latitude[i], elevation_in_meter);
+    }
+    break;
+  }
+  return true;
+}
+
+bool GeoProjectionConverter::from_lat_long(const double* latitude, const double* longitude, size_t n, double* x, double* y) const
+{
+  if (source_projection == 0)
+  {
+    return false;
+  }
+
+  size_t i;
+  const double meter2coordinates = 1.0/coordinates2meter;
+  bool projected = true;
+
+  switch (source_projection->type)
+  {
+  case GEO_PROJECTION_UTM:
+    LLtoUTM_array(latitude, longitude, n, meter2coordinates, x, y, ellipsoid, (const GeoProjectionParametersUTM*)source_projection);
+    break;
+  case GEO_PROJECTION_LCC:
+    projected = LLtoLCC_array(latitude, longitude, n, meter2coordinates, x, y, ellipsoid, (const GeoProjectionParametersLCC*)source_projection);
+    break;
+  case GEO_PROJECTION_TM:
+    LLtoTM_array(latitude, longitude, n, meter2coordinates, x, y, ellipsoid, (const GeoProjectionParametersTM*)source_projection);
+    break;
+  case GEO_PROJECTION_LONG_LAT:
+    for (i = 0; i < n; i++)
+    {
+      x[i] = longitude[i];
+      y[i] = latitude[i];
+    }
+    break;
+  case GEO_PROJECTION_LAT_LONG:
+    for (i = 0; i < n; i++)
+    {
+      x[i] = latitude[i];
+      y[i] = longitude[i];
+    }
+    break;
+  case GEO_PROJECTION_AEAC:
+    for (i = 0; i < n; i++)
+    {
+      projected = LLtoAEAC(latitude[i], longitude[i], x[i], y[i], ellipsoid, (const GeoProjectionParametersAEAC*)source_projection) && projected;
+      x[i] *= meter2coordinates;
+      y[i] *= meter2coordinates;
+    }
+    break;
+  case GEO_PROJECTION_HOM:
+    for (i = 0; i < n; i++)
+    {
+      projected = LLtoHOM(latitude[i], longitude[i], x[i], y[i], ellipsoid, (const GeoProjectionParametersHOM*)source_projection) && projected;
+      x[i] *= meter2coordinates;
+      y[i] *= meter2coordinates;
+    }
+    break;
+  case GEO_PROJECTION_OS:
+    for (i = 0; i < n; i++)
+    {
+      projected = LLtoOS(latitude[i], longitude[i], x[i], y[i], ellipsoid, (const GeoProjectionParametersOS*)source_projection) && projected;
+      x[i] *= meter2coordinates;
+      y[i] *= meter2coordinates;
+    }
+    break;
+  default:
+    // ECEF needs the elevation
+    return false;
+  }
+  return projected;
+}
+
 bool GeoProjectionConverter::check_horizontal_datum_before_reprojection()
 {
   if (source_projection && target_projection)
@@ -51,6 +51,8 @@
 
   CHANGE HISTORY:
 
+    18 October 2026 -- array kernels with precomputed constants for UTM, TM, and LCC
+    18 October 2026 -- to_lat_long() converts arrays of coordinates with one call
      1 November 2018 -- changes requested by Kirk Waters including GEO_GCS_NAD83_CORS96
      7 September 2018 -- introduced the LASCopyString macro to replace _strdup
     30 October 2017 -- '-vertical_evrf2007' for European Vertical Reference Frame 2007
@@ -70,6 +72,8 @@
 #ifndef GEO_PROJECTION_CONVERTER_HPP
 #define GEO_PROJECTION_CONVERTER_HPP
 
+#include <stddef.h>
+
 struct GeoProjectionGeoKeys
 {
   unsigned short key_id;
@@ -422,6 +426,14 @@ public:
   bool to_lon_lat_ele(double* point) const;
   bool to_lon_lat_ele(const double* point, double& longitude, double& latitude, double& elevation_in_meter) const;
 
+  // from current projection to latitude/longitude for n coordinates at once
+
+  bool to_lat_long(const double* x, const double* y, size_t n, double* latitude, double* longitude) const;
+
+  // and back. fails for ECEF and for points that cannot be projected
+
+  bool from_lat_long(const double* latitude, const double* longitude, size_t n, double* x, double* y) const;
+
   // from current projection to target projection
 
   bool to_target(double* point) const;
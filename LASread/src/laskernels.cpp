@@ -0,0 +1,436 @@
+/*
+===============================================================================
+
+  FILE:  laskernels.cpp
+
+  CONTENTS:
+
+    see corresponding header file
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    see corresponding header file
+
+===============================================================================
+*/
+#include "laskernels.hpp"
+
+#include <string.h>
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1920) && (defined(_M_X64) || defined(_M_IX86))
+#define LAS_KERNELS_X86
+#include <intrin.h>
+#include <immintrin.h>
+#define LAS_TARGET_SSE41
+#define LAS_TARGET_AVX2
+#define LAS_TARGET_AVX512
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define LAS_KERNELS_X86
+#include <immintrin.h>
+#define LAS_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define LAS_TARGET_AVX2 __attribute__((target("avx2")))
+#define LAS_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#endif
+
+#define LAS_ISA_SSE41  0x01
+#define LAS_ISA_AVX2   0x02
+#define LAS_ISA_AVX512 0x04
+
+LASkernels laskernels;
+
+// the scalar kernels are the reference and also process the remainder of each column
+
+template<class T>
+static inline void range_scalar(const T* values, const U32 number, T* min, T* max)
+{
+  T lo = *min;
+  T hi = *max;
+  for (U32 i = 0; i < number; i++)
+  {
+    if (values[i] < lo) lo = values[i];
+    if (values[i] > hi) hi = values[i];
+  }
+  *min = lo;
+  *max = hi;
+}
+
+static void range_I32_scalar(const I32* values, const U32 number, I32* min, I32* max) { range_scalar(values, number, min, max); }
+static void range_U16_scalar(const U16* values, const U32 number, U16* min, U16* max) { range_scalar(values, number, min, max); }
+static void range_I16_scalar(const I16* values, const U32 number, I16* min, I16* max) { range_scalar(values, number, min, max); }
+static void range_I8_scalar(const I8* values, const U32 number, I8* min, I8* max) { range_scalar(values, number, min, max); }
+static void range_F64_scalar(const F64* values, const U32 number, F64* min, F64* max) { range_scalar(values, number, min, max); }
+
+static inline void fluff_scalar(const I32* values, const U32 number, I64* fluff_10, I64* fluff_100, I64* fluff_1000)
+{
+  for (U32 i = 0; i < number; i++)
+  {
+    if ((values[i]%10) == 0)
+    {
+      (*fluff_10)++;
+      if ((values[i]%100) == 0)
+      {
+        (*fluff_100)++;
+        if ((values[i]%1000) == 0)
+        {
+          (*fluff_1000)++;
+        }
+      }
+    }
+  }
+}
+
+#ifdef LAS_KERNELS_X86
+
+// the vector registers start with the current min and max in every lane and are
+// reduced with the scalar kernel. as all lanes take a value only when it is less
+// (or greater) the result is exactly that of the scalar kernel for integers
+
+#define LAS_RANGE_KERNEL(NAME, TARGET, TYPE, VEC, LOAD, STORE, SET1, MIN, MAX) \
+TARGET static void NAME(const TYPE* values, const U32 number, TYPE* min, TYPE* max) \
+{ \
+  const U32 lanes = sizeof(VEC)/sizeof(TYPE); \
+  U32 i = 0; \
+  if (number >= lanes) \
+  { \
+    VEC vmin = SET1(*min); \
+    VEC vmax = SET1(*max); \
+    for (; i + lanes <= number; i += lanes) \
+    { \
+      VEC v = LOAD(values + i); \
+      vmin = MIN(v, vmin); \
+      vmax = MAX(v, vmax); \
+    } \
+    TYPE reduce[sizeof(VEC)/sizeof(TYPE)]; \
+    STORE(reduce, vmin); \
+    range_scalar(reduce, lanes, min, max); \
+    STORE(reduce, vmax); \
+    range_scalar(reduce, lanes, min, max); \
+  } \
+  range_scalar(values + i, number - i, min, max); \
+}
+
+// MINPD and MAXPD return the second operand for a NaN so that NaNs are skipped
+// as by the scalar compare. only the sign of a zero range may depend on which
+// lane saw it first, so in that (rare) case the column is redone with scalars
+
+#define LAS_RANGE_F64_KERNEL(NAME, VECTOR_NAME) \
+static void NAME(const F64* values, const U32 number, F64* min, F64* max) \
+{ \
+  F64 min_before = *min; \
+  F64 max_before = *max; \
+  VECTOR_NAME(values, number, min, max); \
+  if ((*min == 0.0) || (*max == 0.0)) \
+  { \
+    *min = min_before; \
+    *max = max_before; \
+    range_scalar(values, number, min, max); \
+  } \
+}
+
+#define SSE_LOAD(p) _mm_loadu_si128((const __m128i*)(p))
+#define SSE_STORE(p, v) _mm_storeu_si128((__m128i*)(p), v)
+#define SSE_SET1_I32(x) _mm_set1_epi32(x)
+#define SSE_SET1_I16(x) _mm_set1_epi16((short)(x))
+#define SSE_SET1_I8(x) _mm_set1_epi8((char)(x))
+
+LAS_RANGE_KERNEL(range_I32_sse41, LAS_TARGET_SSE41, I32, __m128i, SSE_LOAD, SSE_STORE, SSE_SET1_I32, _mm_min_epi32, _mm_max_epi32)
+LAS_RANGE_KERNEL(range_U16_sse41, LAS_TARGET_SSE41, U16, __m128i, SSE_LOAD, SSE_STORE, SSE_SET1_I16, _mm_min_epu16, _mm_max_epu16)
+LAS_RANGE_KERNEL(range_I16_sse41, LAS_TARGET_SSE41, I16, __m128i, SSE_LOAD, SSE_STORE, SSE_SET1_I16, _mm_min_epi16, _mm_max_epi16)
+LAS_RANGE_KERNEL(range_I8_sse41, LAS_TARGET_SSE41, I8, __m128i, SSE_LOAD, SSE_STORE, SSE_SET1_I8, _mm_min_epi8, _mm_max_epi8)
+LAS_RANGE_KERNEL(range_F64_sse41_lanes, LAS_TARGET_SSE41, F64, __m128d, _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd, _mm_min_pd, _mm_max_pd)
+LAS_RANGE_F64_KERNEL(range_F64_sse41, range_F64_sse41_lanes)
+
+#define AVX2_LOAD(p) _mm256_loadu_si256((const __m256i*)(p))
+#define AVX2_STORE(p, v) _mm256_storeu_si256((__m256i*)(p), v)
+#define AVX2_SET1_I32(x) _mm256_set1_epi32(x)
+#define AVX2_SET1_I16(x) _mm256_set1_epi16((short)(x))
+#define AVX2_SET1_I8(x) _mm256_set1_epi8((char)(x))
+
+LAS_RANGE_KERNEL(range_I32_avx2, LAS_TARGET_AVX2, I32, __m256i, AVX2_LOAD, AVX2_STORE, AVX2_SET1_I32, _mm256_min_epi32, _mm256_max_epi32)
+LAS_RANGE_KERNEL(range_U16_avx2, LAS_TARGET_AVX2, U16, __m256i, AVX2_LOAD, AVX2_STORE, AVX2_SET1_I16, _mm256_min_epu16, _mm256_max_epu16)
+LAS_RANGE_KERNEL(range_I16_avx2, LAS_TARGET_AVX2, I16, __m256i, AVX2_LOAD, AVX2_STORE, AVX2_SET1_I16, _mm256_min_epi16, _mm256_max_epi16)
+LAS_RANGE_KERNEL(range_I8_avx2, LAS_TARGET_AVX2, I8, __m256i, AVX2_LOAD, AVX2_STORE, AVX2_SET1_I8, _mm256_min_epi8, _mm256_max_epi8)
+LAS_RANGE_KERNEL(range_F64_avx2_lanes, LAS_TARGET_AVX2, F64, __m256d, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd, _mm256_min_pd, _mm256_max_pd)
+LAS_RANGE_F64_KERNEL(range_F64_avx2, range_F64_avx2_lanes)
+
+// some versions of GCC warn about the undefined pass-through operand inside
+// their own AVX-512 intrinsics (which is not used with a full mask). the
+// warning is only turned off for the AVX-512 kernels
+
+#if defined(__GNUC__) && !defined(__clang__)
+#define LAS_AVX512_WARNINGS_OFF _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+#define LAS_AVX512_WARNINGS_ON _Pragma("GCC diagnostic pop")
+#else
+#define LAS_AVX512_WARNINGS_OFF
+#define LAS_AVX512_WARNINGS_ON
+#endif
+
+#define AVX512_LOAD(p) _mm512_loadu_si512((const void*)(p))
+#define AVX512_STORE(p, v) _mm512_storeu_si512((void*)(p), v)
+#define AVX512_SET1_I32(x) _mm512_set1_epi32(x)
+#define AVX512_SET1_I16(x) _mm512_set1_epi16((short)(x))
+#define AVX512_SET1_I8(x) _mm512_set1_epi8((char)(x))
+
+LAS_AVX512_WARNINGS_OFF
+LAS_RANGE_KERNEL(range_I32_avx512, LAS_TARGET_AVX512, I32, __m512i, AVX512_LOAD, AVX512_STORE, AVX512_SET1_I32, _mm512_min_epi32, _mm512_max_epi32)
+LAS_RANGE_KERNEL(range_U16_avx512, LAS_TARGET_AVX512, U16, __m512i, AVX512_LOAD, AVX512_STORE, AVX512_SET1_I16, _mm512_min_epu16, _mm512_max_epu16)
+LAS_RANGE_KERNEL(range_I16_avx512, LAS_TARGET_AVX512, I16, __m512i, AVX512_LOAD, AVX512_STORE, AVX512_SET1_I16, _mm512_min_epi16, _mm512_max_epi16)
+LAS_RANGE_KERNEL(range_I8_avx512, LAS_TARGET_AVX512, I8, __m512i, AVX512_LOAD, AVX512_STORE, AVX512_SET1_I8, _mm512_min_epi8, _mm512_max_epi8)
+LAS_RANGE_KERNEL(range_F64_avx512_lanes, LAS_TARGET_AVX512, F64, __m512d, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd, _mm512_min_pd, _mm512_max_pd)
+LAS_RANGE_F64_KERNEL(range_F64_avx512, range_F64_avx512_lanes)
+LAS_AVX512_WARNINGS_ON
+
+// instead of the three chained modulos the fluff kernels test divisibility with
+// a multiplication (Hacker's Delight 10-17): |x| is a multiple of d = 2^k * d0
+// (d0 odd) exactly when |x| times the inverse of d0 modulo 2^32 rotated right by
+// k bits is at most (2^32-1)/d. |x| is taken as unsigned so that it is correct
+// also for -2^31. the divisors 10, 100, and 1000 have d0 5, 25, 125 and k 1, 2, 3
+
+#define LAS_INVERSE_5   0xCCCCCCCD
+#define LAS_INVERSE_25  0xC28F5C29
+#define LAS_INVERSE_125 0x26E978D5
+#define LAS_LIMIT_10    429496729
+#define LAS_LIMIT_100   42949672
+#define LAS_LIMIT_1000  4294967
+
+LAS_TARGET_SSE41 static void fluff_sse41(const I32* values, const U32 number, I64* fluff_10, I64* fluff_100, I64* fluff_1000)
+{
+  U32 i = 0;
+  if (number >= 4)
+  {
+    const __m128i inverse_5 = _mm_set1_epi32((I32)LAS_INVERSE_5);
+    const __m128i inverse_25 = _mm_set1_epi32((I32)LAS_INVERSE_25);
+    const __m128i inverse_125 = _mm_set1_epi32((I32)LAS_INVERSE_125);
+    const __m128i limit_10 = _mm_set1_epi32(LAS_LIMIT_10);
+    const __m128i limit_100 = _mm_set1_epi32(LAS_LIMIT_100);
+    const __m128i limit_1000 = _mm_set1_epi32(LAS_LIMIT_1000);
+    __m128i count_10 = _mm_setzero_si128();
+    __m128i count_100 = _mm_setzero_si128();
+    __m128i count_1000 = _mm_setzero_si128();
+    __m128i v, t;
+    for (; i + 4 <= number; i += 4)
+    {
+      v = _mm_abs_epi32(SSE_LOAD(values + i));
+      t = _mm_mullo_epi32(v, inverse_5);
+      t = _mm_or_si128(_mm_srli_epi32(t, 1), _mm_slli_epi32(t, 31));
+      count_10 = _mm_sub_epi32(count_10, _mm_cmpeq_epi32(_mm_min_epu32(t, limit_10), t));
+      t = _mm_mullo_epi32(v, inverse_25);
+      t = _mm_or_si128(_mm_srli_epi32(t, 2), _mm_slli_epi32(t, 30));
+      count_100 = _mm_sub_epi32(count_100, _mm_cmpeq_epi32(_mm_min_epu32(t, limit_100), t));
+      t = _mm_mullo_epi32(v, inverse_125);
+      t = _mm_or_si128(_mm_srli_epi32(t, 3), _mm_slli_epi32(t, 29));
+      count_1000 = _mm_sub_epi32(count_1000, _mm_cmpeq_epi32(_mm_min_epu32(t, limit_1000), t));
+    }
+    U32 reduce[4];
+    SSE_STORE(reduce, count_10);
+    *fluff_10 += (I64)reduce[0] + reduce[1] + reduce[2] + reduce[3];
+    SSE_STORE(reduce, count_100);
+    *fluff_100 += (I64)reduce[0] + reduce[1] + reduce[2] + reduce[3];
+    SSE_STORE(reduce, count_1000);
+    *fluff_1000 += (I64)reduce[0] + reduce[1] + reduce[2] + reduce[3];
+  }
+  fluff_scalar(values + i, number - i, fluff_10, fluff_100, fluff_1000);
+}
+
+LAS_TARGET_AVX2 static void fluff_avx2(const I32* values, const U32 number, I64* fluff_10, I64* fluff_100, I64* fluff_1000)
+{
+  U32 i = 0;
+  if (number >= 8)
+  {
+    const __m256i inverse_5 = _mm256_set1_epi32((I32)LAS_INVERSE_5);
+    const __m256i inverse_25 = _mm256_set1_epi32((I32)LAS_INVERSE_25);
+    const __m256i inverse_125 = _mm256_set1_epi32((I32)LAS_INVERSE_125);
+    const __m256i limit_10 = _mm256_set1_epi32(LAS_LIMIT_10);
+    const __m256i limit_100 = _mm256_set1_epi32(LAS_LIMIT_100);
+    const __m256i limit_1000 = _mm256_set1_epi32(LAS_LIMIT_1000);
+    __m256i count_10 = _mm256_setzero_si256();
+    __m256i count_100 = _mm256_setzero_si256();
+    __m256i count_1000 = _mm256_setzero_si256();
+    __m256i v, t;
+    for (; i + 8 <= number; i += 8)
+    {
+      v = _mm256_abs_epi32(AVX2_LOAD(values + i));
+      t = _mm256_mullo_epi32(v, inverse_5);
+      t = _mm256_or_si256(_mm256_srli_epi32(t, 1), _mm256_slli_epi32(t, 31));
+      count_10 = _mm256_sub_epi32(count_10, _mm256_cmpeq_epi32(_mm256_min_epu32(t, limit_10), t));
+      t = _mm256_mullo_epi32(v, inverse_25);
+      t = _mm256_or_si256(_mm256_srli_epi32(t, 2), _mm256_slli_epi32(t, 30));
+      count_100 = _mm256_sub_epi32(count_100, _mm256_cmpeq_epi32(_mm256_min_epu32(t, limit_100), t));
+      t = _mm256_mullo_epi32(v, inverse_125);
+      t = _mm256_or_si256(_mm256_srli_epi32(t, 3), _mm256_slli_epi32(t, 29));
+      count_1000 = _mm256_sub_epi32(count_1000, _mm256_cmpeq_epi32(_mm256_min_epu32(t, limit_1000), t));
+    }
+    U32 j, reduce[8];
+    AVX2_STORE(reduce, count_10);
+    for (j = 0; j < 8; j++) *fluff_10 += reduce[j];
+    AVX2_STORE(reduce, count_100);
+    for (j = 0; j < 8; j++) *fluff_100 += reduce[j];
+    AVX2_STORE(reduce, count_1000);
+    for (j = 0; j < 8; j++) *fluff_1000 += reduce[j];
+  }
+  fluff_scalar(values + i, number - i, fluff_10, fluff_100, fluff_1000);
+}
+
+LAS_AVX512_WARNINGS_OFF
+LAS_TARGET_AVX512 static void fluff_avx512(const I32* values, const U32 number, I64* fluff_10, I64* fluff_100, I64* fluff_1000)
+{
+  U32 i = 0;
+  if (number >= 16)
+  {
+    const __m512i inverse_5 = _mm512_set1_epi32((I32)LAS_INVERSE_5);
+    const __m512i inverse_25 = _mm512_set1_epi32((I32)LAS_INVERSE_25);
+    const __m512i inverse_125 = _mm512_set1_epi32((I32)LAS_INVERSE_125);
+    const __m512i limit_10 = _mm512_set1_epi32(LAS_LIMIT_10);
+    const __m512i limit_100 = _mm512_set1_epi32(LAS_LIMIT_100);
+    const __m512i limit_1000 = _mm512_set1_epi32(LAS_LIMIT_1000);
+    const __m512i one = _mm512_set1_epi32(1);
+    __m512i count_10 = _mm512_setzero_si512();
+    __m512i count_100 = _mm512_setzero_si512();
+    __m512i count_1000 = _mm512_setzero_si512();
+    __m512i v, t;
+    for (; i + 16 <= number; i += 16)
+    {
+      v = _mm512_abs_epi32(AVX512_LOAD(values + i));
+      t = _mm512_ror_epi32(_mm512_mullo_epi32(v, inverse_5), 1);
+      count_10 = _mm512_mask_add_epi32(count_10, _mm512_cmple_epu32_mask(t, limit_10), count_10, one);
+      t = _mm512_ror_epi32(_mm512_mullo_epi32(v, inverse_25), 2);
+      count_100 = _mm512_mask_add_epi32(count_100, _mm512_cmple_epu32_mask(t, limit_100), count_100, one);
+      t = _mm512_ror_epi32(_mm512_mullo_epi32(v, inverse_125), 3);
+      count_1000 = _mm512_mask_add_epi32(count_1000, _mm512_cmple_epu32_mask(t, limit_1000), count_1000, one);
+    }
+    U32 j, reduce[16];
+    AVX512_STORE(reduce, count_10);
+    for (j = 0; j < 16; j++) *fluff_10 += reduce[j];
+    AVX512_STORE(reduce, count_100);
+    for (j = 0; j < 16; j++) *fluff_100 += reduce[j];
+    AVX512_STORE(reduce, count_1000);
+    for (j = 0; j < 16; j++) *fluff_1000 += reduce[j];
+  }
+  fluff_scalar(values + i, number - i, fluff_10, fluff_100, fluff_1000);
+}
+LAS_AVX512_WARNINGS_ON
+
+// which of the instruction sets the CPU and the operating system support
+
+static U32 supported_isas()
+{
+  U32 isas = 0;
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  int highest = info[0];
+  __cpuid(info, 1);
+  if (info[2] & (1 << 19)) isas |= LAS_ISA_SSE41;
+  // the operating system must save the AVX (and AVX-512) registers
+  if ((highest >= 7) && (info[2] & (1 << 27)))
+  {
+    unsigned long long xcr0 = _xgetbv(0);
+    __cpuidex(info, 7, 0);
+    if (((xcr0 & 0x06) == 0x06) && (info[1] & (1 << 5))) isas |= LAS_ISA_AVX2;
+    if (((xcr0 & 0xE6) == 0xE6) && (info[1] & (1 << 16)) && (info[1] & (1 << 30))) isas |= LAS_ISA_AVX512;
+  }
+#else
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse4.1")) isas |= LAS_ISA_SSE41;
+  if (__builtin_cpu_supports("avx2")) isas |= LAS_ISA_AVX2;
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) isas |= LAS_ISA_AVX512;
+#endif
+  return isas;
+}
+
+#else
+
+static U32 supported_isas()
+{
+  return 0;
+}
+
+#endif // LAS_KERNELS_X86
+
+BOOL LASkernels::select(const CHAR* isa)
+{
+  U32 isas = supported_isas();
+  if (strcmp(isa, "scalar") == 0)
+  {
+    range_I32 = range_I32_scalar;
+    range_U16 = range_U16_scalar;
+    range_I16 = range_I16_scalar;
+    range_I8 = range_I8_scalar;
+    range_F64 = range_F64_scalar;
+    fluff = fluff_scalar;
+    this->isa = "scalar";
+    return TRUE;
+  }
+#ifdef LAS_KERNELS_X86
+  if ((strcmp(isa, "sse41") == 0) && (isas & LAS_ISA_SSE41))
+  {
+    range_I32 = range_I32_sse41;
+    range_U16 = range_U16_sse41;
+    range_I16 = range_I16_sse41;
+    range_I8 = range_I8_sse41;
+    range_F64 = range_F64_sse41;
+    fluff = fluff_sse41;
+    this->isa = "sse41";
+    return TRUE;
+  }
+  if ((strcmp(isa, "avx2") == 0) && (isas & LAS_ISA_AVX2))
+  {
+    range_I32 = range_I32_avx2;
+    range_U16 = range_U16_avx2;
+    range_I16 = range_I16_avx2;
+    range_I8 = range_I8_avx2;
+    range_F64 = range_F64_avx2;
+    fluff = fluff_avx2;
+    this->isa = "avx2";
+    return TRUE;
+  }
+  if ((strcmp(isa, "avx512") == 0) && (isas & LAS_ISA_AVX512))
+  {
+    range_I32 = range_I32_avx512;
+    range_U16 = range_U16_avx512;
+    range_I16 = range_I16_avx512;
+    range_I8 = range_I8_avx512;
+    range_F64 = range_F64_avx512;
+    fluff = fluff_avx512;
+    this->isa = "avx512";
+    return TRUE;
+  }
+#endif
+  return FALSE;
+}
+
+LASkernels::LASkernels()
+{
+  U32 isas = supported_isas();
+  if (isas & LAS_ISA_AVX512)
+  {
+    select("avx512");
+  }
+  else if (isas & LAS_ISA_AVX2)
+  {
+    select("avx2");
+  }
+  else if (isas & LAS_ISA_SSE41)
+  {
+    select("sse41");
+  }
+  else
+  {
+    select("scalar");
+  }
+}
@@ -0,0 +1,70 @@
+/*
+===============================================================================
+
+  FILE:  laskernels.hpp
+
+  CONTENTS:
+
+    Column kernels for the LASinventory of a LASpointBatch. These compute the
+    range of an attribute and count the coordinate fluff. Vectorized versions
+    for SSE4.1, AVX2, and AVX-512 are selected at run-time depending on what
+    the CPU supports. All versions give results identical to the scalar code.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created for checking blocks of points with SIMD instructions
+
+===============================================================================
+*/
+#ifndef LAS_KERNELS_HPP
+#define LAS_KERNELS_HPP
+
+#include "mydefs.hpp"
+
+class LASkernels
+{
+public:
+  // widen [min,max] by the values of a column. min and max must be initialized
+
+  void (*range_I32)(const I32* values, const U32 number, I32* min, I32* max);
+  void (*range_U16)(const U16* values, const U32 number, U16* min, U16* max);
+  void (*range_I16)(const I16* values, const U32 number, I16* min, I16* max);
+  void (*range_I8)(const I8* values, const U32 number, I8* min, I8* max);
+  void (*range_F64)(const F64* values, const U32 number, F64* min, F64* max);
+
+  // count the coordinates that are multiples of 10, 100, and 1000
+
+  void (*fluff)(const I32* values, const U32 number, I64* fluff_10, I64* fluff_100, I64* fluff_1000);
+
+  // "scalar", "sse41", "avx2", or "avx512"
+
+  const CHAR* get_isa() const { return isa; };
+
+  // use the kernels of another instruction set. fails if the CPU lacks it
+
+  BOOL select(const CHAR* isa);
+
+  LASkernels();
+
+private:
+  const CHAR* isa;
+};
+
+extern LASkernels laskernels;
+
+#endif
@@ -301,7 +301,7 @@ void LASpoint::zero()
   Y = 0;
   Z = 0;
   intensity = 0;
-  number_of_returns_of_given_pulse = 1;
+  number_of_returns = 1;
   return_number = 1;
   classification_flags = 0;
   scanner_channel = 0;          // LAS 1.4, point types 6 - 10 only
@@ -356,3 +356,104 @@ LASpoint::~LASpoint()
 {
   clean();
 };
+
+BOOL LASpointBatch::init(const LASpoint* point, const U32 capacity)
+{
+  clean();
+
+  if (capacity == 0)
+  {
+    return FALSE;
+  }
+
+  have_gps_time = point->have_gps_time;
+  have_rgb = point->have_rgb;
+  have_nir = point->have_nir;
+  have_wave_packet = point->have_wave_packet;
+  quantizer = point->quantizer;
+
+  X = new I32[capacity];
+  Y = new I32[capacity];
+  Z = new I32[capacity];
+  intensity = new U16[capacity];
+  return_number = new U8[capacity];
+  number_of_returns = new U8[capacity];
+  classification = new U8[capacity];
+  scan_angle_rank = new I8[capacity];
+  scan_angle = new I16[capacity];
+  point_source_ID = new U16[capacity];
+  if (have_gps_time) gps_time = new F64[capacity];
+  if (have_rgb)
+  {
+    R = new U16[capacity];
+    G = new U16[capacity];
+    B = new U16[capacity];
+  }
+  if (have_nir) I = new U16[capacity];
+  if (have_wave_packet) wave_packet_index = new U8[capacity];
+
+  this->capacity = capacity;
+  return TRUE;
+}
+
+void LASpointBatch::clean()
+{
+  if (X) delete [] X;
+  if (Y) delete [] Y;
+  if (Z) delete [] Z;
+  if (intensity) delete [] intensity;
+  if (return_number) delete [] return_number;
+  if (number_of_returns) delete [] number_of_returns;
+  if (classification) delete [] classification;
+  if (scan_angle_rank) delete [] scan_angle_rank;
+  if (scan_angle) delete [] scan_angle;
+  if (point_source_ID) delete [] point_source_ID;
+  if (gps_time) delete [] gps_time;
+  if (R) delete [] R;
+  if (G) delete [] G;
+  if (B) delete [] B;
+  if (I) delete [] I;
+  if (wave_packet_index) delete [] wave_packet_index;
+
+  X = Y = Z = 0;
+  intensity = 0;
+  return_number = 0;
+  number_of_returns = 0;
+  classification = 0;
+  scan_angle_rank = 0;
+  scan_angle = 0;
+  point_source_ID = 0;
+  gps_time = 0;
+  R = G = B = I = 0;
+  wave_packet_index = 0;
+
+  have_gps_time = FALSE;
+  have_rgb = FALSE;
+  have_nir = FALSE;
+  have_wave_packet = FALSE;
+  quantizer = 0;
+
+  capacity = 0;
+  number = 0;
+}
+
+LASpointBatch::LASpointBatch()
+{
+  X = Y = Z = 0;
+  intensity = 0;
+  return_number = 0;
+  number_of_returns = 0;
+  classification = 0;
+  scan_angle_rank = 0;
+  scan_angle = 0;
+  point_source_ID = 0;
+  gps_time = 0;
+  R = G = B = I = 0;
+  wave_packet_index = 0;
+  clean();
+}
+
+LASpointBatch::~LASpointBatch()
+{
+  clean();
+}
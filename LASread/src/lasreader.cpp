@@ -33,6 +33,7 @@
 #include "bytestreamin.hpp"
 #include "bytestreamin_file.hpp"
 #include "bytestreamin_istream.hpp"
+#include "bytestreamin_mmap.hpp"
 #include "lasreadpoint.hpp"
 #include <cstring>
 
@@ -44,7 +45,9 @@
 #include <stdlib.h>
 #include <string.h>
 
-BOOL LASreader::open(const char* file_name, U32 io_buffer_size)
+#include <chrono>
+
+BOOL LASreader::open(const char* file_name, U32 io_buffer_size, BOOL use_mmap, U32 decompress_selective)
 {
   if (file_name == 0)
   {
@@ -52,6 +55,24 @@ BOOL LASreader::open(const char* file_name, U32 io_buffer_size)
     return FALSE;
   }
 
+  // maybe read from the mapped file (an empty or unmappable file is opened normally)
+
+  if (use_mmap)
+  {
+    if (IS_LITTLE_ENDIAN())
+    {
+      ByteStreamInMMapLE* in = new ByteStreamInMMapLE();
+      if (in->open(file_name)) return open(in, decompress_selective);
+      delete in;
+    }
+    else
+    {
+      ByteStreamInMMapBE* in = new ByteStreamInMMapBE();
+      if (in->open(file_name)) return open(in, decompress_selective);
+      delete in;
+    }
+  }
+
   file = fopen(file_name, "rb");
   if (file == 0)
   {
@@ -71,7 +92,7 @@ BOOL LASreader::open(const char* file_name, U32 io_buffer_size)
   else
     in = new ByteStreamInFileBE(file);
 
-  return open(in);
+  return open(in, decompress_selective);
 }
 
 BOOL LASreader::open(FILE* file)
@@ -115,7 +136,7 @@ BOOL LASreader::open(istream& stream)
   return open(in);
 }
 
-BOOL LASreader::open(ByteStreamIn* stream)
+BOOL LASreader::open(ByteStreamIn* stream, U32 decompress_selective)
 {
   if (stream == 0)
   {
@@ -138,6 +159,8 @@ BOOL LASreader::open(ByteStreamIn* stream)
 
   // load the header VLRs
 
+  std::chrono::steady_clock::time_point vlrs_start = std::chrono::steady_clock::now();
+
   if (!header.load_vlrs(stream))
   {
     return FALSE;
@@ -150,6 +173,8 @@ BOOL LASreader::open(ByteStreamIn* stream)
     return FALSE;
   }
 
+  vlrs_seconds = std::chrono::duration<F64>(std::chrono::steady_clock::now() - vlrs_start).count();
+
 //  // load the header VLRs_tiling
 //
 //  if (!header.load_vlrs_tiling(stream))
@@ -164,9 +189,9 @@ BOOL LASreader::open(ByteStreamIn* stream)
 //      return FALSE;
 //  }
 
-  // create the point reader
+  // create the point reader (that may skip decoding layers of LAS 1.4 points)
 
-  reader = new LASreadPoint();
+  reader = new LASreadPoint(decompress_selective);
 
   // initialize point and the reader
 
@@ -210,13 +235,81 @@ BOOL LASreader::seek(const I64 p_index)
   return FALSE;
 }
 
+U32 LASreader::get_number_chunks()
+{
+  if ((reader == 0) || (p_count != 0) || !is_compressed())
+  {
+    return 0;
+  }
+  return reader->get_number_chunks();
+}
+
+I64 LASreader::get_chunk_first_point(const U32 chunk) const
+{
+  I64 p_index = reader->get_chunk_first_point(chunk);
+  return (p_index < npoints ? p_index : npoints);
+}
+
+BOOL LASreader::check_chunk_table()
+{
+  if ((reader == 0) || (p_count != 0) || !is_compressed())
+  {
+    return FALSE;
+  }
+  return reader->check_chunk_table(npoints);
+}
+
+BOOL LASreader::check_chunks(const U32 first, const U32 end)
+{
+  // reads the chunk table if that was not done yet
+  if (get_number_chunks() < end)
+  {
+    return FALSE;
+  }
+  U32 chunk;
+  for (chunk = first; chunk < end; chunk++)
+  {
+    if (!reader->check_chunk(chunk, npoints))
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+const CHAR* LASreader::get_error() const
+{
+  if (reader && reader->error())
+  {
+    return reader->error();
+  }
+  return "unknown error";
+}
+
+I64 LASreader::get_number_stored_points()
+{
+  if ((stream == 0) || (p_count != 0) || is_compressed() || !stream->isSeekable() || (header.point_data_record_length == 0))
+  {
+    return 0;
+  }
+  I64 here = stream->tell();
+  if (!stream->seekEnd())
+  {
+    stream->seek(here);
+    return 0;
+  }
+  I64 number_points = (stream->tell() - here) / header.point_data_record_length;
+  stream->seek(here);
+  return (number_points < npoints ? number_points : npoints);
+}
+
 BOOL LASreader::read_point()
 {
   if (p_count < npoints)
   {
     if (reader->read(point.point) == FALSE)
     {
-      fprintf(stderr,"WARNING: end-of-file after %u of %u points\n", (U32)p_count, (U32)npoints);
+      if (!quiet) fprintf(stderr,"WARNING: end-of-file after %u of %u points\n", (U32)p_count, (U32)npoints);
       return FALSE;
     }
     p_count++;
@@ -225,6 +318,20 @@ BOOL LASreader::read_point()
   return FALSE;
 }
 
+U32 LASreader::read_points(U32 n, LASpointBatch* batch)
+{
+  batch->number = 0;
+  if (n > batch->capacity)
+  {
+    n = batch->capacity;
+  }
+  while ((batch->number < n) && read_point())
+  {
+    batch->add(&point);
+  }
+  return batch->number;
+}
+
 void LASreader::close(BOOL close_stream)
 {
   if (reader) 
@@ -252,9 +359,11 @@ LASreader::LASreader()
 {
   npoints = 0;
   p_count = 0;
+  vlrs_seconds = 0.0;
   file = 0;
   stream = 0;
   reader = 0;
+  quiet = FALSE;
 }
 
 LASreader::~LASreader()
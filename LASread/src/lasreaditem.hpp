@@ -24,6 +24,7 @@
   
   CHANGE HISTORY:
   
+    18 October 2026 -- chunk_bytes() sums the layer sizes read by chunk_sizes()
     28 August 2017 -- moving 'context' from global development hack to interface  
     23 August 2016 -- layering of items for selective decompression in LAS 1.4 
     10 January 2011 -- licensing change for LGPL release and liblas integration
@@ -68,6 +69,7 @@ class LASreadItemCompressed : public LASreadItem
 {
 public:
   virtual BOOL chunk_sizes() { return FALSE; };
+  virtual U64 chunk_bytes() const { return 0; };
   virtual BOOL init(const U8* item, U32& context)=0;
 
   virtual ~LASreadItemCompressed(){};
@@ -24,6 +24,7 @@
   
   CHANGE HISTORY:
   
+    18 October 2026 -- chunk_bytes() for checking the layer sizes of a chunk
     19 March 2019 -- set "legacy classification" to zero if "classification > 31"  
     28 August 2017 -- moving 'context' from global development hack to interface  
     19 April 2017 -- support for selective decompression for new LAS 1.4 points 
@@ -49,6 +50,7 @@ public:
   LASreadItemCompressed_POINT14_v3(ArithmeticDecoder* dec, const U32 decompress_selective=LASZIP_DECOMPRESS_SELECTIVE_ALL);
 
   BOOL chunk_sizes();
+  U64 chunk_bytes() const { return (U64)num_bytes_channel_returns_XY + num_bytes_Z + num_bytes_classification + num_bytes_flags + num_bytes_intensity + num_bytes_scan_angle + num_bytes_user_data + num_bytes_point_source + num_bytes_gps_time; };
   BOOL init(const U8* item, U32& context); // context is set
   void read(U8* item, U32& context);       // context is set
 
@@ -125,6 +127,7 @@ public:
   LASreadItemCompressed_RGB14_v3(ArithmeticDecoder* dec, const U32 decompress_selective=LASZIP_DECOMPRESS_SELECTIVE_ALL);
 
   BOOL chunk_sizes();
+  U64 chunk_bytes() const { return num_bytes_RGB; };
   BOOL init(const U8* item, U32& context); // context is only read
   void read(U8* item, U32& context);       // context is only read
 
@@ -162,6 +165,7 @@ public:
   LASreadItemCompressed_RGBNIR14_v3(ArithmeticDecoder* dec, const U32 decompress_selective=LASZIP_DECOMPRESS_SELECTIVE_ALL);
 
   BOOL chunk_sizes();
+  U64 chunk_bytes() const { return (U64)num_bytes_RGB + num_bytes_NIR; };
   BOOL init(const U8* item, U32& context); // context is only read
   void read(U8* item, U32& context);       // context is only read
 
@@ -204,6 +208,7 @@ public:
   LASreadItemCompressed_WAVEPACKET14_v3(ArithmeticDecoder* dec, const U32 decompress_selective=LASZIP_DECOMPRESS_SELECTIVE_ALL);
 
   BOOL chunk_sizes();
+  U64 chunk_bytes() const { return num_bytes_wavepacket; };
   BOOL init(const U8* item, U32& context); // context is only read
   void read(U8* item, U32& context);       // context is only read
 
@@ -241,6 +246,7 @@ public:
   LASreadItemCompressed_BYTE14_v3(ArithmeticDecoder* dec, U32 number, const U32 decompress_selective=LASZIP_DECOMPRESS_SELECTIVE_ALL);
 
   BOOL chunk_sizes();
+  U64 chunk_bytes() const;
   BOOL init(const U8* item, U32& context); // context is only read
   void read(U8* item, U32& context);       // context is only read
 
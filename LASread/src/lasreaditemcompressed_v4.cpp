@@ -2204,6 +2204,17 @@ BOOL LASreadItemCompressed_BYTE14_v4::chunk_sizes()
   return TRUE;
 }
 
+U64 LASreadItemCompressed_BYTE14_v4::chunk_bytes() const
+{
+  U64 num_bytes = 0;
+  U32 i;
+  for (i = 0; i < number; i++)
+  {
+    num_bytes += num_bytes_Bytes[i];
+  }
+  return num_bytes;
+}
+
 BOOL LASreadItemCompressed_BYTE14_v4::init(const U8* item, U32& context)
 {
   U32 i;
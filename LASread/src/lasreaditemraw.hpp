@@ -24,6 +24,7 @@
   
   CHANGE HISTORY:
   
+    18 October 2026 -- fused readers for the standard point types 0 to 10
     28 August 2017 -- moving 'context' from global development hack to interface  
     22 April 2013 -- adapted from the LASzip library for the ASPRS LASvalidator
   
@@ -35,6 +36,7 @@
 #include "lasreaditem.hpp"
 
 #include <assert.h>
+#include <string.h>
 
 typedef struct LASremainderPoint10
 {
@@ -293,4 +295,77 @@ private:
   U8 swapped[8];
 };
 
+// the raw items of the standard point types 0 to 10 (plus any extra bytes)
+// fused into one function that converts an entire point record that was read
+// with a single getBytes(). all branches depend only on the template argument
+// so that each point type compiles into straight-line code. the result is the
+// same as that of the item readers above. only for little endian machines.
+
+typedef void (*LASreadPointRaw)(const U8* record, U8* const * point, const U32 number_extra_bytes);
+
+template <int FORMAT>
+void LASreadPointRaw_LE(const U8* record, U8* const * point, const U32 number_extra_bytes)
+{
+  const BOOL point14 = (FORMAT >= 6);
+  const BOOL gpstime11 = (FORMAT == 1) || (FORMAT == 3) || (FORMAT == 4) || (FORMAT == 5);
+  const BOOL rgb = (FORMAT == 2) || (FORMAT == 3) || (FORMAT == 5) || (FORMAT == 7) || (FORMAT == 8) || (FORMAT == 10);
+  const BOOL nir = (FORMAT == 8) || (FORMAT == 10);
+  const BOOL wavepacket = (FORMAT == 4) || (FORMAT == 5) || (FORMAT == 9) || (FORMAT == 10);
+
+  U8* item = point[0];
+  U32 i = 1;
+  if (point14)
+  {
+    // same as LASreadItemRaw_POINT14_LE
+    memcpy(item, record, 22);
+    memcpy(item+24, record+22, 8);
+    record += 30;
+  }
+  else
+  {
+    // same as LASreadItemRaw_POINT10_LE but with shifts and masks on whole
+    // bytes instead of copying bitfield by bitfield
+    memcpy(item, record, 14);
+    U8 returns = record[14];   // return_number : 3, number_of_returns : 3, scan_direction_flag : 1, edge_of_flight_line : 1
+    U8 classes = record[15];   // classification : 5, classification_flags : 3
+    I8 scan_angle_rank = (I8)record[16];
+    item[14] = (returns & 0x07) | ((returns & 0x38) << 1);     // return_number : 4, number_of_returns : 4
+    item[15] = (classes >> 5) | (returns & 0xC0);              // classification_flags : 4, scanner_channel : 2, scan_direction_flag : 1, edge_of_flight_line : 1
+    item[16] = classes & 0x1F;                                 // classification
+    item[17] = record[17];                                     // user_data
+    *((I16*)&item[18]) = I16_QUANTIZE(166.6666666f * scan_angle_rank);
+    item[20] = record[18];                                     // point_source_ID
+    item[21] = record[19];
+    item[22] = (U8)scan_angle_rank;
+    record += 20;
+    if (gpstime11)
+    {
+      memcpy(point[i++], record, 8);
+      record += 8;
+    }
+  }
+  if (rgb)
+  {
+    if (nir)
+    {
+      memcpy(point[i++], record, 8);
+      record += 8;
+    }
+    else
+    {
+      memcpy(point[i++], record, 6);
+      record += 6;
+    }
+  }
+  if (wavepacket)
+  {
+    memcpy(point[i++], record, 29);
+    record += 29;
+  }
+  if (number_extra_bytes)
+  {
+    memcpy(point[i], record, number_extra_bytes);
+  }
+}
+
 #endif
@@ -34,6 +34,18 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <cctype>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
 
 #ifdef _WIN32
 #define DIRECTORY_SLASH '\\'
@@ -59,15 +71,18 @@ void LASreadOpener::reset()
 
 LASreader* LASreadOpener::open(U32 file_name_current)
 {
-  if (file_names)
+  if (file_name_number)
   {
-    if (file_name_current == file_name_number)
+    // use a local file name so that several threads can open files concurrently
+
+    const char* file_name;
+    if (file_name_current >= file_name_number)
     {
       return 0;
     }
     else
     {
-      file_name = file_names[file_name_current];
+      file_name = file_name_arena + file_name_offsets[file_name_current];
     }
 #ifdef LASZIP_ENABLED
     if (strstr(file_name, ".las") || strstr(file_name, ".laz") || strstr(file_name, ".LAS") || strstr(file_name, ".LAZ"))
@@ -76,7 +91,7 @@ LASreader* LASreadOpener::open(U32 file_name_current)
 #endif
     {
       LASreader* lasreader = new LASreader();
-      if (!lasreader->open(file_name, io_ibuffer_size))
+      if (!lasreader->open(file_name, io_ibuffer_size, use_mmap, decompress_selective))
       {
         if (!lasreader->header.fails)
         {
@@ -150,7 +165,14 @@ const char* LASreadOpener::get_path() const
   if (file_name)
     return file_name;
   if (file_name_number)
-    return file_names[0];
+    return file_name_arena + file_name_offsets[0];
+  return 0;
+}
+
+const char* LASreadOpener::get_path(U32 number) const
+{
+  if (number < file_name_number)
+    return file_name_arena + file_name_offsets[number];
   return 0;
 }
 
@@ -176,9 +198,29 @@ const char* LASreadOpener::get_file_name() const
   return 0;
 }
 
-#ifdef _WIN32
+const char* LASreadOpener::get_file_name(U32 number) const
+{
+  const char* file_name_only = get_path(number);
+  if (file_name_only)
+  {
+    int len = strlen(file_name_only);
+    while ((len >= 0) && (file_name_only[len] != DIRECTORY_SLASH))
+    {
+      len--;
+    }
+    if (len >= 0)
+    {
+      return (file_name_only + len + 1);
+    }
+    else
+    {
+      return file_name_only;
+    }
+  }
+  return 0;
+}
 
-#include <windows.h>
+#ifdef _WIN32
 
 BOOL LASreadOpener::add_file_name(const char* file_name, BOOL unique)
 {
@@ -194,13 +236,15 @@ BOOL LASreadOpener::add_file_name(const char* file_name, BOOL unique)
     if (len)
     {
       len++;
-      char full_file_name[512];
+      // the path may be longer than MAX_PATH but each found name is not
+      char* full_file_name = (char*)malloc(len + MAX_PATH + 1);
       strncpy(full_file_name, file_name, len);
 	    do
 	    {
         sprintf(&full_file_name[len], "%s", info.cFileName);
         if (add_file_name_single(full_file_name, unique)) r = TRUE;
   	  } while (FindNextFile(h, &info));
+      free(full_file_name);
     }
     else
     {
@@ -214,47 +258,407 @@ BOOL LASreadOpener::add_file_name(const char* file_name, BOOL unique)
   return r;
 }
 
-#endif
-
-#ifdef _WIN32
-BOOL LASreadOpener::add_file_name_single(const char* file_name, BOOL unique)
 #else
+
 BOOL LASreadOpener::add_file_name(const char* file_name, BOOL unique)
+{
+  return add_file_name_single(file_name, unique);
+}
+
 #endif
+
+static U32 hash_file_name(const char* file_name)
 {
-  if (unique)
+  // FNV-1a
+  U32 hash = 2166136261u;
+  while (*file_name)
   {
+    hash ^= (U8)(*file_name);
+    hash *= 16777619u;
+    file_name++;
+  }
+  return hash;
+}
+
+BOOL LASreadOpener::add_file_name_hash(U32 number)
+{
+  // keep the hash set at most half full
+  if (2*(number+1) > file_name_hash_size)
+  {
+    U32 hash_size = (file_name_hash_size ? 2*file_name_hash_size : 1024);
+    while (2*(number+1) > hash_size) hash_size *= 2;
+    U32* hash = (U32*)calloc(hash_size, sizeof(U32));
+    if (hash == 0)
+    {
+      fprintf(stderr, "ERROR: alloc for file name hash set failed at %u\n", hash_size);
+      return FALSE;
+    }
+    if (file_name_hash) free(file_name_hash);
+    file_name_hash = hash;
+    file_name_hash_size = hash_size;
+    // reinsert all earlier names
     U32 i;
-    for (i = 0; i < file_name_number; i++)
+    for (i = 0; i < number; i++)
+    {
+      U32 h = hash_file_name(file_name_arena + file_name_offsets[i]) & (hash_size - 1);
+      while (file_name_hash[h]) h = (h + 1) & (hash_size - 1);
+      file_name_hash[h] = i + 1;
+    }
+  }
+  U32 h = hash_file_name(file_name_arena + file_name_offsets[number]) & (file_name_hash_size - 1);
+  while (file_name_hash[h]) h = (h + 1) & (file_name_hash_size - 1);
+  file_name_hash[h] = number + 1;
+  return TRUE;
+}
+
+BOOL LASreadOpener::add_file_name_single(const char* file_name, BOOL unique)
+{
+  // the hash set is only built once a unique name is asked for
+
+  if (unique && (file_name_hash == 0) && file_name_number)
+  {
+    if (!add_file_name_hash(file_name_number - 1))
     {
-      if (strcmp(file_names[i], file_name) == 0)
+      return FALSE;
+    }
+  }
+  if (unique && file_name_hash)
+  {
+    U32 h = hash_file_name(file_name) & (file_name_hash_size - 1);
+    while (file_name_hash[h])
+    {
+      if (strcmp(file_name_arena + file_name_offsets[file_name_hash[h] - 1], file_name) == 0)
       {
         return FALSE;
       }
+      h = (h + 1) & (file_name_hash_size - 1);
     }
   }
   if (file_name_number == file_name_allocated)
   {
-    if (file_names)
+    U32 allocated = (file_name_allocated ? 2*file_name_allocated : 16);
+    U64* offsets = (U64*)realloc(file_name_offsets, sizeof(U64)*allocated);
+    if (offsets == 0)
     {
-      file_name_allocated *= 2;
-      file_names = (char**)realloc(file_names, sizeof(char*)*file_name_allocated);
+      fprintf(stderr, "ERROR: alloc for file name offsets failed at %u\n", allocated);
+      return FALSE;
     }
-    else
+    file_name_offsets = offsets;
+    file_name_allocated = allocated;
+  }
+  U64 len = strlen(file_name) + 1;
+  if (file_name_arena_size + len > file_name_arena_allocated)
+  {
+    U64 allocated = (file_name_arena_allocated ? 2*file_name_arena_allocated : 4096);
+    while (file_name_arena_size + len > allocated) allocated *= 2;
+    char* arena = (char*)realloc(file_name_arena, (size_t)allocated);
+    if (arena == 0)
     {
-      file_name_allocated = 16;
-      file_names = (char**)malloc(sizeof(char*)*file_name_allocated);
+      fprintf(stderr, "ERROR: alloc for file name arena failed at %.0f bytes\n", (F64)allocated);
+      return FALSE;
     }
-    if (file_names == 0)
+    file_name_arena = arena;
+    file_name_arena_allocated = allocated;
+  }
+  memcpy(file_name_arena + file_name_arena_size, file_name, (size_t)len);
+  file_name_offsets[file_name_number] = file_name_arena_size;
+  file_name_arena_size += len;
+  if (unique || file_name_hash)
+  {
+    if (!add_file_name_hash(file_name_number))
     {
-      fprintf(stderr, "ERROR: alloc for file_names pointer array failed at %d\n", file_name_allocated);
+      return FALSE;
     }
   }
-  file_names[file_name_number] = strdup(file_name);
   file_name_number++;
   return TRUE;
 }
 
+BOOL LASreadOpener::add_list_of_files(const char* list_of_files, BOOL unique)
+{
+  // one file name per line. the list is read from stdin when its name is '-'
+
+  FILE* file = (strcmp(list_of_files, "-") == 0 ? stdin : fopen(list_of_files, "r"));
+  if (file == 0)
+  {
+    fprintf(stderr, "ERROR: cannot open list of files '%s'\n", list_of_files);
+    return FALSE;
+  }
+
+  // the list is read in large blocks and split into lines in place
+
+  U32 size = 65536;
+  char* buffer = (char*)malloc(size + 1);
+  U32 used = 0;
+  BOOL done = FALSE;
+  while (!done)
+  {
+    if (used == size)
+    {
+      // a line longer than the buffer
+      size *= 2;
+      buffer = (char*)realloc(buffer, size + 1);
+    }
+    U32 read = (U32)fread(buffer + used, 1, size - used, file);
+    if (read == 0)
+    {
+      done = TRUE;
+      // the last line may not end with a new line
+      buffer[used] = '\n';
+      read = 1;
+    }
+    char* line = buffer;
+    char* end = buffer + used + read;
+    char* next;
+    while ((next = (char*)memchr(line, '\n', end - line)) != 0)
+    {
+      // strip the carriage return and trailing white space
+      char* last = next;
+      while ((last > line) && ((last[-1] == '\r') || (last[-1] == ' ') || (last[-1] == '\t'))) last--;
+      *last = '\0';
+      if (line[0] != '\0')
+      {
+        add_file_name_single(line, unique);
+      }
+      line = next + 1;
+    }
+    used = (U32)(end - line);
+    if (used && (line != buffer)) memmove(buffer, line, used);
+    if (done) used = 0;
+  }
+  free(buffer);
+
+  if (file != stdin) fclose(file);
+  return TRUE;
+}
+
+// matches '*' and '?' wild cards
+
+static BOOL match_wild_card(const char* pattern, const char* name)
+{
+  const char* star = 0;
+  const char* star_name = 0;
+  while (*name)
+  {
+    if ((*pattern == '?') || (*pattern == *name))
+    {
+      pattern++;
+      name++;
+    }
+    else if (*pattern == '*')
+    {
+      star = pattern++;
+      star_name = name;
+    }
+    else if (star)
+    {
+      pattern = star + 1;
+      name = ++star_name;
+    }
+    else
+    {
+      return FALSE;
+    }
+  }
+  while (*pattern == '*') pattern++;
+  return (*pattern == '\0');
+}
+
+BOOL LASreadOpener::is_excluded(const char* name, const char* path) const
+{
+  U32 i;
+  for (i = 0; i < exclude_number; i++)
+  {
+    // patterns with a slash are matched against the entire path
+    if (strchr(excludes[i], '/') || strchr(excludes[i], '\\'))
+    {
+      if (match_wild_card(excludes[i], path)) return TRUE;
+    }
+    else if (match_wild_card(excludes[i], name))
+    {
+      return TRUE;
+    }
+  }
+  return FALSE;
+}
+
+BOOL LASreadOpener::has_extension(const char* name) const
+{
+  const char* dot = strrchr(name, '.');
+  if (dot == 0) return FALSE;
+  dot++;
+  U32 len = (U32)strlen(dot);
+  if (len == 0) return FALSE;
+  const char* ext = (extensions ? extensions : "las,laz");
+  while (*ext)
+  {
+    while (*ext == '.') ext++;
+    const char* end = ext;
+    while (*end && (*end != ',')) end++;
+    if ((U32)(end - ext) == len)
+    {
+      // extensions are compared without case
+      U32 j;
+      for (j = 0; j < len; j++)
+      {
+        if (tolower((U8)ext[j]) != tolower((U8)dot[j])) break;
+      }
+      if (j == len) return TRUE;
+    }
+    ext = (*end ? end + 1 : end);
+  }
+  return FALSE;
+}
+
+void LASreadOpener::set_extensions(const char* extensions)
+{
+  if (this->extensions) free(this->extensions);
+  this->extensions = (extensions ? strdup(extensions) : 0);
+}
+
+void LASreadOpener::add_exclude(const char* pattern)
+{
+  excludes = (char**)realloc(excludes, sizeof(char*)*(exclude_number+1));
+  excludes[exclude_number] = strdup(pattern);
+  exclude_number++;
+}
+
+class LASdirectoryFile
+{
+public:
+  std::string path;
+  I64 size;
+};
+
+class LASdirectoryListing
+{
+public:
+  BOOL opened;
+  std::vector<std::string> directories;
+  std::vector<LASdirectoryFile> files;
+};
+
+BOOL LASreadOpener::add_directory(const char* directory, BOOL recursive, BOOL unique)
+{
+  std::string root(directory);
+  while ((root.size() > 1) && ((root.back() == '/') || (root.back() == '\\'))) root.pop_back();
+
+  std::vector<std::string> level(1, root);
+  std::vector<LASdirectoryFile> files;
+
+  // the directories of each level are listed in parallel. a file whose size is
+  // not known after listing is stat()ed afterwards, also in parallel
+
+  while (level.size())
+  {
+    std::vector<LASdirectoryListing> listings(level.size());
+    I32 i;
+#pragma omp parallel for schedule(dynamic, 1)
+    for (i = 0; i < (I32)level.size(); i++)
+    {
+      LASdirectoryListing& listing = listings[i];
+      const std::string& path = level[i];
+#ifdef _WIN32
+      WIN32_FIND_DATAA info;
+      HANDLE h = FindFirstFileA((path + "\\*").c_str(), &info);
+      listing.opened = (h != INVALID_HANDLE_VALUE);
+      if (!listing.opened) continue;
+      do
+      {
+        const char* name = info.cFileName;
+        if ((strcmp(name, ".") == 0) || (strcmp(name, "..") == 0)) continue;
+        std::string full = path + DIRECTORY_SLASH + name;
+        if (is_excluded(name, full.c_str())) continue;
+        if (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+        {
+          // junctions and symbolic links to directories are not followed
+          if (recursive && !(info.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)) listing.directories.push_back(full);
+        }
+        else if (has_extension(name))
+        {
+          LASdirectoryFile file;
+          file.path = full;
+          file.size = (((I64)info.nFileSizeHigh) << 32) | (I64)info.nFileSizeLow;
+          listing.files.push_back(file);
+        }
+      } while (FindNextFileA(h, &info));
+      FindClose(h);
+#else
+      DIR* dir = opendir(path.c_str());
+      listing.opened = (dir != 0);
+      if (!listing.opened) continue;
+      struct dirent* entry;
+      while ((entry = readdir(dir)) != 0)
+      {
+        const char* name = entry->d_name;
+        if ((strcmp(name, ".") == 0) || (strcmp(name, "..") == 0)) continue;
+        std::string full = path + DIRECTORY_SLASH + name;
+        if (is_excluded(name, full.c_str())) continue;
+        unsigned char type = entry->d_type;
+        if (type == DT_UNKNOWN)
+        {
+          struct stat st;
+          if (fstatat(dirfd(dir), name, &st, AT_SYMLINK_NOFOLLOW) != 0) continue;
+          type = (S_ISDIR(st.st_mode) ? DT_DIR : (S_ISLNK(st.st_mode) ? DT_LNK : (S_ISREG(st.st_mode) ? DT_REG : DT_UNKNOWN)));
+        }
+        if (type == DT_DIR)
+        {
+          // symbolic links to directories are not followed
+          if (recursive) listing.directories.push_back(full);
+        }
+        else if (((type == DT_REG) || (type == DT_LNK)) && has_extension(name))
+        {
+          LASdirectoryFile file;
+          file.path = full;
+          file.size = -1;
+          listing.files.push_back(file);
+        }
+      }
+      closedir(dir);
+#endif
+    }
+    if ((level[0] == root) && !listings[0].opened)
+    {
+      fprintf(stderr, "ERROR: cannot open directory '%s'\n", directory);
+      return FALSE;
+    }
+    std::vector<std::string> next;
+    for (i = 0; i < (I32)listings.size(); i++)
+    {
+      next.insert(next.end(), listings[i].directories.begin(), listings[i].directories.end());
+      files.insert(files.end(), listings[i].files.begin(), listings[i].files.end());
+    }
+    level.swap(next);
+  }
+
+#ifndef _WIN32
+  I32 i;
+#pragma omp parallel for schedule(dynamic, 64)
+  for (i = 0; i < (I32)files.size(); i++)
+  {
+    struct stat st;
+    if ((stat(files[i].path.c_str(), &st) == 0) && S_ISREG(st.st_mode))
+    {
+      files[i].size = (I64)st.st_size;
+    }
+  }
+#endif
+
+  // the largest files are validated first so that one huge file does not
+  // start last and keep all other cores waiting
+
+  std::sort(files.begin(), files.end(), [](const LASdirectoryFile& a, const LASdirectoryFile& b) { return (a.size != b.size ? a.size > b.size : a.path < b.path); });
+
+  size_t j;
+  for (j = 0; j < files.size(); j++)
+  {
+    // dangling links and links to directories
+    if (files[j].size < 0) continue;
+    add_file_name_single(files[j].path.c_str(), unique);
+  }
+  return TRUE;
+}
+
 U32 LASreadOpener::get_file_name_number() const
 {
   return file_name_number;
@@ -263,19 +667,33 @@ U32 LASreadOpener::get_file_name_number() const
 LASreadOpener::LASreadOpener()
 {
   io_ibuffer_size = 65536;
-  file_names = 0;
+  use_mmap = FALSE;
+  decompress_selective = LASZIP_DECOMPRESS_SELECTIVE_ALL;
+  file_name_arena = 0;
+  file_name_arena_size = 0;
+  file_name_arena_allocated = 0;
+  file_name_offsets = 0;
   file_name = 0;
   file_name_number = 0;
   file_name_allocated = 0;
   file_name_current = 0;
+  file_name_hash = 0;
+  file_name_hash_size = 0;
+  extensions = 0;
+  excludes = 0;
+  exclude_number = 0;
 }
 
 LASreadOpener::~LASreadOpener()
 {
-  if (file_names)
+  if (file_name_arena) free(file_name_arena);
+  if (file_name_offsets) free(file_name_offsets);
+  if (file_name_hash) free(file_name_hash);
+  if (extensions) free(extensions);
+  if (excludes)
   {
     U32 i;
-    for (i = 0; i < file_name_number; i++) free(file_names[i]);
-    free(file_names);
+    for (i = 0; i < exclude_number; i++) free(excludes[i]);
+    free(excludes);
   }
 }
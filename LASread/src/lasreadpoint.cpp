@@ -50,6 +50,9 @@ LASreadPoint::LASreadPoint(U32 decompress_selective)
   readers = 0;
   readers_raw = 0;
   readers_compressed = 0;
+  read_fused = 0;
+  fused_record = 0;
+  fused_extra_bytes = 0;
   dec = 0;
   layered_las14_compression = FALSE;
   // used for chunking
@@ -60,6 +63,7 @@ LASreadPoint::LASreadPoint(U32 decompress_selective)
   tabled_chunks = 0;
   chunk_totals = 0;
   chunk_starts = 0;
+  chunk_table_start = -1;
   // used for selective decompression (new LAS 1.4 point types only)
   this->decompress_selective = decompress_selective;
   // used for seeking
@@ -169,6 +173,12 @@ BOOL LASreadPoint::setup(U32 num_items, const LASitem* items, const LASzip* lasz
     point_size += items[i].size;
   }
 
+  // uncompressed points of the standard types are read by one fused reader
+  if (!dec && IS_LITTLE_ENDIAN())
+  {
+    setup_fused(num_items, items);
+  }
+
   if (dec)
   {
     readers_compressed = new LASreadItem*[num_readers];
@@ -490,6 +500,11 @@ BOOL LASreadPoint::read(U8* const * point)
         readers = readers_compressed;
       }
     }
+    else if (read_fused)
+    {
+      instream->getBytes(fused_record, point_size);
+      read_fused(fused_record, point, fused_extra_bytes);
+    }
     else
     {
       for (i = 0; i < num_readers; i++)
@@ -565,6 +580,201 @@ BOOL LASreadPoint::done()
   return TRUE;
 }
 
+U32 LASreadPoint::get_number_chunks()
+{
+  if (dec == 0) return 0;
+
+  // maybe read the chunk table (as done by the first read() or seek())
+
+  if (point_start == 0)
+  {
+    I64 here = instream->tell();
+    if (!init_dec())
+    {
+      // leave the stream as it was so that reading sequentially still works
+      instream->seek(here);
+      number_chunks = U32_MAX;
+      point_start = 0;
+      return 0;
+    }
+    chunk_count = 0;
+  }
+
+  // only a complete chunk table allows independent access to all chunks
+
+  if ((number_chunks == U32_MAX) || (tabled_chunks != (number_chunks + 1)))
+  {
+    return 0;
+  }
+  return number_chunks;
+}
+
+I64 LASreadPoint::get_chunk_first_point(const U32 chunk) const
+{
+  if (chunk_totals)
+  {
+    return chunk_totals[chunk];
+  }
+  return (I64)chunk_size*chunk;
+}
+
+BOOL LASreadPoint::check_chunk_table(const I64 number_points)
+{
+  if (last_error == 0) last_error = new CHAR[128];
+
+  if (get_number_chunks() == 0)
+  {
+    // pointwise compressed files and those read from a stream that cannot
+    // seek have no chunk table, so there is nothing to check
+
+    if ((number_chunks == 0) && (chunk_starts == 0))
+    {
+      return TRUE;
+    }
+    if (last_warning)
+    {
+      strcpy(last_error, last_warning);
+    }
+    else
+    {
+      sprintf(last_error, "chunk table is missing or incomplete");
+    }
+    return FALSE;
+  }
+
+  // read_chunk_table() made sure that the chunk starts increase. the last chunk
+  // has to end where the chunk table starts and inside of the file
+
+  I64 here = instream->tell();
+  if (!instream->seekEnd())
+  {
+    sprintf(last_error, "cannot seek to end of file");
+    return FALSE;
+  }
+  I64 file_size = instream->tell();
+  instream->seek(here);
+  if (chunk_starts[number_chunks] > file_size)
+  {
+#ifdef _WIN32
+    sprintf(last_error, "chunk %u ends at byte %I64d after end of file at %I64d", number_chunks-1, chunk_starts[number_chunks], file_size);
+#else
+    sprintf(last_error, "chunk %u ends at byte %lld after end of file at %lld", number_chunks-1, chunk_starts[number_chunks], file_size);
+#endif
+    return FALSE;
+  }
+  if (chunk_starts[number_chunks] != chunk_table_start)
+  {
+#ifdef _WIN32
+    sprintf(last_error, "chunk %u ends at byte %I64d but chunk table starts at %I64d", number_chunks-1, chunk_starts[number_chunks], chunk_table_start);
+#else
+    sprintf(last_error, "chunk %u ends at byte %lld but chunk table starts at %lld", number_chunks-1, chunk_starts[number_chunks], chunk_table_start);
+#endif
+    return FALSE;
+  }
+
+  // the chunks have to hold exactly the points of the header
+
+  if (chunk_totals)
+  {
+    if ((I64)chunk_totals[number_chunks] != number_points)
+    {
+#ifdef _WIN32
+      sprintf(last_error, "chunk table lists %u points and not %I64d", chunk_totals[number_chunks], number_points);
+#else
+      sprintf(last_error, "chunk table lists %u points and not %lld", chunk_totals[number_chunks], number_points);
+#endif
+      return FALSE;
+    }
+  }
+  else if ((number_points > (I64)chunk_size*number_chunks) || (number_points <= (I64)chunk_size*(number_chunks-1)))
+  {
+#ifdef _WIN32
+    sprintf(last_error, "%u chunks of %u points cannot hold %I64d points", number_chunks, chunk_size, number_points);
+#else
+    sprintf(last_error, "%u chunks of %u points cannot hold %lld points", number_chunks, chunk_size, number_points);
+#endif
+    return FALSE;
+  }
+  return TRUE;
+}
+
+BOOL LASreadPoint::check_chunk(const U32 chunk, const I64 number_points)
+{
+  if (last_error == 0) last_error = new CHAR[128];
+
+  I64 start = chunk_starts[chunk];
+  I64 end = chunk_starts[chunk+1];
+  U32 expected;
+  if (chunk_totals)
+  {
+    expected = chunk_totals[chunk+1] - chunk_totals[chunk];
+  }
+  else
+  {
+    I64 remaining = number_points - (I64)chunk_size*chunk;
+    expected = (U32)(remaining < chunk_size ? remaining : chunk_size);
+  }
+
+  // each chunk starts with its first point uncompressed
+
+  if ((start + point_size) > end)
+  {
+    sprintf(last_error, "chunk %u is too small for its first point", chunk);
+    return FALSE;
+  }
+
+  try
+  {
+    if (layered_las14_compression)
+    {
+      // then come the point count and the sizes of all layers
+
+      instream->seek(start + point_size);
+      dec->init(instream, FALSE);
+      U32 count;
+      instream->get32bitsLE((U8*)&count);
+      if (count != expected)
+      {
+        sprintf(last_error, "chunk %u has %u points and not %u", chunk, count, expected);
+        return FALSE;
+      }
+      U32 i;
+      U64 layer_bytes = 0;
+      for (i = 0; i < num_readers; i++)
+      {
+        ((LASreadItemCompressed*)(readers_compressed[i]))->chunk_sizes();
+        layer_bytes += ((LASreadItemCompressed*)(readers_compressed[i]))->chunk_bytes();
+      }
+      I64 size = instream->tell() - start + (I64)layer_bytes;
+      if (size != (end - start))
+      {
+#ifdef _WIN32
+        sprintf(last_error, "chunk %u has layers for %I64d bytes and not %I64d", chunk, size, end - start);
+#else
+        sprintf(last_error, "chunk %u has layers for %lld bytes and not %lld", chunk, size, end - start);
+#endif
+        return FALSE;
+      }
+    }
+    else if (expected > 1)
+    {
+      // then comes the arithmetic coder that starts with 4 bytes
+
+      if ((start + point_size + 4) > end)
+      {
+        sprintf(last_error, "chunk %u is too small for its arithmetic coder", chunk);
+        return FALSE;
+      }
+    }
+  }
+  catch (...)
+  {
+    sprintf(last_error, "end-of-file in header of chunk %u", chunk);
+    return FALSE;
+  }
+  return TRUE;
+}
+
 BOOL LASreadPoint::init_dec()
 {
   // maybe read chunk table (only if chunking enabled)
@@ -652,6 +862,8 @@ BOOL LASreadPoint::read_chunk_table()
     }
   }
 
+  chunk_table_start = chunk_table_start_position;
+
   // read the chunk table
   try
   {
@@ -775,6 +987,67 @@ BOOL LASreadPoint::read_chunk_table()
   return TRUE;
 }
 
+BOOL LASreadPoint::setup_fused(const U32 num_items, const LASitem* items)
+{
+  // the items of the standard point types 0 to 10 without the extra bytes
+  static const U32 num_types[11] = { 1, 2, 2, 3, 3, 4, 1, 2, 2, 2, 3 };
+  static const LASitem::Type types[11][4] = {
+    { LASitem::POINT10 },
+    { LASitem::POINT10, LASitem::GPSTIME11 },
+    { LASitem::POINT10, LASitem::RGB12 },
+    { LASitem::POINT10, LASitem::GPSTIME11, LASitem::RGB12 },
+    { LASitem::POINT10, LASitem::GPSTIME11, LASitem::WAVEPACKET13 },
+    { LASitem::POINT10, LASitem::GPSTIME11, LASitem::RGB12, LASitem::WAVEPACKET13 },
+    { LASitem::POINT14 },
+    { LASitem::POINT14, LASitem::RGB14 },
+    { LASitem::POINT14, LASitem::RGBNIR14 },
+    { LASitem::POINT14, LASitem::WAVEPACKET14 },
+    { LASitem::POINT14, LASitem::RGBNIR14, LASitem::WAVEPACKET14 }
+  };
+  static const LASreadPointRaw functions[11] = {
+    LASreadPointRaw_LE<0>, LASreadPointRaw_LE<1>, LASreadPointRaw_LE<2>, LASreadPointRaw_LE<3>,
+    LASreadPointRaw_LE<4>, LASreadPointRaw_LE<5>, LASreadPointRaw_LE<6>, LASreadPointRaw_LE<7>,
+    LASreadPointRaw_LE<8>, LASreadPointRaw_LE<9>, LASreadPointRaw_LE<10>
+  };
+
+  read_fused = 0;
+  fused_extra_bytes = 0;
+
+  // the extra bytes can only be last
+  U32 num_standard = num_items;
+  if (num_standard && (items[num_standard-1].is_type(LASitem::BYTE) || items[num_standard-1].is_type(LASitem::BYTE14)))
+  {
+    num_standard--;
+    fused_extra_bytes = items[num_standard].size;
+  }
+
+  U32 f, i;
+  for (f = 0; f < 11; f++)
+  {
+    if (num_types[f] != num_standard) continue;
+    for (i = 0; i < num_standard; i++)
+    {
+      // older and newer versions of these items are read the same way
+      LASitem::Type type = types[f][i];
+      if ((type == LASitem::RGB14) && (items[i].type == LASitem::RGB12)) type = LASitem::RGB12;
+      else if ((type == LASitem::WAVEPACKET14) && (items[i].type == LASitem::WAVEPACKET13)) type = LASitem::WAVEPACKET13;
+      if (!items[i].is_type(type)) break;
+    }
+    if (i == num_standard) break;
+  }
+
+  // any other composition of items is read item by item
+  if (f == 11)
+  {
+    return FALSE;
+  }
+
+  if (fused_record) delete [] fused_record;
+  fused_record = new U8[point_size];
+  read_fused = functions[f];
+  return TRUE;
+}
+
 U32 LASreadPoint::search_chunk_table(const U32 index, const U32 lower, const U32 upper)
 {
   if (lower + 1 == upper) return lower;
@@ -789,6 +1062,8 @@ LASreadPoint::~LASreadPoint()
 {
   U32 i;
 
+  if (fused_record) delete [] fused_record;
+
   if (readers_raw)
   {
     for (i = 0; i < num_readers; i++)
@@ -24,6 +24,10 @@
   
   CHANGE HISTORY:
   
+    18 October 2026 -- files without chunk table pass check_chunk_table()
+    18 October 2026 -- read uncompressed points of types 0 to 10 with a fused reader
+    18 October 2026 -- structural checks of chunk table and chunk headers without decoding
+    18 October 2026 -- expose the chunk table for reading chunks in parallel
     28 August 2017 -- moving 'context' from global development hack to interface  
     18 July 2017 -- bug fix for spatial-indexed reading of native compressed LAS 1.4 
     19 April 2017 -- support for selective decompression for new LAS 1.4 points 
@@ -67,6 +71,16 @@ public:
   BOOL check_end();
   BOOL done();
 
+  // with a complete chunk table the chunks can be read independently
+  U32 get_number_chunks();
+  I64 get_chunk_first_point(const U32 chunk) const;
+
+  // structural checks that decode no points. the chunk table has to agree with
+  // the file size and the point count and each chunk header with the size of
+  // the chunk. on failure error() says why. the reader cannot read afterwards
+  BOOL check_chunk_table(const I64 number_points);
+  BOOL check_chunk(const U32 chunk, const I64 number_points);
+
   inline const CHAR* error() const { return last_error; };
   inline const CHAR* warning() const { return last_warning; };
 
@@ -76,6 +90,11 @@ private:
   LASreadItem** readers;
   LASreadItem** readers_raw;
   LASreadItem** readers_compressed;
+  // used for uncompressed points of the standard types
+  void (*read_fused)(const U8* record, U8* const * point, const U32 number_extra_bytes);
+  U8* fused_record;
+  U32 fused_extra_bytes;
+  BOOL setup_fused(const U32 num_items, const LASitem* items);
   ArithmeticDecoder* dec;
   BOOL layered_las14_compression;
   // used for chunking
@@ -86,6 +105,7 @@ private:
   U32 tabled_chunks;
   I64* chunk_starts;
   U32* chunk_totals;
+  I64 chunk_table_start;
   BOOL init_dec();
   BOOL read_chunk_table();
   U32 search_chunk_table(const U32 index, const U32 lower, const U32 upper);
@@ -29,6 +29,7 @@
 ===============================================================================
 */
 #include "lasutility.hpp"
+#include "laskernels.hpp"
 
 #include <cstdio>
 #include <cstdlib>
@@ -69,10 +70,35 @@ LASsummary::LASsummary()
   first = TRUE;
 }
 
+static void copy_attributes(LASpoint* to, const LASpoint* from)
+{
+  to->X = from->X;
+  to->Y = from->Y;
+  to->Z = from->Z;
+  to->intensity = from->intensity;
+  to->return_number = from->return_number;
+  to->number_of_returns = from->number_of_returns;
+  to->classification_flags = from->classification_flags;
+  to->scanner_channel = from->scanner_channel;
+  to->scan_direction_flag = from->scan_direction_flag;
+  to->edge_of_flight_line = from->edge_of_flight_line;
+  to->classification = from->classification;
+  to->user_data = from->user_data;
+  to->scan_angle = from->scan_angle;
+  to->point_source_ID = from->point_source_ID;
+  to->scan_angle_rank = from->scan_angle_rank;
+  to->gps_time_change = from->gps_time_change;
+  to->gps_time = from->gps_time;
+  to->rgbi[0] = from->rgbi[0];
+  to->rgbi[1] = from->rgbi[1];
+  to->rgbi[2] = from->rgbi[2];
+  to->rgbi[3] = from->rgbi[3];
+}
+
 BOOL LASsummary::add(const LASpoint* point)
 {
   number_of_point_records++;
-  if (point->extended_point_type)
+  if (point->get_extended_point_type())
   {
     number_of_points_by_return[point->get_extended_return_number()]++;
     number_of_returns[point->get_extended_number_of_returns()]++;
@@ -101,9 +127,9 @@ BOOL LASsummary::add(const LASpoint* point)
 //      max.extra_bytes = new U8[point->extra_bytes_number];
 //      max.extra_bytes_number = point->extra_bytes_number;
 //    }
-    // initialize min and max
-    min = *point;
-    max = *point;
+    // initialize min and max (copying the attributes but not the buffers the point owns)
+    copy_attributes(&min, point);
+    copy_attributes(&max, point);
     // initialize fluff detection
     xyz_low_digits_10[0] = (U16)(point->get_X()%10);
     xyz_low_digits_10[1] = (U16)(point->get_Y()%10);
@@ -333,3 +359,200 @@ BOOL LASinventory::add(const LASpoint* point)
   }
   return TRUE;
 }
+
+// the column kernels give exactly the same result as LASinventory::add() for
+// every single point (e.g. a NaN GPS time also never widens the range here)
+
+BOOL LASinventory::add(const LASpointBatch* batch)
+{
+  U32 i;
+  const U32 number = batch->number;
+  if (number == 0)
+  {
+    return TRUE;
+  }
+  number_of_point_records += number;
+  for (i = 0; i < number; i++)
+  {
+    number_of_points_by_return[batch->return_number[i]]++;
+    number_of_returns_of_given_pulse[batch->number_of_returns[i]]++;
+    return_count_for_return_number[batch->number_of_returns[i]][batch->return_number[i]]++;
+  }
+  if (first)
+  {
+    min_X = max_X = batch->X[0];
+    min_Y = max_Y = batch->Y[0];
+    min_Z = max_Z = batch->Z[0];
+    min_intensity = max_intensity = batch->intensity[0];
+    min_point_source_ID = max_point_source_ID = batch->point_source_ID[0];
+    min_scan_angle_rank = max_scan_angle_rank = batch->scan_angle_rank[0];
+    min_scan_angle = max_scan_angle = batch->scan_angle[0];
+    min_gps_time = max_gps_time = (batch->have_gps_time ? batch->gps_time[0] : 0.0);
+    max_R = min_R = (batch->have_rgb ? batch->R[0] : 0);
+    max_G = min_G = (batch->have_rgb ? batch->G[0] : 0);
+    max_B = min_B = (batch->have_rgb ? batch->B[0] : 0);
+    max_I = min_I = (batch->have_nir ? batch->I[0] : 0);
+    first = FALSE;
+  }
+  laskernels.range_I32(batch->X, number, &min_X, &max_X);
+  laskernels.range_I32(batch->Y, number, &min_Y, &max_Y);
+  laskernels.range_I32(batch->Z, number, &min_Z, &max_Z);
+  laskernels.range_U16(batch->intensity, number, &min_intensity, &max_intensity);
+  laskernels.range_U16(batch->point_source_ID, number, &min_point_source_ID, &max_point_source_ID);
+  laskernels.range_I8(batch->scan_angle_rank, number, &min_scan_angle_rank, &max_scan_angle_rank);
+  laskernels.range_I16(batch->scan_angle, number, &min_scan_angle, &max_scan_angle);
+  // the columns a point type does not have are zero like the LASpoint fields
+  if (batch->have_gps_time) laskernels.range_F64(batch->gps_time, number, &min_gps_time, &max_gps_time);
+  if (batch->have_rgb)
+  {
+    laskernels.range_U16(batch->R, number, &min_R, &max_R);
+    laskernels.range_U16(batch->G, number, &min_G, &max_G);
+    laskernels.range_U16(batch->B, number, &min_B, &max_B);
+  }
+  if (batch->have_nir) laskernels.range_U16(batch->I, number, &min_I, &max_I);
+  laskernels.fluff(batch->X, number, &xyz_fluff_10[0], &xyz_fluff_100[0], &xyz_fluff_1000[0]);
+  laskernels.fluff(batch->Y, number, &xyz_fluff_10[1], &xyz_fluff_100[1], &xyz_fluff_1000[1]);
+  laskernels.fluff(batch->Z, number, &xyz_fluff_10[2], &xyz_fluff_100[2], &xyz_fluff_1000[2]);
+  if (batch->have_wave_packet)
+  {
+    for (i = 0; i < number; i++)
+    {
+      set_wave_packet_index(batch->wave_packet_index[i]);
+    }
+  }
+  return TRUE;
+}
+
+BOOL LASsummary::merge(const LASsummary& summary)
+{
+  if (summary.first)
+  {
+    return TRUE;
+  }
+  U32 i;
+  number_of_point_records += summary.number_of_point_records;
+  for (i = 0; i < 16; i++)
+  {
+    number_of_points_by_return[i] += summary.number_of_points_by_return[i];
+    number_of_returns[i] += summary.number_of_returns[i];
+  }
+  for (i = 0; i < 32; i++)
+  {
+    classification[i] += summary.classification[i];
+  }
+  for (i = 0; i < 256; i++)
+  {
+    extended_classification[i] += summary.extended_classification[i];
+    flagged_synthetic_classification[i] += summary.flagged_synthetic_classification[i];
+    flagged_keypoint_classification[i] += summary.flagged_keypoint_classification[i];
+    flagged_withheld_classification[i] += summary.flagged_withheld_classification[i];
+    flagged_extended_overlap_classification[i] += summary.flagged_extended_overlap_classification[i];
+  }
+  flagged_synthetic += summary.flagged_synthetic;
+  flagged_keypoint += summary.flagged_keypoint;
+  flagged_withheld += summary.flagged_withheld;
+  flagged_extended_overlap += summary.flagged_extended_overlap;
+  for (i = 0; i < 3; i++)
+  {
+    xyz_fluff_10[i] += summary.xyz_fluff_10[i];
+    xyz_fluff_100[i] += summary.xyz_fluff_100[i];
+    xyz_fluff_1000[i] += summary.xyz_fluff_1000[i];
+    xyz_fluff_10000[i] += summary.xyz_fluff_10000[i];
+  }
+  if (first)
+  {
+    // the first point of the merged summary is the first point of the other
+    copy_attributes(&min, &summary.min);
+    copy_attributes(&max, &summary.max);
+    for (i = 0; i < 3; i++)
+    {
+      xyz_low_digits_10[i] = summary.xyz_low_digits_10[i];
+      xyz_low_digits_100[i] = summary.xyz_low_digits_100[i];
+      xyz_low_digits_1000[i] = summary.xyz_low_digits_1000[i];
+      xyz_low_digits_10000[i] = summary.xyz_low_digits_10000[i];
+    }
+    first = FALSE;
+    return TRUE;
+  }
+  // the same attributes as in add()
+  if (summary.min.get_X() < min.get_X()) min.set_X(summary.min.get_X());
+  if (summary.max.get_X() > max.get_X()) max.set_X(summary.max.get_X());
+  if (summary.min.get_Y() < min.get_Y()) min.set_Y(summary.min.get_Y());
+  if (summary.max.get_Y() > max.get_Y()) max.set_Y(summary.max.get_Y());
+  if (summary.min.get_Z() < min.get_Z()) min.set_Z(summary.min.get_Z());
+  if (summary.max.get_Z() > max.get_Z()) max.set_Z(summary.max.get_Z());
+  if (summary.min.intensity < min.intensity) min.intensity = summary.min.intensity;
+  if (summary.max.intensity > max.intensity) max.intensity = summary.max.intensity;
+  if (summary.min.edge_of_flight_line < min.edge_of_flight_line) min.edge_of_flight_line = summary.min.edge_of_flight_line;
+  if (summary.max.edge_of_flight_line > max.edge_of_flight_line) max.edge_of_flight_line = summary.max.edge_of_flight_line;
+  if (summary.min.scan_direction_flag < min.scan_direction_flag) min.scan_direction_flag = summary.min.scan_direction_flag;
+  if (summary.max.scan_direction_flag > max.scan_direction_flag) max.scan_direction_flag = summary.max.scan_direction_flag;
+  if (summary.min.number_of_returns < min.number_of_returns) min.number_of_returns = summary.min.number_of_returns;
+  if (summary.max.number_of_returns > max.number_of_returns) max.number_of_returns = summary.max.number_of_returns;
+  if (summary.min.return_number < min.return_number) min.return_number = summary.min.return_number;
+  if (summary.max.return_number > max.return_number) max.return_number = summary.max.return_number;
+  if (summary.min.classification < min.classification) min.classification = summary.min.classification;
+  if (summary.max.classification > max.classification) max.classification = summary.max.classification;
+  if (summary.min.scan_angle_rank < min.scan_angle_rank) min.scan_angle_rank = summary.min.scan_angle_rank;
+  if (summary.max.scan_angle_rank > max.scan_angle_rank) max.scan_angle_rank = summary.max.scan_angle_rank;
+  if (summary.min.user_data < min.user_data) min.user_data = summary.min.user_data;
+  if (summary.max.user_data > max.user_data) max.user_data = summary.max.user_data;
+  if (summary.min.point_source_ID < min.point_source_ID) min.point_source_ID = summary.min.point_source_ID;
+  if (summary.max.point_source_ID > max.point_source_ID) max.point_source_ID = summary.max.point_source_ID;
+  return TRUE;
+}
+
+BOOL LASinventory::merge(const LASinventory& inventory)
+{
+  if (inventory.first)
+  {
+    return TRUE;
+  }
+  U32 i, j;
+  number_of_point_records += inventory.number_of_point_records;
+  for (i = 0; i < 16; i++)
+  {
+    number_of_points_by_return[i] += inventory.number_of_points_by_return[i];
+    number_of_returns_of_given_pulse[i] += inventory.number_of_returns_of_given_pulse[i];
+    for (j = 0; j < 16; j++)
+    {
+      return_count_for_return_number[i][j] += inventory.return_count_for_return_number[i][j];
+    }
+  }
+  if (first || (inventory.min_X < min_X)) min_X = inventory.min_X;
+  if (first || (inventory.max_X > max_X)) max_X = inventory.max_X;
+  if (first || (inventory.min_Y < min_Y)) min_Y = inventory.min_Y;
+  if (first || (inventory.max_Y > max_Y)) max_Y = inventory.max_Y;
+  if (first || (inventory.min_Z < min_Z)) min_Z = inventory.min_Z;
+  if (first || (inventory.max_Z > max_Z)) max_Z = inventory.max_Z;
+  if (first || (inventory.min_intensity < min_intensity)) min_intensity = inventory.min_intensity;
+  if (first || (inventory.max_intensity > max_intensity)) max_intensity = inventory.max_intensity;
+  if (first || (inventory.min_point_source_ID < min_point_source_ID)) min_point_source_ID = inventory.min_point_source_ID;
+  if (first || (inventory.max_point_source_ID > max_point_source_ID)) max_point_source_ID = inventory.max_point_source_ID;
+  if (first || (inventory.min_scan_angle_rank < min_scan_angle_rank)) min_scan_angle_rank = inventory.min_scan_angle_rank;
+  if (first || (inventory.max_scan_angle_rank > max_scan_angle_rank)) max_scan_angle_rank = inventory.max_scan_angle_rank;
+  if (first || (inventory.min_scan_angle < min_scan_angle)) min_scan_angle = inventory.min_scan_angle;
+  if (first || (inventory.max_scan_angle > max_scan_angle)) max_scan_angle = inventory.max_scan_angle;
+  if (first || (inventory.min_gps_time < min_gps_time)) min_gps_time = inventory.min_gps_time;
+  if (first || (inventory.max_gps_time > max_gps_time)) max_gps_time = inventory.max_gps_time;
+  if (first || (inventory.min_R < min_R)) min_R = inventory.min_R;
+  if (first || (inventory.max_R > max_R)) max_R = inventory.max_R;
+  if (first || (inventory.min_G < min_G)) min_G = inventory.min_G;
+  if (first || (inventory.max_G > max_G)) max_G = inventory.max_G;
+  if (first || (inventory.min_B < min_B)) min_B = inventory.min_B;
+  if (first || (inventory.max_B > max_B)) max_B = inventory.max_B;
+  if (first || (inventory.min_I < min_I)) min_I = inventory.min_I;
+  if (first || (inventory.max_I > max_I)) max_I = inventory.max_I;
+  for (i = 0; i < 3; i++)
+  {
+    xyz_fluff_10[i] += inventory.xyz_fluff_10[i];
+    xyz_fluff_100[i] += inventory.xyz_fluff_100[i];
+    xyz_fluff_1000[i] += inventory.xyz_fluff_1000[i];
+  }
+  for (i = 0; i < 8; i++)
+  {
+    wave_packet_index_mask[i] |= inventory.wave_packet_index_mask[i];
+  }
+  first = FALSE;
+  return TRUE;
+}
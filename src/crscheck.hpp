@@ -5,8 +5,8 @@
 
   CONTENTS:
 
-    Functions to validate whether the GEOTIFF tags specify a valid geo-coding
-    and (someday) whether they are in agreement to the OGC WKT string.
+    Functions to validate whether the GEOTIFF tags and the OGC WKT string
+    specify a valid geo-coding and whether they are in agreement.
 
   PROGRAMMERS:
 
@@ -25,6 +25,12 @@
 
   CHANGE HISTORY:
 
+    18 October 2026 -- the ids of the common ellipsoids are public for the EPSG table
+    18 October 2026 -- the CRScache frees its entries at exit
+    18 October 2026 -- CRSlocation checks that the coordinates are plausible for the CRS
+    18 October 2026 -- parse the OGC WKT and compare it with the GEOTIFF tags
+    18 October 2026 -- CRScache replays the verdict of identical GeoKeys and OGC WKT
+    18 October 2026 -- EPSG codes from a sorted table generated by crsepsg.py
     8 July 2015 -- look-up name of unknown ESPG codes in list by Loren Dawe
     3 July 2014 -- allowing unknown ESPG codes to pass CRS check with warning
     8 September 2013 -- it started raining on the beach after TREEMAPS meeting
@@ -36,6 +42,53 @@
 
 #include "lasheader.hpp"
 
+class CRSwkt;
+
+// the ids of the reference ellipsoids that the EPSG codes use most
+
+#define CRS_ELLIPSOID_NAD27 5
+#define CRS_ELLIPSOID_NAD83 11
+#define CRS_ELLIPSOID_Inter 14
+#define CRS_ELLIPSOID_SAD69 19
+#define CRS_ELLIPSOID_WGS72 22
+#define CRS_ELLIPSOID_WGS84 23
+#define CRS_ELLIPSOID_ID74  24
+#define CRS_ELLIPSOID_GDA94 CRS_ELLIPSOID_NAD83
+
+// what CRScheck understood of the horizontal CRS. it is enough to map the
+// coordinates to latitude and longitude with a GeoProjectionConverter and to
+// see whether they lie where this CRS can be used
+
+#define CRS_LOCATION_NONE      0
+#define CRS_LOCATION_UTM       1
+#define CRS_LOCATION_TM        2
+#define CRS_LOCATION_LCC       3
+#define CRS_LOCATION_LONG_LAT  4
+#define CRS_LOCATION_LAT_LONG  5
+
+class CRSlocation
+{
+public:
+  I32 type;
+  I32 ellipsoid;            // id of the reference ellipsoid or 0 when unknown
+  F64 coordinates2meter;
+  I32 utm_zone;
+  BOOL utm_northern;
+  F64 parameters[6];        // TM and LCC: false easting and northing in meter,
+                            // latitude of origin, central meridian, and then
+                            // the scale factor (TM) or the standard parallels
+
+  // adds a warning when some of the coordinates map to a latitude and longitude
+  // where the CRS cannot be used. 'what' names the coordinates in the warning
+  BOOL check(LASheader* lasheader, const F64* x, const F64* y, const U32 number, const CHAR* what) const;
+
+  CRSlocation() { type = CRS_LOCATION_NONE; ellipsoid = 0; coordinates2meter = 1.0; utm_zone = 0; utm_northern = TRUE; memset(parameters, 0, sizeof(parameters)); };
+
+private:
+  U32 count_implausible(const F64* x, const F64* y, const U32 number, const F64 coordinates2meter, F64* latitude, F64* longitude, U32* first) const;
+  void describe(CHAR* area) const;
+};
+
 class CRSprojectionEllipsoid
 {
 public:
@@ -106,7 +159,7 @@ public:
 class CRScheck
 {
 public:
-  void check(LASheader* lasheader, CHAR* description=0, BOOL no_CRS_fail=FALSE);
+  void check(LASheader* lasheader, CHAR* description=0, BOOL no_CRS_fail=FALSE, CRSlocation* location=0);
   CRScheck();
   ~CRScheck();
 
@@ -116,6 +169,7 @@ private:
   U32 vertical_epsg[2];
   CRSprojectionEllipsoid* ellipsoids[2];
   CRSprojectionParameters* projections[2];
+  F64 projection_units[2];  // meter per unit of the false easting and northing
 
   void set_coordinates_in_survey_feet(const BOOL from_geokeys);
   void set_coordinates_in_feet(const BOOL from_geokeys);
@@ -144,6 +198,27 @@ private:
   BOOL set_projection_from_ProjectedCSTypeGeoKey(const U16 value, CHAR* description=0);
 
   BOOL check_geokeys(LASheader* lasheader, CHAR* description);
+
+  static F64 get_coordinate_units_in_meter(const U32 units);
+  void set_from_ogc_wkt(const CRSwkt* crswkt);
+  void compare_geokeys_with_ogc_wkt(LASheader* lasheader, const CRSwkt* crswkt, const BOOL no_CRS_fail);
+  void check_ogc_wkt(LASheader* lasheader, CHAR* description, const BOOL no_CRS_fail);
+  void get_location(CRSlocation* location) const;
+};
+
+// the tiles of one delivery usually have byte-identical GeoKeys and OGC WKT.
+// the CRS of only the first of them is checked and the fails, warnings, and
+// description are replayed for all others. shared by all threads
+
+class CRScache
+{
+public:
+  // same as CRScheck::check() but looks for an identical earlier CRS first
+  static void check(LASheader* lasheader, CHAR* description=0, BOOL no_CRS_fail=FALSE, CRSlocation* location=0);
+
+  // how often check() was called and how often it replayed an earlier CRS
+  static U64 get_lookups();
+  static U64 get_hits();
 };
 
 #endif
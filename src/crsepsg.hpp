@@ -0,0 +1,5718 @@
+/*
+===============================================================================
+
+  FILE:  crsepsg.hpp
+
+  CONTENTS:
+
+    The EPSG codes of projected coordinate systems that CRScheck knows sorted
+    by code for a binary search.
+
+    GENERATED by crsepsg.py from crsepsg.csv. DO NOT EDIT. add codes to
+    crsepsg.csv instead and run 'python3 crsepsg.py crsepsg.csv crsepsg.hpp'
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- the binary search takes any sorted table
+    18 October 2026 -- created to replace the switch and the list of EPSG codes
+
+===============================================================================
+*/
+#ifndef CRS_EPSG_HPP
+#define CRS_EPSG_HPP
+
+#include "mydefs.hpp"
+
+// needs the CRS_ELLIPSOID_ definitions of crscheck.hpp
+
+#define CRS_EPSG_NAME   0
+#define CRS_EPSG_UTM    1
+#define CRS_EPSG_MGA    2
+#define CRS_EPSG_SP27   3
+#define CRS_EPSG_SP83   4
+#define CRS_EPSG_TM     5
+#define CRS_EPSG_LCC    6
+
+#define CRS_EPSG_UNITS_NONE         0
+#define CRS_EPSG_UNITS_METER        1
+#define CRS_EPSG_UNITS_FEET         2
+#define CRS_EPSG_UNITS_SURVEY_FEET  3
+
+class CRSepsg
+{
+public:
+  U16 code;
+  U8 projection;
+  U8 units;
+  I8 ellipsoid;           // -1 does not set the ellipsoid
+  I8 utm_zone;            // negative for the southern hemisphere
+  I16 parameters;         // index into crs_epsg_parameters or -1
+  const CHAR* state_plane;
+  const CHAR* description;
+};
+
+static constexpr F64 crs_epsg_parameters[60][6] =
+{
+  { 600000.0, 750000.0, 53.5, -8.0, 0.99982, 0.0 },
+  { 500000.0, -5300000.0, 0.0, 19.0, 0.9993, 0.0 },
+  { 1600000.0, 10000000.0, 0.0, 173.0, 0.9996, 0.0 },
+  { 500000.0, 10000000.0, 0.0, -171.0, 0.9996, 0.0 },
+  { 400000.0, 0.0, 37.66666666666666, -77.0, 37.66666666666666, 38.3 },
+  { 3500000.0, 2000000.0, 37.66666666666666, -78.5, 39.2, 38.03333333333333 },
+  { 3500000.0, 1000000.0, 36.33333333333334, -78.5, 37.96666666666667, 36.76666666666667 },
+  { 500000.0, 0.0, 0.0, -51.0, 0.9996, 0.0 },
+  { 400000.0, 0.0, 41.75, -120.5, 43.0, 45.5 },
+  { 500000.0, 0.0, 0.0, 15.0, 0.9996, 0.0 },
+  { 4000000.0, 2800000.0, 52.0, 10.0, 35.0, 65.0 },
+  { 500000.0, 0.0, 0.0, 21.0, 0.9996, 0.0 },
+  { 500000.0, 0.0, 0.0, 27.0, 0.9996, 0.0 },
+  { 500000.0, 0.0, 0.0, 33.0, 0.9996, 0.0 },
+  { 2000000.0, 4000000.0, -17.0, 178.75, 0.99985, 0.0 },
+  { 400000.0, 0.0, 37.66666666666666, -77.0, 39.45, 38.3 },
+  { 500000.0, -5000000.0, 0.0, 15.0, 0.9999, 0.0 },
+  { 1700000.0, 1200000.0, 42.0, 3.0, 41.25, 42.75 },
+  { 1700000.0, 2200000.0, 43.0, 3.0, 42.25, 43.75 },
+  { 1700000.0, 3200000.0, 44.0, 3.0, 43.25, 44.75 },
+  { 1700000.0, 4200000.0, 45.0, 3.0, 44.25, 45.75 },
+  { 1700000.0, 5200000.0, 46.0, 3.0, 45.25, 46.75 },
+  { 1700000.0, 6200000.0, 47.0, 3.0, 46.25, 47.75 },
+  { 1700000.0, 7200000.0, 48.0, 3.0, 47.25, 48.75 },
+  { 1700000.0, 8200000.0, 49.0, 3.0, 48.25, 49.75 },
+  { 1700000.0, 9200000.0, 50.0, 3.0, 49.25, 50.75 },
+  { 200000.0, -5000000.0, 0.0, 9.0, 0.99998, 0.0 },
+  { 400000.0, -5000000.0, 0.0, 10.0, 0.99998, 0.0 },
+  { 600000.0, -5000000.0, 0.0, 11.75, 0.99998, 0.0 },
+  { 800000.0, -5000000.0, 0.0, 15.0, 0.99998, 0.0 },
+  { 32500000.0, 0.0, 0.0, 9.0, 0.9996, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 5.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 6.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 7.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 8.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 9.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 10.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 11.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 12.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 13.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 14.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 15.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 16.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 17.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 18.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 19.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 20.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 21.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 22.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 23.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 24.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 25.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 26.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 27.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 28.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 29.3, 1.0, 0.0 },
+  { 100000.0, 1000000.0, 58.0, 30.3, 1.0, 0.0 },
+  { 33500000.0, 0.0, 0.0, 15.0, 0.9996, 0.0 },
+  { 400000.0, -100000.0, 49.0, -2.0, 0.9996012717, 0.0 },
+  { 150000.013, 5400088.438, 90.0, 4.367486666666666, 51.16666723333333, 49.8333339 },
+};
+
+static constexpr U32 crs_epsg_number = 5538;
+
+static constexpr CRSepsg crs_epsg_table[crs_epsg_number] =
+{
+  { 2000, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Anguilla 1957 / British West Indies Grid" },
+  { 2001, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Antigua 1943 / British West Indies Grid" },
+  { 2002, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dominica 1945 / British West Indies Grid" },
+  { 2003, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Grenada 1953 / British West Indies Grid" },
+  { 2004, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Montserrat 1958 / British West Indies Grid" },
+  { 2005, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "St. Kitts 1955 / British West Indies Grid" },
+  { 2006, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "St. Lucia 1955 / British West Indies Grid" },
+  { 2007, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "St. Vincent 45 / British West Indies Grid" },
+  { 2008, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / SCoPQ zone 2" },
+  { 2009, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / SCoPQ zone 3" },
+  { 2010, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / SCoPQ zone 4" },
+  { 2011, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / SCoPQ zone 5" },
+  { 2012, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / SCoPQ zone 6" },
+  { 2013, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / SCoPQ zone 7" },
+  { 2014, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / SCoPQ zone 8" },
+  { 2015, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / SCoPQ zone 9" },
+  { 2016, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / SCoPQ zone 10" },
+  { 2017, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / MTM zone 8" },
+  { 2018, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / MTM zone 9" },
+  { 2019, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / MTM zone 10" },
+  { 2020, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / MTM zone 11" },
+  { 2021, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / MTM zone 12" },
+  { 2022, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / MTM zone 13" },
+  { 2023, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / MTM zone 14" },
+  { 2024, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / MTM zone 15" },
+  { 2025, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / MTM zone 16" },
+  { 2026, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / MTM zone 17" },
+  { 2027, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / UTM zone 15N" },
+  { 2028, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / UTM zone 16N" },
+  { 2029, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / UTM zone 17N" },
+  { 2030, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76) / UTM zone 18N" },
+  { 2031, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / UTM zone 17N" },
+  { 2032, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / UTM zone 18N" },
+  { 2033, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / UTM zone 19N" },
+  { 2034, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / UTM zone 20N" },
+  { 2035, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / UTM zone 21N" },
+  { 2036, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / New Brunswick Stereo" },
+  { 2037, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / UTM zone 19N" },
+  { 2038, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / UTM zone 20N" },
+  { 2039, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Israel 1993 / Israeli TM Grid" },
+  { 2040, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Locodjo 1965 / UTM zone 30N" },
+  { 2041, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Abidjan 1987 / UTM zone 30N" },
+  { 2042, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Locodjo 1965 / UTM zone 29N" },
+  { 2043, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Abidjan 1987 / UTM zone 29N" },
+  { 2044, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hanoi 1972 / Gauss-Kruger zone 18" },
+  { 2045, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hanoi 1972 / Gauss-Kruger zone 19" },
+  { 2046, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94 / Lo15" },
+  { 2047, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94 / Lo17" },
+  { 2048, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94 / Lo19" },
+  { 2049, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94 / Lo21" },
+  { 2050, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94 / Lo23" },
+  { 2051, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94 / Lo25" },
+  { 2052, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94 / Lo27" },
+  { 2053, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94 / Lo29" },
+  { 2054, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94 / Lo31" },
+  { 2055, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94 / Lo33" },
+  { 2056, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CH1903+ / LV95" },
+  { 2057, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Rassadiran / Nakhl e Taqi" },
+  { 2058, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50(ED77) / UTM zone 38N" },
+  { 2059, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50(ED77) / UTM zone 39N" },
+  { 2060, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50(ED77) / UTM zone 40N" },
+  { 2061, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50(ED77) / UTM zone 41N" },
+  { 2062, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Madrid 1870 (Madrid) / Spain" },
+  { 2063, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dabola 1981 / UTM zone 28N" },
+  { 2064, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dabola 1981 / UTM zone 29N" },
+  { 2065, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "S-JTSK (Ferro) / Krovak" },
+  { 2066, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mount Dillon / Tobago Grid" },
+  { 2067, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Naparima 1955 / UTM zone 20N" },
+  { 2068, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / Libya zone 5" },
+  { 2069, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / Libya zone 6" },
+  { 2070, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / Libya zone 7" },
+  { 2071, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / Libya zone 8" },
+  { 2072, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / Libya zone 9" },
+  { 2073, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / Libya zone 10" },
+  { 2074, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / Libya zone 11" },
+  { 2075, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / Libya zone 12" },
+  { 2076, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / Libya zone 13" },
+  { 2077, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / UTM zone 32N" },
+  { 2078, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / UTM zone 33N" },
+  { 2079, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / UTM zone 34N" },
+  { 2080, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / UTM zone 35N" },
+  { 2081, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Chos Malal 1914 / Argentina 2" },
+  { 2082, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pampa del Castillo / Argentina 2" },
+  { 2083, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hito XVIII 1963 / Argentina 2" },
+  { 2084, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hito XVIII 1963 / UTM zone 19S" },
+  { 2085, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Cuba Norte" },
+  { 2086, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Cuba Sur" },
+  { 2087, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79 / TM 12 NE" },
+  { 2088, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Carthage / TM 11 NE" },
+  { 2089, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yemen NGN96 / UTM zone 38N" },
+  { 2090, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yemen NGN96 / UTM zone 39N" },
+  { 2091, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "South Yemen / Gauss Kruger zone 8" },
+  { 2092, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "South Yemen / Gauss Kruger zone 9" },
+  { 2093, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hanoi 1972 / GK 106 NE" },
+  { 2094, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 72BE / TM 106 NE" },
+  { 2095, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bissau / UTM zone 28N" },
+  { 2096, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korean 1985 / East Belt" },
+  { 2097, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korean 1985 / Central Belt" },
+  { 2098, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korean 1985 / West Belt" },
+  { 2099, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qatar 1948 / Qatar Grid" },
+  { 2100, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GGRS87 / Greek Grid" },
+  { 2101, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lake / Maracaibo Grid M1" },
+  { 2102, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lake / Maracaibo Grid" },
+  { 2103, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lake / Maracaibo Grid M3" },
+  { 2104, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lake / Maracaibo La Rosa Grid" },
+  { 2105, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Mount Eden 2000" },
+  { 2106, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Bay of Plenty 2000" },
+  { 2107, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Poverty Bay 2000" },
+  { 2108, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Hawkes Bay 2000" },
+  { 2109, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Taranaki 2000" },
+  { 2110, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Tuhirangi 2000" },
+  { 2111, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Wanganui 2000" },
+  { 2112, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Wairarapa 2000" },
+  { 2113, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Wellington 2000" },
+  { 2114, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Collingwood 2000" },
+  { 2115, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Nelson 2000" },
+  { 2116, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Karamea 2000" },
+  { 2117, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Buller 2000" },
+  { 2118, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Grey 2000" },
+  { 2119, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Amuri 2000" },
+  { 2120, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Marlborough 2000" },
+  { 2121, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Hokitika 2000" },
+  { 2122, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Okarito 2000" },
+  { 2123, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Jacksons Bay 2000" },
+  { 2124, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Mount Pleasant 2000" },
+  { 2125, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Gawler 2000" },
+  { 2126, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Timaru 2000" },
+  { 2127, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Lindis Peak 2000" },
+  { 2128, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Mount Nicholas 2000" },
+  { 2129, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Mount York 2000" },
+  { 2130, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Observation Point 2000" },
+  { 2131, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / North Taieri 2000" },
+  { 2132, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Bluff 2000" },
+  { 2133, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / UTM zone 58S" },
+  { 2134, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / UTM zone 59S" },
+  { 2135, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / UTM zone 60S" },
+  { 2136, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Accra / Ghana National Grid" },
+  { 2137, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Accra / TM 1 NW" },
+  { 2138, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77) / Quebec Lambert" },
+  { 2139, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / SCoPQ zone 2" },
+  { 2140, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / MTM zone 3" },
+  { 2141, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / MTM zone 4" },
+  { 2142, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / MTM zone 5" },
+  { 2143, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / MTM zone 6" },
+  { 2144, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / MTM zone 7" },
+  { 2145, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / MTM zone 8" },
+  { 2146, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / MTM zone 9" },
+  { 2147, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / MTM zone 10" },
+  { 2148, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / UTM zone 21N" },
+  { 2149, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / UTM zone 18N" },
+  { 2150, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / UTM zone 17N" },
+  { 2151, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / UTM zone 13N" },
+  { 2152, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / UTM zone 12N" },
+  { 2153, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / UTM zone 11N" },
+  { 2154, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGF93 / Lambert-93" },
+  { 2155, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "American Samoa 1962 / American Samoa Lambert" },
+  { 2156, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / UTM zone 59S" },
+  { 2157, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 0, 0, "IRENET95 / Irish Transverse Mercator" },
+  { 2158, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IRENET95 / UTM zone 29N" },
+  { 2159, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sierra Leone 1924 / New Colony Grid" },
+  { 2160, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sierra Leone 1924 / New War Office Grid" },
+  { 2161, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sierra Leone 1968 / UTM zone 28N" },
+  { 2162, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sierra Leone 1968 / UTM zone 29N" },
+  { 2163, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "US National Atlas Equal Area" },
+  { 2164, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Locodjo 1965 / TM 5 NW" },
+  { 2165, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Abidjan 1987 / TM 5 NW" },
+  { 2166, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / Gauss Kruger zone 3" },
+  { 2167, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / Gauss Kruger zone 4" },
+  { 2168, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / Gauss Kruger zone 5" },
+  { 2169, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Luxembourg 1930 / Gauss" },
+  { 2170, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Slovenia Grid" },
+  { 2171, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / Poland zone I" },
+  { 2172, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / Poland zone II" },
+  { 2173, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / Poland zone III" },
+  { 2174, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / Poland zone IV" },
+  { 2175, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / Poland zone V" },
+  { 2176, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Poland CS2000 zone 5" },
+  { 2177, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Poland CS2000 zone 6" },
+  { 2178, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Poland CS2000 zone 7" },
+  { 2179, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Poland CS2000 zone 8" },
+  { 2180, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 1, 0, "ETRS89 / Poland CS92" },
+  { 2188, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Azores Occidental 1939 / UTM zone 25N" },
+  { 2189, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Azores Central 1948 / UTM zone 26N" },
+  { 2190, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Azores Oriental 1940 / UTM zone 26N" },
+  { 2191, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Madeira 1936 / UTM zone 28N" },
+  { 2192, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / France EuroLambert" },
+  { 2193, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 2, 0, "NZGD2000" },
+  { 2194, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "American Samoa 1962 / American Samoa Lambert" },
+  { 2195, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 3, 0, "UTM zone 2S (American Samoa)" },
+  { 2196, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Kp2000 Jutland" },
+  { 2197, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Kp2000 Zealand" },
+  { 2198, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Kp2000 Bornholm" },
+  { 2199, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Albanian 1987 / Gauss Kruger zone 4" },
+  { 2200, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ATS77 / New Brunswick Stereographic (ATS77)" },
+  { 2201, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGVEN / UTM zone 18N" },
+  { 2202, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGVEN / UTM zone 19N" },
+  { 2203, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGVEN / UTM zone 20N" },
+  { 2204, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Tennessee" },
+  { 2205, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Kentucky North" },
+  { 2206, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / 3-degree Gauss-Kruger zone 9" },
+  { 2207, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / 3-degree Gauss-Kruger zone 10" },
+  { 2208, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / 3-degree Gauss-Kruger zone 11" },
+  { 2209, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / 3-degree Gauss-Kruger zone 12" },
+  { 2210, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / 3-degree Gauss-Kruger zone 13" },
+  { 2211, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / 3-degree Gauss-Kruger zone 14" },
+  { 2212, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / 3-degree Gauss-Kruger zone 15" },
+  { 2213, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / TM 30 NE" },
+  { 2214, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Douala 1948 / AOF west" },
+  { 2215, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Manoca 1962 / UTM zone 32N" },
+  { 2216, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927 / UTM zone 22N" },
+  { 2217, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927 / UTM zone 23N" },
+  { 2218, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Scoresbysund 1952 / Greenland zone 5 east" },
+  { 2219, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ATS77 / UTM zone 19N" },
+  { 2220, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ATS77 / UTM zone 20N" },
+  { 2221, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Scoresbysund 1952 / Greenland zone 6 east" },
+  { 2222, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Arizona East (ft)" },
+  { 2223, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Arizona Central (ft)" },
+  { 2224, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Arizona West (ft)" },
+  { 2225, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / California zone 1 (ftUS)" },
+  { 2226, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / California zone 2 (ftUS)" },
+  { 2227, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / California zone 3 (ftUS)" },
+  { 2228, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / California zone 4 (ftUS)" },
+  { 2229, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / California zone 5 (ftUS)" },
+  { 2230, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / California zone 6 (ftUS)" },
+  { 2231, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Colorado North (ftUS)" },
+  { 2232, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Colorado Central (ftUS)" },
+  { 2233, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Colorado South (ftUS)" },
+  { 2234, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Connecticut (ftUS)" },
+  { 2235, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Delaware (ftUS)" },
+  { 2236, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Florida East (ftUS)" },
+  { 2237, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Florida West (ftUS)" },
+  { 2238, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Florida North (ftUS)" },
+  { 2239, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Georgia East (ftUS)" },
+  { 2240, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Georgia West (ftUS)" },
+  { 2241, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Idaho East (ftUS)" },
+  { 2242, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Idaho Central (ftUS)" },
+  { 2243, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Idaho West (ftUS)" },
+  { 2244, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Indiana East (ftUS)" },
+  { 2245, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Indiana West (ftUS)" },
+  { 2246, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Kentucky North (ftUS)" },
+  { 2247, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Kentucky South (ftUS)" },
+  { 2248, CRS_EPSG_LCC, CRS_EPSG_UNITS_SURVEY_FEET, CRS_ELLIPSOID_NAD83, 0, 4, 0, "NAD83 / Maryland (ftUS)" },
+  { 2249, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Massachusetts Mainland (ftUS)" },
+  { 2250, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Massachusetts Island (ftUS)" },
+  { 2251, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Michigan North (ft)" },
+  { 2252, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Michigan Central (ft)" },
+  { 2253, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Michigan South (ft)" },
+  { 2254, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Mississippi East (ftUS)" },
+  { 2255, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Mississippi West (ftUS)" },
+  { 2256, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Montana (ft)" },
+  { 2257, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / New Mexico East (ftUS)" },
+  { 2258, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / New Mexico Central (ftUS)" },
+  { 2259, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / New Mexico West (ftUS)" },
+  { 2260, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / New York East (ftUS)" },
+  { 2261, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / New York Central (ftUS)" },
+  { 2262, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / New York West (ftUS)" },
+  { 2263, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / New York Long Island (ftUS)" },
+  { 2264, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / North Carolina (ftUS)" },
+  { 2265, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / North Dakota North (ft)" },
+  { 2266, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / North Dakota South (ft)" },
+  { 2267, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Oklahoma North (ftUS)" },
+  { 2268, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Oklahoma South (ftUS)" },
+  { 2269, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Oregon North (ft)" },
+  { 2270, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Oregon South (ft)" },
+  { 2271, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Pennsylvania North (ftUS)" },
+  { 2272, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Pennsylvania South (ftUS)" },
+  { 2273, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / South Carolina (ft)" },
+  { 2274, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Tennessee (ftUS)" },
+  { 2275, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Texas North (ftUS)" },
+  { 2276, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Texas North Central (ftUS)" },
+  { 2277, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Texas Central (ftUS)" },
+  { 2278, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Texas South Central (ftUS)" },
+  { 2279, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Texas South (ftUS)" },
+  { 2280, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Utah North (ft)" },
+  { 2281, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Utah Central (ft)" },
+  { 2282, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Utah South (ft)" },
+  { 2283, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Virginia North (ftUS)" },
+  { 2284, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Virginia South (ftUS)" },
+  { 2285, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Washington North (ftUS)" },
+  { 2286, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Washington South (ftUS)" },
+  { 2287, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Wisconsin North (ftUS)" },
+  { 2288, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Wisconsin Central (ftUS)" },
+  { 2289, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Wisconsin South (ftUS)" },
+  { 2290, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ATS77 / Prince Edward Isl. Stereographic (ATS77)" },
+  { 2291, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / Prince Edward Isl. Stereographic (NAD83)" },
+  { 2292, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98) / Prince Edward Isl. Stereographic (NAD83)" },
+  { 2294, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ATS77 / MTM Nova Scotia zone 4" },
+  { 2295, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ATS77 / MTM Nova Scotia zone 5" },
+  { 2296, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ammassalik 1958 / Greenland zone 7 east" },
+  { 2297, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927 / Greenland zone 1 east" },
+  { 2298, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927 / Greenland zone 2 east" },
+  { 2299, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927 / Greenland zone 2 west" },
+  { 2300, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927 / Greenland zone 3 east" },
+  { 2301, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927 / Greenland zone 3 west" },
+  { 2302, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927 / Greenland zone 4 east" },
+  { 2303, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927 / Greenland zone 4 west" },
+  { 2304, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927 / Greenland zone 5 west" },
+  { 2305, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927 / Greenland zone 6 west" },
+  { 2306, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927 / Greenland zone 7 west" },
+  { 2307, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927 / Greenland zone 8 east" },
+  { 2308, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Batavia / TM 109 SE" },
+  { 2309, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / TM 116 SE" },
+  { 2310, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / TM 132 SE" },
+  { 2311, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / TM 6 NE" },
+  { 2312, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Garoua / UTM zone 33N" },
+  { 2313, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kousseri / UTM zone 33N" },
+  { 2314, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Trinidad 1903 / Trinidad Grid (ftCla)" },
+  { 2315, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Campo Inchauspe / UTM zone 19S" },
+  { 2316, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Campo Inchauspe / UTM zone 20S" },
+  { 2317, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PSAD56 / ICN Regional" },
+  { 2318, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ain el Abd / Aramco Lambert" },
+  { 2319, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / TM27" },
+  { 2320, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / TM30" },
+  { 2321, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / TM33" },
+  { 2322, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / TM36" },
+  { 2323, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / TM39" },
+  { 2324, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / TM42" },
+  { 2325, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / TM45" },
+  { 2326, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hong Kong 1980 Grid System" },
+  { 2327, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger zone 13" },
+  { 2328, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger zone 14" },
+  { 2329, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger zone 15" },
+  { 2330, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger zone 16" },
+  { 2331, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger zone 17" },
+  { 2332, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger zone 18" },
+  { 2333, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger zone 19" },
+  { 2334, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger zone 20" },
+  { 2335, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger zone 21" },
+  { 2336, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger zone 22" },
+  { 2337, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger zone 23" },
+  { 2338, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger CM 75E" },
+  { 2339, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger CM 81E" },
+  { 2340, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger CM 87E" },
+  { 2341, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger CM 93E" },
+  { 2342, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger CM 99E" },
+  { 2343, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger CM 105E" },
+  { 2344, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger CM 111E" },
+  { 2345, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger CM 117E" },
+  { 2346, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger CM 123E" },
+  { 2347, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger CM 129E" },
+  { 2348, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / Gauss-Kruger CM 135E" },
+  { 2349, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 25" },
+  { 2350, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 26" },
+  { 2351, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 27" },
+  { 2352, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 28" },
+  { 2353, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 29" },
+  { 2354, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 30" },
+  { 2355, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 31" },
+  { 2356, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 32" },
+  { 2357, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 33" },
+  { 2358, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 34" },
+  { 2359, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 35" },
+  { 2360, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 36" },
+  { 2361, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 37" },
+  { 2362, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 38" },
+  { 2363, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 39" },
+  { 2364, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 40" },
+  { 2365, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 41" },
+  { 2366, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 42" },
+  { 2367, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 43" },
+  { 2368, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 44" },
+  { 2369, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger zone 45" },
+  { 2370, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 75E" },
+  { 2371, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 78E" },
+  { 2372, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 81E" },
+  { 2373, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 84E" },
+  { 2374, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 87E" },
+  { 2375, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 90E" },
+  { 2376, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 93E" },
+  { 2377, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 96E" },
+  { 2378, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 99E" },
+  { 2379, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 102E" },
+  { 2380, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 105E" },
+  { 2381, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 108E" },
+  { 2382, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 111E" },
+  { 2383, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 114E" },
+  { 2384, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 117E" },
+  { 2385, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 120E" },
+  { 2386, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 123E" },
+  { 2387, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 126E" },
+  { 2388, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 129E" },
+  { 2389, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 132E" },
+  { 2390, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980 / 3-degree Gauss-Kruger CM 135E" },
+  { 2391, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KKJ / Finland zone 1" },
+  { 2392, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KKJ / Finland zone 2" },
+  { 2393, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KKJ / Finland Uniform Coordinate System" },
+  { 2394, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KKJ / Finland zone 4" },
+  { 2395, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "South Yemen / Gauss-Kruger zone 8" },
+  { 2396, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "South Yemen / Gauss-Kruger zone 9" },
+  { 2397, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 3" },
+  { 2398, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 4" },
+  { 2399, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 5" },
+  { 2400, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT90 2.5 gon W" },
+  { 2401, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 25" },
+  { 2402, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 26" },
+  { 2403, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 27" },
+  { 2404, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 28" },
+  { 2405, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 29" },
+  { 2406, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 30" },
+  { 2407, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 31" },
+  { 2408, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 32" },
+  { 2409, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 33" },
+  { 2410, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 34" },
+  { 2411, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 35" },
+  { 2412, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 36" },
+  { 2413, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 37" },
+  { 2414, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 38" },
+  { 2415, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 39" },
+  { 2416, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 40" },
+  { 2417, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 41" },
+  { 2418, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 42" },
+  { 2419, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 43" },
+  { 2420, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 44" },
+  { 2421, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger zone 45" },
+  { 2422, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 75E" },
+  { 2423, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 78E" },
+  { 2424, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 81E" },
+  { 2425, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 84E" },
+  { 2426, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 87E" },
+  { 2427, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 90E" },
+  { 2428, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 93E" },
+  { 2429, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 96E" },
+  { 2430, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 99E" },
+  { 2431, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 102E" },
+  { 2432, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 105E" },
+  { 2433, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 108E" },
+  { 2434, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 111E" },
+  { 2435, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 114E" },
+  { 2436, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 117E" },
+  { 2437, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 120E" },
+  { 2438, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 123E" },
+  { 2439, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 126E" },
+  { 2440, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 129E" },
+  { 2441, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 132E" },
+  { 2442, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / 3-degree Gauss-Kruger CM 135E" },
+  { 2443, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS I" },
+  { 2444, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS II" },
+  { 2445, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS III" },
+  { 2446, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS IV" },
+  { 2447, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS V" },
+  { 2448, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS VI" },
+  { 2449, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS VII" },
+  { 2450, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS VIII" },
+  { 2451, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS IX" },
+  { 2452, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS X" },
+  { 2453, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS XI" },
+  { 2454, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS XII" },
+  { 2455, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS XIII" },
+  { 2456, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS XIV" },
+  { 2457, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS XV" },
+  { 2458, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS XVI" },
+  { 2459, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS XVII" },
+  { 2460, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS XVIII" },
+  { 2461, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / Japan Plane Rectangular CS XIX" },
+  { 2462, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Albanian 1987 / Gauss-Kruger zone 4" },
+  { 2463, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 21E" },
+  { 2464, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 27E" },
+  { 2465, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 33E" },
+  { 2466, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 39E" },
+  { 2467, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 45E" },
+  { 2468, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 51E" },
+  { 2469, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 57E" },
+  { 2470, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 63E" },
+  { 2471, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 69E" },
+  { 2472, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 75E" },
+  { 2473, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 81E" },
+  { 2474, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 87E" },
+  { 2475, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 93E" },
+  { 2476, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 99E" },
+  { 2477, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 105E" },
+  { 2478, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 111E" },
+  { 2479, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 117E" },
+  { 2480, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 123E" },
+  { 2481, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 129E" },
+  { 2482, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 135E" },
+  { 2483, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 141E" },
+  { 2484, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 147E" },
+  { 2485, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 153E" },
+  { 2486, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 159E" },
+  { 2487, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 165E" },
+  { 2488, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 171E" },
+  { 2489, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 177E" },
+  { 2490, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 177W" },
+  { 2491, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger CM 171W" },
+  { 2492, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 9E" },
+  { 2493, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 15E" },
+  { 2494, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 21E" },
+  { 2495, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 27E" },
+  { 2496, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 33E" },
+  { 2497, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 39E" },
+  { 2498, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 45E" },
+  { 2499, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 51E" },
+  { 2500, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 57E" },
+  { 2501, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 63E" },
+  { 2502, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 69E" },
+  { 2503, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 75E" },
+  { 2504, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 81E" },
+  { 2505, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 87E" },
+  { 2506, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 93E" },
+  { 2507, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 99E" },
+  { 2508, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 105E" },
+  { 2509, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 111E" },
+  { 2510, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 117E" },
+  { 2511, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 123E" },
+  { 2512, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 129E" },
+  { 2513, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 135E" },
+  { 2514, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 141E" },
+  { 2515, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 147E" },
+  { 2516, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 153E" },
+  { 2517, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 159E" },
+  { 2518, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 165E" },
+  { 2519, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 171E" },
+  { 2520, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 177E" },
+  { 2521, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 177W" },
+  { 2522, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger CM 171W" },
+  { 2523, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 7" },
+  { 2524, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 8" },
+  { 2525, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 9" },
+  { 2526, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 10" },
+  { 2527, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 11" },
+  { 2528, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 12" },
+  { 2529, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 13" },
+  { 2530, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 14" },
+  { 2531, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 15" },
+  { 2532, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 16" },
+  { 2533, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 17" },
+  { 2534, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 18" },
+  { 2535, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 19" },
+  { 2536, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 20" },
+  { 2537, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 21" },
+  { 2538, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 22" },
+  { 2539, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 23" },
+  { 2540, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 24" },
+  { 2541, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 25" },
+  { 2542, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 26" },
+  { 2543, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 27" },
+  { 2544, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 28" },
+  { 2545, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 29" },
+  { 2546, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 30" },
+  { 2547, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 31" },
+  { 2548, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 32" },
+  { 2549, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 33" },
+  { 2550, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Samboja / UTM zone 50S" },
+  { 2551, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 34" },
+  { 2552, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 35" },
+  { 2553, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 36" },
+  { 2554, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 37" },
+  { 2555, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 38" },
+  { 2556, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 39" },
+  { 2557, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 40" },
+  { 2558, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 41" },
+  { 2559, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 42" },
+  { 2560, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 43" },
+  { 2561, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 44" },
+  { 2562, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 45" },
+  { 2563, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 46" },
+  { 2564, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 47" },
+  { 2565, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 48" },
+  { 2566, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 49" },
+  { 2567, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 50" },
+  { 2568, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 51" },
+  { 2569, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 52" },
+  { 2570, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 53" },
+  { 2571, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 54" },
+  { 2572, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 55" },
+  { 2573, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 56" },
+  { 2574, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 57" },
+  { 2575, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 58" },
+  { 2576, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 59" },
+  { 2577, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 60" },
+  { 2578, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 61" },
+  { 2579, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 62" },
+  { 2580, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 63" },
+  { 2581, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 64" },
+  { 2582, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 21E" },
+  { 2583, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 24E" },
+  { 2584, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 27E" },
+  { 2585, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 30E" },
+  { 2586, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 33E" },
+  { 2587, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 36E" },
+  { 2588, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 39E" },
+  { 2589, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 42E" },
+  { 2590, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 45E" },
+  { 2591, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 48E" },
+  { 2592, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 51E" },
+  { 2593, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 54E" },
+  { 2594, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 57E" },
+  { 2595, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 60E" },
+  { 2596, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 63E" },
+  { 2597, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 66E" },
+  { 2598, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 69E" },
+  { 2599, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 72E" },
+  { 2600, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lietuvos Koordinoei Sistema 1994" },
+  { 2601, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 75E" },
+  { 2602, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 78E" },
+  { 2603, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 81E" },
+  { 2604, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 84E" },
+  { 2605, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 87E" },
+  { 2606, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 90E" },
+  { 2607, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 93E" },
+  { 2608, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 96E" },
+  { 2609, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 99E" },
+  { 2610, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 102E" },
+  { 2611, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 105E" },
+  { 2612, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 108E" },
+  { 2613, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 111E" },
+  { 2614, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 114E" },
+  { 2615, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 117E" },
+  { 2616, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 120E" },
+  { 2617, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 123E" },
+  { 2618, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 126E" },
+  { 2619, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 129E" },
+  { 2620, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 132E" },
+  { 2621, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 135E" },
+  { 2622, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 138E" },
+  { 2623, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 141E" },
+  { 2624, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 144E" },
+  { 2625, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 147E" },
+  { 2626, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 150E" },
+  { 2627, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 153E" },
+  { 2628, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 156E" },
+  { 2629, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 159E" },
+  { 2630, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 162E" },
+  { 2631, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 165E" },
+  { 2632, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 168E" },
+  { 2633, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 171E" },
+  { 2634, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 174E" },
+  { 2635, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 177E" },
+  { 2636, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 180E" },
+  { 2637, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 177W" },
+  { 2638, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 174W" },
+  { 2639, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 171W" },
+  { 2640, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 168W" },
+  { 2641, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 7" },
+  { 2642, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 8" },
+  { 2643, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 9" },
+  { 2644, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 10" },
+  { 2645, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 11" },
+  { 2646, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 12" },
+  { 2647, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 13" },
+  { 2648, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 14" },
+  { 2649, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 15" },
+  { 2650, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 16" },
+  { 2651, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 17" },
+  { 2652, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 18" },
+  { 2653, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 19" },
+  { 2654, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 20" },
+  { 2655, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 21" },
+  { 2656, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 22" },
+  { 2657, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 23" },
+  { 2658, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 24" },
+  { 2659, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 25" },
+  { 2660, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 26" },
+  { 2661, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 27" },
+  { 2662, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 28" },
+  { 2663, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 29" },
+  { 2664, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 30" },
+  { 2665, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 31" },
+  { 2666, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 32" },
+  { 2667, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 33" },
+  { 2668, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 34" },
+  { 2669, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 35" },
+  { 2670, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 36" },
+  { 2671, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 37" },
+  { 2672, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 38" },
+  { 2673, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 39" },
+  { 2674, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 40" },
+  { 2675, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 41" },
+  { 2676, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 42" },
+  { 2677, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 43" },
+  { 2678, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 44" },
+  { 2679, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 45" },
+  { 2680, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 46" },
+  { 2681, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 47" },
+  { 2682, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 48" },
+  { 2683, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 49" },
+  { 2684, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 50" },
+  { 2685, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 51" },
+  { 2686, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 52" },
+  { 2687, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 53" },
+  { 2688, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 54" },
+  { 2689, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 55" },
+  { 2690, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 56" },
+  { 2691, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 57" },
+  { 2692, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 58" },
+  { 2693, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 59" },
+  { 2694, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 60" },
+  { 2695, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 61" },
+  { 2696, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 62" },
+  { 2697, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 63" },
+  { 2698, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 64" },
+  { 2699, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 21E" },
+  { 2700, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 24E" },
+  { 2701, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 27E" },
+  { 2702, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 30E" },
+  { 2703, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 33E" },
+  { 2704, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 36E" },
+  { 2705, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 39E" },
+  { 2706, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 42E" },
+  { 2707, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 45E" },
+  { 2708, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 48E" },
+  { 2709, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 51E" },
+  { 2710, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 54E" },
+  { 2711, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 57E" },
+  { 2712, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 60E" },
+  { 2713, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 63E" },
+  { 2714, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 66E" },
+  { 2715, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 69E" },
+  { 2716, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 72E" },
+  { 2717, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 75E" },
+  { 2718, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 78E" },
+  { 2719, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 81E" },
+  { 2720, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 84E" },
+  { 2721, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 87E" },
+  { 2722, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 90E" },
+  { 2723, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 93E" },
+  { 2724, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 96E" },
+  { 2725, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 99E" },
+  { 2726, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 102E" },
+  { 2727, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 105E" },
+  { 2728, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 108E" },
+  { 2729, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 111E" },
+  { 2730, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 114E" },
+  { 2731, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 117E" },
+  { 2732, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 120E" },
+  { 2733, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 123E" },
+  { 2734, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 126E" },
+  { 2735, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 129E" },
+  { 2736, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tete / UTM zone 36S" },
+  { 2737, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tete / UTM zone 37S" },
+  { 2738, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 132E" },
+  { 2739, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 135E" },
+  { 2740, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 138E" },
+  { 2741, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 141E" },
+  { 2742, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 144E" },
+  { 2743, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 147E" },
+  { 2744, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 150E" },
+  { 2745, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 153E" },
+  { 2746, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 156E" },
+  { 2747, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 159E" },
+  { 2748, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 162E" },
+  { 2749, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 165E" },
+  { 2750, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 168E" },
+  { 2751, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 171E" },
+  { 2752, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 174E" },
+  { 2753, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 177E" },
+  { 2754, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 180E" },
+  { 2755, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 177W" },
+  { 2756, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 174W" },
+  { 2757, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 171W" },
+  { 2758, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 168W" },
+  { 2759, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Alabama East" },
+  { 2760, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Alabama West" },
+  { 2761, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Arizona East" },
+  { 2762, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Arizona Central" },
+  { 2763, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Arizona West" },
+  { 2764, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Arkansas North" },
+  { 2765, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Arkansas South" },
+  { 2766, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / California zone 1" },
+  { 2767, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / California zone 2" },
+  { 2768, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / California zone 3" },
+  { 2769, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / California zone 4" },
+  { 2770, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / California zone 5" },
+  { 2771, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / California zone 6" },
+  { 2772, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Colorado North" },
+  { 2773, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Colorado Central" },
+  { 2774, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Colorado South" },
+  { 2775, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Connecticut" },
+  { 2776, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Delaware" },
+  { 2777, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Florida East" },
+  { 2778, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Florida West" },
+  { 2779, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Florida North" },
+  { 2780, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Georgia East" },
+  { 2781, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Georgia West" },
+  { 2782, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Hawaii zone 1" },
+  { 2783, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Hawaii zone 2" },
+  { 2784, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Hawaii zone 3" },
+  { 2785, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Hawaii zone 4" },
+  { 2786, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Hawaii zone 5" },
+  { 2787, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Idaho East" },
+  { 2788, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Idaho Central" },
+  { 2789, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Idaho West" },
+  { 2790, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Illinois East" },
+  { 2791, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Illinois West" },
+  { 2792, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Indiana East" },
+  { 2793, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Indiana West" },
+  { 2794, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Iowa North" },
+  { 2795, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Iowa South" },
+  { 2796, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Kansas North" },
+  { 2797, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Kansas South" },
+  { 2798, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Kentucky North" },
+  { 2799, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Kentucky South" },
+  { 2800, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Louisiana North" },
+  { 2801, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Louisiana South" },
+  { 2802, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Maine East" },
+  { 2803, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Maine West" },
+  { 2804, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Maryland" },
+  { 2805, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Massachusetts Mainland" },
+  { 2806, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Massachusetts Island" },
+  { 2807, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Michigan North" },
+  { 2808, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Michigan Central" },
+  { 2809, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Michigan South" },
+  { 2810, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Minnesota North" },
+  { 2811, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Minnesota Central" },
+  { 2812, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Minnesota South" },
+  { 2813, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Mississippi East" },
+  { 2814, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Mississippi West" },
+  { 2815, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Missouri East" },
+  { 2816, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Missouri Central" },
+  { 2817, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Missouri West" },
+  { 2818, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Montana" },
+  { 2819, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Nebraska" },
+  { 2820, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Nevada East" },
+  { 2821, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Nevada Central" },
+  { 2822, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Nevada West" },
+  { 2823, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New Hampshire" },
+  { 2824, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New Jersey" },
+  { 2825, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New Mexico East" },
+  { 2826, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New Mexico Central" },
+  { 2827, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New Mexico West" },
+  { 2828, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New York East" },
+  { 2829, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New York Central" },
+  { 2830, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New York West" },
+  { 2831, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New York Long Island" },
+  { 2832, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / North Dakota North" },
+  { 2833, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / North Dakota South" },
+  { 2834, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Ohio North" },
+  { 2835, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Ohio South" },
+  { 2836, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Oklahoma North" },
+  { 2837, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Oklahoma South" },
+  { 2838, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Oregon North" },
+  { 2839, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Oregon South" },
+  { 2840, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Rhode Island" },
+  { 2841, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / South Dakota North" },
+  { 2842, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / South Dakota South" },
+  { 2843, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Tennessee" },
+  { 2844, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Texas North" },
+  { 2845, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Texas North Central" },
+  { 2846, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Texas Central" },
+  { 2847, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Texas South Central" },
+  { 2848, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Texas South" },
+  { 2849, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Utah North" },
+  { 2850, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Utah Central" },
+  { 2851, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Utah South" },
+  { 2852, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Vermont" },
+  { 2853, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Virginia North" },
+  { 2854, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Virginia South" },
+  { 2855, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Washington North" },
+  { 2856, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Washington South" },
+  { 2857, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / West Virginia North" },
+  { 2858, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / West Virginia South" },
+  { 2859, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wisconsin North" },
+  { 2860, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wisconsin Central" },
+  { 2861, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wisconsin South" },
+  { 2862, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wyoming East" },
+  { 2863, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wyoming East Central" },
+  { 2864, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wyoming West Central" },
+  { 2865, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wyoming West" },
+  { 2866, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Puerto Rico and Virgin Is." },
+  { 2867, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Arizona East (ft)" },
+  { 2868, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Arizona Central (ft)" },
+  { 2869, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Arizona West (ft)" },
+  { 2870, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / California zone 1 (ftUS)" },
+  { 2871, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / California zone 2 (ftUS)" },
+  { 2872, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / California zone 3 (ftUS)" },
+  { 2873, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / California zone 4 (ftUS)" },
+  { 2874, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / California zone 5 (ftUS)" },
+  { 2875, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / California zone 6 (ftUS)" },
+  { 2876, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Colorado North (ftUS)" },
+  { 2877, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Colorado Central (ftUS)" },
+  { 2878, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Colorado South (ftUS)" },
+  { 2879, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Connecticut (ftUS)" },
+  { 2880, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Delaware (ftUS)" },
+  { 2881, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Florida East (ftUS)" },
+  { 2882, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Florida West (ftUS)" },
+  { 2883, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Florida North (ftUS)" },
+  { 2884, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Georgia East (ftUS)" },
+  { 2885, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Georgia West (ftUS)" },
+  { 2886, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Idaho East (ftUS)" },
+  { 2887, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Idaho Central (ftUS)" },
+  { 2888, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Idaho West (ftUS)" },
+  { 2889, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Indiana East (ftUS)" },
+  { 2890, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Indiana West (ftUS)" },
+  { 2891, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Kentucky North (ftUS)" },
+  { 2892, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Kentucky South (ftUS)" },
+  { 2893, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Maryland (ftUS)" },
+  { 2894, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Massachusetts Mainland (ftUS)" },
+  { 2895, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Massachusetts Island (ftUS)" },
+  { 2896, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Michigan North (ft)" },
+  { 2897, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Michigan Central (ft)" },
+  { 2898, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Michigan South (ft)" },
+  { 2899, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Mississippi East (ftUS)" },
+  { 2900, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Mississippi West (ftUS)" },
+  { 2901, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Montana (ft)" },
+  { 2902, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New Mexico East (ftUS)" },
+  { 2903, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New Mexico Central (ftUS)" },
+  { 2904, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New Mexico West (ftUS)" },
+  { 2905, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New York East (ftUS)" },
+  { 2906, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New York Central (ftUS)" },
+  { 2907, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New York West (ftUS)" },
+  { 2908, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New York Long Island (ftUS)" },
+  { 2909, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / North Dakota North (ft)" },
+  { 2910, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / North Dakota South (ft)" },
+  { 2911, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Oklahoma North (ftUS)" },
+  { 2912, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Oklahoma South (ftUS)" },
+  { 2913, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Oregon North (ft)" },
+  { 2914, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Oregon South (ft)" },
+  { 2915, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Tennessee (ftUS)" },
+  { 2916, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Texas North (ftUS)" },
+  { 2917, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Texas North Central (ftUS)" },
+  { 2918, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Texas Central (ftUS)" },
+  { 2919, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Texas South Central (ftUS)" },
+  { 2920, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Texas South (ftUS)" },
+  { 2921, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Utah North (ft)" },
+  { 2922, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Utah Central (ft)" },
+  { 2923, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Utah South (ft)" },
+  { 2924, CRS_EPSG_LCC, CRS_EPSG_UNITS_SURVEY_FEET, CRS_ELLIPSOID_NAD83, 0, 5, 0, "NAD83(HARN) / Virginia North (ftUS)" },
+  { 2925, CRS_EPSG_LCC, CRS_EPSG_UNITS_SURVEY_FEET, CRS_ELLIPSOID_NAD83, 0, 6, 0, "NAD83(HARN) / Virginia South (ftUS)" },
+  { 2926, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Washington North (ftUS)" },
+  { 2927, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Washington South (ftUS)" },
+  { 2928, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wisconsin North (ftUS)" },
+  { 2929, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wisconsin Central (ftUS)" },
+  { 2930, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wisconsin South (ftUS)" },
+  { 2931, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beduaram / TM 13 NE" },
+  { 2932, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "QND95 / Qatar National Grid" },
+  { 2933, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Segara / UTM zone 50S" },
+  { 2934, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Segara (Jakarta) / NEIEZ" },
+  { 2935, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / CS63 zone A1" },
+  { 2936, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / CS63 zone A2" },
+  { 2937, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / CS63 zone A3" },
+  { 2938, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / CS63 zone A4" },
+  { 2939, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / CS63 zone K2" },
+  { 2940, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / CS63 zone K3" },
+  { 2941, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / CS63 zone K4" },
+  { 2942, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Porto Santo / UTM zone 28N" },
+  { 2943, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Selvagem Grande / UTM zone 28N" },
+  { 2944, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / SCoPQ zone 2" },
+  { 2945, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 3" },
+  { 2946, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 4" },
+  { 2947, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 5" },
+  { 2948, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 6" },
+  { 2949, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 7" },
+  { 2950, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 8" },
+  { 2951, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 9" },
+  { 2952, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 10" },
+  { 2953, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / New Brunswick Stereographic" },
+  { 2954, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Prince Edward Isl. Stereographic (NAD83)" },
+  { 2955, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 11N" },
+  { 2956, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 12N" },
+  { 2957, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 13N" },
+  { 2958, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 17N" },
+  { 2959, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 18N" },
+  { 2960, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 19N" },
+  { 2961, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 20N" },
+  { 2962, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 21N" },
+  { 2963, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lisbon 1890 (Lisbon) / Portugal Bonne" },
+  { 2964, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Alaska Albers" },
+  { 2965, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Indiana East (ftUS)" },
+  { 2966, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Indiana West (ftUS)" },
+  { 2967, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Indiana East (ftUS)" },
+  { 2968, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Indiana West (ftUS)" },
+  { 2969, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Fort Marigot / UTM zone 20N" },
+  { 2970, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Guadeloupe 1948 / UTM zone 20N" },
+  { 2971, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CSG67 / UTM zone 22N" },
+  { 2972, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 7, 0, "Reseau Geodesique Francais Guyane 1995" },
+  { 2973, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Martinique 1938 / UTM zone 20N" },
+  { 2975, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGR92 / UTM zone 40S" },
+  { 2976, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tahiti 52 / UTM zone 6S" },
+  { 2977, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tahaa 54 / UTM zone 5S" },
+  { 2978, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN72 Nuku Hiva / UTM zone 7S" },
+  { 2979, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "K0 1949 / UTM zone 42S" },
+  { 2980, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Combani 1950 / UTM zone 38S" },
+  { 2981, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN56 Lifou / UTM zone 58S" },
+  { 2982, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN72 Grand Terre / UTM zone 58S" },
+  { 2983, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ST87 Ouvea / UTM zone 58S" },
+  { 2984, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGNC 1991 / Lambert New Caledonia" },
+  { 2985, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Petrels 1972 / Terre Adelie Polar Stereographic" },
+  { 2986, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Perroud 1950 / Terre Adelie Polar Stereographic" },
+  { 2987, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Saint Pierre et Miquelon 1950 / UTM zone 21N" },
+  { 2988, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MOP78 / UTM zone 1S" },
+  { 2989, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RRAF 1991 / UTM zone 20N" },
+  { 2990, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Reunion 1947 / TM Reunion" },
+  { 2991, CRS_EPSG_LCC, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 8, 0, "NAD83 / Oregon Lambert" },
+  { 2992, CRS_EPSG_LCC, CRS_EPSG_UNITS_FEET, CRS_ELLIPSOID_NAD83, 0, 8, 0, "NAD83 / Oregon Lambert (ft)" },
+  { 2993, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Oregon LCC (m)" },
+  { 2994, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Oregon GIC Lambert (ft)" },
+  { 2995, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN53 Mare / UTM zone 58S" },
+  { 2996, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ST84 Ile des Pins / UTM zone 58S" },
+  { 2997, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ST71 Belep / UTM zone 58S" },
+  { 2998, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NEA74 Noumea / UTM zone 58S" },
+  { 2999, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Grand Comoros / UTM zone 38S" },
+  { 3000, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Segara / NEIEZ" },
+  { 3001, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Batavia / NEIEZ" },
+  { 3002, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Makassar / NEIEZ" },
+  { 3003, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Monte Mario / Italy zone 1" },
+  { 3004, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Monte Mario / Italy zone 2" },
+  { 3005, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BC Albers" },
+  { 3006, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 9, 0, "SWEREF99 TM" },
+  { 3007, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 12 00" },
+  { 3008, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 13 30" },
+  { 3009, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 15 00" },
+  { 3010, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 16 30" },
+  { 3011, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 18 00" },
+  { 3012, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 14 15" },
+  { 3013, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 15 45" },
+  { 3014, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 17 15" },
+  { 3015, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 18 45" },
+  { 3016, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 20 15" },
+  { 3017, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 21 45" },
+  { 3018, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 23 15" },
+  { 3019, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT90 7.5 gon V" },
+  { 3020, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT90 5 gon V" },
+  { 3021, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT90 2.5 gon V" },
+  { 3022, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT90 0 gon" },
+  { 3023, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT90 2.5 gon O" },
+  { 3024, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT90 5 gon O" },
+  { 3025, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT38 7.5 gon V" },
+  { 3026, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT38 5 gon V" },
+  { 3027, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT38 2.5 gon V" },
+  { 3028, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT38 0 gon" },
+  { 3029, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT38 2.5 gon O" },
+  { 3030, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT38 5 gon O" },
+  { 3031, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Antarctic Polar Stereographic" },
+  { 3032, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Australian Antarctic Polar Stereographic" },
+  { 3033, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Australian Antarctic Lambert" },
+  { 3034, CRS_EPSG_LCC, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 10, 0, "ETRS89 / ETRS-LCC" },
+  { 3035, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / LAEA Europe" },
+  { 3036, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Moznet / UTM zone 36S" },
+  { 3037, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Moznet / UTM zone 37S" },
+  { 3038, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / TM26" },
+  { 3039, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / TM27" },
+  { 3040, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 28N (N-E)" },
+  { 3041, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 29N (N-E)" },
+  { 3042, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 30N (N-E)" },
+  { 3043, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 31N (N-E)" },
+  { 3044, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 32N (N-E)" },
+  { 3045, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 33N (N-E)" },
+  { 3046, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 11, 0, "ETRS89 / ETRS-TM34" },
+  { 3047, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 12, 0, "ETRS89 / ETRS-TM35" },
+  { 3048, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 13, 0, "ETRS89 / ETRS-TM36" },
+  { 3049, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 37N (N-E)" },
+  { 3050, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / TM38" },
+  { 3051, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / TM39" },
+  { 3052, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Reykjavik 1900 / Lambert 1900" },
+  { 3053, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hjorsey 1955 / Lambert 1955" },
+  { 3054, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hjorsey 1955 / UTM zone 26N" },
+  { 3055, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hjorsey 1955 / UTM zone 27N" },
+  { 3056, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hjorsey 1955 / UTM zone 28N" },
+  { 3057, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ISN93 / Lambert 1993" },
+  { 3058, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Helle 1954 / Jan Mayen Grid" },
+  { 3059, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LKS92 / Latvia TM" },
+  { 3060, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN72 Grande Terre / UTM zone 58S" },
+  { 3061, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Porto Santo 1995 / UTM zone 28N" },
+  { 3062, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Azores Oriental 1995 / UTM zone 26N" },
+  { 3063, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Azores Central 1995 / UTM zone 26N" },
+  { 3064, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGM95 / UTM zone 32N" },
+  { 3065, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGM95 / UTM zone 33N" },
+  { 3066, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / Jordan TM" },
+  { 3067, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 12, 0, "ETRS89 / ETRS-TM35FIN" },
+  { 3068, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / Soldner Berlin" },
+  { 3069, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Wisconsin Transverse Mercator" },
+  { 3070, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Wisconsin Transverse Mercator" },
+  { 3071, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wisconsin Transverse Mercator" },
+  { 3072, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Maine CS2000 East" },
+  { 3073, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Maine CS2000 Central" },
+  { 3074, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Maine CS2000 West" },
+  { 3075, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Maine CS2000 East" },
+  { 3076, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Maine CS2000 Central" },
+  { 3077, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Maine CS2000 West" },
+  { 3078, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Michigan Oblique Mercator" },
+  { 3079, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Michigan Oblique Mercator" },
+  { 3080, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Shackleford" },
+  { 3081, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Texas State Mapping System" },
+  { 3082, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Texas Centric Lambert Conformal" },
+  { 3083, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Texas Centric Albers Equal Area" },
+  { 3084, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Texas Centric Lambert Conformal" },
+  { 3085, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Texas Centric Albers Equal Area" },
+  { 3086, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Florida GDL Albers" },
+  { 3087, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Florida GDL Albers" },
+  { 3088, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Kentucky Single Zone" },
+  { 3089, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Kentucky Single Zone (ftUS)" },
+  { 3090, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Kentucky Single Zone" },
+  { 3091, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Kentucky Single Zone (ftUS)" },
+  { 3092, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / UTM zone 51N" },
+  { 3093, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / UTM zone 52N" },
+  { 3094, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / UTM zone 53N" },
+  { 3095, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / UTM zone 54N" },
+  { 3096, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / UTM zone 55N" },
+  { 3097, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / UTM zone 51N" },
+  { 3098, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / UTM zone 52N" },
+  { 3099, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / UTM zone 53N" },
+  { 3100, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / UTM zone 54N" },
+  { 3101, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 / UTM zone 55N" },
+  { 3102, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "American Samoa 1962 / American Samoa Lambert" },
+  { 3103, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mauritania 1999 / UTM zone 28N" },
+  { 3104, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mauritania 1999 / UTM zone 29N" },
+  { 3105, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mauritania 1999 / UTM zone 30N" },
+  { 3106, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Gulshan 303 / Bangladesh Transverse Mercator" },
+  { 3107, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / SA Lambert" },
+  { 3108, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Guernsey Grid" },
+  { 3109, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Jersey Transverse Mercator" },
+  { 3110, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66 / Vicgrid66" },
+  { 3111, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / Vicgrid94" },
+  { 3112, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / Geoscience Australia Lambert" },
+  { 3113, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / BCSG02" },
+  { 3114, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Colombia Far West zone" },
+  { 3115, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Colombia West zone" },
+  { 3116, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Colombia Bogota zone" },
+  { 3117, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Colombia East Central zone" },
+  { 3118, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Colombia East zone" },
+  { 3119, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Douala 1948 / AEF west" },
+  { 3120, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / Poland zone I" },
+  { 3121, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PRS92 / Philippines zone 1" },
+  { 3122, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PRS92 / Philippines zone 2" },
+  { 3123, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PRS92 / Philippines zone 3" },
+  { 3124, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PRS92 / Philippines zone 4" },
+  { 3125, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PRS92 / Philippines zone 5" },
+  { 3126, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / ETRS-GK19FIN" },
+  { 3127, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / ETRS-GK20FIN" },
+  { 3128, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / ETRS-GK21FIN" },
+  { 3129, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / ETRS-GK22FIN" },
+  { 3130, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / ETRS-GK23FIN" },
+  { 3131, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / ETRS-GK24FIN" },
+  { 3132, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / ETRS-GK25FIN" },
+  { 3133, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / ETRS-GK26FIN" },
+  { 3134, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / ETRS-GK27FIN" },
+  { 3135, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / ETRS-GK28FIN" },
+  { 3136, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / ETRS-GK29FIN" },
+  { 3137, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / ETRS-GK30FIN" },
+  { 3138, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / ETRS-GK31FIN" },
+  { 3139, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Vanua Levu 1915 / Vanua Levu Grid" },
+  { 3140, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Viti Levu 1912 / Viti Levu Grid" },
+  { 3141, CRS_EPSG_UTM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_Inter, -60, -1, 0, "Fiji 1956 / UTM zone 60S" },
+  { 3142, CRS_EPSG_UTM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_Inter, -1, -1, 0, "Fiji 1956 / UTM zone 1S" },
+  { 3143, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Fiji 1986 / Fiji Map Grid" },
+  { 3144, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "FD54 / Faroe Lambert" },
+  { 3145, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Faroe Lambert" },
+  { 3146, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 6" },
+  { 3147, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger CM 18E" },
+  { 3148, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Indian 1960 / UTM zone 48N" },
+  { 3149, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Indian 1960 / UTM zone 49N" },
+  { 3150, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 6" },
+  { 3151, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger CM 18E" },
+  { 3152, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ST74" },
+  { 3153, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / BC Albers" },
+  { 3154, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 7, -1, 0, "NAD83(CSRS) / UTM zone 7N" },
+  { 3155, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 8, -1, 0, "NAD83(CSRS) / UTM zone 8N" },
+  { 3156, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 9, -1, 0, "NAD83(CSRS) / UTM zone 9N" },
+  { 3157, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 10, -1, 0, "NAD83(CSRS) / UTM zone 10N" },
+  { 3158, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 14, -1, 0, "NAD83(CSRS) / UTM zone 14N" },
+  { 3159, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 15, -1, 0, "NAD83(CSRS) / UTM zone 15N" },
+  { 3160, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 16, -1, 0, "NAD83(CSRS) / UTM zone 16N" },
+  { 3161, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Ontario MNR Lambert" },
+  { 3162, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Ontario MNR Lambert" },
+  { 3163, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGNC91-93 / Lambert New Caledonia" },
+  { 3164, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ST87 Ouvea / UTM zone 58S" },
+  { 3165, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NEA74 Noumea / Noumea Lambert" },
+  { 3166, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NEA74 Noumea / Noumea Lambert 2" },
+  { 3167, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau (RSO) / RSO Malaya (ch)" },
+  { 3168, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau (RSO) / RSO Malaya (m)" },
+  { 3169, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGNC91-93 / UTM zone 57S" },
+  { 3170, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGNC91-93 / UTM zone 58S" },
+  { 3171, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGNC91-93 / UTM zone 59S" },
+  { 3172, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN53 Mare / UTM zone 59S" },
+  { 3173, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "fk89 / Faroe Lambert FK89" },
+  { 3174, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Great Lakes Albers" },
+  { 3175, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Great Lakes and St Lawrence Albers" },
+  { 3176, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Indian 1960 / TM 106 NE" },
+  { 3177, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / Libya TM" },
+  { 3178, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / UTM zone 18N" },
+  { 3179, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / UTM zone 19N" },
+  { 3180, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / UTM zone 20N" },
+  { 3181, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / UTM zone 21N" },
+  { 3182, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / UTM zone 22N" },
+  { 3183, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / UTM zone 23N" },
+  { 3184, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / UTM zone 24N" },
+  { 3185, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / UTM zone 25N" },
+  { 3186, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / UTM zone 26N" },
+  { 3187, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / UTM zone 27N" },
+  { 3188, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / UTM zone 28N" },
+  { 3189, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / UTM zone 29N" },
+  { 3190, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / Libya TM zone 5" },
+  { 3191, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / Libya TM zone 6" },
+  { 3192, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / Libya TM zone 7" },
+  { 3193, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / Libya TM zone 8" },
+  { 3194, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / Libya TM zone 9" },
+  { 3195, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / Libya TM zone 10" },
+  { 3196, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / Libya TM zone 11" },
+  { 3197, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / Libya TM zone 12" },
+  { 3198, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / Libya TM zone 13" },
+  { 3199, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / UTM zone 32N" },
+  { 3200, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "FD58 / Iraq zone" },
+  { 3201, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / UTM zone 33N" },
+  { 3202, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / UTM zone 34N" },
+  { 3203, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006 / UTM zone 35N" },
+  { 3204, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SP19-20" },
+  { 3205, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SP21-22" },
+  { 3206, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SP23-24" },
+  { 3207, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ01-02" },
+  { 3208, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ19-20" },
+  { 3209, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ21-22" },
+  { 3210, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ37-38" },
+  { 3211, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ39-40" },
+  { 3212, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ41-42" },
+  { 3213, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ43-44" },
+  { 3214, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ45-46" },
+  { 3215, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ47-48" },
+  { 3216, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ49-50" },
+  { 3217, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ51-52" },
+  { 3218, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ53-54" },
+  { 3219, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ55-56" },
+  { 3220, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SQ57-58" },
+  { 3221, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR13-14" },
+  { 3222, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR15-16" },
+  { 3223, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR17-18" },
+  { 3224, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR19-20" },
+  { 3225, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR27-28" },
+  { 3226, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR29-30" },
+  { 3227, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR31-32" },
+  { 3228, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR33-34" },
+  { 3229, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR35-36" },
+  { 3230, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR37-38" },
+  { 3231, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR39-40" },
+  { 3232, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR41-42" },
+  { 3233, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR43-44" },
+  { 3234, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR45-46" },
+  { 3235, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR47-48" },
+  { 3236, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR49-50" },
+  { 3237, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR51-52" },
+  { 3238, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR53-54" },
+  { 3239, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR55-56" },
+  { 3240, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR57-58" },
+  { 3241, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SR59-60" },
+  { 3242, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS04-06" },
+  { 3243, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS07-09" },
+  { 3244, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS10-12" },
+  { 3245, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS13-15" },
+  { 3246, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS16-18" },
+  { 3247, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS19-21" },
+  { 3248, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS25-27" },
+  { 3249, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS28-30" },
+  { 3250, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS31-33" },
+  { 3251, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS34-36" },
+  { 3252, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS37-39" },
+  { 3253, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS40-42" },
+  { 3254, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS43-45" },
+  { 3255, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS46-48" },
+  { 3256, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS49-51" },
+  { 3257, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS52-54" },
+  { 3258, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS55-57" },
+  { 3259, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SS58-60" },
+  { 3260, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST01-04" },
+  { 3261, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST05-08" },
+  { 3262, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST09-12" },
+  { 3263, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST13-16" },
+  { 3264, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST17-20" },
+  { 3265, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST21-24" },
+  { 3266, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST25-28" },
+  { 3267, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST29-32" },
+  { 3268, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST33-36" },
+  { 3269, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST37-40" },
+  { 3270, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST41-44" },
+  { 3271, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST45-48" },
+  { 3272, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST49-52" },
+  { 3273, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST53-56" },
+  { 3274, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW ST57-60" },
+  { 3275, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SU01-05" },
+  { 3276, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SU06-10" },
+  { 3277, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SU11-15" },
+  { 3278, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SU16-20" },
+  { 3279, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SU21-25" },
+  { 3280, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SU26-30" },
+  { 3281, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SU31-35" },
+  { 3282, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SU36-40" },
+  { 3283, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SU41-45" },
+  { 3284, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SU46-50" },
+  { 3285, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SU51-55" },
+  { 3286, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SU56-60" },
+  { 3287, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SV01-10" },
+  { 3288, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SV11-20" },
+  { 3289, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SV21-30" },
+  { 3290, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SV31-40" },
+  { 3291, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SV41-50" },
+  { 3292, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SV51-60" },
+  { 3293, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / SCAR IMW SW01-60" },
+  { 3294, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / USGS Transantarctic Mountains" },
+  { 3295, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Guam 1963 / Yap Islands" },
+  { 3296, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGPF / UTM zone 5S" },
+  { 3297, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGPF / UTM zone 6S" },
+  { 3298, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGPF / UTM zone 7S" },
+  { 3299, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGPF / UTM zone 8S" },
+  { 3300, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Estonian Coordinate System of 1992" },
+  { 3301, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Estonian Coordinate System of 1997" },
+  { 3302, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN63 Hiva Oa / UTM zone 7S" },
+  { 3303, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Fatu Iva 72 / UTM zone 7S" },
+  { 3304, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tahiti 79 / UTM zone 6S" },
+  { 3305, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Moorea 87 / UTM zone 6S" },
+  { 3306, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Maupiti 83 / UTM zone 5S" },
+  { 3307, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nakhl-e Ghanem / UTM zone 39N" },
+  { 3308, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / NSW Lambert" },
+  { 3309, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / California Albers" },
+  { 3310, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / California Albers" },
+  { 3311, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / California Albers" },
+  { 3312, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CSG67 / UTM zone 21N" },
+  { 3313, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGFG95 / UTM zone 21N" },
+  { 3314, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Katanga 1955 / Katanga Lambert" },
+  { 3315, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Katanga 1955 / Katanga TM" },
+  { 3316, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kasai 1953 / Congo TM zone 22" },
+  { 3317, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kasai 1953 / Congo TM zone 24" },
+  { 3318, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGC 1962 / Congo TM zone 12" },
+  { 3319, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGC 1962 / Congo TM zone 14" },
+  { 3320, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGC 1962 / Congo TM zone 16" },
+  { 3321, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGC 1962 / Congo TM zone 18" },
+  { 3322, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGC 1962 / Congo TM zone 20" },
+  { 3323, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGC 1962 / Congo TM zone 22" },
+  { 3324, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGC 1962 / Congo TM zone 24" },
+  { 3325, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGC 1962 / Congo TM zone 26" },
+  { 3326, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGC 1962 / Congo TM zone 28" },
+  { 3327, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGC 1962 / Congo TM zone 30" },
+  { 3328, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / GUGiK-80" },
+  { 3329, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 5" },
+  { 3330, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 6" },
+  { 3331, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 7" },
+  { 3332, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 8" },
+  { 3333, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / Gauss-Kruger zone 3" },
+  { 3334, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / Gauss-Kruger zone 4" },
+  { 3335, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / Gauss-Kruger zone 5" },
+  { 3336, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN 1962 Kerguelen / UTM zone 42S" },
+  { 3337, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Le Pouce 1934 / Mauritius Grid" },
+  { 3338, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Alaska Albers" },
+  { 3339, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGCB 1955 / Congo TM zone 12" },
+  { 3340, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGCB 1955 / Congo TM zone 14" },
+  { 3341, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGCB 1955 / Congo TM zone 16" },
+  { 3342, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGCB 1955 / UTM zone 33S" },
+  { 3343, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mauritania 1999 / UTM zone 28N" },
+  { 3344, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mauritania 1999 / UTM zone 29N" },
+  { 3345, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mauritania 1999 / UTM zone 30N" },
+  { 3346, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LKS94 / Lithuania TM" },
+  { 3347, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Statistics Canada Lambert" },
+  { 3348, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Statistics Canada Lambert" },
+  { 3349, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / PDC Mercator" },
+  { 3350, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / CS63 zone C0" },
+  { 3351, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / CS63 zone C1" },
+  { 3352, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / CS63 zone C2" },
+  { 3353, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mhast (onshore) / UTM zone 32S" },
+  { 3354, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mhast (offshore) / UTM zone 32S" },
+  { 3355, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Egypt Gulf of Suez S-650 TL / Red Belt" },
+  { 3356, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Grand Cayman 1959 / UTM zone 17N" },
+  { 3357, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Little Cayman 1961 / UTM zone 17N" },
+  { 3358, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / North Carolina" },
+  { 3359, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / North Carolina (ftUS)" },
+  { 3360, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / South Carolina" },
+  { 3361, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / South Carolina (ft)" },
+  { 3362, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Pennsylvania North" },
+  { 3363, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Pennsylvania North (ftUS)" },
+  { 3364, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Pennsylvania South" },
+  { 3365, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Pennsylvania South (ftUS)" },
+  { 3366, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hong Kong 1963 Grid System" },
+  { 3367, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN Astro 1960 / UTM zone 28N" },
+  { 3368, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN Astro 1960 / UTM zone 29N" },
+  { 3369, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN Astro 1960 / UTM zone 30N" },
+  { 3370, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / UTM zone 59N" },
+  { 3371, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / UTM zone 60N" },
+  { 3372, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / UTM zone 59N" },
+  { 3373, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / UTM zone 60N" },
+  { 3374, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "FD54 / UTM zone 29N" },
+  { 3375, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000 / Peninsula RSO" },
+  { 3376, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000 / East Malaysia BRSO" },
+  { 3377, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000 / Johor Grid" },
+  { 3378, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000 / Sembilan and Melaka Grid" },
+  { 3379, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000 / Pahang Grid" },
+  { 3380, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000 / Selangor Grid" },
+  { 3381, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000 / Terengganu Grid" },
+  { 3382, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000 / Pinang Grid" },
+  { 3383, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000 / Kedah and Perlis Grid" },
+  { 3384, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000 / Perak Grid" },
+  { 3385, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000 / Kelantan Grid" },
+  { 3386, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KKJ / Finland zone 0" },
+  { 3387, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KKJ / Finland zone 5" },
+  { 3388, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Caspian Sea Mercator" },
+  { 3389, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / 3-degree Gauss-Kruger zone 60" },
+  { 3390, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / 3-degree Gauss-Kruger zone 60" },
+  { 3391, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Karbala 1979 / UTM zone 37N" },
+  { 3392, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Karbala 1979 / UTM zone 38N" },
+  { 3393, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Karbala 1979 / UTM zone 39N" },
+  { 3394, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nahrwan 1934 / Iraq zone" },
+  { 3395, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / World Mercator" },
+  { 3396, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PD/83 / 3-degree Gauss-Kruger zone 3" },
+  { 3397, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PD/83 / 3-degree Gauss-Kruger zone 4" },
+  { 3398, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RD/83 / 3-degree Gauss-Kruger zone 4" },
+  { 3399, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RD/83 / 3-degree Gauss-Kruger zone 5" },
+  { 3400, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Alberta 10-TM (Forest)" },
+  { 3401, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Alberta 10-TM (Resource)" },
+  { 3402, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Alberta 10-TM (Forest)" },
+  { 3403, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Alberta 10-TM (Resource)" },
+  { 3404, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / North Carolina (ftUS)" },
+  { 3405, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "VN-2000 / UTM zone 48N" },
+  { 3406, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "VN-2000 / UTM zone 49N" },
+  { 3407, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hong Kong 1963 Grid System" },
+  { 3408, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NSIDC EASE-Grid North" },
+  { 3409, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NSIDC EASE-Grid South" },
+  { 3410, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NSIDC EASE-Grid Global" },
+  { 3411, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NSIDC Sea Ice Polar Stereographic North" },
+  { 3412, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NSIDC Sea Ice Polar Stereographic South" },
+  { 3413, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / NSIDC Sea Ice Polar Stereographic North" },
+  { 3414, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SVY21 / Singapore TM" },
+  { 3415, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 72BE / South China Sea Lambert" },
+  { 3416, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Austria Lambert" },
+  { 3417, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Iowa North (ftUS)" },
+  { 3418, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Iowa South (ftUS)" },
+  { 3419, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Kansas North (ftUS)" },
+  { 3420, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Kansas South (ftUS)" },
+  { 3421, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Nevada East (ftUS)" },
+  { 3422, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Nevada Central (ftUS)" },
+  { 3423, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Nevada West (ftUS)" },
+  { 3424, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / New Jersey (ftUS)" },
+  { 3425, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Iowa North (ftUS)" },
+  { 3426, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Iowa South (ftUS)" },
+  { 3427, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Kansas North (ftUS)" },
+  { 3428, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Kansas South (ftUS)" },
+  { 3429, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Nevada East (ftUS)" },
+  { 3430, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Nevada Central (ftUS)" },
+  { 3431, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Nevada West (ftUS)" },
+  { 3432, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New Jersey (ftUS)" },
+  { 3433, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Arkansas North (ftUS)" },
+  { 3434, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Arkansas South (ftUS)" },
+  { 3435, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Illinois East (ftUS)" },
+  { 3436, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Illinois West (ftUS)" },
+  { 3437, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / New Hampshire (ftUS)" },
+  { 3438, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Rhode Island (ftUS)" },
+  { 3439, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PSD93 / UTM zone 39N" },
+  { 3440, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PSD93 / UTM zone 40N" },
+  { 3441, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Arkansas North (ftUS)" },
+  { 3442, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Arkansas South (ftUS)" },
+  { 3443, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Illinois East (ftUS)" },
+  { 3444, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Illinois West (ftUS)" },
+  { 3445, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / New Hampshire (ftUS)" },
+  { 3446, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Rhode Island (ftUS)" },
+  { 3447, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Belgian Lambert 2005" },
+  { 3448, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JAD2001 / Jamaica Metric Grid" },
+  { 3449, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JAD2001 / UTM zone 17N" },
+  { 3450, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JAD2001 / UTM zone 18N" },
+  { 3451, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Louisiana North (ftUS)" },
+  { 3452, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Louisiana South (ftUS)" },
+  { 3453, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Louisiana Offshore (ftUS)" },
+  { 3454, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / South Dakota North (ftUS)" },
+  { 3455, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / South Dakota South (ftUS)" },
+  { 3456, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Louisiana North (ftUS)" },
+  { 3457, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Louisiana South (ftUS)" },
+  { 3458, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / South Dakota North (ftUS)" },
+  { 3459, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / South Dakota South (ftUS)" },
+  { 3460, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_WGS72, 0, 14, 0, "Fiji 1986 / Fiji Map Grid" },
+  { 3461, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dabola 1981 / UTM zone 28N" },
+  { 3462, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dabola 1981 / UTM zone 29N" },
+  { 3463, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Maine CS2000 Central" },
+  { 3464, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Maine CS2000 Central" },
+  { 3465, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Alabama East" },
+  { 3466, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Alabama West" },
+  { 3467, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Alaska Albers" },
+  { 3468, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Alaska zone 1" },
+  { 3469, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Alaska zone 2" },
+  { 3470, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Alaska zone 3" },
+  { 3471, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Alaska zone 4" },
+  { 3472, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Alaska zone 5" },
+  { 3473, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Alaska zone 6" },
+  { 3474, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Alaska zone 7" },
+  { 3475, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Alaska zone 8" },
+  { 3476, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Alaska zone 9" },
+  { 3477, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Alaska zone 10" },
+  { 3478, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Arizona Central" },
+  { 3479, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Arizona Central (ft)" },
+  { 3480, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Arizona East" },
+  { 3481, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Arizona East (ft)" },
+  { 3482, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Arizona West" },
+  { 3483, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Arizona West (ft)" },
+  { 3484, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Arkansas North" },
+  { 3485, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Arkansas North (ftUS)" },
+  { 3486, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Arkansas South" },
+  { 3487, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Arkansas South (ftUS)" },
+  { 3488, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / California Albers" },
+  { 3489, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / California zone 1" },
+  { 3490, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / California zone 1 (ftUS)" },
+  { 3491, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / California zone 2" },
+  { 3492, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / California zone 2 (ftUS)" },
+  { 3493, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / California zone 3" },
+  { 3494, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / California zone 3 (ftUS)" },
+  { 3495, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / California zone 4" },
+  { 3496, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / California zone 4 (ftUS)" },
+  { 3497, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / California zone 5" },
+  { 3498, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / California zone 5 (ftUS)" },
+  { 3499, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / California zone 6" },
+  { 3500, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / California zone 6 (ftUS)" },
+  { 3501, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Colorado Central" },
+  { 3502, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Colorado Central (ftUS)" },
+  { 3503, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Colorado North" },
+  { 3504, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Colorado North (ftUS)" },
+  { 3505, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Colorado South" },
+  { 3506, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Colorado South (ftUS)" },
+  { 3507, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Connecticut" },
+  { 3508, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Connecticut (ftUS)" },
+  { 3509, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Delaware" },
+  { 3510, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Delaware (ftUS)" },
+  { 3511, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Florida East" },
+  { 3512, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Florida East (ftUS)" },
+  { 3513, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Florida GDL Albers" },
+  { 3514, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Florida North" },
+  { 3515, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Florida North (ftUS)" },
+  { 3516, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Florida West" },
+  { 3517, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Florida West (ftUS)" },
+  { 3518, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Georgia East" },
+  { 3519, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Georgia East (ftUS)" },
+  { 3520, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Georgia West" },
+  { 3521, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Georgia West (ftUS)" },
+  { 3522, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Idaho Central" },
+  { 3523, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Idaho Central (ftUS)" },
+  { 3524, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Idaho East" },
+  { 3525, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Idaho East (ftUS)" },
+  { 3526, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Idaho West" },
+  { 3527, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Idaho West (ftUS)" },
+  { 3528, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Illinois East" },
+  { 3529, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Illinois East (ftUS)" },
+  { 3530, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Illinois West" },
+  { 3531, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Illinois West (ftUS)" },
+  { 3532, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Indiana East" },
+  { 3533, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Indiana East (ftUS)" },
+  { 3534, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Indiana West" },
+  { 3535, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Indiana West (ftUS)" },
+  { 3536, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Iowa North" },
+  { 3537, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Iowa North (ftUS)" },
+  { 3538, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Iowa South" },
+  { 3539, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Iowa South (ftUS)" },
+  { 3540, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Kansas North" },
+  { 3541, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Kansas North (ftUS)" },
+  { 3542, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Kansas South" },
+  { 3543, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Kansas South (ftUS)" },
+  { 3544, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Kentucky North" },
+  { 3545, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Kentucky North (ftUS)" },
+  { 3546, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Kentucky Single Zone" },
+  { 3547, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Kentucky Single Zone (ftUS)" },
+  { 3548, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Kentucky South" },
+  { 3549, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Kentucky South (ftUS)" },
+  { 3550, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Louisiana North" },
+  { 3551, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Louisiana North (ftUS)" },
+  { 3552, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Louisiana South" },
+  { 3553, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Louisiana South (ftUS)" },
+  { 3554, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Maine CS2000 Central" },
+  { 3555, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Maine CS2000 East" },
+  { 3556, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Maine CS2000 West" },
+  { 3557, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Maine East" },
+  { 3558, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Maine West" },
+  { 3559, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Maryland" },
+  { 3560, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Utah North (ftUS)" },
+  { 3561, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Old Hawaiian / Hawaii zone 1" },
+  { 3562, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Old Hawaiian / Hawaii zone 2" },
+  { 3563, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Old Hawaiian / Hawaii zone 3" },
+  { 3564, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Old Hawaiian / Hawaii zone 4" },
+  { 3565, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Old Hawaiian / Hawaii zone 5" },
+  { 3566, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Utah Central (ftUS)" },
+  { 3567, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Utah South (ftUS)" },
+  { 3568, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Utah North (ftUS)" },
+  { 3569, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Utah Central (ftUS)" },
+  { 3570, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Utah South (ftUS)" },
+  { 3571, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / North Pole LAEA Bering Sea" },
+  { 3572, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / North Pole LAEA Alaska" },
+  { 3573, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / North Pole LAEA Canada" },
+  { 3574, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / North Pole LAEA Atlantic" },
+  { 3575, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / North Pole LAEA Europe" },
+  { 3576, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / North Pole LAEA Russia" },
+  { 3577, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / Australian Albers" },
+  { 3578, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Yukon Albers" },
+  { 3579, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Yukon Albers" },
+  { 3580, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / NWT Lambert" },
+  { 3581, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / NWT Lambert" },
+  { 3582, CRS_EPSG_LCC, CRS_EPSG_UNITS_SURVEY_FEET, CRS_ELLIPSOID_NAD83, 0, 15, 0, "NAD83(NSRS2007) / Maryland (ftUS)" },
+  { 3583, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Massachusetts Island" },
+  { 3584, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Massachusetts Island (ftUS)" },
+  { 3585, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Massachusetts Mainland" },
+  { 3586, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Massachusetts Mainland (ftUS)" },
+  { 3587, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Michigan Central" },
+  { 3588, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Michigan Central (ft)" },
+  { 3589, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Michigan North" },
+  { 3590, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Michigan North (ft)" },
+  { 3591, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Michigan Oblique Mercator" },
+  { 3592, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Michigan South" },
+  { 3593, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Michigan South (ft)" },
+  { 3594, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Minnesota Central" },
+  { 3595, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Minnesota North" },
+  { 3596, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Minnesota South" },
+  { 3597, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Mississippi East" },
+  { 3598, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Mississippi East (ftUS)" },
+  { 3599, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Mississippi West" },
+  { 3600, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Mississippi West (ftUS)" },
+  { 3601, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Missouri Central" },
+  { 3602, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Missouri East" },
+  { 3603, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Missouri West" },
+  { 3604, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Montana" },
+  { 3605, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Montana (ft)" },
+  { 3606, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Nebraska" },
+  { 3607, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Nevada Central" },
+  { 3608, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Nevada Central (ftUS)" },
+  { 3609, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Nevada East" },
+  { 3610, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Nevada East (ftUS)" },
+  { 3611, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Nevada West" },
+  { 3612, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Nevada West (ftUS)" },
+  { 3613, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New Hampshire" },
+  { 3614, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New Hampshire (ftUS)" },
+  { 3615, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New Jersey" },
+  { 3616, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New Jersey (ftUS)" },
+  { 3617, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New Mexico Central" },
+  { 3618, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New Mexico Central (ftUS)" },
+  { 3619, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New Mexico East" },
+  { 3620, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New Mexico East (ftUS)" },
+  { 3621, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New Mexico West" },
+  { 3622, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New Mexico West (ftUS)" },
+  { 3623, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New York Central" },
+  { 3624, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New York Central (ftUS)" },
+  { 3625, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New York East" },
+  { 3626, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New York East (ftUS)" },
+  { 3627, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New York Long Island" },
+  { 3628, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New York Long Island (ftUS)" },
+  { 3629, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New York West" },
+  { 3630, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / New York West (ftUS)" },
+  { 3631, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / North Carolina" },
+  { 3632, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / North Carolina (ftUS)" },
+  { 3633, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / North Dakota North" },
+  { 3634, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / North Dakota North (ft)" },
+  { 3635, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / North Dakota South" },
+  { 3636, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / North Dakota South (ft)" },
+  { 3637, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Ohio North" },
+  { 3638, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Ohio South" },
+  { 3639, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Oklahoma North" },
+  { 3640, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Oklahoma North (ftUS)" },
+  { 3641, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Oklahoma South" },
+  { 3642, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Oklahoma South (ftUS)" },
+  { 3643, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Oregon LCC (m)" },
+  { 3644, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Oregon GIC Lambert (ft)" },
+  { 3645, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Oregon North" },
+  { 3646, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Oregon North (ft)" },
+  { 3647, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Oregon South" },
+  { 3648, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Oregon South (ft)" },
+  { 3649, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Pennsylvania North" },
+  { 3650, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Pennsylvania North (ftUS)" },
+  { 3651, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Pennsylvania South" },
+  { 3652, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Pennsylvania South (ftUS)" },
+  { 3653, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Rhode Island" },
+  { 3654, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Rhode Island (ftUS)" },
+  { 3655, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / South Carolina" },
+  { 3656, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / South Carolina (ft)" },
+  { 3657, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / South Dakota North" },
+  { 3658, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / South Dakota North (ftUS)" },
+  { 3659, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / South Dakota South" },
+  { 3660, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / South Dakota South (ftUS)" },
+  { 3661, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Tennessee" },
+  { 3662, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Tennessee (ftUS)" },
+  { 3663, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Texas Central" },
+  { 3664, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Texas Central (ftUS)" },
+  { 3665, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Texas Centric Albers Equal Area" },
+  { 3666, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Texas Centric Lambert Conformal" },
+  { 3667, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Texas North" },
+  { 3668, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Texas North (ftUS)" },
+  { 3669, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Texas North Central" },
+  { 3670, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Texas North Central (ftUS)" },
+  { 3671, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Texas South" },
+  { 3672, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Texas South (ftUS)" },
+  { 3673, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Texas South Central" },
+  { 3674, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Texas South Central (ftUS)" },
+  { 3675, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Utah Central" },
+  { 3676, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Utah Central (ft)" },
+  { 3677, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Utah Central (ftUS)" },
+  { 3678, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Utah North" },
+  { 3679, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Utah North (ft)" },
+  { 3680, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Utah North (ftUS)" },
+  { 3681, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Utah South" },
+  { 3682, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Utah South (ft)" },
+  { 3683, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Utah South (ftUS)" },
+  { 3684, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Vermont" },
+  { 3685, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Virginia North" },
+  { 3686, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Virginia North (ftUS)" },
+  { 3687, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Virginia South" },
+  { 3688, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Virginia South (ftUS)" },
+  { 3689, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Washington North" },
+  { 3690, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Washington North (ftUS)" },
+  { 3691, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Washington South" },
+  { 3692, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Washington South (ftUS)" },
+  { 3693, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / West Virginia North" },
+  { 3694, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / West Virginia South" },
+  { 3695, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wisconsin Central" },
+  { 3696, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wisconsin Central (ftUS)" },
+  { 3697, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wisconsin North" },
+  { 3698, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wisconsin North (ftUS)" },
+  { 3699, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wisconsin South" },
+  { 3700, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wisconsin South (ftUS)" },
+  { 3701, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wisconsin Transverse Mercator" },
+  { 3702, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wyoming East" },
+  { 3703, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wyoming East Central" },
+  { 3704, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wyoming West Central" },
+  { 3705, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wyoming West" },
+  { 3706, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 59N" },
+  { 3707, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 60N" },
+  { 3708, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 1N" },
+  { 3709, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 2N" },
+  { 3710, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 3N" },
+  { 3711, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 4N" },
+  { 3712, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 5N" },
+  { 3713, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 6N" },
+  { 3714, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 7N" },
+  { 3715, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 8N" },
+  { 3716, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 9N" },
+  { 3717, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 10N" },
+  { 3718, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 11N" },
+  { 3719, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 12N" },
+  { 3720, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 13N" },
+  { 3721, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 14N" },
+  { 3722, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 15N" },
+  { 3723, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 16N" },
+  { 3724, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 17N" },
+  { 3725, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 18N" },
+  { 3726, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / UTM zone 19N" },
+  { 3727, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Reunion 1947 / TM Reunion" },
+  { 3728, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Ohio North (ftUS)" },
+  { 3729, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Ohio South (ftUS)" },
+  { 3730, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wyoming East (ftUS)" },
+  { 3731, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wyoming East Central (ftUS)" },
+  { 3732, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wyoming West Central (ftUS)" },
+  { 3733, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Wyoming West (ftUS)" },
+  { 3734, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Ohio North (ftUS)" },
+  { 3735, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Ohio South (ftUS)" },
+  { 3736, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Wyoming East (ftUS)" },
+  { 3737, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Wyoming East Central (ftUS)" },
+  { 3738, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Wyoming West Central (ftUS)" },
+  { 3739, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Wyoming West (ftUS)" },
+  { 3740, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / UTM zone 10N" },
+  { 3741, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / UTM zone 11N" },
+  { 3742, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / UTM zone 12N" },
+  { 3743, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / UTM zone 13N" },
+  { 3744, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / UTM zone 14N" },
+  { 3745, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / UTM zone 15N" },
+  { 3746, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / UTM zone 16N" },
+  { 3747, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / UTM zone 17N" },
+  { 3748, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / UTM zone 18N" },
+  { 3749, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / UTM zone 19N" },
+  { 3750, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / UTM zone 4N" },
+  { 3751, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / UTM zone 5N" },
+  { 3752, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Mercator 41" },
+  { 3753, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Ohio North (ftUS)" },
+  { 3754, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Ohio South (ftUS)" },
+  { 3755, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wyoming East (ftUS)" },
+  { 3756, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wyoming East Central (ftUS)" },
+  { 3757, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wyoming West Central (ftUS)" },
+  { 3758, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Wyoming West (ftUS)" },
+  { 3759, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Hawaii zone 3 (ftUS)" },
+  { 3760, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Hawaii zone 3 (ftUS)" },
+  { 3761, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 22N" },
+  { 3762, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / South Georgia Lambert" },
+  { 3763, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Portugal TM06" },
+  { 3764, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Chatham Island Circuit 2000" },
+  { 3765, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HTRS96 / Croatia TM" },
+  { 3766, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HTRS96 / Croatia LCC" },
+  { 3767, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HTRS96 / UTM zone 33N" },
+  { 3768, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HTRS96 / UTM zone 34N" },
+  { 3769, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bermuda 1957 / UTM zone 20N" },
+  { 3770, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "BDA2000 / Bermuda 2000 National Grid" },
+  { 3771, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Alberta 3TM ref merid 111 W" },
+  { 3772, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Alberta 3TM ref merid 114 W" },
+  { 3773, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Alberta 3TM ref merid 117 W" },
+  { 3774, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Alberta 3TM ref merid 120 W" },
+  { 3775, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Alberta 3TM ref merid 111 W" },
+  { 3776, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Alberta 3TM ref merid 114 W" },
+  { 3777, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Alberta 3TM ref merid 117 W" },
+  { 3778, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Alberta 3TM ref merid 120 W" },
+  { 3779, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Alberta 3TM ref merid 111 W" },
+  { 3780, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Alberta 3TM ref merid 114 W" },
+  { 3781, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Alberta 3TM ref merid 117 W" },
+  { 3782, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Alberta 3TM ref merid 120 W" },
+  { 3783, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pitcairn 2006 / Pitcairn TM 2006" },
+  { 3784, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pitcairn 1967 / UTM zone 9S" },
+  { 3785, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Popular Visualisation CRS / Mercator" },
+  { 3786, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "World Equidistant Cylindrical (Sphere)" },
+  { 3787, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Slovene National Grid" },
+  { 3788, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Auckland Islands TM 2000" },
+  { 3789, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Campbell Island TM 2000" },
+  { 3790, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Antipodes Islands TM 2000" },
+  { 3791, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Raoul Island TM 2000" },
+  { 3793, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / Chatham Islands TM 2000" },
+  { 3794, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 16, 0, "Slovenia 1996 / Slovene National Grid" },
+  { 3795, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Cuba Norte" },
+  { 3796, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Cuba Sur" },
+  { 3797, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / MTQ Lambert" },
+  { 3798, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTQ Lambert" },
+  { 3799, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTQ Lambert" },
+  { 3800, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Alberta 3TM ref merid 120 W" },
+  { 3801, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Alberta 3TM ref merid 120 W" },
+  { 3802, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Alberta 3TM ref merid 120 W" },
+  { 3812, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Belgian Lambert 2008" },
+  { 3814, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Mississippi TM" },
+  { 3815, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Mississippi TM" },
+  { 3816, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Mississippi TM" },
+  { 3819, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HD1909" },
+  { 3821, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TWD67" },
+  { 3822, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TWD97" },
+  { 3823, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TWD97" },
+  { 3824, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TWD97" },
+  { 3825, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TWD97 / TM2 zone 119" },
+  { 3826, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TWD97 / TM2 zone 121" },
+  { 3827, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TWD67 / TM2 zone 119" },
+  { 3828, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TWD67 / TM2 zone 121" },
+  { 3829, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hu Tzu Shan 1950 / UTM zone 51N" },
+  { 3832, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / PDC Mercator" },
+  { 3833, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / Gauss-Kruger zone 2" },
+  { 3834, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / Gauss-Kruger zone 2" },
+  { 3835, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / Gauss-Kruger zone 3" },
+  { 3836, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / Gauss-Kruger zone 4" },
+  { 3837, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 3" },
+  { 3838, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 4" },
+  { 3839, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 9" },
+  { 3840, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 10" },
+  { 3841, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 6" },
+  { 3842, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 7" },
+  { 3843, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 8" },
+  { 3844, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / Stereo70" },
+  { 3845, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 / RT90 7.5 gon V emulation" },
+  { 3846, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 / RT90 5 gon V emulation" },
+  { 3847, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 / RT90 2.5 gon V emulation" },
+  { 3848, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 / RT90 0 gon emulation" },
+  { 3849, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 / RT90 2.5 gon O emulation" },
+  { 3850, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 / RT90 5 gon O emulation" },
+  { 3851, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / NZCS2000" },
+  { 3852, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RSRGD2000 / DGLC2000" },
+  { 3854, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "County ST74" },
+  { 3855, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EGM2008 geoid height" },
+  { 3857, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Pseudo-Mercator" },
+  { 3873, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / GK19FIN" },
+  { 3874, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / GK20FIN" },
+  { 3875, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / GK21FIN" },
+  { 3876, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / GK22FIN" },
+  { 3877, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / GK23FIN" },
+  { 3878, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / GK24FIN" },
+  { 3879, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / GK25FIN" },
+  { 3880, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / GK26FIN" },
+  { 3881, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / GK27FIN" },
+  { 3882, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / GK28FIN" },
+  { 3883, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / GK29FIN" },
+  { 3884, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / GK30FIN" },
+  { 3885, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / GK31FIN" },
+  { 3886, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Fao 1979 height" },
+  { 3887, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGRS" },
+  { 3888, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGRS" },
+  { 3889, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGRS" },
+  { 3890, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGRS / UTM zone 37N" },
+  { 3891, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGRS / UTM zone 38N" },
+  { 3892, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGRS / UTM zone 39N" },
+  { 3893, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / Iraq National Grid" },
+  { 3900, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "N2000 height" },
+  { 3901, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KKJ / Finland Uniform Coordinate System + N60 height" },
+  { 3902, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / TM35FIN(N,E) + N60 height" },
+  { 3903, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / TM35FIN(N,E) + N2000 height" },
+  { 3906, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI 1901" },
+  { 3907, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI 1901 / Balkans zone 5" },
+  { 3908, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI 1901 / Balkans zone 6" },
+  { 3909, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI 1901 / Balkans zone 7" },
+  { 3910, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI 1901 / Balkans zone 8" },
+  { 3911, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI 1901 / Slovenia Grid" },
+  { 3912, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, 3, 0, 16, 0, "MGI 1901 / Slovene National Grid" },
+  { 3920, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Puerto Rico / UTM zone 20N" },
+  { 3942, CRS_EPSG_LCC, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 17, 0, "RGF93 / CC42 Reseau_Geodesique_Francais_1993" },
+  { 3943, CRS_EPSG_LCC, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 18, 0, "RGF93 / CC43 Reseau_Geodesique_Francais_1993" },
+  { 3944, CRS_EPSG_LCC, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 19, 0, "RGF93 / CC44 Reseau_Geodesique_Francais_1993" },
+  { 3945, CRS_EPSG_LCC, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 20, 0, "RGF93 / CC45 Reseau_Geodesique_Francais_1993" },
+  { 3946, CRS_EPSG_LCC, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 21, 0, "RGF93 / CC46 Reseau_Geodesique_Francais_1993" },
+  { 3947, CRS_EPSG_LCC, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 22, 0, "RGF93 / CC47 Reseau_Geodesique_Francais_1993" },
+  { 3948, CRS_EPSG_LCC, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 23, 0, "RGF93 / CC48 Reseau_Geodesique_Francais_1993" },
+  { 3949, CRS_EPSG_LCC, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 24, 0, "RGF93 / CC49 Reseau_Geodesique_Francais_1993" },
+  { 3950, CRS_EPSG_LCC, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 25, 0, "RGF93 / CC50 Reseau_Geodesique_Francais_1993" },
+  { 3968, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Virginia Lambert" },
+  { 3969, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Virginia Lambert" },
+  { 3970, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Virginia Lambert" },
+  { 3973, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / NSIDC EASE-Grid North" },
+  { 3974, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / NSIDC EASE-Grid South" },
+  { 3975, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / NSIDC EASE-Grid Global" },
+  { 3976, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / NSIDC Sea Ice Polar Stereographic South" },
+  { 3978, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Canada Atlas Lambert" },
+  { 3979, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Canada Atlas Lambert" },
+  { 3985, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Katanga 1955 / Katanga Lambert" },
+  { 3986, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Katanga 1955 / Katanga Gauss zone A" },
+  { 3987, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Katanga 1955 / Katanga Gauss zone B" },
+  { 3988, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Katanga 1955 / Katanga Gauss zone C" },
+  { 3989, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Katanga 1955 / Katanga Gauss zone D" },
+  { 3991, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Puerto Rico State Plane CS of 1927" },
+  { 3992, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Puerto Rico / St. Croix" },
+  { 3993, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Guam 1963 / Guam SPCS" },
+  { 3994, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Mercator 41" },
+  { 3995, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Arctic Polar Stereographic" },
+  { 3996, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / IBCAO Polar Stereographic" },
+  { 3997, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Dubai Local TM" },
+  { 4000, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MOLDREF99" },
+  { 4001, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Airy 1830 ellipsoid" },
+  { 4002, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Airy Modified 1849 ellipsoid" },
+  { 4003, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Australian National Spheroid" },
+  { 4004, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Bessel 1841 ellipsoid" },
+  { 4005, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Bessel Modified ellipsoid" },
+  { 4006, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Bessel Namibia ellipsoid" },
+  { 4007, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Clarke 1858 ellipsoid" },
+  { 4008, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Clarke 1866 ellipsoid" },
+  { 4009, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Clarke 1866 Michigan ellipsoid" },
+  { 4010, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Clarke 1880 (Benoit) ellipsoid" },
+  { 4011, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Clarke 1880 (IGN) ellipsoid" },
+  { 4012, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Clarke 1880 (RGS) ellipsoid" },
+  { 4013, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Clarke 1880 (Arc) ellipsoid" },
+  { 4014, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Clarke 1880 (SGA 1922) ellipsoid" },
+  { 4015, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Everest 1830 (1937 Adjustment) ellipsoid" },
+  { 4016, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Everest 1830 (1967 Definition) ellipsoid" },
+  { 4017, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MOLDREF99" },
+  { 4018, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Everest 1830 Modified ellipsoid" },
+  { 4019, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the GRS 1980 ellipsoid" },
+  { 4020, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Helmert 1906 ellipsoid" },
+  { 4021, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Indonesian National Spheroid" },
+  { 4022, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the International 1924 ellipsoid" },
+  { 4023, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MOLDREF99" },
+  { 4024, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Krassowsky 1940 ellipsoid" },
+  { 4025, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the NWL 9D ellipsoid" },
+  { 4026, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MOLDREF99 / Moldova TM" },
+  { 4027, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Plessis 1817 ellipsoid" },
+  { 4028, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Struve 1860 ellipsoid" },
+  { 4029, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the War Office ellipsoid" },
+  { 4030, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the WGS 84 ellipsoid" },
+  { 4031, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the GEM 10C ellipsoid" },
+  { 4032, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the OSU86F ellipsoid" },
+  { 4033, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the OSU91A ellipsoid" },
+  { 4034, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Clarke 1880 ellipsoid" },
+  { 4035, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Authalic Sphere" },
+  { 4036, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the GRS 1967 ellipsoid" },
+  { 4037, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / TMzn35N" },
+  { 4038, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / TMzn36N" },
+  { 4039, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005" },
+  { 4040, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005" },
+  { 4041, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Average Terrestrial System 1977 ellipsoid" },
+  { 4042, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Everest (1830 Definition) ellipsoid" },
+  { 4043, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the WGS 72 ellipsoid" },
+  { 4044, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Everest 1830 (1962 Definition) ellipsoid" },
+  { 4045, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unknown datum based upon the Everest 1830 (1975 Definition) ellipsoid" },
+  { 4046, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005" },
+  { 4047, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unspecified datum based upon the GRS 1980 Authalic Sphere" },
+  { 4048, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005 / Congo TM zone 12" },
+  { 4049, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005 / Congo TM zone 14" },
+  { 4050, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005 / Congo TM zone 16" },
+  { 4051, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005 / Congo TM zone 18" },
+  { 4052, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unspecified datum based upon the Clarke 1866 Authalic Sphere" },
+  { 4053, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unspecified datum based upon the International 1924 Authalic Sphere" },
+  { 4054, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Unspecified datum based upon the Hughes 1980 ellipsoid" },
+  { 4055, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Popular Visualisation CRS" },
+  { 4056, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005 / Congo TM zone 20" },
+  { 4057, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005 / Congo TM zone 22" },
+  { 4058, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005 / Congo TM zone 24" },
+  { 4059, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005 / Congo TM zone 26" },
+  { 4060, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005 / Congo TM zone 28" },
+  { 4061, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005 / UTM zone 33S" },
+  { 4062, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005 / UTM zone 34S" },
+  { 4063, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005 / UTM zone 35S" },
+  { 4071, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Chua / UTM zone 23S" },
+  { 4073, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SREF98" },
+  { 4074, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SREF98" },
+  { 4075, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SREF98" },
+  { 4079, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGCAN95" },
+  { 4080, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGCAN95" },
+  { 4081, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGCAN95" },
+  { 4082, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGCAN95 / UTM zone 27N" },
+  { 4083, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGCAN95 / UTM zone 28N" },
+  { 4087, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / World Equidistant Cylindrical" },
+  { 4088, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "World Equidistant Cylindrical (Sphere)" },
+  { 4093, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 26, 0, "ETRS89 / DKTM1" },
+  { 4094, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 27, 0, "ETRS89 / DKTM2" },
+  { 4095, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 28, 0, "ETRS89 / DKTM3" },
+  { 4096, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 29, 0, "ETRS89 / DKTM4" },
+  { 4097, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / DKTM1 + DVR90 height" },
+  { 4098, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / DKTM2 + DVR90 height" },
+  { 4099, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / DKTM3 + DVR90 height" },
+  { 4100, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / DKTM4 + DVR90 height" },
+  { 4120, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Greek" },
+  { 4121, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GGRS87" },
+  { 4122, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ATS77" },
+  { 4123, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KKJ" },
+  { 4124, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT90" },
+  { 4125, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Samboja" },
+  { 4126, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LKS94 (ETRS89)" },
+  { 4127, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tete" },
+  { 4128, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Madzansua" },
+  { 4129, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Observatario" },
+  { 4130, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Moznet" },
+  { 4131, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Indian 1960" },
+  { 4132, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "FD58" },
+  { 4133, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EST92" },
+  { 4134, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PSD93" },
+  { 4135, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Old Hawaiian" },
+  { 4136, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "St. Lawrence Island" },
+  { 4137, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "St. Paul Island" },
+  { 4138, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "St. George Island" },
+  { 4139, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Puerto Rico" },
+  { 4140, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS98)" },
+  { 4141, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Israel 1993" },
+  { 4142, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Locodjo 1965" },
+  { 4143, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Abidjan 1987" },
+  { 4144, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1937" },
+  { 4145, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1962" },
+  { 4146, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1975" },
+  { 4147, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hanoi 1972" },
+  { 4148, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94" },
+  { 4149, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CH1903" },
+  { 4150, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CH1903+" },
+  { 4151, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CHTRF95" },
+  { 4152, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN)" },
+  { 4153, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Rassadiran" },
+  { 4154, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50(ED77)" },
+  { 4155, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dabola 1981" },
+  { 4156, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "S-JTSK" },
+  { 4157, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mount Dillon" },
+  { 4158, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Naparima 1955" },
+  { 4159, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ELD79" },
+  { 4160, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Chos Malal 1914" },
+  { 4161, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pampa del Castillo" },
+  { 4162, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korean 1985" },
+  { 4163, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yemen NGN96" },
+  { 4164, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "South Yemen" },
+  { 4165, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bissau" },
+  { 4166, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korean 1995" },
+  { 4167, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000" },
+  { 4168, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Accra" },
+  { 4169, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "American Samoa 1962" },
+  { 4170, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995" },
+  { 4171, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGF93" },
+  { 4172, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR" },
+  { 4173, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IRENET95" },
+  { 4174, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sierra Leone 1924" },
+  { 4175, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sierra Leone 1968" },
+  { 4176, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Australian Antarctic" },
+  { 4178, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83)" },
+  { 4179, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58)" },
+  { 4180, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EST97" },
+  { 4181, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Luxembourg 1930" },
+  { 4182, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Azores Occidental 1939" },
+  { 4183, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Azores Central 1948" },
+  { 4184, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Azores Oriental 1940" },
+  { 4185, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Madeira 1936" },
+  { 4188, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "OSNI 1952" },
+  { 4189, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGVEN" },
+  { 4190, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 98" },
+  { 4191, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Albanian 1987" },
+  { 4192, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Douala 1948" },
+  { 4193, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Manoca 1962" },
+  { 4194, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq 1927" },
+  { 4195, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Scoresbysund 1952" },
+  { 4196, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ammassalik 1958" },
+  { 4197, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Garoua" },
+  { 4198, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kousseri" },
+  { 4199, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Egypt 1930" },
+  { 4200, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995" },
+  { 4201, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Adindan" },
+  { 4202, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66" },
+  { 4203, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD84" },
+  { 4204, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ain el Abd" },
+  { 4205, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Afgooye" },
+  { 4206, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Agadez" },
+  { 4207, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lisbon" },
+  { 4208, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Aratu" },
+  { 4209, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Arc 1950" },
+  { 4210, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Arc 1960" },
+  { 4211, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Batavia" },
+  { 4212, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Barbados 1938" },
+  { 4213, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beduaram" },
+  { 4214, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954" },
+  { 4215, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Belge 1950" },
+  { 4216, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bermuda 1957" },
+  { 4217, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 59N (ftUS)" },
+  { 4218, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bogota 1975" },
+  { 4219, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bukit Rimpah" },
+  { 4220, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Camacupa" },
+  { 4221, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Campo Inchauspe" },
+  { 4222, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape" },
+  { 4223, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Carthage" },
+  { 4224, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Chua" },
+  { 4225, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Corrego Alegre 1970-72" },
+  { 4226, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cote d'Ivoire" },
+  { 4227, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Deir ez Zor" },
+  { 4228, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Douala" },
+  { 4229, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Egypt 1907" },
+  { 4230, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50" },
+  { 4231, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED87" },
+  { 4232, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Fahud" },
+  { 4233, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Gandajika 1970" },
+  { 4234, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Garoua" },
+  { 4235, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Guyane Francaise" },
+  { 4236, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hu Tzu Shan 1950" },
+  { 4237, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HD72" },
+  { 4238, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ID74" },
+  { 4239, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Indian 1954" },
+  { 4240, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Indian 1975" },
+  { 4241, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Jamaica 1875" },
+  { 4242, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JAD69" },
+  { 4243, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1880" },
+  { 4244, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kandawala" },
+  { 4245, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau 1968" },
+  { 4246, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KOC" },
+  { 4247, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "La Canoa" },
+  { 4248, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PSAD56" },
+  { 4249, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lake" },
+  { 4250, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Leigon" },
+  { 4251, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Liberia 1964" },
+  { 4252, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lome" },
+  { 4253, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Luzon 1911" },
+  { 4254, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hito XVIII 1963" },
+  { 4255, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Herat North" },
+  { 4256, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mahe 1971" },
+  { 4257, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Makassar" },
+  { 4258, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89" },
+  { 4259, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Malongo 1987" },
+  { 4260, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Manoca" },
+  { 4261, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Merchich" },
+  { 4262, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Massawa" },
+  { 4263, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Minna" },
+  { 4264, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mhast" },
+  { 4265, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Monte Mario" },
+  { 4266, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "M'poraloko" },
+  { 4267, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27" },
+  { 4268, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 Michigan" },
+  { 4269, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83" },
+  { 4270, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nahrwan 1967" },
+  { 4271, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Naparima 1972" },
+  { 4272, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49" },
+  { 4273, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGO 1948" },
+  { 4274, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Datum 73" },
+  { 4275, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF" },
+  { 4276, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NSWC 9Z-2" },
+  { 4277, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "OSGB 1936" },
+  { 4278, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "OSGB70" },
+  { 4279, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "OS(SN)80" },
+  { 4280, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Padang" },
+  { 4281, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Palestine 1923" },
+  { 4282, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pointe Noire" },
+  { 4283, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94" },
+  { 4284, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942" },
+  { 4285, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qatar 1974" },
+  { 4286, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qatar 1948" },
+  { 4287, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qornoq" },
+  { 4288, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Loma Quintana" },
+  { 4289, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Amersfoort" },
+  { 4291, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69" },
+  { 4292, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sapper Hill 1943" },
+  { 4293, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Schwarzeck" },
+  { 4294, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Segora" },
+  { 4295, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Serindung" },
+  { 4296, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sudan" },
+  { 4297, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tananarive" },
+  { 4298, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Timbalai 1948" },
+  { 4299, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TM65" },
+  { 4300, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TM75" },
+  { 4301, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo" },
+  { 4302, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Trinidad 1903" },
+  { 4303, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TC(1948)" },
+  { 4304, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Voirol 1875" },
+  { 4306, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bern 1938" },
+  { 4307, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nord Sahara 1959" },
+  { 4308, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT38" },
+  { 4309, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yacare" },
+  { 4310, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yoff" },
+  { 4311, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Zanderij" },
+  { 4312, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI" },
+  { 4313, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Belge 1972" },
+  { 4314, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN" },
+  { 4315, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Conakry 1905" },
+  { 4316, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dealul Piscului 1930" },
+  { 4317, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dealul Piscului 1970" },
+  { 4318, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGN" },
+  { 4319, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KUDAMS" },
+  { 4322, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 72" },
+  { 4324, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 72BE" },
+  { 4326, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84" },
+  { 4327, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 (geographic 3D)" },
+  { 4328, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 (geocentric)" },
+  { 4329, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 (3D)" },
+  { 4330, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF88 (geocentric)" },
+  { 4331, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF89 (geocentric)" },
+  { 4332, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF90 (geocentric)" },
+  { 4333, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF91 (geocentric)" },
+  { 4334, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF92 (geocentric)" },
+  { 4335, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF93 (geocentric)" },
+  { 4336, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF94 (geocentric)" },
+  { 4337, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF96 (geocentric)" },
+  { 4338, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF97 (geocentric)" },
+  { 4339, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Australian Antarctic (3D)" },
+  { 4340, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Australian Antarctic (geocentric)" },
+  { 4341, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EST97 (3D)" },
+  { 4342, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EST97 (geocentric)" },
+  { 4343, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CHTRF95 (3D)" },
+  { 4344, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CHTRF95 (geocentric)" },
+  { 4345, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 (3D)" },
+  { 4346, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 (geocentric)" },
+  { 4347, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 (3D)" },
+  { 4348, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 (geocentric)" },
+  { 4349, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94 (3D)" },
+  { 4350, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94 (geocentric)" },
+  { 4351, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IRENET95 (3D)" },
+  { 4352, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IRENET95 (geocentric)" },
+  { 4353, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 (3D)" },
+  { 4354, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 (geocentric)" },
+  { 4355, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LKS94 (ETRS89) (3D)" },
+  { 4356, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LKS94 (ETRS89) (geocentric)" },
+  { 4357, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Moznet (3D)" },
+  { 4358, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Moznet (geocentric)" },
+  { 4359, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) (3D)" },
+  { 4360, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) (geocentric)" },
+  { 4361, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) (3D)" },
+  { 4362, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) (geocentric)" },
+  { 4363, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 (3D)" },
+  { 4364, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 (geocentric)" },
+  { 4365, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 98 (3D)" },
+  { 4366, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 98 (geocentric)" },
+  { 4367, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGVEN (3D)" },
+  { 4368, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGVEN (geocentric)" },
+  { 4369, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGF93 (3D)" },
+  { 4370, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGF93 (geocentric)" },
+  { 4371, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGFG95 (3D)" },
+  { 4372, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGFG95 (geocentric)" },
+  { 4373, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGR92 (3D)" },
+  { 4374, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGR92 (geocentric)" },
+  { 4375, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS (3D)" },
+  { 4376, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS (geocentric)" },
+  { 4377, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 (3D)" },
+  { 4378, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 (geocentric)" },
+  { 4379, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yemen NGN96 (3D)" },
+  { 4380, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yemen NGN96 (geocentric)" },
+  { 4381, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGNC 1991 (3D)" },
+  { 4382, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGNC 1991 (geocentric)" },
+  { 4383, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RRAF 1991 (3D)" },
+  { 4384, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RRAF 1991 (geocentric)" },
+  { 4385, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF2000 (geocentric)" },
+  { 4386, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ISN93 (3D)" },
+  { 4387, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ISN93 (geocentric)" },
+  { 4388, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LKS92 (3D)" },
+  { 4389, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LKS92 (geocentric)" },
+  { 4390, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau 1968 / Johor Grid" },
+  { 4391, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau 1968 / Sembilan and Melaka Grid" },
+  { 4392, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau 1968 / Pahang Grid" },
+  { 4393, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau 1968 / Selangor Grid" },
+  { 4394, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau 1968 / Terengganu Grid" },
+  { 4395, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau 1968 / Pinang Grid" },
+  { 4396, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau 1968 / Kedah and Perlis Grid" },
+  { 4397, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau 1968 / Perak Revised Grid" },
+  { 4398, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau 1968 / Kelantan Grid" },
+  { 4399, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 59N (ftUS)" },
+  { 4400, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 60N (ftUS)" },
+  { 4401, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 1N (ftUS)" },
+  { 4402, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 2N (ftUS)" },
+  { 4403, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 3N (ftUS)" },
+  { 4404, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 4N (ftUS)" },
+  { 4405, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 5N (ftUS)" },
+  { 4406, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 6N (ftUS)" },
+  { 4407, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 7N (ftUS)" },
+  { 4408, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 8N (ftUS)" },
+  { 4409, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 9N (ftUS)" },
+  { 4410, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 10N (ftUS)" },
+  { 4411, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 11N (ftUS)" },
+  { 4412, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 12N (ftUS)" },
+  { 4413, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 13N (ftUS)" },
+  { 4414, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Guam Map Grid" },
+  { 4415, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Katanga 1955 / Katanga Lambert" },
+  { 4417, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 7" },
+  { 4418, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 18N (ftUS)" },
+  { 4419, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 19N (ftUS)" },
+  { 4420, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 60N (ftUS)" },
+  { 4421, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 1N (ftUS)" },
+  { 4422, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 2N (ftUS)" },
+  { 4423, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 3N (ftUS)" },
+  { 4424, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 4N (ftUS)" },
+  { 4425, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 5N (ftUS)" },
+  { 4426, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 6N (ftUS)" },
+  { 4427, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 7N (ftUS)" },
+  { 4428, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 8N (ftUS)" },
+  { 4429, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 9N (ftUS)" },
+  { 4430, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 10N (ftUS)" },
+  { 4431, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 11N (ftUS)" },
+  { 4432, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 12N (ftUS)" },
+  { 4433, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 13N (ftUS)" },
+  { 4434, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 8" },
+  { 4437, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Puerto Rico and Virgin Is." },
+  { 4438, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 18N (ftUS)" },
+  { 4439, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 19N (ftUS)" },
+  { 4440, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZVD2009 height" },
+  { 4455, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Pennsylvania South" },
+  { 4456, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / New York Long Island" },
+  { 4457, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / South Dakota North (ftUS)" },
+  { 4458, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dunedin-Bluff 1960 height" },
+  { 4462, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Australian Centre for Remote Sensing Lambert" },
+  { 4463, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGSPM06" },
+  { 4465, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGSPM06" },
+  { 4466, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGSPM06" },
+  { 4467, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGSPM06 / UTM zone 21N" },
+  { 4468, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGM04" },
+  { 4469, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGM04" },
+  { 4470, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGM04" },
+  { 4471, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGM04 / UTM zone 38S" },
+  { 4472, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cadastre 1997" },
+  { 4473, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cadastre 1997" },
+  { 4474, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cadastre 1997 / UTM zone 38S" },
+  { 4475, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cadastre 1997" },
+  { 4479, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "China Geodetic Coordinate System 2000" },
+  { 4480, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "China Geodetic Coordinate System 2000" },
+  { 4481, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF92" },
+  { 4482, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF92" },
+  { 4483, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF92" },
+  { 4484, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF92 / UTM zone 11N" },
+  { 4485, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF92 / UTM zone 12N" },
+  { 4486, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF92 / UTM zone 13N" },
+  { 4487, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF92 / UTM zone 14N" },
+  { 4488, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF92 / UTM zone 15N" },
+  { 4489, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF92 / UTM zone 16N" },
+  { 4490, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "China Geodetic Coordinate System 2000" },
+  { 4491, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger zone 13" },
+  { 4492, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger zone 14" },
+  { 4493, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger zone 15" },
+  { 4494, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger zone 16" },
+  { 4495, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger zone 17" },
+  { 4496, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger zone 18" },
+  { 4497, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger zone 19" },
+  { 4498, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger zone 20" },
+  { 4499, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger zone 21" },
+  { 4500, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger zone 22" },
+  { 4501, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger zone 23" },
+  { 4502, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger CM 75E" },
+  { 4503, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger CM 81E" },
+  { 4504, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger CM 87E" },
+  { 4505, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger CM 93E" },
+  { 4506, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger CM 99E" },
+  { 4507, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger CM 105E" },
+  { 4508, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger CM 111E" },
+  { 4509, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger CM 117E" },
+  { 4510, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger CM 123E" },
+  { 4511, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger CM 129E" },
+  { 4512, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / Gauss-Kruger CM 135E" },
+  { 4513, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 25" },
+  { 4514, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 26" },
+  { 4515, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 27" },
+  { 4516, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 28" },
+  { 4517, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 29" },
+  { 4518, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 30" },
+  { 4519, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 31" },
+  { 4520, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 32" },
+  { 4521, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 33" },
+  { 4522, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 34" },
+  { 4523, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 35" },
+  { 4524, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 36" },
+  { 4525, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 37" },
+  { 4526, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 38" },
+  { 4527, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 39" },
+  { 4528, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 40" },
+  { 4529, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 41" },
+  { 4530, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 42" },
+  { 4531, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 43" },
+  { 4532, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 44" },
+  { 4533, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger zone 45" },
+  { 4534, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 75E" },
+  { 4535, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 78E" },
+  { 4536, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 81E" },
+  { 4537, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 84E" },
+  { 4538, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 87E" },
+  { 4539, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 90E" },
+  { 4540, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 93E" },
+  { 4541, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 96E" },
+  { 4542, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 99E" },
+  { 4543, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 102E" },
+  { 4544, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 105E" },
+  { 4545, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 108E" },
+  { 4546, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 111E" },
+  { 4547, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 114E" },
+  { 4548, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 117E" },
+  { 4549, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 120E" },
+  { 4550, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 123E" },
+  { 4551, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 126E" },
+  { 4552, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 129E" },
+  { 4553, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 132E" },
+  { 4554, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGCS2000 / 3-degree Gauss-Kruger CM 135E" },
+  { 4555, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing" },
+  { 4556, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RRAF 1991" },
+  { 4557, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RRAF 1991" },
+  { 4558, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RRAF 1991" },
+  { 4559, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RRAF 1991 / UTM zone 20N" },
+  { 4568, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger zone 13" },
+  { 4569, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger zone 14" },
+  { 4570, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger zone 15" },
+  { 4571, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger zone 16" },
+  { 4572, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger zone 17" },
+  { 4573, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger zone 18" },
+  { 4574, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger zone 19" },
+  { 4575, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger zone 20" },
+  { 4576, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger zone 21" },
+  { 4577, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger zone 22" },
+  { 4578, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger zone 23" },
+  { 4579, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger CM 75E" },
+  { 4580, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger CM 81E" },
+  { 4581, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger CM 87E" },
+  { 4582, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger CM 93E" },
+  { 4583, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger CM 99E" },
+  { 4584, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger CM 105E" },
+  { 4585, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger CM 111E" },
+  { 4586, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger CM 117E" },
+  { 4587, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger CM 123E" },
+  { 4588, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger CM 129E" },
+  { 4589, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / Gauss-Kruger CM 135E" },
+  { 4600, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Anguilla 1957" },
+  { 4601, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Antigua 1943" },
+  { 4602, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dominica 1945" },
+  { 4603, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Grenada 1953" },
+  { 4604, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Montserrat 1958" },
+  { 4605, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "St. Kitts 1955" },
+  { 4606, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "St. Lucia 1955" },
+  { 4607, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "St. Vincent 1945" },
+  { 4608, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(76)" },
+  { 4609, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27(CGQ77)" },
+  { 4610, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Xian 1980" },
+  { 4611, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hong Kong 1980" },
+  { 4612, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000" },
+  { 4613, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Segara" },
+  { 4614, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "QND95" },
+  { 4615, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Porto Santo" },
+  { 4616, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Selvagem Grande" },
+  { 4617, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS)" },
+  { 4618, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69" },
+  { 4619, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99" },
+  { 4620, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Point 58" },
+  { 4621, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Fort Marigot" },
+  { 4622, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Guadeloupe 1948" },
+  { 4623, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CSG67" },
+  { 4624, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGFG95" },
+  { 4625, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Martinique 1938" },
+  { 4626, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Reunion 1947" },
+  { 4627, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGR92" },
+  { 4628, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tahiti 52" },
+  { 4629, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tahaa 54" },
+  { 4630, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN72 Nuku Hiva" },
+  { 4631, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "K0 1949" },
+  { 4632, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Combani 1950" },
+  { 4633, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN56 Lifou" },
+  { 4634, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN72 Grand Terre" },
+  { 4635, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ST87 Ouvea" },
+  { 4636, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Petrels 1972" },
+  { 4637, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Perroud 1950" },
+  { 4638, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Saint Pierre et Miquelon 1950" },
+  { 4639, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MOP78" },
+  { 4640, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RRAF 1991" },
+  { 4641, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN53 Mare" },
+  { 4642, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ST84 Ile des Pins" },
+  { 4643, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ST71 Belep" },
+  { 4644, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NEA74 Noumea" },
+  { 4645, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGNC 1991" },
+  { 4646, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Grand Comoros" },
+  { 4647, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 30, 0, "ETRS89 / UTM zone 32N (zE-N)" },
+  { 4652, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 25" },
+  { 4653, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 26" },
+  { 4654, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 27" },
+  { 4655, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 28" },
+  { 4656, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 29" },
+  { 4657, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Reykjavik 1900" },
+  { 4658, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hjorsey 1955" },
+  { 4659, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ISN93" },
+  { 4660, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Helle 1954" },
+  { 4661, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LKS92" },
+  { 4662, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN72 Grande Terre" },
+  { 4663, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Porto Santo 1995" },
+  { 4664, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Azores Oriental 1995" },
+  { 4665, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Azores Central 1995" },
+  { 4666, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lisbon 1890" },
+  { 4667, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IKBD-92" },
+  { 4668, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED79" },
+  { 4669, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LKS94" },
+  { 4670, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGM95" },
+  { 4671, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Voirol 1879" },
+  { 4672, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Chatham Islands 1971" },
+  { 4673, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Chatham Islands 1979" },
+  { 4674, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000" },
+  { 4675, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Guam 1963" },
+  { 4676, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Vientiane 1982" },
+  { 4677, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lao 1993" },
+  { 4678, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lao 1997" },
+  { 4679, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Jouik 1961" },
+  { 4680, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nouakchott 1965" },
+  { 4681, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mauritania 1999" },
+  { 4682, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Gulshan 303" },
+  { 4683, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PRS92" },
+  { 4684, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Gan 1970" },
+  { 4685, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Gandajika" },
+  { 4686, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS" },
+  { 4687, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGPF" },
+  { 4688, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Fatu Iva 72" },
+  { 4689, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN63 Hiva Oa" },
+  { 4690, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tahiti 79" },
+  { 4691, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Moorea 87" },
+  { 4692, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Maupiti 83" },
+  { 4693, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nakhl-e Ghanem" },
+  { 4694, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 94" },
+  { 4695, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Katanga 1955" },
+  { 4696, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kasai 1953" },
+  { 4697, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGC 1962 6th Parallel South" },
+  { 4698, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN 1962 Kerguelen" },
+  { 4699, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Le Pouce 1934" },
+  { 4700, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN Astro 1960" },
+  { 4701, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGCB 1955" },
+  { 4702, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mauritania 1999" },
+  { 4703, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mhast 1951" },
+  { 4704, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mhast (onshore)" },
+  { 4705, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mhast (offshore)" },
+  { 4706, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Egypt Gulf of Suez S-650 TL" },
+  { 4707, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tern Island 1961" },
+  { 4708, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cocos Islands 1965" },
+  { 4709, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Iwo Jima 1945" },
+  { 4710, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "St. Helena 1971" },
+  { 4711, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Marcus Island 1952" },
+  { 4712, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ascension Island 1958" },
+  { 4713, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ayabelle Lighthouse" },
+  { 4714, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bellevue" },
+  { 4715, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Camp Area Astro" },
+  { 4716, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Phoenix Islands 1966" },
+  { 4717, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape Canaveral" },
+  { 4718, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Solomon 1968" },
+  { 4719, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Easter Island 1967" },
+  { 4720, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Fiji 1986" },
+  { 4721, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Fiji 1956" },
+  { 4722, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "South Georgia 1968" },
+  { 4723, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GCGD59" },
+  { 4724, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Diego Garcia 1969" },
+  { 4725, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Johnston Island 1961" },
+  { 4726, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIGD61" },
+  { 4727, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Midway 1961" },
+  { 4728, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pico de las Nieves 1984" },
+  { 4729, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pitcairn 1967" },
+  { 4730, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Santo 1965" },
+  { 4731, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Viti Levu 1916" },
+  { 4732, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Marshall Islands 1960" },
+  { 4733, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Wake Island 1952" },
+  { 4734, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tristan 1968" },
+  { 4735, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kusaie 1951" },
+  { 4736, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Deception Island" },
+  { 4737, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korea 2000" },
+  { 4738, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hong Kong 1963" },
+  { 4739, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hong Kong 1963(67)" },
+  { 4740, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PZ-90" },
+  { 4741, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "FD54" },
+  { 4742, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000" },
+  { 4743, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Karbala 1979" },
+  { 4744, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nahrwan 1934" },
+  { 4745, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RD/83" },
+  { 4746, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PD/83" },
+  { 4747, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96" },
+  { 4748, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Vanua Levu 1915" },
+  { 4749, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGNC91-93" },
+  { 4750, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ST87 Ouvea" },
+  { 4751, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau (RSO)" },
+  { 4752, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Viti Levu 1912" },
+  { 4753, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "fk89" },
+  { 4754, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006" },
+  { 4755, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95" },
+  { 4756, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "VN-2000" },
+  { 4757, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SVY21" },
+  { 4758, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JAD2001" },
+  { 4759, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007)" },
+  { 4760, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 66" },
+  { 4761, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HTRS96" },
+  { 4762, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "BDA2000" },
+  { 4763, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pitcairn 2006" },
+  { 4764, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RSRGD2000" },
+  { 4765, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Slovenia 1996" },
+  { 4766, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 30" },
+  { 4767, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 31" },
+  { 4768, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 32" },
+  { 4769, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 33" },
+  { 4770, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 34" },
+  { 4771, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 35" },
+  { 4772, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 36" },
+  { 4773, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 37" },
+  { 4774, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 38" },
+  { 4775, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 39" },
+  { 4776, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 40" },
+  { 4777, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 41" },
+  { 4778, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 42" },
+  { 4779, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 43" },
+  { 4780, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 44" },
+  { 4781, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger zone 45" },
+  { 4782, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 75E" },
+  { 4783, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 78E" },
+  { 4784, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 81E" },
+  { 4785, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 84E" },
+  { 4786, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 87E" },
+  { 4787, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 90E" },
+  { 4788, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 93E" },
+  { 4789, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 96E" },
+  { 4790, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 99E" },
+  { 4791, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 102E" },
+  { 4792, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 105E" },
+  { 4793, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 108E" },
+  { 4794, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 111E" },
+  { 4795, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 114E" },
+  { 4796, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 117E" },
+  { 4797, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 120E" },
+  { 4798, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 123E" },
+  { 4799, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 126E" },
+  { 4800, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 129E" },
+  { 4801, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bern 1898 (Bern)" },
+  { 4802, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bogota 1975 (Bogota)" },
+  { 4803, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lisbon (Lisbon)" },
+  { 4804, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Makassar (Jakarta)" },
+  { 4805, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI (Ferro)" },
+  { 4806, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Monte Mario (Rome)" },
+  { 4807, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris)" },
+  { 4808, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Padang (Jakarta)" },
+  { 4809, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Belge 1950 (Brussels)" },
+  { 4810, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tananarive (Paris)" },
+  { 4811, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Voirol 1875 (Paris)" },
+  { 4812, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 132E" },
+  { 4813, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Batavia (Jakarta)" },
+  { 4814, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT38 (Stockholm)" },
+  { 4815, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Greek (Athens)" },
+  { 4816, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Carthage (Paris)" },
+  { 4817, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGO 1948 (Oslo)" },
+  { 4818, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "S-JTSK (Ferro)" },
+  { 4819, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nord Sahara 1959 (Paris)" },
+  { 4820, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Segara (Jakarta)" },
+  { 4821, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Voirol 1879 (Paris)" },
+  { 4822, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "New Beijing / 3-degree Gauss-Kruger CM 135E" },
+  { 4823, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sao Tome" },
+  { 4824, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Principe" },
+  { 4826, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Cape Verde National" },
+  { 4839, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / LCC Germany (N-E)" },
+  { 4855, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 5" },
+  { 4856, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 6" },
+  { 4857, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 7" },
+  { 4858, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 8" },
+  { 4859, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 9" },
+  { 4860, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 10" },
+  { 4861, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 11" },
+  { 4862, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 12" },
+  { 4863, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 13" },
+  { 4864, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 14" },
+  { 4865, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 15" },
+  { 4866, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 16" },
+  { 4867, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 17" },
+  { 4868, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 18" },
+  { 4869, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 19" },
+  { 4870, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 20" },
+  { 4871, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 21" },
+  { 4872, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 22" },
+  { 4873, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 23" },
+  { 4874, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 24" },
+  { 4875, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 25" },
+  { 4876, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 26" },
+  { 4877, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 27" },
+  { 4878, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 28" },
+  { 4879, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 29" },
+  { 4880, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 30" },
+  { 4882, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Slovenia 1996" },
+  { 4883, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Slovenia 1996" },
+  { 4884, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RSRGD2000" },
+  { 4885, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RSRGD2000" },
+  { 4886, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "BDA2000" },
+  { 4887, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "BDA2000" },
+  { 4888, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HTRS96" },
+  { 4889, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HTRS96" },
+  { 4890, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 66" },
+  { 4891, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 66" },
+  { 4892, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007)" },
+  { 4893, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007)" },
+  { 4894, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JAD2001" },
+  { 4895, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JAD2001" },
+  { 4896, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF2005" },
+  { 4897, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95" },
+  { 4898, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95" },
+  { 4899, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006" },
+  { 4900, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LGD2006" },
+  { 4901, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ATF (Paris)" },
+  { 4902, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NDG (Paris)" },
+  { 4903, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Madrid 1870 (Madrid)" },
+  { 4904, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lisbon 1890 (Lisbon)" },
+  { 4906, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGNC91-93" },
+  { 4907, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGNC91-93" },
+  { 4908, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96" },
+  { 4909, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96" },
+  { 4910, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF88" },
+  { 4911, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF89" },
+  { 4912, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF90" },
+  { 4913, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF91" },
+  { 4914, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF92" },
+  { 4915, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF93" },
+  { 4916, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF94" },
+  { 4917, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF96" },
+  { 4918, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF97" },
+  { 4919, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF2000" },
+  { 4920, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000" },
+  { 4921, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDM2000" },
+  { 4922, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PZ-90" },
+  { 4923, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PZ-90" },
+  { 4924, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mauritania 1999" },
+  { 4925, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mauritania 1999" },
+  { 4926, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korea 2000" },
+  { 4927, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korea 2000" },
+  { 4928, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 94" },
+  { 4929, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 94" },
+  { 4930, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Australian Antarctic" },
+  { 4931, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Australian Antarctic" },
+  { 4932, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CHTRF95" },
+  { 4933, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CHTRF95" },
+  { 4934, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EST97" },
+  { 4935, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EST97" },
+  { 4936, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89" },
+  { 4937, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89" },
+  { 4938, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94" },
+  { 4939, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94" },
+  { 4940, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94" },
+  { 4941, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hartebeesthoek94" },
+  { 4942, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IRENET95" },
+  { 4943, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IRENET95" },
+  { 4944, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ISN93" },
+  { 4945, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ISN93" },
+  { 4946, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000" },
+  { 4947, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000" },
+  { 4948, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LKS92" },
+  { 4949, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LKS92" },
+  { 4950, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LKS94" },
+  { 4951, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LKS94" },
+  { 4952, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Moznet" },
+  { 4953, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Moznet" },
+  { 4954, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS)" },
+  { 4955, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS)" },
+  { 4956, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN)" },
+  { 4957, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN)" },
+  { 4958, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000" },
+  { 4959, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000" },
+  { 4960, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 98" },
+  { 4961, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 98" },
+  { 4962, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGVEN" },
+  { 4963, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGVEN" },
+  { 4964, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGF93" },
+  { 4965, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGF93" },
+  { 4966, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGFG95" },
+  { 4967, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGFG95" },
+  { 4968, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGNC 1991" },
+  { 4969, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGNC 1991" },
+  { 4970, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGR92" },
+  { 4971, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGR92" },
+  { 4972, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RRAF 1991" },
+  { 4973, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RRAF 1991" },
+  { 4974, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995" },
+  { 4975, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995" },
+  { 4976, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99" },
+  { 4977, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99" },
+  { 4978, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84" },
+  { 4979, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84" },
+  { 4980, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yemen NGN96" },
+  { 4981, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yemen NGN96" },
+  { 4982, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGM95" },
+  { 4983, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGM95" },
+  { 4984, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 72" },
+  { 4985, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 72" },
+  { 4986, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 72BE" },
+  { 4987, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 72BE" },
+  { 4988, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000" },
+  { 4989, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000" },
+  { 4990, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lao 1993" },
+  { 4991, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lao 1993" },
+  { 4992, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lao 1997" },
+  { 4993, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lao 1997" },
+  { 4994, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PRS92" },
+  { 4995, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PRS92" },
+  { 4996, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS" },
+  { 4997, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS" },
+  { 4998, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGPF" },
+  { 4999, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGPF" },
+  { 5011, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PTRA08" },
+  { 5012, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PTRA08" },
+  { 5013, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PTRA08" },
+  { 5014, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PTRA08 / UTM zone 25N" },
+  { 5015, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PTRA08 / UTM zone 26N" },
+  { 5016, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PTRA08 / UTM zone 28N" },
+  { 5017, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lisbon 1890 / Portugal Bonne New" },
+  { 5018, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lisbon / Portuguese Grid New" },
+  { 5041, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / UPS North (E,N)" },
+  { 5042, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / UPS South (E,N)" },
+  { 5048, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / TM35FIN(N,E)" },
+  { 5069, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Conus Albers" },
+  { 5070, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Conus Albers" },
+  { 5071, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Conus Albers" },
+  { 5072, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Conus Albers" },
+  { 5105, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 31, 0, "ETRS89 / NTM zone 5" },
+  { 5106, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 32, 0, "ETRS89 / NTM zone 6" },
+  { 5107, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 33, 0, "ETRS89 / NTM zone 7" },
+  { 5108, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 34, 0, "ETRS89 / NTM zone 8" },
+  { 5109, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 35, 0, "ETRS89 / NTM zone 9" },
+  { 5110, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 36, 0, "ETRS89 / NTM zone 10" },
+  { 5111, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 37, 0, "ETRS89 / NTM zone 11" },
+  { 5112, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 38, 0, "ETRS89 / NTM zone 12" },
+  { 5113, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 39, 0, "ETRS89 / NTM zone 13" },
+  { 5114, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 40, 0, "ETRS89 / NTM zone 14" },
+  { 5115, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 41, 0, "ETRS89 / NTM zone 15" },
+  { 5116, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 42, 0, "ETRS89 / NTM zone 16" },
+  { 5117, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 43, 0, "ETRS89 / NTM zone 17" },
+  { 5118, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 44, 0, "ETRS89 / NTM zone 18" },
+  { 5119, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 45, 0, "ETRS89 / NTM zone 19" },
+  { 5120, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 46, 0, "ETRS89 / NTM zone 20" },
+  { 5121, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 47, 0, "ETRS89 / NTM zone 21" },
+  { 5122, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 48, 0, "ETRS89 / NTM zone 22" },
+  { 5123, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 49, 0, "ETRS89 / NTM zone 23" },
+  { 5124, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 50, 0, "ETRS89 / NTM zone 24" },
+  { 5125, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 51, 0, "ETRS89 / NTM zone 25" },
+  { 5126, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 52, 0, "ETRS89 / NTM zone 26" },
+  { 5127, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 53, 0, "ETRS89 / NTM zone 27" },
+  { 5128, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 54, 0, "ETRS89 / NTM zone 28" },
+  { 5129, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 55, 0, "ETRS89 / NTM zone 29" },
+  { 5130, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 56, 0, "ETRS89 / NTM zone 30" },
+  { 5132, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo 1892" },
+  { 5167, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korean 1985 / East Sea Belt" },
+  { 5168, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korean 1985 / Central Belt Jeju" },
+  { 5169, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo 1892 / Korea West Belt" },
+  { 5170, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo 1892 / Korea Central Belt" },
+  { 5171, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo 1892 / Korea East Belt" },
+  { 5172, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo 1892 / Korea East Sea Belt" },
+  { 5173, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korean 1985 / Modified West Belt" },
+  { 5174, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korean 1985 / Modified Central Belt" },
+  { 5175, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korean 1985 / Modified Central Belt Jeju" },
+  { 5176, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korean 1985 / Modified East Belt" },
+  { 5177, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korean 1985 / Modified East Sea Belt" },
+  { 5178, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korean 1985 / Unified CS" },
+  { 5179, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korea 2000 / Unified CS" },
+  { 5180, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korea 2000 / West Belt" },
+  { 5181, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korea 2000 / Central Belt" },
+  { 5182, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korea 2000 / Central Belt Jeju" },
+  { 5183, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korea 2000 / East Belt" },
+  { 5184, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korea 2000 / East Sea Belt" },
+  { 5185, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korea 2000 / West Belt 2010" },
+  { 5186, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korea 2000 / Central Belt 2010" },
+  { 5187, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korea 2000 / East Belt 2010" },
+  { 5188, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Korea 2000 / East Sea Belt 2010" },
+  { 5193, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Incheon height" },
+  { 5195, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Trieste height" },
+  { 5214, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Genoa height" },
+  { 5221, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "S-JTSK (Ferro) / Krovak East North" },
+  { 5223, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Gabon TM" },
+  { 5224, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "S-JTSK/05 (Ferro) / Modified Krovak" },
+  { 5225, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "S-JTSK/05 (Ferro) / Modified Krovak East North" },
+  { 5228, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "S-JTSK/05" },
+  { 5229, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "S-JTSK/05 (Ferro)" },
+  { 5233, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SLD99" },
+  { 5234, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kandawala / Sri Lanka Grid" },
+  { 5235, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SLD99 / Sri Lanka Grid 1999" },
+  { 5237, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SLVD height" },
+  { 5243, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / LCC Germany (E-N)" },
+  { 5244, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDBD2009" },
+  { 5245, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDBD2009" },
+  { 5246, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDBD2009" },
+  { 5247, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDBD2009 / Brunei BRSO" },
+  { 5250, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF" },
+  { 5251, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF" },
+  { 5252, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF" },
+  { 5253, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / TM27" },
+  { 5254, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / TM30" },
+  { 5255, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / TM33" },
+  { 5256, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / TM36" },
+  { 5257, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / TM39" },
+  { 5258, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / TM42" },
+  { 5259, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / TM45" },
+  { 5262, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03" },
+  { 5263, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03" },
+  { 5264, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03" },
+  { 5266, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Bhutan National Grid" },
+  { 5269, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / 3-degree Gauss-Kruger zone 9" },
+  { 5270, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / 3-degree Gauss-Kruger zone 10" },
+  { 5271, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / 3-degree Gauss-Kruger zone 11" },
+  { 5272, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / 3-degree Gauss-Kruger zone 12" },
+  { 5273, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / 3-degree Gauss-Kruger zone 13" },
+  { 5274, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / 3-degree Gauss-Kruger zone 14" },
+  { 5275, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / 3-degree Gauss-Kruger zone 15" },
+  { 5292, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Bumthang TM" },
+  { 5293, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Chhukha TM" },
+  { 5294, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Dagana TM" },
+  { 5295, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Gasa TM" },
+  { 5296, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Ha TM" },
+  { 5297, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Lhuentse TM" },
+  { 5298, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Mongar TM" },
+  { 5299, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Paro TM" },
+  { 5300, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Pemagatshel TM" },
+  { 5301, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Punakha TM" },
+  { 5302, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Samdrup Jongkhar TM" },
+  { 5303, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Samtse TM" },
+  { 5304, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Sarpang TM" },
+  { 5305, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Thimphu TM" },
+  { 5306, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Trashigang TM" },
+  { 5307, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Trongsa TM" },
+  { 5308, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Tsirang TM" },
+  { 5309, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Wangdue Phodrang TM" },
+  { 5310, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Yangtse TM" },
+  { 5311, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DRUKREF 03 / Zhemgang TM" },
+  { 5316, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Faroe TM" },
+  { 5317, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "FVR09 height" },
+  { 5318, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Faroe TM + FVR09 height" },
+  { 5320, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Teranet Ontario Lambert" },
+  { 5321, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Teranet Ontario Lambert" },
+  { 5322, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ISN2004" },
+  { 5323, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ISN2004" },
+  { 5324, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ISN2004" },
+  { 5325, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ISN2004 / Lambert 2004" },
+  { 5329, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Segara (Jakarta) / NEIEZ" },
+  { 5330, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Batavia (Jakarta) / NEIEZ" },
+  { 5331, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Makassar (Jakarta) / NEIEZ" },
+  { 5332, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ITRF2008" },
+  { 5336, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Black Sea depth" },
+  { 5337, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Aratu / UTM zone 25S" },
+  { 5340, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 2007" },
+  { 5341, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 2007" },
+  { 5342, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 2007" },
+  { 5343, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 2007 / Argentina 1" },
+  { 5344, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 2007 / Argentina 2" },
+  { 5345, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 2007 / Argentina 3" },
+  { 5346, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 2007 / Argentina 4" },
+  { 5347, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 2007 / Argentina 5" },
+  { 5348, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 2007 / Argentina 6" },
+  { 5349, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 2007 / Argentina 7" },
+  { 5352, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MARGEN" },
+  { 5353, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MARGEN" },
+  { 5354, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MARGEN" },
+  { 5355, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MARGEN / UTM zone 20S" },
+  { 5356, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MARGEN / UTM zone 19S" },
+  { 5357, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MARGEN / UTM zone 21S" },
+  { 5358, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS-Chile" },
+  { 5359, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS-Chile" },
+  { 5360, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS-Chile" },
+  { 5361, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS-Chile / UTM zone 19S" },
+  { 5362, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS-Chile / UTM zone 18S" },
+  { 5363, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CR05" },
+  { 5364, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CR05" },
+  { 5365, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CR05" },
+  { 5367, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CR05 / CRTM05" },
+  { 5368, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MACARIO SOLIS" },
+  { 5369, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Peru96" },
+  { 5370, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MACARIO SOLIS" },
+  { 5371, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MACARIO SOLIS" },
+  { 5372, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Peru96" },
+  { 5373, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Peru96" },
+  { 5379, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS-ROU98" },
+  { 5380, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS-ROU98" },
+  { 5381, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS-ROU98" },
+  { 5382, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS-ROU98 / UTM zone 21S" },
+  { 5383, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS-ROU98 / UTM zone 22S" },
+  { 5387, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Peru96 / UTM zone 18S" },
+  { 5388, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Peru96 / UTM zone 17S" },
+  { 5389, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Peru96 / UTM zone 19S" },
+  { 5391, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS_ES2007.8" },
+  { 5392, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS_ES2007.8" },
+  { 5393, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS_ES2007.8" },
+  { 5396, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 26S" },
+  { 5451, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ocotepeque 1935" },
+  { 5456, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ocotepeque 1935 / Costa Rica Norte" },
+  { 5457, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ocotepeque 1935 / Costa Rica Sur" },
+  { 5458, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ocotepeque 1935 / Guatemala Norte" },
+  { 5459, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ocotepeque 1935 / Guatemala Sur" },
+  { 5460, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ocotepeque 1935 / El Salvador Lambert" },
+  { 5461, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ocotepeque 1935 / Nicaragua Norte" },
+  { 5462, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ocotepeque 1935 / Nicaragua Sur" },
+  { 5463, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 17N" },
+  { 5464, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sibun Gorge 1922" },
+  { 5466, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sibun Gorge 1922 / Colony Grid" },
+  { 5467, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Panama-Colon 1911" },
+  { 5469, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Panama-Colon 1911 / Panama Lambert" },
+  { 5472, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Panama-Colon 1911 / Panama Polyconic" },
+  { 5479, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RSRGD2000 / MSLC2000" },
+  { 5480, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RSRGD2000 / BCLC2000" },
+  { 5481, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RSRGD2000 / PCLC2000" },
+  { 5482, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RSRGD2000 / RSPS2000" },
+  { 5487, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGAF09" },
+  { 5488, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGAF09" },
+  { 5489, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGAF09" },
+  { 5490, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGAF09 / UTM zone 20N" },
+  { 5498, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 + NAVD88 height" },
+  { 5499, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) + NAVD88 height" },
+  { 5500, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) + NAVD88 height" },
+  { 5513, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "S-JTSK / Krovak" },
+  { 5514, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "S-JTSK / Krovak East North" },
+  { 5515, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "S-JTSK/05 / Modified Krovak" },
+  { 5516, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "S-JTSK/05 / Modified Krovak East North" },
+  { 5518, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CI1971 / Chatham Islands Map Grid" },
+  { 5519, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CI1979 / Chatham Islands Map Grid" },
+  { 5520, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss-Kruger zone 1" },
+  { 5523, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Gabon TM 2011" },
+  { 5524, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Corrego Alegre 1961" },
+  { 5527, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69(96)" },
+  { 5530, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69(96) / Brazil Polyconic" },
+  { 5531, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69(96) / UTM zone 21S" },
+  { 5532, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69(96) / UTM zone 22S" },
+  { 5533, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69(96) / UTM zone 23S" },
+  { 5534, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69(96) / UTM zone 24S" },
+  { 5535, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69(96) / UTM zone 25S" },
+  { 5536, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Corrego Alegre 1961 / UTM zone 21S" },
+  { 5537, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Corrego Alegre 1961 / UTM zone 22S" },
+  { 5538, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Corrego Alegre 1961 / UTM zone 23S" },
+  { 5539, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Corrego Alegre 1961 / UTM zone 24S" },
+  { 5544, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PNG94" },
+  { 5545, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PNG94" },
+  { 5546, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PNG94" },
+  { 5550, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PNG94 / PNGMG94 zone 54" },
+  { 5551, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PNG94 / PNGMG94 zone 55" },
+  { 5552, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PNG94 / PNGMG94 zone 56" },
+  { 5554, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 31N + DHHN92 height" },
+  { 5555, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 32N + DHHN92 height" },
+  { 5556, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 33N + DHHN92 height" },
+  { 5558, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000" },
+  { 5559, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ocotepeque 1935 / Guatemala Norte" },
+  { 5560, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000" },
+  { 5561, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000" },
+  { 5562, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Gauss-Kruger zone 4" },
+  { 5563, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Gauss-Kruger zone 5" },
+  { 5564, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Gauss-Kruger zone 6" },
+  { 5565, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Gauss-Kruger zone 7" },
+  { 5566, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Gauss-Kruger CM 21E" },
+  { 5567, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Gauss-Kruger CM 27E" },
+  { 5568, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Gauss-Kruger CM 33E" },
+  { 5569, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Gauss-Kruger CM 39E" },
+  { 5570, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger zone 7" },
+  { 5571, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger zone 8" },
+  { 5572, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger zone 9" },
+  { 5573, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger zone 10" },
+  { 5574, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger zone 11" },
+  { 5575, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger zone 12" },
+  { 5576, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger zone 13" },
+  { 5577, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger CM 21E" },
+  { 5578, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger CM 24E" },
+  { 5579, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger CM 27E" },
+  { 5580, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger CM 30E" },
+  { 5581, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger CM 33E" },
+  { 5582, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger CM 36E" },
+  { 5583, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / 3-degree Gauss-Kruger CM 39E" },
+  { 5588, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / New Brunswick Stereographic (NAD27)" },
+  { 5589, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sibun Gorge 1922 / Colony Grid" },
+  { 5591, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "FEH2010" },
+  { 5592, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "FEH2010" },
+  { 5593, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "FEH2010" },
+  { 5596, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "FEH2010 / Fehmarnbelt TM" },
+  { 5597, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "FCSVR10 height" },
+  { 5598, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "FEH2010 / Fehmarnbelt TM + FCSVR10 height" },
+  { 5600, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGPF height" },
+  { 5601, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN 1966 height" },
+  { 5602, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Moorea SAU 1981 height" },
+  { 5603, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Raiatea SAU 2001 height" },
+  { 5604, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Maupiti SAU 2001 height" },
+  { 5605, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Huahine SAU 2001 height" },
+  { 5606, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tahaa SAU 2001 height" },
+  { 5607, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bora Bora SAU 2001 height" },
+  { 5608, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGLD 1955 height" },
+  { 5609, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGLD 1985 height" },
+  { 5610, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HVRS71 height" },
+  { 5611, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Caspian height" },
+  { 5612, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Baltic depth" },
+  { 5613, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RH2000 height" },
+  { 5614, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KOC WD depth (ft)" },
+  { 5615, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RH00 height" },
+  { 5616, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN 1988 LS height" },
+  { 5617, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN 1988 MG height" },
+  { 5618, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN 1992 LD height" },
+  { 5619, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN 1988 SB height" },
+  { 5620, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGN 1988 SM height" },
+  { 5621, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EVRF2007 height" },
+  { 5623, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Michigan East" },
+  { 5624, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Michigan Old Central" },
+  { 5625, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Michigan West" },
+  { 5627, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / TM 6 NE" },
+  { 5628, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 + RH2000 height" },
+  { 5629, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Moznet / UTM zone 38S" },
+  { 5631, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / Gauss-Kruger zone 2 (E-N)" },
+  { 5632, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PTRA08 / LCC Europe" },
+  { 5633, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PTRA08 / LAEA Europe" },
+  { 5634, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGCAN95 / LCC Europe" },
+  { 5635, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "REGCAN95 / LAEA Europe" },
+  { 5636, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / LAEA Europe" },
+  { 5637, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TUREF / LCC Europe" },
+  { 5638, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ISN2004 / LAEA Europe" },
+  { 5639, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ISN2004 / LCC Europe" },
+  { 5641, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / Brazil Mercator" },
+  { 5643, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / SPBA LCC" },
+  { 5644, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGR92 / UTM zone 39S" },
+  { 5646, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Vermont (ftUS)" },
+  { 5649, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 31N (zE-N)" },
+  { 5650, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_NAD83, 0, 57, 0, "ETRS89 / UTM zone 33N (zE-N)" },
+  { 5651, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 31N (N-zE)" },
+  { 5652, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 32N (N-zE)" },
+  { 5653, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 33N (N-zE)" },
+  { 5654, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Vermont (ftUS)" },
+  { 5655, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Vermont (ftUS)" },
+  { 5659, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Monte Mario / TM Emilia-Romagna" },
+  { 5663, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / Gauss-Kruger zone 3 (E-N)" },
+  { 5664, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / Gauss-Kruger zone 2 (E-N)" },
+  { 5665, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / Gauss-Kruger zone 3 (E-N)" },
+  { 5666, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PD/83 / 3-degree Gauss-Kruger zone 3 (E-N)" },
+  { 5667, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PD/83 / 3-degree Gauss-Kruger zone 4 (E-N)" },
+  { 5668, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RD/83 / 3-degree Gauss-Kruger zone 4 (E-N)" },
+  { 5669, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RD/83 / 3-degree Gauss-Kruger zone 5 (E-N)" },
+  { 5670, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 3 (E-N)" },
+  { 5671, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 4 (E-N)" },
+  { 5672, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 5 (E-N)" },
+  { 5673, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 3 (E-N)" },
+  { 5674, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 4 (E-N)" },
+  { 5675, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 5 (E-N)" },
+  { 5676, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss-Kruger zone 2 (E-N)" },
+  { 5677, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss-Kruger zone 3 (E-N)" },
+  { 5678, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss-Kruger zone 4 (E-N)" },
+  { 5679, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss-Kruger zone 5 (E-N)" },
+  { 5680, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss-Kruger zone 1 (E-N)" },
+  { 5681, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DB_REF" },
+  { 5682, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DB_REF / 3-degree Gauss-Kruger zone 2 (E-N)" },
+  { 5683, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DB_REF / 3-degree Gauss-Kruger zone 3 (E-N)" },
+  { 5684, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DB_REF / 3-degree Gauss-Kruger zone 4 (E-N)" },
+  { 5685, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DB_REF / 3-degree Gauss-Kruger zone 5 (E-N)" },
+  { 5698, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGF93 / Lambert-93 + NGF-IGN69 height" },
+  { 5699, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGF93 / Lambert-93 + NGF-IGN78 height" },
+  { 5700, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD2000 / UTM zone 1S" },
+  { 5701, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ODN height" },
+  { 5702, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGVD29 height" },
+  { 5703, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAVD88 height" },
+  { 5704, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yellow Sea" },
+  { 5705, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Baltic height" },
+  { 5706, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Caspian depth" },
+  { 5707, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert zone I + NGF-IGN69 height" },
+  { 5708, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert zone IV + NGF-IGN78 height" },
+  { 5709, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAP height" },
+  { 5710, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ostend height" },
+  { 5711, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AHD height" },
+  { 5712, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AHD (Tasmania) height" },
+  { 5713, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGVD28 height" },
+  { 5714, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MSL height" },
+  { 5715, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MSL depth" },
+  { 5716, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Piraeus height" },
+  { 5717, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "N60 height" },
+  { 5718, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RH70 height" },
+  { 5719, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGF Lallemand height" },
+  { 5720, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGF-IGN69 height" },
+  { 5721, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGF-IGN78 height" },
+  { 5722, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Maputo height" },
+  { 5723, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JSLD69 height" },
+  { 5724, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PHD93 height" },
+  { 5725, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Fahud HD height" },
+  { 5726, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ha Tien 1960 height" },
+  { 5727, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Hon Dau 1992 height" },
+  { 5728, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LN02 height" },
+  { 5729, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LHN95 height" },
+  { 5730, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EVRF2000 height" },
+  { 5731, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Malin Head height" },
+  { 5732, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Belfast height" },
+  { 5733, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DNN height" },
+  { 5734, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AIOC95 depth" },
+  { 5735, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Black Sea height" },
+  { 5736, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yellow Sea 1956 height" },
+  { 5737, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yellow Sea 1985 height" },
+  { 5738, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HKPD height" },
+  { 5739, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HKCD depth" },
+  { 5740, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ODN Orkney height" },
+  { 5741, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Fair Isle height" },
+  { 5742, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lerwick height" },
+  { 5743, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Foula height" },
+  { 5744, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sule Skerry height" },
+  { 5745, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "North Rona height" },
+  { 5746, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Stornoway height" },
+  { 5747, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "St Kilda height" },
+  { 5748, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Flannan Isles height" },
+  { 5749, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "St Marys height" },
+  { 5750, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Douglas height" },
+  { 5751, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Fao height" },
+  { 5752, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bandar Abbas height" },
+  { 5753, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGNC height" },
+  { 5754, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Poolbeg height" },
+  { 5755, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGG1977 height" },
+  { 5756, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Martinique 1987 height" },
+  { 5757, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Guadeloupe 1988 height" },
+  { 5758, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Reunion 1989 height" },
+  { 5759, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Auckland 1946 height" },
+  { 5760, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bluff 1955 height" },
+  { 5761, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dunedin 1958 height" },
+  { 5762, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Gisborne 1926 height" },
+  { 5763, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lyttelton 1937 height" },
+  { 5764, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Moturiki 1953 height" },
+  { 5765, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Napier 1962 height" },
+  { 5766, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nelson 1955 height" },
+  { 5767, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "One Tree Point 1964 height" },
+  { 5768, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tararu 1952 height" },
+  { 5769, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Taranaki 1970 height" },
+  { 5770, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Wellington 1953 height" },
+  { 5771, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Chatham Island 1959 height" },
+  { 5772, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Stewart Island 1977 height" },
+  { 5773, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EGM96 geoid height" },
+  { 5774, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NG-L height" },
+  { 5775, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Antalya height" },
+  { 5776, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NN54 height" },
+  { 5777, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Durres height" },
+  { 5778, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GHA height" },
+  { 5779, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NVN99 height" },
+  { 5780, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cascais height" },
+  { 5781, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Constanta height" },
+  { 5782, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Alicante height" },
+  { 5783, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHHN92 height" },
+  { 5784, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHHN85 height" },
+  { 5785, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SNN76 height" },
+  { 5786, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Baltic 1982 height" },
+  { 5787, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EOMA 1980 height" },
+  { 5788, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kuwait PWD height" },
+  { 5789, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KOC WD depth" },
+  { 5790, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KOC CD height" },
+  { 5791, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGC 1948 height" },
+  { 5792, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Danger 1950 height" },
+  { 5793, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mayotte 1950 height" },
+  { 5794, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Martinique 1955 height" },
+  { 5795, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Guadeloupe 1951 height" },
+  { 5796, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lagos 1955 height" },
+  { 5797, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AIOC95 height" },
+  { 5798, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EGM84 geoid height" },
+  { 5799, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DVR90 height" },
+  { 5800, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Astra Minas Grid" },
+  { 5801, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Barcelona Grid B1" },
+  { 5802, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Barcelona Grid B2" },
+  { 5803, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Maturin Grid" },
+  { 5804, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EPSG seismic bin grid example A" },
+  { 5805, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EPSG seismic bin grid example B" },
+  { 5806, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EPSG local engineering grid example A" },
+  { 5807, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EPSG local engineering grid example B" },
+  { 5808, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Maracaibo Cross Grid M4" },
+  { 5809, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Maracaibo Cross Grid M5" },
+  { 5810, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "La Rosa Grid" },
+  { 5811, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mene Grande" },
+  { 5812, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "El Cubo" },
+  { 5813, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dabajuro" },
+  { 5814, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tucupita" },
+  { 5815, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Santa Maria de Ipire" },
+  { 5816, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Barinas west base" },
+  { 5817, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tombak LNG plant" },
+  { 5818, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "[enter here name of (I = J+90\260) bin grid]" },
+  { 5819, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EPSG topocentric example A" },
+  { 5820, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EPSG topocentric example B" },
+  { 5821, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "EPSG vertical perspective example" },
+  { 5825, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66 / ACT Standard Grid" },
+  { 5828, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DB_REF" },
+  { 5829, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Instantaneous Water Level height" },
+  { 5830, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DB_REF" },
+  { 5831, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Instantaneous Water Level depth" },
+  { 5832, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DB_REF / 3-degree Gauss-Kruger zone 2 (E-N) + DHHN92 height" },
+  { 5833, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DB_REF / 3-degree Gauss-Kruger zone 3 (E-N) + DHHN92 height" },
+  { 5834, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DB_REF / 3-degree Gauss-Kruger zone 4 (E-N) + DHHN92 height" },
+  { 5835, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DB_REF / 3-degree Gauss-Kruger zone 5 (E-N) + DHHN92 height" },
+  { 5836, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yemen NGN96 / UTM zone 37N" },
+  { 5837, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Yemen NGN96 / UTM zone 40N" },
+  { 5839, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Peru96 / UTM zone 17S" },
+  { 5842, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / TM 12 SE" },
+  { 5843, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ras Ghumays height" },
+  { 5844, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RGRDC 2005 / Congo TM zone 30" },
+  { 5845, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 TM + RH2000 height" },
+  { 5846, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 12 00 + RH2000 height" },
+  { 5847, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 13 30 + RH2000 height" },
+  { 5848, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 15 00 + RH2000 height" },
+  { 5849, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 16 30 + RH2000 height" },
+  { 5850, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 18 00 + RH2000 height" },
+  { 5851, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 14 15 + RH2000 height" },
+  { 5852, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 15 45 + RH2000 height" },
+  { 5853, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 17 15 + RH2000 height" },
+  { 5854, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 18 45 + RH2000 height" },
+  { 5855, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 20 15 + RH2000 height" },
+  { 5856, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 21 45 + RH2000 height" },
+  { 5857, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SWEREF99 23 15 + RH2000 height" },
+  { 5858, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69(96) / UTM zone 22S" },
+  { 5859, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "[enter here name of (I = J-90\260) bin grid]" },
+  { 5861, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LAT depth" },
+  { 5862, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LLWLT depth" },
+  { 5863, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ISLW depth" },
+  { 5864, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MLLWS depth" },
+  { 5865, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MLWS depth" },
+  { 5866, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MLLW depth" },
+  { 5867, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MLW depth" },
+  { 5868, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MHW height" },
+  { 5869, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MHHW height" },
+  { 5870, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MHWS height" },
+  { 5871, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HHWLT height" },
+  { 5872, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HAT height" },
+  { 5873, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Low Water depth" },
+  { 5874, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "High Water height" },
+  { 5875, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69(96) / UTM zone 18S" },
+  { 5876, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69(96) / UTM zone 19S" },
+  { 5877, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69(96) / UTM zone 20S" },
+  { 5879, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cadastre 1997 / UTM zone 38S" },
+  { 5880, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / Brazil Polyconic" },
+  { 5884, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TGD2005" },
+  { 5885, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TGD2005" },
+  { 5886, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TGD2005" },
+  { 5887, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TGD2005 / Tonga Map Grid" },
+  { 5890, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JAXA Snow Depth Polar Stereographic North" },
+  { 5921, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone A1" },
+  { 5922, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone A2" },
+  { 5923, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone A3" },
+  { 5924, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone A4" },
+  { 5925, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone A5" },
+  { 5926, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone B1" },
+  { 5927, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone B2" },
+  { 5928, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone B3" },
+  { 5929, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone B4" },
+  { 5930, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone B5" },
+  { 5931, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone C1" },
+  { 5932, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone C2" },
+  { 5933, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone C3" },
+  { 5934, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone C4" },
+  { 5935, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic Regional zone C5" },
+  { 5936, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Alaska Polar Stereographic" },
+  { 5937, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Canada Polar Stereographic" },
+  { 5938, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Greenland Polar Stereographic" },
+  { 5939, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Norway Polar Stereographic" },
+  { 5940, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Russia Polar Stereographic" },
+  { 5941, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NN2000 height" },
+  { 5942, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 + NN2000 height" },
+  { 5945, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 5 + NN2000 height" },
+  { 5946, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 6 + NN2000 height" },
+  { 5947, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 7 + NN2000 height" },
+  { 5948, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 8 + NN2000 height" },
+  { 5949, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 9 + NN2000 height" },
+  { 5950, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 10 + NN2000 height" },
+  { 5951, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 11 + NN2000 height" },
+  { 5952, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 12 + NN2000 height" },
+  { 5953, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 13 + NN2000 height" },
+  { 5954, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 14 + NN2000 height" },
+  { 5955, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 15 + NN2000 height" },
+  { 5956, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 16 + NN2000 height" },
+  { 5957, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 17 + NN2000 height" },
+  { 5958, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 18 + NN2000 height" },
+  { 5959, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 19 + NN2000 height" },
+  { 5960, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 20 + NN2000 height" },
+  { 5961, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 21 + NN2000 height" },
+  { 5962, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 22 + NN2000 height" },
+  { 5963, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 23 + NN2000 height" },
+  { 5964, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 24 + NN2000 height" },
+  { 5965, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 25 + NN2000 height" },
+  { 5966, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 26 + NN2000 height" },
+  { 5967, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 27 + NN2000 height" },
+  { 5968, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 28 + NN2000 height" },
+  { 5969, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 29 + NN2000 height" },
+  { 5970, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 30 + NN2000 height" },
+  { 5971, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 31 + NN2000 height" },
+  { 5972, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 32 + NN2000 height" },
+  { 5973, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 33 + NN2000 height" },
+  { 5974, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 34 + NN2000 height" },
+  { 5975, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 35 + NN2000 height" },
+  { 5976, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 36 + NN2000 height" },
+  { 6050, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 1-25" },
+  { 6051, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 2-18" },
+  { 6052, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 2-20" },
+  { 6053, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 3-29" },
+  { 6054, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 3-31" },
+  { 6055, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 3-33" },
+  { 6056, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 4-20" },
+  { 6057, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 4-22" },
+  { 6058, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 4-24" },
+  { 6059, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 5-41" },
+  { 6060, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 5-43" },
+  { 6061, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 5-45" },
+  { 6062, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 6-26" },
+  { 6063, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 6-28" },
+  { 6064, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 6-30" },
+  { 6065, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 7-11" },
+  { 6066, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 7-13" },
+  { 6067, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 8-20" },
+  { 6068, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GR96 / EPSG Arctic zone 8-22" },
+  { 6069, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / EPSG Arctic zone 2-22" },
+  { 6070, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / EPSG Arctic zone 3-11" },
+  { 6071, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / EPSG Arctic zone 4-26" },
+  { 6072, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / EPSG Arctic zone 4-28" },
+  { 6073, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / EPSG Arctic zone 5-11" },
+  { 6074, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / EPSG Arctic zone 5-13" },
+  { 6075, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 2-24" },
+  { 6076, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 2-26" },
+  { 6077, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 3-13" },
+  { 6078, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 3-15" },
+  { 6079, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 3-17" },
+  { 6080, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 3-19" },
+  { 6081, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 4-30" },
+  { 6082, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 4-32" },
+  { 6083, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 4-34" },
+  { 6084, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 4-36" },
+  { 6085, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 4-38" },
+  { 6086, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 4-40" },
+  { 6087, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 5-15" },
+  { 6088, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 5-17" },
+  { 6089, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 5-19" },
+  { 6090, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 5-21" },
+  { 6091, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 5-23" },
+  { 6092, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 5-25" },
+  { 6093, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 5-27" },
+  { 6094, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / EPSG Arctic zone 5-29" },
+  { 6095, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / EPSG Arctic zone 5-31" },
+  { 6096, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / EPSG Arctic zone 6-14" },
+  { 6097, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / EPSG Arctic zone 6-16" },
+  { 6098, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 1-23" },
+  { 6099, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 2-14" },
+  { 6100, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 2-16" },
+  { 6101, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 3-25" },
+  { 6102, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 3-27" },
+  { 6103, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 3-29" },
+  { 6104, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 4-14" },
+  { 6105, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 4-16" },
+  { 6106, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 4-18" },
+  { 6107, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 5-33" },
+  { 6108, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 5-35" },
+  { 6109, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 5-37" },
+  { 6110, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 5-39" },
+  { 6111, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 6-18" },
+  { 6112, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 6-20" },
+  { 6113, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 6-22" },
+  { 6114, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / EPSG Arctic zone 6-24" },
+  { 6115, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 1-27" },
+  { 6116, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 1-29" },
+  { 6117, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 1-31" },
+  { 6118, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 1-21" },
+  { 6119, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 2-28" },
+  { 6120, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 2-10" },
+  { 6121, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 2-12" },
+  { 6122, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 3-21" },
+  { 6123, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 3-23" },
+  { 6124, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / EPSG Arctic zone 4-12" },
+  { 6125, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / EPSG Arctic zone 5-47" },
+  { 6128, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Grand Cayman National Grid 1959" },
+  { 6129, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Sister Islands National Grid 1961" },
+  { 6130, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GCVD54 height" },
+  { 6131, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "LCVD61 height" },
+  { 6132, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CBVD61 height" },
+  { 6133, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CIGD11" },
+  { 6134, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CIGD11" },
+  { 6135, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CIGD11" },
+  { 6141, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cayman Islands National Grid 2011" },
+  { 6144, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 + NN54 height" },
+  { 6145, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 5 + NN54 height" },
+  { 6146, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 6 + NN54 height" },
+  { 6147, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 7 + NN54 height" },
+  { 6148, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 8 + NN54 height" },
+  { 6149, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 9 + NN54 height" },
+  { 6150, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 10 + NN54 height" },
+  { 6151, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 11 + NN54 height" },
+  { 6152, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 12 + NN54 height" },
+  { 6153, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 13 + NN54 height" },
+  { 6154, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 14 + NN54 height" },
+  { 6155, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 15 + NN54 height" },
+  { 6156, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 16 + NN54 height" },
+  { 6157, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 17 + NN54 height" },
+  { 6158, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 18 + NN54 height" },
+  { 6159, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 19 + NN54 height" },
+  { 6160, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 20 + NN54 height" },
+  { 6161, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 21 + NN54 height" },
+  { 6162, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 22 + NN54 height" },
+  { 6163, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 23 + NN54 height" },
+  { 6164, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 24 + NN54 height" },
+  { 6165, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 25 + NN54 height" },
+  { 6166, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 26 + NN54 height" },
+  { 6167, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 27 + NN54 height" },
+  { 6168, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 28 + NN54 height" },
+  { 6169, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 29 + NN54 height" },
+  { 6170, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / NTM zone 30 + NN54 height" },
+  { 6171, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 31 + NN54 height" },
+  { 6172, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 32 + NN54 height" },
+  { 6173, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 33 + NN54 height" },
+  { 6174, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 34 + NN54 height" },
+  { 6175, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 35 + NN54 height" },
+  { 6176, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 36 + NN54 height" },
+  { 6178, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cais da Pontinha - Funchal height" },
+  { 6179, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cais da Vila - Porto Santo height" },
+  { 6180, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cais das Velas height" },
+  { 6181, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Horta height" },
+  { 6182, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cais da Madalena height" },
+  { 6183, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Santa Cruz da Graciosa height" },
+  { 6184, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cais da Figueirinha - Angra do Heroismo height" },
+  { 6185, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Santa Cruz das Flores height" },
+  { 6186, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cais da Vila do Porto height" },
+  { 6187, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ponta Delgada height" },
+  { 6190, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Belge 1972 / Belgian Lambert 72 + Ostend height" },
+  { 6200, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Michigan North" },
+  { 6201, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Michigan Central" },
+  { 6202, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Michigan South" },
+  { 6204, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Macedonian State Coordinate System" },
+  { 6207, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nepal 1981" },
+  { 6210, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 23N" },
+  { 6211, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 24N" },
+  { 6244, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Arauca urban grid" },
+  { 6245, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Armenia urban grid" },
+  { 6246, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Barranquilla urban grid" },
+  { 6247, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Bogota urban grid" },
+  { 6248, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Bucaramanga urban grid" },
+  { 6249, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Cali urban grid" },
+  { 6250, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Cartagena urban grid" },
+  { 6251, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Cucuta urban grid" },
+  { 6252, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Florencia urban grid" },
+  { 6253, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Ibague urban grid" },
+  { 6254, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Inirida urban grid" },
+  { 6255, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Leticia urban grid" },
+  { 6256, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Manizales urban grid" },
+  { 6257, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Medellin urban grid" },
+  { 6258, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Mitu urban grid" },
+  { 6259, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Mocoa urban grid" },
+  { 6260, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Monteria urban grid" },
+  { 6261, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Neiva urban grid" },
+  { 6262, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Pasto urban grid" },
+  { 6263, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Pereira urban grid" },
+  { 6264, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Popayan urban grid" },
+  { 6265, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Puerto Carreno urban grid" },
+  { 6266, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Quibdo urban grid" },
+  { 6267, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Riohacha urban grid" },
+  { 6268, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / San Andres urban grid" },
+  { 6269, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / San Jose del Guaviare urban grid" },
+  { 6270, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Santa Marta urban grid" },
+  { 6271, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Sucre urban grid" },
+  { 6272, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Tunja urban grid" },
+  { 6273, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Valledupar urban grid" },
+  { 6274, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Villavicencio urban grid" },
+  { 6275, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MAGNA-SIRGAS / Yopal urban grid" },
+  { 6307, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Puerto Rico and Virgin Is." },
+  { 6316, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Macedonia State Coordinate System zone 7" },
+  { 6317, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011)" },
+  { 6318, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011)" },
+  { 6319, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011)" },
+  { 6320, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(PA11)" },
+  { 6321, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(PA11)" },
+  { 6322, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(PA11)" },
+  { 6323, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(MA11)" },
+  { 6324, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(MA11)" },
+  { 6325, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(MA11)" },
+  { 6328, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 59N" },
+  { 6329, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 60N" },
+  { 6330, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 1N" },
+  { 6331, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 2N" },
+  { 6332, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 3N" },
+  { 6333, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 4N" },
+  { 6334, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 5N" },
+  { 6335, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 6N" },
+  { 6336, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 7N" },
+  { 6337, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 8N" },
+  { 6338, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 9N" },
+  { 6339, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 10N" },
+  { 6340, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 11N" },
+  { 6341, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 12N" },
+  { 6342, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 13N" },
+  { 6343, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 14N" },
+  { 6344, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 15N" },
+  { 6345, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 16N" },
+  { 6346, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 17N" },
+  { 6347, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 18N" },
+  { 6348, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / UTM zone 19N" },
+  { 6349, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) + NAVD88 height" },
+  { 6350, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Conus Albers" },
+  { 6351, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / EPSG Arctic zone 5-29" },
+  { 6352, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / EPSG Arctic zone 5-31" },
+  { 6353, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / EPSG Arctic zone 6-14" },
+  { 6354, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / EPSG Arctic zone 6-16" },
+  { 6355, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Alabama East" },
+  { 6356, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Alabama West" },
+  { 6357, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAVD88 depth" },
+  { 6358, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAVD88 depth (ftUS)" },
+  { 6359, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGVD29 depth" },
+  { 6360, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAVD88 height (ftUS)" },
+  { 6362, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF92 / LCC" },
+  { 6363, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF2008" },
+  { 6364, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF2008" },
+  { 6365, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF2008" },
+  { 6366, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF2008 / UTM zone 11N" },
+  { 6367, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF2008 / UTM zone 12N" },
+  { 6368, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF2008 / UTM zone 13N" },
+  { 6369, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF2008 / UTM zone 14N" },
+  { 6370, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF2008 / UTM zone 15N" },
+  { 6371, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF2008 / UTM zone 16N" },
+  { 6372, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Mexico ITRF2008 / LCC" },
+  { 6381, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Ukraine TM zone 7" },
+  { 6382, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Ukraine TM zone 8" },
+  { 6383, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Ukraine TM zone 9" },
+  { 6384, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Ukraine TM zone 10" },
+  { 6385, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Ukraine TM zone 11" },
+  { 6386, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Ukraine TM zone 12" },
+  { 6387, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "UCS-2000 / Ukraine TM zone 13" },
+  { 6391, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cayman Islands National Grid 2011" },
+  { 6393, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Alaska Albers" },
+  { 6394, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Alaska zone 1" },
+  { 6395, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Alaska zone 2" },
+  { 6396, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Alaska zone 3" },
+  { 6397, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Alaska zone 4" },
+  { 6398, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Alaska zone 5" },
+  { 6399, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Alaska zone 6" },
+  { 6400, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Alaska zone 7" },
+  { 6401, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Alaska zone 8" },
+  { 6402, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Alaska zone 9" },
+  { 6403, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Alaska zone 10" },
+  { 6404, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Arizona Central" },
+  { 6405, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Arizona Central (ft)" },
+  { 6406, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Arizona East" },
+  { 6407, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Arizona East (ft)" },
+  { 6408, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Arizona West" },
+  { 6409, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Arizona West (ft)" },
+  { 6410, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Arkansas North" },
+  { 6411, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Arkansas North (ftUS)" },
+  { 6412, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Arkansas South" },
+  { 6413, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Arkansas South (ftUS)" },
+  { 6414, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / California Albers" },
+  { 6415, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / California zone 1" },
+  { 6416, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / California zone 1 (ftUS)" },
+  { 6417, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / California zone 2" },
+  { 6418, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / California zone 2 (ftUS)" },
+  { 6419, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / California zone 3" },
+  { 6420, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / California zone 3 (ftUS)" },
+  { 6421, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / California zone 4" },
+  { 6422, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / California zone 4 (ftUS)" },
+  { 6423, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / California zone 5" },
+  { 6424, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / California zone 5 (ftUS)" },
+  { 6425, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / California zone 6" },
+  { 6426, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / California zone 6 (ftUS)" },
+  { 6427, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Colorado Central" },
+  { 6428, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Colorado Central (ftUS)" },
+  { 6429, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Colorado North" },
+  { 6430, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Colorado North (ftUS)" },
+  { 6431, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Colorado South" },
+  { 6432, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Colorado South (ftUS)" },
+  { 6433, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Connecticut" },
+  { 6434, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Connecticut (ftUS)" },
+  { 6435, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Delaware" },
+  { 6436, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Delaware (ftUS)" },
+  { 6437, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Florida East" },
+  { 6438, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Florida East (ftUS)" },
+  { 6439, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Florida GDL Albers" },
+  { 6440, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Florida North" },
+  { 6441, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Florida North (ftUS)" },
+  { 6442, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Florida West" },
+  { 6443, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Florida West (ftUS)" },
+  { 6444, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Georgia East" },
+  { 6445, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Georgia East (ftUS)" },
+  { 6446, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Georgia West" },
+  { 6447, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Georgia West (ftUS)" },
+  { 6448, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Idaho Central" },
+  { 6449, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Idaho Central (ftUS)" },
+  { 6450, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Idaho East" },
+  { 6451, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Idaho East (ftUS)" },
+  { 6452, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Idaho West" },
+  { 6453, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Idaho West (ftUS)" },
+  { 6454, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Illinois East" },
+  { 6455, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Illinois East (ftUS)" },
+  { 6456, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Illinois West" },
+  { 6457, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Illinois West (ftUS)" },
+  { 6458, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Indiana East" },
+  { 6459, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Indiana East (ftUS)" },
+  { 6460, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Indiana West" },
+  { 6461, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Indiana West (ftUS)" },
+  { 6462, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Iowa North" },
+  { 6463, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Iowa North (ftUS)" },
+  { 6464, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Iowa South" },
+  { 6465, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Iowa South (ftUS)" },
+  { 6466, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Kansas North" },
+  { 6467, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Kansas North (ftUS)" },
+  { 6468, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Kansas South" },
+  { 6469, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Kansas South (ftUS)" },
+  { 6470, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Kentucky North" },
+  { 6471, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Kentucky North (ftUS)" },
+  { 6472, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Kentucky Single Zone" },
+  { 6473, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Kentucky Single Zone (ftUS)" },
+  { 6474, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Kentucky South" },
+  { 6475, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Kentucky South (ftUS)" },
+  { 6476, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Louisiana North" },
+  { 6477, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Louisiana North (ftUS)" },
+  { 6478, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Louisiana South" },
+  { 6479, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Louisiana South (ftUS)" },
+  { 6480, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Maine CS2000 Central" },
+  { 6481, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Maine CS2000 East" },
+  { 6482, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Maine CS2000 West" },
+  { 6483, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Maine East" },
+  { 6484, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Maine East (ftUS)" },
+  { 6485, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Maine West" },
+  { 6486, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Maine West (ftUS)" },
+  { 6487, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Maryland" },
+  { 6488, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Maryland (ftUS)" },
+  { 6489, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Massachusetts Island" },
+  { 6490, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Massachusetts Island (ftUS)" },
+  { 6491, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Massachusetts Mainland" },
+  { 6492, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Massachusetts Mainland (ftUS)" },
+  { 6493, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Michigan Central" },
+  { 6494, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Michigan Central (ft)" },
+  { 6495, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Michigan North" },
+  { 6496, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Michigan North (ft)" },
+  { 6497, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Michigan Oblique Mercator" },
+  { 6498, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Michigan South" },
+  { 6499, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Michigan South (ft)" },
+  { 6500, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Minnesota Central" },
+  { 6501, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Minnesota Central (ftUS)" },
+  { 6502, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Minnesota North" },
+  { 6503, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Minnesota North (ftUS)" },
+  { 6504, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Minnesota South" },
+  { 6505, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Minnesota South (ftUS)" },
+  { 6506, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Mississippi East" },
+  { 6507, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Mississippi East (ftUS)" },
+  { 6508, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Mississippi TM" },
+  { 6509, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Mississippi West" },
+  { 6510, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Mississippi West (ftUS)" },
+  { 6511, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Missouri Central" },
+  { 6512, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Missouri East" },
+  { 6513, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Missouri West" },
+  { 6514, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Montana" },
+  { 6515, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Montana (ft)" },
+  { 6516, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Nebraska" },
+  { 6517, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Nebraska (ftUS)" },
+  { 6518, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Nevada Central" },
+  { 6519, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Nevada Central (ftUS)" },
+  { 6520, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Nevada East" },
+  { 6521, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Nevada East (ftUS)" },
+  { 6522, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Nevada West" },
+  { 6523, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Nevada West (ftUS)" },
+  { 6524, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New Hampshire" },
+  { 6525, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New Hampshire (ftUS)" },
+  { 6526, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New Jersey" },
+  { 6527, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New Jersey (ftUS)" },
+  { 6528, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New Mexico Central" },
+  { 6529, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New Mexico Central (ftUS)" },
+  { 6530, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New Mexico East" },
+  { 6531, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New Mexico East (ftUS)" },
+  { 6532, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New Mexico West" },
+  { 6533, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New Mexico West (ftUS)" },
+  { 6534, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New York Central" },
+  { 6535, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New York Central (ftUS)" },
+  { 6536, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New York East" },
+  { 6537, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New York East (ftUS)" },
+  { 6538, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New York Long Island" },
+  { 6539, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New York Long Island (ftUS)" },
+  { 6540, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New York West" },
+  { 6541, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / New York West (ftUS)" },
+  { 6542, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / North Carolina" },
+  { 6543, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / North Carolina (ftUS)" },
+  { 6544, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / North Dakota North" },
+  { 6545, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / North Dakota North (ft)" },
+  { 6546, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / North Dakota South" },
+  { 6547, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / North Dakota South (ft)" },
+  { 6548, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Ohio North" },
+  { 6549, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Ohio North (ftUS)" },
+  { 6550, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Ohio South" },
+  { 6551, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Ohio South (ftUS)" },
+  { 6552, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oklahoma North" },
+  { 6553, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oklahoma North (ftUS)" },
+  { 6554, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oklahoma South" },
+  { 6555, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oklahoma South (ftUS)" },
+  { 6556, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon LCC (m)" },
+  { 6557, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon GIC Lambert (ft)" },
+  { 6558, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon North" },
+  { 6559, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon North (ft)" },
+  { 6560, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon South" },
+  { 6561, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon South (ft)" },
+  { 6562, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Pennsylvania North" },
+  { 6563, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Pennsylvania North (ftUS)" },
+  { 6564, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Pennsylvania South" },
+  { 6565, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Pennsylvania South (ftUS)" },
+  { 6566, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Puerto Rico and Virgin Is." },
+  { 6567, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Rhode Island" },
+  { 6568, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Rhode Island (ftUS)" },
+  { 6569, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / South Carolina" },
+  { 6570, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / South Carolina (ft)" },
+  { 6571, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / South Dakota North" },
+  { 6572, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / South Dakota North (ftUS)" },
+  { 6573, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / South Dakota South" },
+  { 6574, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / South Dakota South (ftUS)" },
+  { 6575, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Tennessee" },
+  { 6576, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Tennessee (ftUS)" },
+  { 6577, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Texas Central" },
+  { 6578, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Texas Central (ftUS)" },
+  { 6579, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Texas Centric Albers Equal Area" },
+  { 6580, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Texas Centric Lambert Conformal" },
+  { 6581, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Texas North" },
+  { 6582, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Texas North (ftUS)" },
+  { 6583, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Texas North Central" },
+  { 6584, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Texas North Central (ftUS)" },
+  { 6585, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Texas South" },
+  { 6586, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Texas South (ftUS)" },
+  { 6587, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Texas South Central" },
+  { 6588, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Texas South Central (ftUS)" },
+  { 6589, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Vermont" },
+  { 6590, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Vermont (ftUS)" },
+  { 6591, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Virginia Lambert" },
+  { 6592, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Virginia North" },
+  { 6593, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Virginia North (ftUS)" },
+  { 6594, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Virginia South" },
+  { 6595, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Virginia South (ftUS)" },
+  { 6596, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Washington North" },
+  { 6597, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Washington North (ftUS)" },
+  { 6598, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Washington South" },
+  { 6599, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Washington South (ftUS)" },
+  { 6600, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / West Virginia North" },
+  { 6601, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / West Virginia North (ftUS)" },
+  { 6602, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / West Virginia South" },
+  { 6603, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / West Virginia South (ftUS)" },
+  { 6604, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wisconsin Central" },
+  { 6605, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wisconsin Central (ftUS)" },
+  { 6606, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wisconsin North" },
+  { 6607, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wisconsin North (ftUS)" },
+  { 6608, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wisconsin South" },
+  { 6609, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wisconsin South (ftUS)" },
+  { 6610, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wisconsin Transverse Mercator" },
+  { 6611, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wyoming East" },
+  { 6612, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wyoming East (ftUS)" },
+  { 6613, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wyoming East Central" },
+  { 6614, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wyoming East Central (ftUS)" },
+  { 6615, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wyoming West" },
+  { 6616, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wyoming West (ftUS)" },
+  { 6617, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wyoming West Central" },
+  { 6618, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wyoming West Central (ftUS)" },
+  { 6619, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Utah Central" },
+  { 6620, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Utah North" },
+  { 6621, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Utah South" },
+  { 6622, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Quebec Lambert" },
+  { 6623, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Quebec Albers" },
+  { 6624, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / Quebec Albers" },
+  { 6625, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Utah Central (ftUS)" },
+  { 6626, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Utah North (ftUS)" },
+  { 6627, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Utah South (ftUS)" },
+  { 6628, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(PA11) / Hawaii zone 1" },
+  { 6629, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(PA11) / Hawaii zone 2" },
+  { 6630, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(PA11) / Hawaii zone 3" },
+  { 6631, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(PA11) / Hawaii zone 4" },
+  { 6632, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(PA11) / Hawaii zone 5" },
+  { 6633, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(PA11) / Hawaii zone 3 (ftUS)" },
+  { 6634, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(PA11) / UTM zone 4N" },
+  { 6635, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(PA11) / UTM zone 5N" },
+  { 6636, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(PA11) / UTM zone 2S" },
+  { 6637, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(MA11) / Guam Map Grid" },
+  { 6638, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tutuila 1962 height" },
+  { 6639, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Guam 1963 height" },
+  { 6640, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NMVD03 height" },
+  { 6641, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PRVD02 height" },
+  { 6642, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "VIVD09 height" },
+  { 6643, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ASVD02 height" },
+  { 6644, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GUVD04 height" },
+  { 6646, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Karbala 1979 / Iraq National Grid" },
+  { 6647, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CGVD2013 height" },
+  { 6649, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) + CGVD2013 height" },
+  { 6650, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 7N + CGVD2013 height" },
+  { 6651, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 8N + CGVD2013 height" },
+  { 6652, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 9N + CGVD2013 height" },
+  { 6653, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 10N + CGVD2013 height" },
+  { 6654, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 11N + CGVD2013 height" },
+  { 6655, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 12N + CGVD2013 height" },
+  { 6656, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 13N + CGVD2013 height" },
+  { 6657, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 14N + CGVD2013 height" },
+  { 6658, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 15N + CGVD2013 height" },
+  { 6659, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 16N + CGVD2013 height" },
+  { 6660, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 17N + CGVD2013 height" },
+  { 6661, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 18N + CGVD2013 height" },
+  { 6662, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 19N + CGVD2013 height" },
+  { 6663, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 20N + CGVD2013 height" },
+  { 6664, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 21N + CGVD2013 height" },
+  { 6665, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / UTM zone 22N + CGVD2013 height" },
+  { 6666, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011" },
+  { 6667, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011" },
+  { 6668, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011" },
+  { 6669, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS I" },
+  { 6670, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS II" },
+  { 6671, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS III" },
+  { 6672, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS IV" },
+  { 6673, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS V" },
+  { 6674, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS VI" },
+  { 6675, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS VII" },
+  { 6676, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS VIII" },
+  { 6677, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS IX" },
+  { 6678, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS X" },
+  { 6679, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS XI" },
+  { 6680, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS XII" },
+  { 6681, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS XIII" },
+  { 6682, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS XIV" },
+  { 6683, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS XV" },
+  { 6684, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS XVI" },
+  { 6685, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS XVII" },
+  { 6686, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS XVIII" },
+  { 6687, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / Japan Plane Rectangular CS XIX" },
+  { 6688, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / UTM zone 51N" },
+  { 6689, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / UTM zone 52N" },
+  { 6690, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / UTM zone 53N" },
+  { 6691, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / UTM zone 54N" },
+  { 6692, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 / UTM zone 55N" },
+  { 6693, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JSLD72 height" },
+  { 6694, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 (vertical) height" },
+  { 6695, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 (vertical) height" },
+  { 6696, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2000 + JGD2000 (vertical) height" },
+  { 6697, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JGD2011 + JGD2011 (vertical) height" },
+  { 6700, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo + JSLD72 height" },
+  { 6703, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / TM 60 SW" },
+  { 6704, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RDN2008" },
+  { 6705, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RDN2008" },
+  { 6706, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RDN2008" },
+  { 6707, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RDN2008 / TM32" },
+  { 6708, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RDN2008 / TM33" },
+  { 6709, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RDN2008 / TM34" },
+  { 6715, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Christmas Island Grid 1985" },
+  { 6720, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / CIG92" },
+  { 6721, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / CIG94" },
+  { 6722, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / CKIG92" },
+  { 6723, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / CKIG94" },
+  { 6732, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / MGA zone 41" },
+  { 6733, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / MGA zone 42" },
+  { 6734, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / MGA zone 43" },
+  { 6735, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / MGA zone 44" },
+  { 6736, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / MGA zone 46" },
+  { 6737, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / MGA zone 47" },
+  { 6738, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "GDA94 / MGA zone 59" },
+  { 6781, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96)" },
+  { 6782, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96)" },
+  { 6783, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96)" },
+  { 6784, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Baker zone (m)" },
+  { 6785, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Baker zone (ft)" },
+  { 6786, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Baker zone (m)" },
+  { 6787, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Baker zone (ft)" },
+  { 6788, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Bend-Klamath Falls zone (m)" },
+  { 6789, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Bend-Klamath Falls zone (ft)" },
+  { 6790, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Bend-Klamath Falls zone (m)" },
+  { 6791, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Bend-Klamath Falls zone (ft)" },
+  { 6792, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Bend-Redmond-Prineville zone (m)" },
+  { 6793, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Bend-Redmond-Prineville zone (ft)" },
+  { 6794, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Bend-Redmond-Prineville zone (m)" },
+  { 6795, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Bend-Redmond-Prineville zone (ft)" },
+  { 6796, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Bend-Burns zone (m)" },
+  { 6797, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Bend-Burns zone (ft)" },
+  { 6798, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Bend-Burns zone (m)" },
+  { 6799, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Bend-Burns zone (ft)" },
+  { 6800, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Canyonville-Grants Pass zone (m)" },
+  { 6801, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Canyonville-Grants Pass zone (ft)" },
+  { 6802, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Canyonville-Grants Pass zone (m)" },
+  { 6803, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Canyonville-Grants Pass zone (ft)" },
+  { 6804, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Columbia River East zone (m)" },
+  { 6805, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Columbia River East zone (ft)" },
+  { 6806, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Columbia River East zone (m)" },
+  { 6807, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Columbia River East zone (ft)" },
+  { 6808, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Columbia River West zone (m)" },
+  { 6809, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Columbia River West zone (ft)" },
+  { 6810, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Columbia River West zone (m)" },
+  { 6811, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Columbia River West zone (ft)" },
+  { 6812, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Cottage Grove-Canyonville zone (m)" },
+  { 6813, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Cottage Grove-Canyonville zone (ft)" },
+  { 6814, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Cottage Grove-Canyonville zone (m)" },
+  { 6815, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Cottage Grove-Canyonville zone (ft)" },
+  { 6816, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Dufur-Madras zone (m)" },
+  { 6817, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Dufur-Madras zone (ft)" },
+  { 6818, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Dufur-Madras zone (m)" },
+  { 6819, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Dufur-Madras zone (ft)" },
+  { 6820, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Eugene zone (m)" },
+  { 6821, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Eugene zone (ft)" },
+  { 6822, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Eugene zone (m)" },
+  { 6823, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Eugene zone (ft)" },
+  { 6824, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Grants Pass-Ashland zone (m)" },
+  { 6825, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Grants Pass-Ashland zone (ft)" },
+  { 6826, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Grants Pass-Ashland zone (m)" },
+  { 6827, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Grants Pass-Ashland zone (ft)" },
+  { 6828, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Gresham-Warm Springs zone (m)" },
+  { 6829, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Gresham-Warm Springs zone (ft)" },
+  { 6830, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Gresham-Warm Springs zone (m)" },
+  { 6831, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Gresham-Warm Springs zone (ft)" },
+  { 6832, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon La Grande zone (m)" },
+  { 6833, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon La Grande zone (ft)" },
+  { 6834, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon La Grande zone (m)" },
+  { 6835, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon La Grande zone (ft)" },
+  { 6836, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Ontario zone (m)" },
+  { 6837, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Ontario zone (ft)" },
+  { 6838, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Ontario zone (m)" },
+  { 6839, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Ontario zone (ft)" },
+  { 6840, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Coast zone (m)" },
+  { 6841, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Coast zone (ft)" },
+  { 6842, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Coast zone (m)" },
+  { 6843, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Coast zone (ft)" },
+  { 6844, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Pendleton zone (m)" },
+  { 6845, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Pendleton zone (ft)" },
+  { 6846, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Pendleton zone (m)" },
+  { 6847, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Pendleton zone (ft)" },
+  { 6848, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Pendleton-La Grande zone (m)" },
+  { 6849, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Pendleton-La Grande zone (ft)" },
+  { 6850, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Pendleton-La Grande zone (m)" },
+  { 6851, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Pendleton-La Grande zone (ft)" },
+  { 6852, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Portland zone (m)" },
+  { 6853, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Portland zone (ft)" },
+  { 6854, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Portland zone (m)" },
+  { 6855, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Portland zone (ft)" },
+  { 6856, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Salem zone (m)" },
+  { 6857, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Salem zone (ft)" },
+  { 6858, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Salem zone (m)" },
+  { 6859, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Salem zone (ft)" },
+  { 6860, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Santiam Pass zone (m)" },
+  { 6861, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon Santiam Pass zone (ft)" },
+  { 6862, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Santiam Pass zone (m)" },
+  { 6863, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Oregon Santiam Pass (ft)" },
+  { 6867, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon LCC (m)" },
+  { 6868, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon GIC Lambert (ft)" },
+  { 6870, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Albania TM 2010" },
+  { 6871, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Pseudo-Mercator +  EGM2008 geoid height" },
+  { 6875, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RDN2008 / Italy zone" },
+  { 6876, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RDN2008 / Zone 12" },
+  { 6879, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Wisconsin Central" },
+  { 6880, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Nebraska (ftUS)" },
+  { 6881, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Aden 1925" },
+  { 6882, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bekaa Valley 1920" },
+  { 6883, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bioko" },
+  { 6884, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon North" },
+  { 6885, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon North (ft)" },
+  { 6886, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon South" },
+  { 6887, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CORS96) / Oregon South (ft)" },
+  { 6892, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "South East Island 1943" },
+  { 6893, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / World Mercator +  EGM2008 geoid height" },
+  { 6894, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Gambia" },
+  { 6915, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "South East Island 1943 / UTM zone 40N" },
+  { 6916, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SHD height" },
+  { 6917, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SVY21 + SHD height" },
+  { 6922, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Kansas LCC" },
+  { 6923, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Kansas LCC (ftUS)" },
+  { 6924, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Kansas LCC" },
+  { 6925, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / Kansas LCC (ftUS)" },
+  { 6927, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SVY21 / Singapore TM + SHD height" },
+  { 6931, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / NSIDC EASE-Grid 2.0 North" },
+  { 6932, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / NSIDC EASE-Grid 2.0 South" },
+  { 6933, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / NSIDC EASE-Grid 2.0 Global" },
+  { 6934, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGS08" },
+  { 6956, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "VN-2000 / TM-3 zone 481" },
+  { 6957, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "VN-2000 / TM-3 zone 482" },
+  { 6958, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "VN-2000 / TM-3 zone 491" },
+  { 6959, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "VN-2000 / TM-3 Da Nang zone" },
+  { 6962, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Albania LCC 2010" },
+  { 6966, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Michigan North" },
+  { 6978, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGD05" },
+  { 6979, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGD05" },
+  { 6980, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGD05" },
+  { 6981, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IG05 Intermediate CRS" },
+  { 6982, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IG05 Intermediate CRS" },
+  { 6983, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IG05 Intermediate CRS" },
+  { 6984, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Israeli Grid 05" },
+  { 6985, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGD05/12" },
+  { 6986, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGD05/12" },
+  { 6987, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IGD05/12" },
+  { 6988, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IG05/12 Intermediate CRS" },
+  { 6989, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IG05/12 Intermediate CRS" },
+  { 6990, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "IG05/12 Intermediate CRS" },
+  { 6991, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Israeli Grid 05/12" },
+  { 6996, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / San Francisco CS13" },
+  { 6997, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(2011) / San Francisco CS13 (ftUS)" },
+  { 7005, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nahrwan 1934 / UTM zone 37N" },
+  { 7006, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nahrwan 1934 / UTM zone 38N" },
+  { 7007, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nahrwan 1934 / UTM zone 39N" },
+  { 7400, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) + NGF IGN69 height" },
+  { 7401, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / France II + NGF Lallemand" },
+  { 7402, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / France II + NGF IGN69" },
+  { 7403, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / France III + NGF IGN69" },
+  { 7404, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT90 + RH70 height" },
+  { 7405, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "OSGB 1936 / British National Grid + ODN height" },
+  { 7406, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 + NGVD29 height" },
+  { 7407, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Texas North + NGVD29 height" },
+  { 7408, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RD/NAP" },
+  { 7409, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 + EVRF2000 height" },
+  { 7410, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PSHD93" },
+  { 7411, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert zone II + NGF Lallemand height" },
+  { 7412, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert zone II + NGF IGN69" },
+  { 7413, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert zone III + NGF IGN69" },
+  { 7414, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo + JSLD69 height" },
+  { 7415, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Amersfoort / RD New + NAP height" },
+  { 7416, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 32N + DVR90 height" },
+  { 7417, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / UTM zone 33N + DVR90 height" },
+  { 7418, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Kp2000 Jutland + DVR90 height" },
+  { 7419, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Kp2000 Zealand + DVR90 height" },
+  { 7420, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / Kp2000 Bornholm + DVR90 height" },
+  { 7421, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert zone II + NGF-IGN69 height" },
+  { 7422, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert zone III + NGF-IGN69 height" },
+  { 7423, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 + EVRF2007 height" },
+  { 20004, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 4" },
+  { 20005, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 5" },
+  { 20006, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 6" },
+  { 20007, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 7" },
+  { 20008, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 8" },
+  { 20009, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 9" },
+  { 20010, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 10" },
+  { 20011, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 11" },
+  { 20012, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 12" },
+  { 20013, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 13" },
+  { 20014, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 14" },
+  { 20015, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 15" },
+  { 20016, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 16" },
+  { 20017, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 17" },
+  { 20018, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 18" },
+  { 20019, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 19" },
+  { 20020, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 20" },
+  { 20021, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 21" },
+  { 20022, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 22" },
+  { 20023, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 23" },
+  { 20024, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 24" },
+  { 20025, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 25" },
+  { 20026, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 26" },
+  { 20027, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 27" },
+  { 20028, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 28" },
+  { 20029, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 29" },
+  { 20030, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 30" },
+  { 20031, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 31" },
+  { 20032, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger zone 32" },
+  { 20064, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 4N" },
+  { 20065, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 5N" },
+  { 20066, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 6N" },
+  { 20067, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 7N" },
+  { 20068, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 8N" },
+  { 20069, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 9N" },
+  { 20070, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 10N" },
+  { 20071, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 11N" },
+  { 20072, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 12N" },
+  { 20073, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 13N" },
+  { 20074, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 14N" },
+  { 20075, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 15N" },
+  { 20076, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 16N" },
+  { 20077, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 17N" },
+  { 20078, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 18N" },
+  { 20079, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 19N" },
+  { 20080, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 20N" },
+  { 20081, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 21N" },
+  { 20082, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 22N" },
+  { 20083, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 23N" },
+  { 20084, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 24N" },
+  { 20085, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 25N" },
+  { 20086, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 26N" },
+  { 20087, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 27N" },
+  { 20088, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 28N" },
+  { 20089, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 29N" },
+  { 20090, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 30N" },
+  { 20091, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 31N" },
+  { 20092, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1995 / Gauss-Kruger 32N" },
+  { 20135, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Adindan / UTM zone 35N" },
+  { 20136, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Adindan / UTM zone 36N" },
+  { 20137, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 37, -1, 0, "Adindan / UTM zone 37N" },
+  { 20138, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 38, -1, 0, "Adindan / UTM zone 38N" },
+  { 20248, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66 / AMG zone 48" },
+  { 20249, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66 / AMG zone 49" },
+  { 20250, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66 / AMG zone 50" },
+  { 20251, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66 / AMG zone 51" },
+  { 20252, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66 / AMG zone 52" },
+  { 20253, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66 / AMG zone 53" },
+  { 20254, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66 / AMG zone 54" },
+  { 20255, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66 / AMG zone 55" },
+  { 20256, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66 / AMG zone 56" },
+  { 20257, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66 / AMG zone 57" },
+  { 20258, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD66 / AMG zone 58" },
+  { 20348, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD84 / AMG zone 48" },
+  { 20349, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD84 / AMG zone 49" },
+  { 20350, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD84 / AMG zone 50" },
+  { 20351, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD84 / AMG zone 51" },
+  { 20352, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD84 / AMG zone 52" },
+  { 20353, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD84 / AMG zone 53" },
+  { 20354, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD84 / AMG zone 54" },
+  { 20355, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD84 / AMG zone 55" },
+  { 20356, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD84 / AMG zone 56" },
+  { 20357, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD84 / AMG zone 57" },
+  { 20358, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "AGD84 / AMG zone 58" },
+  { 20436, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ain el Abd / UTM zone 36N" },
+  { 20437, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 37, -1, 0, "Ain el Abd / UTM zone 37N" },
+  { 20438, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 38, -1, 0, "Ain el Abd / UTM zone 38N" },
+  { 20439, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 39, -1, 0, "Ain el Abd / UTM zone 39N" },
+  { 20440, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ain el Abd / UTM zone 40N" },
+  { 20499, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Ain el Abd / Bahrain Grid" },
+  { 20538, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 38, -1, 0, "Afgooye / UTM zone 38N" },
+  { 20539, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 39, -1, 0, "Afgooye / UTM zone 39N" },
+  { 20790, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lisbon (Lisbon) / Portuguese National Grid" },
+  { 20791, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Lisbon (Lisbon) / Portuguese Grid" },
+  { 20822, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -22, -1, 0, "Aratu / UTM zone 22S" },
+  { 20823, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -23, -1, 0, "Aratu / UTM zone 23S" },
+  { 20824, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -24, -1, 0, "Aratu / UTM zone 24S" },
+  { 20934, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Arc 1950 / UTM zone 34S" },
+  { 20935, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Arc 1950 / UTM zone 35S" },
+  { 20936, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Arc 1950 / UTM zone 36S" },
+  { 21035, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Arc 1960 / UTM zone 35S" },
+  { 21036, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Arc 1960 / UTM zone 36S" },
+  { 21037, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Arc 1960 / UTM zone 37S" },
+  { 21095, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Arc 1960 / UTM zone 35N" },
+  { 21096, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Arc 1960 / UTM zone 36N" },
+  { 21097, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Arc 1960 / UTM zone 37N" },
+  { 21100, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Batavia (Jakarta) / NEIEZ" },
+  { 21148, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -48, -1, 0, "Batavia / UTM zone 48S" },
+  { 21149, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -49, -1, 0, "Batavia / UTM zone 49S" },
+  { 21150, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -50, -1, 0, "Batavia / UTM zone 50S" },
+  { 21291, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Barbados 1938 / British West Indies Grid" },
+  { 21292, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Barbados 1938 / Barbados National Grid" },
+  { 21413, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger zone 13" },
+  { 21414, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger zone 14" },
+  { 21415, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger zone 15" },
+  { 21416, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger zone 16" },
+  { 21417, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger zone 17" },
+  { 21418, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger zone 18" },
+  { 21419, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger zone 19" },
+  { 21420, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger zone 20" },
+  { 21421, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger zone 21" },
+  { 21422, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger zone 22" },
+  { 21423, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger zone 23" },
+  { 21453, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger CM 75E" },
+  { 21454, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger CM 81E" },
+  { 21455, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger CM 87E" },
+  { 21456, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger CM 93E" },
+  { 21457, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger CM 99E" },
+  { 21458, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger CM 105E" },
+  { 21459, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger CM 111E" },
+  { 21460, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger CM 117E" },
+  { 21461, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger CM 123E" },
+  { 21462, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger CM 129E" },
+  { 21463, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger CM 135E" },
+  { 21473, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger 13N" },
+  { 21474, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger 14N" },
+  { 21475, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger 15N" },
+  { 21476, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger 16N" },
+  { 21477, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger 17N" },
+  { 21478, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger 18N" },
+  { 21479, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger 19N" },
+  { 21480, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger 20N" },
+  { 21481, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger 21N" },
+  { 21482, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger 22N" },
+  { 21483, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Beijing 1954 / Gauss-Kruger 23N" },
+  { 21500, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Belge 1950 (Brussels) / Belge Lambert 50" },
+  { 21780, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bern 1898 (Bern) / LV03C" },
+  { 21781, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CH1903 / LV03" },
+  { 21782, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "CH1903 / LV03C-G" },
+  { 21817, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 17, -1, 0, "Bogota 1975 / UTM zone 17N" },
+  { 21818, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 18, -1, 0, "Bogota 1975 / UTM zone 18N" },
+  { 21891, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bogota 1975 / Colombia West zone" },
+  { 21892, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bogota 1975 / Colombia Bogota zone" },
+  { 21893, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bogota 1975 / Colombia East Central zone" },
+  { 21894, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bogota 1975 / Colombia East" },
+  { 21896, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bogota 1975 / Colombia West zone" },
+  { 21897, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bogota 1975 / Colombia Bogota zone" },
+  { 21898, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bogota 1975 / Colombia East Central zone" },
+  { 21899, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Bogota 1975 / Colombia East" },
+  { 22032, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -32, -1, 0, "Camacupa / UTM zone 32S" },
+  { 22033, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -33, -1, 0, "Camacupa / UTM zone 33S" },
+  { 22091, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Camacupa / TM 11.30 SE" },
+  { 22092, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Camacupa / TM 12 SE" },
+  { 22171, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 98 / Argentina 1" },
+  { 22172, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 98 / Argentina 2" },
+  { 22173, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 98 / Argentina 3" },
+  { 22174, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 98 / Argentina 4" },
+  { 22175, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 98 / Argentina 5" },
+  { 22176, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 98 / Argentina 6" },
+  { 22177, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 98 / Argentina 7" },
+  { 22181, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 94 / Argentina 1" },
+  { 22182, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 94 / Argentina 2" },
+  { 22183, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 94 / Argentina 3" },
+  { 22184, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 94 / Argentina 4" },
+  { 22185, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 94 / Argentina 5" },
+  { 22186, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 94 / Argentina 6" },
+  { 22187, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "POSGAR 94 / Argentina 7" },
+  { 22191, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Campo Inchauspe / Argentina 1" },
+  { 22192, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Campo Inchauspe / Argentina 2" },
+  { 22193, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Campo Inchauspe / Argentina 3" },
+  { 22194, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Campo Inchauspe / Argentina 4" },
+  { 22195, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Campo Inchauspe / Argentina 5" },
+  { 22196, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Campo Inchauspe / Argentina 6" },
+  { 22197, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Campo Inchauspe / Argentina 7" },
+  { 22234, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape / UTM zone 34S" },
+  { 22235, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape / UTM zone 35S" },
+  { 22236, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape / UTM zone 36S" },
+  { 22275, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape / Lo15" },
+  { 22277, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape / Lo17" },
+  { 22279, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape / Lo19" },
+  { 22281, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape / Lo21" },
+  { 22283, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape / Lo23" },
+  { 22285, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape / Lo25" },
+  { 22287, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape / Lo27" },
+  { 22289, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape / Lo29" },
+  { 22291, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape / Lo31" },
+  { 22293, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Cape / Lo33" },
+  { 22300, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Carthage (Paris) / Tunisia Mining Grid" },
+  { 22332, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 32, -1, 0, "Carthage / UTM zone 32N" },
+  { 22391, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Carthage / Nord Tunisie" },
+  { 22392, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Carthage / Sud Tunisie" },
+  { 22521, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Corrego Alegre 1970-72 / UTM zone 21S" },
+  { 22522, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Corrego Alegre 1970-72 / UTM zone 22S" },
+  { 22523, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -23, -1, 0, "Corrego Alegre 1970-72 / UTM zone 23S" },
+  { 22524, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -24, -1, 0, "Corrego Alegre 1970-72 / UTM zone 24S" },
+  { 22525, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Corrego Alegre 1970-72 / UTM zone 25S" },
+  { 22700, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Deir ez Zor / Levant Zone" },
+  { 22770, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Deir ez Zor / Syria Lambert" },
+  { 22780, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Deir ez Zor / Levant Stereographic" },
+  { 22832, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 32, -1, 0, "Douala / UTM zone 32N" },
+  { 22991, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Egypt 1907 / Blue Belt" },
+  { 22992, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Egypt 1907 / Red Belt" },
+  { 22993, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Egypt 1907 / Purple Belt" },
+  { 22994, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Egypt 1907 / Extended Purple Belt" },
+  { 23028, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_Inter, 28, -1, 0, "ED50 / UTM zone 28N" },
+  { 23029, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_Inter, 29, -1, 0, "ED50 / UTM zone 29N" },
+  { 23030, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_Inter, 30, -1, 0, "ED50 / UTM zone 30N" },
+  { 23031, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_Inter, 31, -1, 0, "ED50 / UTM zone 31N" },
+  { 23032, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_Inter, 32, -1, 0, "ED50 / UTM zone 32N" },
+  { 23033, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_Inter, 33, -1, 0, "ED50 / UTM zone 33N" },
+  { 23034, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_Inter, 34, -1, 0, "ED50 / UTM zone 34N" },
+  { 23035, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_Inter, 35, -1, 0, "ED50 / UTM zone 35N" },
+  { 23036, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_Inter, 36, -1, 0, "ED50 / UTM zone 36N" },
+  { 23037, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_Inter, 37, -1, 0, "ED50 / UTM zone 37N" },
+  { 23038, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_Inter, 38, -1, 0, "ED50 / UTM zone 38N" },
+  { 23090, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / TM 0 N" },
+  { 23095, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ED50 / TM 5 NE" },
+  { 23239, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 39, -1, 0, "Fahud / UTM zone 39N" },
+  { 23240, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 40, -1, 0, "Fahud / UTM zone 40N" },
+  { 23433, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 33, -1, 0, "Garoua / UTM zone 33N" },
+  { 23700, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "HD72 / EOV" },
+  { 23830, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 46.2" },
+  { 23831, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 47.1" },
+  { 23832, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 47.2" },
+  { 23833, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 48.1" },
+  { 23834, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 48.2" },
+  { 23835, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 49.1" },
+  { 23836, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 49.2" },
+  { 23837, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 50.1" },
+  { 23838, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 50.2" },
+  { 23839, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 51.1" },
+  { 23840, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 51.2" },
+  { 23841, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 52.1" },
+  { 23842, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 52.2" },
+  { 23843, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 53.1" },
+  { 23844, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 53.2" },
+  { 23845, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / Indonesia TM-3 zone 54.1" },
+  { 23846, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, 46, -1, 0, "ID74 / UTM zone 46N" },
+  { 23847, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, 47, -1, 0, "ID74 / UTM zone 47N" },
+  { 23848, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, 48, -1, 0, "ID74 / UTM zone 48N" },
+  { 23849, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, 49, -1, 0, "ID74 / UTM zone 49N" },
+  { 23850, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, 50, -1, 0, "ID74 / UTM zone 50N" },
+  { 23851, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, 51, -1, 0, "ID74 / UTM zone 51N" },
+  { 23852, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, 52, -1, 0, "ID74 / UTM zone 52N" },
+  { 23853, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, 53, -1, 0, "ID74 / UTM zone 53N" },
+  { 23866, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 46N" },
+  { 23867, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 47N" },
+  { 23868, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 48N" },
+  { 23869, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 49N" },
+  { 23870, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 50N" },
+  { 23871, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 51N" },
+  { 23872, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 52N" },
+  { 23877, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 47S" },
+  { 23878, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 48S" },
+  { 23879, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 49S" },
+  { 23880, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 50S" },
+  { 23881, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 51S" },
+  { 23882, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 52S" },
+  { 23883, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 53S" },
+  { 23884, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DGN95 / UTM zone 54S" },
+  { 23886, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, -46, -1, 0, "ID74 / UTM zone 46S" },
+  { 23887, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, -47, -1, 0, "ID74 / UTM zone 47S" },
+  { 23888, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, -48, -1, 0, "ID74 / UTM zone 48S" },
+  { 23889, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, -49, -1, 0, "ID74 / UTM zone 49S" },
+  { 23890, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, -50, -1, 0, "ID74 / UTM zone 50S" },
+  { 23891, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, -51, -1, 0, "ID74 / UTM zone 51S" },
+  { 23892, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, -52, -1, 0, "ID74 / UTM zone 52S" },
+  { 23893, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, -53, -1, 0, "ID74 / UTM zone 53S" },
+  { 23894, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_ID74, -54, -1, 0, "ID74 / UTM zone 54S" },
+  { 23946, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Indian 1954 / UTM zone 46N" },
+  { 23947, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 47, -1, 0, "Indian 1954 / UTM zone 47N" },
+  { 23948, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 48, -1, 0, "Indian 1954 / UTM zone 48N" },
+  { 24047, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 47, -1, 0, "Indian 1975 / UTM zone 47N" },
+  { 24048, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 48, -1, 0, "Indian 1975 / UTM zone 48N" },
+  { 24100, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Jamaica 1875 / Jamaica (Old Grid)" },
+  { 24200, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "JAD69 / Jamaica National Grid" },
+  { 24305, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1937 / UTM zone 45N" },
+  { 24306, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1937 / UTM zone 46N" },
+  { 24311, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1962 / UTM zone 41N" },
+  { 24312, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1962 / UTM zone 42N" },
+  { 24313, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1962 / UTM zone 43N" },
+  { 24342, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1975 / UTM zone 42N" },
+  { 24343, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1975 / UTM zone 43N" },
+  { 24344, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1975 / UTM zone 44N" },
+  { 24345, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1975 / UTM zone 45N" },
+  { 24346, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1975 / UTM zone 46N" },
+  { 24347, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1975 / UTM zone 47N" },
+  { 24370, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1880 / India zone 0" },
+  { 24371, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1880 / India zone I" },
+  { 24372, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1880 / India zone IIa" },
+  { 24373, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1880 / India zone IIIa" },
+  { 24374, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1880 / India zone IVa" },
+  { 24375, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1937 / India zone IIb" },
+  { 24376, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1962 / India zone I" },
+  { 24377, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1962 / India zone IIa" },
+  { 24378, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1975 / India zone I" },
+  { 24379, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1975 / India zone IIa" },
+  { 24380, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1975 / India zone IIb" },
+  { 24381, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1975 / India zone IIIa" },
+  { 24382, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1880 / India zone IIb" },
+  { 24383, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kalianpur 1975 / India zone IVa" },
+  { 24500, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau 1968 / Singapore Grid" },
+  { 24547, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 47, -1, 0, "Kertau 1968 / UTM zone 47N" },
+  { 24548, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 48, -1, 0, "Kertau 1968 / UTM zone 48N" },
+  { 24571, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Kertau / R.S.O. Malaya (ch)" },
+  { 24600, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KOC Lambert" },
+  { 24718, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "La Canoa / UTM zone 18N" },
+  { 24719, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "La Canoa / UTM zone 19N" },
+  { 24720, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 20, -1, 0, "La Canoa / UTM zone 20N" },
+  { 24721, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 21, -1, 0, 0 },
+  { 24817, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PSAD56 / UTM zone 17N" },
+  { 24818, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 18, -1, 0, "PSAD56 / UTM zone 18N" },
+  { 24819, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 19, -1, 0, "PSAD56 / UTM zone 19N" },
+  { 24820, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 20, -1, 0, "PSAD56 / UTM zone 20N" },
+  { 24821, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 21, -1, 0, "PSAD56 / UTM zone 21N" },
+  { 24877, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -17, -1, 0, "PSAD56 / UTM zone 17S" },
+  { 24878, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -18, -1, 0, "PSAD56 / UTM zone 18S" },
+  { 24879, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -19, -1, 0, "PSAD56 / UTM zone 19S" },
+  { 24880, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -20, -1, 0, "PSAD56 / UTM zone 20S" },
+  { 24881, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PSAD56 / UTM zone 21S" },
+  { 24882, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PSAD56 / UTM zone 22S" },
+  { 24891, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PSAD56 / Peru west zone" },
+  { 24892, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PSAD56 / Peru central zone" },
+  { 24893, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "PSAD56 / Peru east zone" },
+  { 25000, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Leigon / Ghana Metre Grid" },
+  { 25231, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 31, -1, 0, "Lome / UTM zone 31N" },
+  { 25391, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Luzon 1911 / Philippines zone I" },
+  { 25392, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Luzon 1911 / Philippines zone II" },
+  { 25393, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Luzon 1911 / Philippines zone III" },
+  { 25394, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Luzon 1911 / Philippines zone IV" },
+  { 25395, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Luzon 1911 / Philippines zone V" },
+  { 25700, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Makassar (Jakarta) / NEIEZ" },
+  { 25828, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 28, -1, 0, "ETRS89 / UTM zone 28N" },
+  { 25829, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 29, -1, 0, "ETRS89 / UTM zone 29N" },
+  { 25830, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 30, -1, 0, "ETRS89 / UTM zone 30N" },
+  { 25831, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 31, -1, 0, "ETRS89 / UTM zone 31N" },
+  { 25832, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 32, -1, 0, "ETRS89 / UTM zone 32N" },
+  { 25833, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 33, -1, 0, "ETRS89 / UTM zone 33N" },
+  { 25834, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 34, -1, 0, "ETRS89 / UTM zone 34N" },
+  { 25835, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 35, -1, 0, "ETRS89 / UTM zone 35N" },
+  { 25836, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 36, -1, 0, "ETRS89 / UTM zone 36N" },
+  { 25837, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 37, -1, 0, "ETRS89 / UTM zone 37N" },
+  { 25838, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 38, -1, 0, "ETRS89 / UTM zone 38N" },
+  { 25884, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ETRS89 / TM Baltic93" },
+  { 25932, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -32, -1, 0, "Malongo 1987 / UTM zone 32S" },
+  { 26191, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Merchich / Nord Maroc" },
+  { 26192, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Merchich / Sud Maroc" },
+  { 26193, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Merchich / Sahara" },
+  { 26194, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Merchich / Sahara Nord" },
+  { 26195, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Merchich / Sahara Sud" },
+  { 26237, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 37, -1, 0, "Massawa / UTM zone 37N" },
+  { 26331, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 31, -1, 0, "Minna / UTM zone 31N" },
+  { 26332, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 32, -1, 0, "Minna / UTM zone 32N" },
+  { 26391, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Minna / Nigeria West Belt" },
+  { 26392, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Minna / Nigeria Mid Belt" },
+  { 26393, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Minna / Nigeria East Belt" },
+  { 26432, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -32, -1, 0, "Mhast / UTM zone 32S" },
+  { 26591, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Monte Mario (Rome) / Italy zone 1" },
+  { 26592, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Monte Mario (Rome) / Italy zone 2" },
+  { 26632, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 32, -1, 0, "M'poraloko / UTM zone 32N" },
+  { 26692, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -32, -1, 0, "M'poraloko / UTM zone 32S" },
+  { 26701, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / UTM zone 1N" },
+  { 26702, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / UTM zone 2N" },
+  { 26703, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 3, -1, 0, "NAD27 / UTM zone 3N" },
+  { 26704, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 4, -1, 0, "NAD27 / UTM zone 4N" },
+  { 26705, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 5, -1, 0, "NAD27 / UTM zone 5N" },
+  { 26706, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 6, -1, 0, "NAD27 / UTM zone 6N" },
+  { 26707, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 7, -1, 0, "NAD27 / UTM zone 7N" },
+  { 26708, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 8, -1, 0, "NAD27 / UTM zone 8N" },
+  { 26709, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 9, -1, 0, "NAD27 / UTM zone 9N" },
+  { 26710, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 10, -1, 0, "NAD27 / UTM zone 10N" },
+  { 26711, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 11, -1, 0, "NAD27 / UTM zone 11N" },
+  { 26712, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 12, -1, 0, "NAD27 / UTM zone 12N" },
+  { 26713, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 13, -1, 0, "NAD27 / UTM zone 13N" },
+  { 26714, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 14, -1, 0, "NAD27 / UTM zone 14N" },
+  { 26715, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 15, -1, 0, "NAD27 / UTM zone 15N" },
+  { 26716, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 16, -1, 0, "NAD27 / UTM zone 16N" },
+  { 26717, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 17, -1, 0, "NAD27 / UTM zone 17N" },
+  { 26718, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 18, -1, 0, "NAD27 / UTM zone 18N" },
+  { 26719, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 19, -1, 0, "NAD27 / UTM zone 19N" },
+  { 26720, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 20, -1, 0, "NAD27 / UTM zone 20N" },
+  { 26721, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 21, -1, 0, "NAD27 / UTM zone 21N" },
+  { 26722, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 22, -1, 0, "NAD27 / UTM zone 22N" },
+  { 26729, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AL_E", "NAD27 / Alabama East" },
+  { 26730, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AL_W", "NAD27 / Alabama West" },
+  { 26731, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AK_1", "NAD27 / Alaska zone 1" },
+  { 26732, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AK_2", "NAD27 / Alaska zone 2" },
+  { 26733, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AK_3", "NAD27 / Alaska zone 3" },
+  { 26734, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AK_4", "NAD27 / Alaska zone 4" },
+  { 26735, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AK_5", "NAD27 / Alaska zone 5" },
+  { 26736, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AK_6", "NAD27 / Alaska zone 6" },
+  { 26737, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AK_7", "NAD27 / Alaska zone 7" },
+  { 26738, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AK_8", "NAD27 / Alaska zone 8" },
+  { 26739, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AK_9", "NAD27 / Alaska zone 9" },
+  { 26740, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AK_10", "NAD27 / Alaska zone 10" },
+  { 26741, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "CA_I", "NAD27 / California zone I" },
+  { 26742, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "CA_II", "NAD27 / California zone II" },
+  { 26743, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "CA_III", "NAD27 / California zone III" },
+  { 26744, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "CA_IV", "NAD27 / California zone IV" },
+  { 26745, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "CA_V", "NAD27 / California zone V" },
+  { 26746, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "CA_VI", "NAD27 / California zone VI" },
+  { 26747, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "CA_VII", "NAD27 / California zone VII" },
+  { 26748, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AZ_E", "NAD27 / Arizona East" },
+  { 26749, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AZ_C", "NAD27 / Arizona Central" },
+  { 26750, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AZ_W", "NAD27 / Arizona West" },
+  { 26751, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AR_N", "NAD27 / Arkansas North" },
+  { 26752, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "AR_S", "NAD27 / Arkansas South" },
+  { 26753, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "CO_N", "NAD27 / Colorado North" },
+  { 26754, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "CO_C", "NAD27 / Colorado Central" },
+  { 26755, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "CO_S", "NAD27 / Colorado South" },
+  { 26756, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "CT", "NAD27 / Connecticut" },
+  { 26757, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "DE", "NAD27 / Delaware" },
+  { 26758, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "FL_E", "NAD27 / Florida East" },
+  { 26759, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "FL_W", "NAD27 / Florida West" },
+  { 26760, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "FL_N", "NAD27 / Florida North" },
+  { 26761, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "HI_1", 0 },
+  { 26762, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "HI_2", 0 },
+  { 26763, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "HI_3", 0 },
+  { 26764, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "HI_4", 0 },
+  { 26765, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "HI_5", 0 },
+  { 26766, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "GA_E", "NAD27 / Georgia East" },
+  { 26767, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "GA_W", "NAD27 / Georgia West" },
+  { 26768, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "ID_E", "NAD27 / Idaho East" },
+  { 26769, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "ID_C", "NAD27 / Idaho Central" },
+  { 26770, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "ID_W", "NAD27 / Idaho West" },
+  { 26771, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "IL_E", "NAD27 / Illinois East" },
+  { 26772, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "IL_W", "NAD27 / Illinois West" },
+  { 26773, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "IN_E", "NAD27 / Indiana East" },
+  { 26774, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "IN_W", "NAD27 / Indiana West" },
+  { 26775, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "IA_N", "NAD27 / Iowa North" },
+  { 26776, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "IA_S", "NAD27 / Iowa South" },
+  { 26777, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "KS_N", "NAD27 / Kansas North" },
+  { 26778, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "KS_S", "NAD27 / Kansas South" },
+  { 26779, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "KY_N", "NAD27 / Kentucky North" },
+  { 26780, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "KY_S", "NAD27 / Kentucky South" },
+  { 26781, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "LA_N", "NAD27 / Louisiana North" },
+  { 26782, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "LA_S", "NAD27 / Louisiana South" },
+  { 26783, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "ME_E", "NAD27 / Maine East" },
+  { 26784, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "ME_W", "NAD27 / Maine West" },
+  { 26785, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MD", "NAD27 / Maryland" },
+  { 26786, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "M_M", "NAD27 / Massachusetts Mainland" },
+  { 26787, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "M_I", "NAD27 / Massachusetts Island" },
+  { 26788, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MI_N", 0 },
+  { 26789, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MI_C", 0 },
+  { 26790, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MI_S", 0 },
+  { 26791, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MN_N", "NAD27 / Minnesota North" },
+  { 26792, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MN_C", "NAD27 / Minnesota Central" },
+  { 26793, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MN_S", "NAD27 / Minnesota South" },
+  { 26794, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MS_E", "NAD27 / Mississippi East" },
+  { 26795, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MS_W", "NAD27 / Mississippi West" },
+  { 26796, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MO_E", "NAD27 / Missouri East" },
+  { 26797, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MO_C", "NAD27 / Missouri Central" },
+  { 26798, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MO_W", "NAD27 / Missouri West" },
+  { 26799, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / California zone VII" },
+  { 26801, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD Michigan / Michigan East" },
+  { 26802, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD Michigan / Michigan Old Central" },
+  { 26803, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD Michigan / Michigan West" },
+  { 26811, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD Michigan / Michigan North" },
+  { 26812, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD Michigan / Michigan Central" },
+  { 26813, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD Michigan / Michigan South" },
+  { 26814, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Maine East (ftUS)" },
+  { 26815, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Maine West (ftUS)" },
+  { 26819, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Minnesota North (ftUS)" },
+  { 26820, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Minnesota Central (ftUS)" },
+  { 26821, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Minnesota South (ftUS)" },
+  { 26822, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Nebraska (ftUS)" },
+  { 26823, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / West Virginia North (ftUS)" },
+  { 26824, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / West Virginia South (ftUS)" },
+  { 26825, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Maine East (ftUS)" },
+  { 26826, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Maine West (ftUS)" },
+  { 26830, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Minnesota North (ftUS)" },
+  { 26831, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Minnesota Central (ftUS)" },
+  { 26832, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Minnesota South (ftUS)" },
+  { 26833, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Nebraska (ftUS)" },
+  { 26834, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / West Virginia North (ftUS)" },
+  { 26835, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / West Virginia South (ftUS)" },
+  { 26836, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Maine East (ftUS)" },
+  { 26837, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Maine West (ftUS)" },
+  { 26841, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Minnesota North (ftUS)" },
+  { 26842, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Minnesota Central (ftUS)" },
+  { 26843, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Minnesota South (ftUS)" },
+  { 26844, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Nebraska (ftUS)" },
+  { 26845, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / West Virginia North (ftUS)" },
+  { 26846, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / West Virginia South (ftUS)" },
+  { 26847, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Maine East (ftUS)" },
+  { 26848, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Maine West (ftUS)" },
+  { 26849, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Minnesota North (ftUS)" },
+  { 26850, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Minnesota Central (ftUS)" },
+  { 26851, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Minnesota South (ftUS)" },
+  { 26852, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Nebraska (ftUS)" },
+  { 26853, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / West Virginia North (ftUS)" },
+  { 26854, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / West Virginia South (ftUS)" },
+  { 26855, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Maine East (ftUS)" },
+  { 26856, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Maine West (ftUS)" },
+  { 26857, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Minnesota North (ftUS)" },
+  { 26858, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Minnesota Central (ftUS)" },
+  { 26859, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Minnesota South (ftUS)" },
+  { 26860, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / Nebraska (ftUS)" },
+  { 26861, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / West Virginia North (ftUS)" },
+  { 26862, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(HARN) / West Virginia South (ftUS)" },
+  { 26863, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Maine East (ftUS)" },
+  { 26864, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Maine West (ftUS)" },
+  { 26865, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Minnesota North (ftUS)" },
+  { 26866, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Minnesota Central (ftUS)" },
+  { 26867, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Minnesota South (ftUS)" },
+  { 26868, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / Nebraska (ftUS)" },
+  { 26869, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / West Virginia North (ftUS)" },
+  { 26870, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(NSRS2007) / West Virginia South (ftUS)" },
+  { 26891, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 11" },
+  { 26892, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 12" },
+  { 26893, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 13" },
+  { 26894, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 14" },
+  { 26895, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 15" },
+  { 26896, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 16" },
+  { 26897, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 17" },
+  { 26898, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 1" },
+  { 26899, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83(CSRS) / MTM zone 2" },
+  { 26901, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / UTM zone 1N" },
+  { 26902, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / UTM zone 2N" },
+  { 26903, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 3, -1, 0, "NAD83 / UTM zone 3N" },
+  { 26904, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 4, -1, 0, "NAD83 / UTM zone 4N" },
+  { 26905, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 5, -1, 0, "NAD83 / UTM zone 5N" },
+  { 26906, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 6, -1, 0, "NAD83 / UTM zone 6N" },
+  { 26907, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 7, -1, 0, "NAD83 / UTM zone 7N" },
+  { 26908, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 8, -1, 0, "NAD83 / UTM zone 8N" },
+  { 26909, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 9, -1, 0, "NAD83 / UTM zone 9N" },
+  { 26910, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 10, -1, 0, "NAD83 / UTM zone 10N" },
+  { 26911, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 11, -1, 0, "NAD83 / UTM zone 11N" },
+  { 26912, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 12, -1, 0, "NAD83 / UTM zone 12N" },
+  { 26913, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 13, -1, 0, "NAD83 / UTM zone 13N" },
+  { 26914, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 14, -1, 0, "NAD83 / UTM zone 14N" },
+  { 26915, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 15, -1, 0, "NAD83 / UTM zone 15N" },
+  { 26916, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 16, -1, 0, "NAD83 / UTM zone 16N" },
+  { 26917, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 17, -1, 0, "NAD83 / UTM zone 17N" },
+  { 26918, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 18, -1, 0, "NAD83 / UTM zone 18N" },
+  { 26919, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 19, -1, 0, "NAD83 / UTM zone 19N" },
+  { 26920, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 20, -1, 0, "NAD83 / UTM zone 20N" },
+  { 26921, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 21, -1, 0, "NAD83 / UTM zone 21N" },
+  { 26922, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 22, -1, 0, "NAD83 / UTM zone 22N" },
+  { 26923, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 23, -1, 0, "NAD83 / UTM zone 23N" },
+  { 26929, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AL_E", "NAD83 / Alabama East" },
+  { 26930, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AL_W", "NAD83 / Alabama West" },
+  { 26931, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AK_1", "NAD83 / Alaska zone 1" },
+  { 26932, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AK_2", "NAD83 / Alaska zone 2" },
+  { 26933, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AK_3", "NAD83 / Alaska zone 3" },
+  { 26934, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AK_4", "NAD83 / Alaska zone 4" },
+  { 26935, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AK_5", "NAD83 / Alaska zone 5" },
+  { 26936, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AK_6", "NAD83 / Alaska zone 6" },
+  { 26937, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AK_7", "NAD83 / Alaska zone 7" },
+  { 26938, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AK_8", "NAD83 / Alaska zone 8" },
+  { 26939, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AK_9", "NAD83 / Alaska zone 9" },
+  { 26940, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AK_10", "NAD83 / Alaska zone 10" },
+  { 26941, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "CA_I", "NAD83 / California zone 1" },
+  { 26942, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "CA_II", "NAD83 / California zone 2" },
+  { 26943, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "CA_III", "NAD83 / California zone 3" },
+  { 26944, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "CA_IV", "NAD83 / California zone 4" },
+  { 26945, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "CA_V", "NAD83 / California zone 5" },
+  { 26946, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "CA_VI", "NAD83 / California zone 6" },
+  { 26947, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "CA_VII", 0 },
+  { 26948, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AZ_E", "NAD83 / Arizona East" },
+  { 26949, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AZ_C", "NAD83 / Arizona Central" },
+  { 26950, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AZ_W", "NAD83 / Arizona West" },
+  { 26951, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AR_N", "NAD83 / Arkansas North" },
+  { 26952, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "AR_S", "NAD83 / Arkansas South" },
+  { 26953, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "CO_N", "NAD83 / Colorado North" },
+  { 26954, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "CO_C", "NAD83 / Colorado Central" },
+  { 26955, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "CO_S", "NAD83 / Colorado South" },
+  { 26956, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "CT", "NAD83 / Connecticut" },
+  { 26957, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "DE", "NAD83 / Delaware" },
+  { 26958, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "FL_E", "NAD83 / Florida East" },
+  { 26959, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "FL_W", "NAD83 / Florida West" },
+  { 26960, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "FL_N", "NAD83 / Florida North" },
+  { 26961, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "HI_1", "NAD83 / Hawaii zone 1" },
+  { 26962, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "HI_2", "NAD83 / Hawaii zone 2" },
+  { 26963, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "HI_3", "NAD83 / Hawaii zone 3" },
+  { 26964, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "HI_4", "NAD83 / Hawaii zone 4" },
+  { 26965, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "HI_5", "NAD83 / Hawaii zone 5" },
+  { 26966, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "GA_E", "NAD83 / Georgia East" },
+  { 26967, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "GA_W", "NAD83 / Georgia West" },
+  { 26968, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "ID_E", "NAD83 / Idaho East" },
+  { 26969, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "ID_C", "NAD83 / Idaho Central" },
+  { 26970, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "ID_W", "NAD83 / Idaho West" },
+  { 26971, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "IL_E", "NAD83 / Illinois East" },
+  { 26972, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "IL_W", "NAD83 / Illinois West" },
+  { 26973, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "IN_E", "NAD83 / Indiana East" },
+  { 26974, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "IN_W", "NAD83 / Indiana West" },
+  { 26975, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "IA_N", "NAD83 / Iowa North" },
+  { 26976, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "IA_S", "NAD83 / Iowa South" },
+  { 26977, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "KS_N", "NAD83 / Kansas North" },
+  { 26978, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "KS_S", "NAD83 / Kansas South" },
+  { 26979, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "KY_N", "NAD83 / Kentucky North" },
+  { 26980, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "KY_S", "NAD83 / Kentucky South" },
+  { 26981, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "LA_N", "NAD83 / Louisiana North" },
+  { 26982, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "LA_S", "NAD83 / Louisiana South" },
+  { 26983, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "ME_E", "NAD83 / Maine East" },
+  { 26984, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "ME_W", "NAD83 / Maine West" },
+  { 26985, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "MD", "NAD83 / Maryland" },
+  { 26986, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "M_M", "NAD83 / Massachusetts Mainland" },
+  { 26987, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "M_I", "NAD83 / Massachusetts Island" },
+  { 26988, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "MI_N", "NAD83 / Michigan North" },
+  { 26989, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "MI_C", "NAD83 / Michigan Central" },
+  { 26990, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "MI_S", "NAD83 / Michigan South" },
+  { 26991, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "MN_N", "NAD83 / Minnesota North" },
+  { 26992, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "MN_C", "NAD83 / Minnesota Central" },
+  { 26993, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "MN_S", "NAD83 / Minnesota South" },
+  { 26994, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "MS_E", "NAD83 / Mississippi East" },
+  { 26995, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "MS_W", "NAD83 / Mississippi West" },
+  { 26996, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "MO_E", "NAD83 / Missouri East" },
+  { 26997, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "MO_C", "NAD83 / Missouri Central" },
+  { 26998, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "MO_W", "NAD83 / Missouri West" },
+  { 27037, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nahrwan 1967 / UTM zone 37N" },
+  { 27038, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nahrwan 1967 / UTM zone 38N" },
+  { 27039, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nahrwan 1967 / UTM zone 39N" },
+  { 27040, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nahrwan 1967 / UTM zone 40N" },
+  { 27120, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Naparima 1972 / UTM zone 20N" },
+  { 27200, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / New Zealand Map Grid" },
+  { 27205, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Mount Eden Circuit" },
+  { 27206, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Bay of Plenty Circuit" },
+  { 27207, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Poverty Bay Circuit" },
+  { 27208, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Hawkes Bay Circuit" },
+  { 27209, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Taranaki Circuit" },
+  { 27210, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Tuhirangi Circuit" },
+  { 27211, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Wanganui Circuit" },
+  { 27212, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Wairarapa Circuit" },
+  { 27213, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Wellington Circuit" },
+  { 27214, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Collingwood Circuit" },
+  { 27215, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Nelson Circuit" },
+  { 27216, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Karamea Circuit" },
+  { 27217, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Buller Circuit" },
+  { 27218, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Grey Circuit" },
+  { 27219, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Amuri Circuit" },
+  { 27220, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Marlborough Circuit" },
+  { 27221, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Hokitika Circuit" },
+  { 27222, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Okarito Circuit" },
+  { 27223, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Jacksons Bay Circuit" },
+  { 27224, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Mount Pleasant Circuit" },
+  { 27225, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Gawler Circuit" },
+  { 27226, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Timaru Circuit" },
+  { 27227, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Lindis Peak Circuit" },
+  { 27228, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Mount Nicholas Circuit" },
+  { 27229, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Mount York Circuit" },
+  { 27230, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Observation Point Circuit" },
+  { 27231, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / North Taieri Circuit" },
+  { 27232, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / Bluff Circuit" },
+  { 27258, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / UTM zone 58S" },
+  { 27259, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / UTM zone 59S" },
+  { 27260, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / UTM zone 60S" },
+  { 27291, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / North Island Grid" },
+  { 27292, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NZGD49 / South Island Grid" },
+  { 27391, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGO 1948 (Oslo) / NGO zone I" },
+  { 27392, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGO 1948 (Oslo) / NGO zone II" },
+  { 27393, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGO 1948 (Oslo) / NGO zone III" },
+  { 27394, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGO 1948 (Oslo) / NGO zone IV" },
+  { 27395, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGO 1948 (Oslo) / NGO zone V" },
+  { 27396, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGO 1948 (Oslo) / NGO zone VI" },
+  { 27397, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGO 1948 (Oslo) / NGO zone VII" },
+  { 27398, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGO 1948 (Oslo) / NGO zone VIII" },
+  { 27429, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Datum 73 / UTM zone 29N" },
+  { 27492, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Datum 73 / Modified Portuguese Grid" },
+  { 27493, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Datum 73 / Modified Portuguese Grid" },
+  { 27500, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "ATF (Paris) / Nord de Guerre" },
+  { 27561, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert Nord France" },
+  { 27562, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert Centre France" },
+  { 27563, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert Sud France" },
+  { 27564, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert Corse" },
+  { 27571, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert zone I" },
+  { 27572, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert zone II" },
+  { 27573, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert zone III" },
+  { 27574, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Lambert zone IV" },
+  { 27581, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / France I" },
+  { 27582, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / France II" },
+  { 27583, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / France III" },
+  { 27584, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / France IV" },
+  { 27591, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Nord France" },
+  { 27592, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Centre France" },
+  { 27593, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Sud France" },
+  { 27594, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NTF (Paris) / Corse" },
+  { 27700, CRS_EPSG_TM, CRS_EPSG_UNITS_METER, 1, 0, 58, 0, "OSGB 1936 / British National Grid" },
+  { 28191, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Palestine 1923 / Palestine Grid" },
+  { 28192, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Palestine 1923 / Palestine Belt" },
+  { 28193, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Palestine 1923 / Israeli CS Grid" },
+  { 28232, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pointe Noire / UTM zone 32S" },
+  { 28348, CRS_EPSG_MGA, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_GDA94, -48, -1, 0, "GDA94 / MGA zone 48" },
+  { 28349, CRS_EPSG_MGA, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_GDA94, -49, -1, 0, "GDA94 / MGA zone 49" },
+  { 28350, CRS_EPSG_MGA, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_GDA94, -50, -1, 0, "GDA94 / MGA zone 50" },
+  { 28351, CRS_EPSG_MGA, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_GDA94, -51, -1, 0, "GDA94 / MGA zone 51" },
+  { 28352, CRS_EPSG_MGA, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_GDA94, -52, -1, 0, "GDA94 / MGA zone 52" },
+  { 28353, CRS_EPSG_MGA, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_GDA94, -53, -1, 0, "GDA94 / MGA zone 53" },
+  { 28354, CRS_EPSG_MGA, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_GDA94, -54, -1, 0, "GDA94 / MGA zone 54" },
+  { 28355, CRS_EPSG_MGA, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_GDA94, -55, -1, 0, "GDA94 / MGA zone 55" },
+  { 28356, CRS_EPSG_MGA, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_GDA94, -56, -1, 0, "GDA94 / MGA zone 56" },
+  { 28357, CRS_EPSG_MGA, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_GDA94, -57, -1, 0, "GDA94 / MGA zone 57" },
+  { 28358, CRS_EPSG_MGA, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_GDA94, -58, -1, 0, "GDA94 / MGA zone 58" },
+  { 28402, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 2" },
+  { 28403, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 3" },
+  { 28404, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 4" },
+  { 28405, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 5" },
+  { 28406, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 6" },
+  { 28407, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 7" },
+  { 28408, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 8" },
+  { 28409, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 9" },
+  { 28410, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 10" },
+  { 28411, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 11" },
+  { 28412, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 12" },
+  { 28413, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 13" },
+  { 28414, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 14" },
+  { 28415, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 15" },
+  { 28416, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 16" },
+  { 28417, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 17" },
+  { 28418, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 18" },
+  { 28419, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 19" },
+  { 28420, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 20" },
+  { 28421, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 21" },
+  { 28422, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 22" },
+  { 28423, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 23" },
+  { 28424, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 24" },
+  { 28425, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 25" },
+  { 28426, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 26" },
+  { 28427, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 27" },
+  { 28428, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 28" },
+  { 28429, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 29" },
+  { 28430, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 30" },
+  { 28431, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 31" },
+  { 28432, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger zone 32" },
+  { 28462, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 2N" },
+  { 28463, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 3N" },
+  { 28464, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 4N" },
+  { 28465, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 5N" },
+  { 28466, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 6N" },
+  { 28467, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 7N" },
+  { 28468, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 8N" },
+  { 28469, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 9N" },
+  { 28470, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 10N" },
+  { 28471, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 11N" },
+  { 28472, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 12N" },
+  { 28473, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 13N" },
+  { 28474, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 14N" },
+  { 28475, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 15N" },
+  { 28476, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 16N" },
+  { 28477, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 17N" },
+  { 28478, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 18N" },
+  { 28479, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 19N" },
+  { 28480, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 20N" },
+  { 28481, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 21N" },
+  { 28482, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 22N" },
+  { 28483, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 23N" },
+  { 28484, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 24N" },
+  { 28485, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 25N" },
+  { 28486, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 26N" },
+  { 28487, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 27N" },
+  { 28488, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 28N" },
+  { 28489, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 29N" },
+  { 28490, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 30N" },
+  { 28491, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 31N" },
+  { 28492, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Pulkovo 1942 / Gauss-Kruger 32N" },
+  { 28600, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Qatar 1974 / Qatar National Grid" },
+  { 28991, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Amersfoort / RD Old" },
+  { 28992, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Amersfoort / RD New" },
+  { 29100, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / Brazil Polyconic" },
+  { 29101, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / Brazil Polyconic" },
+  { 29118, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, 18, -1, 0, "SAD69 / UTM zone 18N" },
+  { 29119, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, 19, -1, 0, "SAD69 / UTM zone 19N" },
+  { 29120, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, 20, -1, 0, "SAD69 / UTM zone 20N" },
+  { 29121, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, 21, -1, 0, "SAD69 / UTM zone 21N" },
+  { 29122, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, 22, -1, 0, "SAD69 / UTM zone 22N" },
+  { 29168, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 18N" },
+  { 29169, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 19N" },
+  { 29170, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 20N" },
+  { 29171, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 21N" },
+  { 29172, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 22N" },
+  { 29177, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, -17, -1, 0, "SAD69 / UTM zone 17S" },
+  { 29178, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, -18, -1, 0, "SAD69 / UTM zone 18S" },
+  { 29179, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, -19, -1, 0, "SAD69 / UTM zone 19S" },
+  { 29180, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, -20, -1, 0, "SAD69 / UTM zone 20S" },
+  { 29181, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, -21, -1, 0, "SAD69 / UTM zone 21S" },
+  { 29182, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, -22, -1, 0, "SAD69 / UTM zone 22S" },
+  { 29183, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, -23, -1, 0, "SAD69 / UTM zone 23S" },
+  { 29184, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, -24, -1, 0, "SAD69 / UTM zone 24S" },
+  { 29185, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_SAD69, -25, -1, 0, "SAD69 / UTM zone 25S" },
+  { 29187, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 17S" },
+  { 29188, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 18S" },
+  { 29189, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 19S" },
+  { 29190, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 20S" },
+  { 29191, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 21S" },
+  { 29192, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 22S" },
+  { 29193, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 23S" },
+  { 29194, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 24S" },
+  { 29195, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SAD69 / UTM zone 25S" },
+  { 29220, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -20, -1, 0, "Sapper Hill 1943 / UTM zone 20S" },
+  { 29221, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -21, -1, 0, "Sapper Hill 1943 / UTM zone 21S" },
+  { 29333, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -33, -1, 0, "Schwarzeck / UTM zone 33S" },
+  { 29371, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Schwarzeck / Lo22/11" },
+  { 29373, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Schwarzeck / Lo22/13" },
+  { 29375, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Schwarzeck / Lo22/15" },
+  { 29377, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Schwarzeck / Lo22/17" },
+  { 29379, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Schwarzeck / Lo22/19" },
+  { 29381, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Schwarzeck / Lo22/21" },
+  { 29383, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Schwarzeck / Lo22/23" },
+  { 29385, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Schwarzeck / Lo22/25" },
+  { 29635, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 35, -1, 0, "Sudan / UTM zone 35N" },
+  { 29636, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 36, -1, 0, "Sudan / UTM zone 36N" },
+  { 29700, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tananarive (Paris) / Laborde Grid" },
+  { 29701, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tananarive (Paris) / Laborde Grid" },
+  { 29702, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tananarive (Paris) / Laborde Grid approximation" },
+  { 29738, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -38, -1, 0, "Tananarive / UTM zone 38S" },
+  { 29739, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -39, -1, 0, "Tananarive / UTM zone 39S" },
+  { 29849, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 49, -1, 0, "Timbalai 1948 / UTM zone 49N" },
+  { 29850, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 50, -1, 0, "Timbalai 1948 / UTM zone 50N" },
+  { 29871, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Timbalai 1948 / RSO Borneo (ch)" },
+  { 29872, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Timbalai 1948 / RSO Borneo (ft)" },
+  { 29873, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Timbalai 1948 / RSO Borneo (m)" },
+  { 29900, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TM65 / Irish National Grid" },
+  { 29901, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "OSNI 1952 / Irish National Grid" },
+  { 29902, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TM65 / Irish Grid" },
+  { 29903, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "TM75 / Irish Grid" },
+  { 30161, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS I" },
+  { 30162, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS II" },
+  { 30163, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS III" },
+  { 30164, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS IV" },
+  { 30165, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS V" },
+  { 30166, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS VI" },
+  { 30167, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS VII" },
+  { 30168, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS VIII" },
+  { 30169, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS IX" },
+  { 30170, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS X" },
+  { 30171, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS XI" },
+  { 30172, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS XII" },
+  { 30173, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS XIII" },
+  { 30174, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS XIV" },
+  { 30175, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS XV" },
+  { 30176, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS XVI" },
+  { 30177, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS XVII" },
+  { 30178, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS XVIII" },
+  { 30179, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Tokyo / Japan Plane Rectangular CS XIX" },
+  { 30200, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Trinidad 1903 / Trinidad Grid" },
+  { 30339, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 39, -1, 0, "TC(1948) / UTM zone 39N" },
+  { 30340, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 40, -1, 0, "TC(1948) / UTM zone 40N" },
+  { 30491, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Voirol 1875 / Nord Algerie (ancienne)" },
+  { 30492, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Voirol 1875 / Sud Algerie (ancienne)" },
+  { 30493, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Voirol 1879 / Nord Algerie (ancienne)" },
+  { 30494, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Voirol 1879 / Sud Algerie (ancienne)" },
+  { 30729, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 29, -1, 0, "Nord Sahara 1959 / UTM zone 29N" },
+  { 30730, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 30, -1, 0, "Nord Sahara 1959 / UTM zone 30N" },
+  { 30731, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 31, -1, 0, "Nord Sahara 1959 / UTM zone 31N" },
+  { 30732, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 32, -1, 0, "Nord Sahara 1959 / UTM zone 32N" },
+  { 30791, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nord Sahara 1959 / Nord Algerie" },
+  { 30792, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Nord Sahara 1959 / Sud Algerie" },
+  { 30800, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "RT38 2.5 gon W" },
+  { 31028, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 28, -1, 0, "Yoff / UTM zone 28N" },
+  { 31121, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 21, -1, 0, "Zanderij / UTM zone 21N" },
+  { 31154, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Zanderij / TM 54 NW" },
+  { 31170, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Zanderij / Suriname Old TM" },
+  { 31171, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Zanderij / Suriname TM" },
+  { 31251, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI (Ferro) / Austria GK West Zone" },
+  { 31252, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI (Ferro) / Austria GK Central Zone" },
+  { 31253, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI (Ferro) / Austria GK East Zone" },
+  { 31254, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Austria GK West" },
+  { 31255, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Austria GK Central" },
+  { 31256, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Austria GK East" },
+  { 31257, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Austria GK M28" },
+  { 31258, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Austria GK M31" },
+  { 31259, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Austria GK M34" },
+  { 31265, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / 3-degree Gauss zone 5" },
+  { 31266, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / 3-degree Gauss zone 6" },
+  { 31267, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / 3-degree Gauss zone 7" },
+  { 31268, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / 3-degree Gauss zone 8" },
+  { 31275, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Balkans zone 5" },
+  { 31276, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Balkans zone 6" },
+  { 31277, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Balkans zone 7" },
+  { 31278, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Balkans zone 8" },
+  { 31279, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Balkans zone 8" },
+  { 31281, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI (Ferro) / Austria West Zone" },
+  { 31282, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI (Ferro) / Austria Central Zone" },
+  { 31283, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI (Ferro) / Austria East Zone" },
+  { 31284, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Austria M28" },
+  { 31285, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Austria M31" },
+  { 31286, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Austria M34" },
+  { 31287, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Austria Lambert" },
+  { 31288, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI (Ferro) / M28" },
+  { 31289, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI (Ferro) / M31" },
+  { 31290, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI (Ferro) / M34" },
+  { 31291, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI (Ferro) / Austria West Zone" },
+  { 31292, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI (Ferro) / Austria Central Zone" },
+  { 31293, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI (Ferro) / Austria East Zone" },
+  { 31294, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / M28" },
+  { 31295, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / M31" },
+  { 31296, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / M34" },
+  { 31297, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "MGI / Austria Lambert" },
+  { 31300, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Belge 1972 / Belge Lambert 72" },
+  { 31370, CRS_EPSG_LCC, CRS_EPSG_UNITS_METER, CRS_ELLIPSOID_Inter, 0, 59, 0, "Belge 1972 / Belgian Lambert 72" },
+  { 31461, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss zone 1" },
+  { 31462, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss zone 2" },
+  { 31463, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss zone 3" },
+  { 31464, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss zone 4" },
+  { 31465, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss zone 5" },
+  { 31466, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss-Kruger zone 2" },
+  { 31467, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss-Kruger zone 3" },
+  { 31468, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss-Kruger zone 4" },
+  { 31469, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "DHDN / 3-degree Gauss-Kruger zone 5" },
+  { 31528, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Conakry 1905 / UTM zone 28N" },
+  { 31529, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Conakry 1905 / UTM zone 29N" },
+  { 31600, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dealul Piscului 1930 / Stereo 33" },
+  { 31700, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "Dealul Piscului 1970/ Stereo 70" },
+  { 31838, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGN / UTM zone 38N" },
+  { 31839, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NGN / UTM zone 39N" },
+  { 31900, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KUDAMS / KTM" },
+  { 31901, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "KUDAMS / KTM" },
+  { 31965, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 11N" },
+  { 31966, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 12N" },
+  { 31967, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 13N" },
+  { 31968, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 14N" },
+  { 31969, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 15N" },
+  { 31970, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 16N" },
+  { 31971, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 17N" },
+  { 31972, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 18N" },
+  { 31973, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 19N" },
+  { 31974, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 20N" },
+  { 31975, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 21N" },
+  { 31976, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 22N" },
+  { 31977, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 17S" },
+  { 31978, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 18S" },
+  { 31979, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 19S" },
+  { 31980, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 20S" },
+  { 31981, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 21S" },
+  { 31982, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 22S" },
+  { 31983, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 23S" },
+  { 31984, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 24S" },
+  { 31985, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 2000 / UTM zone 25S" },
+  { 31986, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 17N" },
+  { 31987, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 18N" },
+  { 31988, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 19N" },
+  { 31989, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 20N" },
+  { 31990, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 21N" },
+  { 31991, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 22N" },
+  { 31992, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 17S" },
+  { 31993, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 18S" },
+  { 31994, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 19S" },
+  { 31995, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 20S" },
+  { 31996, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 21S" },
+  { 31997, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 22S" },
+  { 31998, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 23S" },
+  { 31999, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 24S" },
+  { 32000, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "SIRGAS 1995 / UTM zone 25S" },
+  { 32001, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MT_N", "NAD27 / Montana North" },
+  { 32002, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MT_C", "NAD27 / Montana Central" },
+  { 32003, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "MT_S", "NAD27 / Montana South" },
+  { 32005, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NE_N", "NAD27 / Nebraska North" },
+  { 32006, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NE_S", "NAD27 / Nebraska South" },
+  { 32007, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NV_E", "NAD27 / Nevada East" },
+  { 32008, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NV_C", "NAD27 / Nevada Central" },
+  { 32009, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NV_W", "NAD27 / Nevada West" },
+  { 32010, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NH", "NAD27 / New Hampshire" },
+  { 32011, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NJ", "NAD27 / New Jersey" },
+  { 32012, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NM_E", "NAD27 / New Mexico East" },
+  { 32013, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NM_C", "NAD27 / New Mexico Central" },
+  { 32014, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NM_W", "NAD27 / New Mexico West" },
+  { 32015, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NY_E", "NAD27 / New York East" },
+  { 32016, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NY_C", "NAD27 / New York Central" },
+  { 32017, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NY_W", "NAD27 / New York West" },
+  { 32018, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NT_LI", "NAD27 / New York Long Island" },
+  { 32019, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "NC", "NAD27 / North Carolina" },
+  { 32020, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "ND_N", "NAD27 / North Dakota North" },
+  { 32021, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "ND_S", "NAD27 / North Dakota South" },
+  { 32022, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "OH_N", "NAD27 / Ohio North" },
+  { 32023, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "OH_S", "NAD27 / Ohio South" },
+  { 32024, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "OK_N", "NAD27 / Oklahoma North" },
+  { 32025, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "OK_S", "NAD27 / Oklahoma South" },
+  { 32026, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "OR_N", "NAD27 / Oregon North" },
+  { 32027, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "OR_S", "NAD27 / Oregon South" },
+  { 32028, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "PA_N", "NAD27 / Pennsylvania North" },
+  { 32029, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "PA_S", "NAD27 / Pennsylvania South" },
+  { 32030, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "RI", "NAD27 / Rhode Island" },
+  { 32031, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "SC_N", "NAD27 / South Carolina North" },
+  { 32033, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "SC_S", "NAD27 / South Carolina South" },
+  { 32034, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "SD_N", "NAD27 / South Dakota North" },
+  { 32035, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "SD_S", "NAD27 / South Dakota South" },
+  { 32036, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "TN", "NAD27 / Tennessee" },
+  { 32037, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "TX_N", "NAD27 / Texas North" },
+  { 32038, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "TX_NC", "NAD27 / Texas North Central" },
+  { 32039, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "TX_C", "NAD27 / Texas Central" },
+  { 32040, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "TX_SC", "NAD27 / Texas South Central" },
+  { 32041, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "TX_S", "NAD27 / Texas South" },
+  { 32042, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "UT_N", "NAD27 / Utah North" },
+  { 32043, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "UT_C", "NAD27 / Utah Central" },
+  { 32044, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "UT_S", "NAD27 / Utah South" },
+  { 32045, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "VT", "NAD27 / Vermont" },
+  { 32046, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "VA_N", "NAD27 / Virginia North" },
+  { 32047, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "VA_S", "NAD27 / Virginia South" },
+  { 32048, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "WA_N", "NAD27 / Washington North" },
+  { 32049, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "WA_S", "NAD27 / Washington South" },
+  { 32050, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "WV_N", "NAD27 / West Virginia North" },
+  { 32051, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "WV_S", "NAD27 / West Virginia South" },
+  { 32052, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "WI_N", "NAD27 / Wisconsin North" },
+  { 32053, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "WI_C", "NAD27 / Wisconsin Central" },
+  { 32054, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "WI_S", "NAD27 / Wisconsin South" },
+  { 32055, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "WY_E", "NAD27 / Wyoming East" },
+  { 32056, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "WY_EC", "NAD27 / Wyoming East Central" },
+  { 32057, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "WY_WC", "NAD27 / Wyoming West Central" },
+  { 32058, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "WY_W", "NAD27 / Wyoming West" },
+  { 32059, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "PR", 0 },
+  { 32060, CRS_EPSG_SP27, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD27, 0, -1, "St.Croix", 0 },
+  { 32061, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Guatemala Norte" },
+  { 32062, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Guatemala Sur" },
+  { 32064, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 14N (ftUS)" },
+  { 32065, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 15N (ftUS)" },
+  { 32066, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 16N (ftUS)" },
+  { 32067, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 17N (ftUS)" },
+  { 32074, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 14N (feet)" },
+  { 32075, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 15N (feet)" },
+  { 32076, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 16N (feet)" },
+  { 32077, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / BLM 17N (feet)" },
+  { 32081, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / MTM zone 1" },
+  { 32082, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / MTM zone 2" },
+  { 32083, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / MTM zone 3" },
+  { 32084, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / MTM zone 4" },
+  { 32085, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / MTM zone 5" },
+  { 32086, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / MTM zone 6" },
+  { 32098, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Quebec Lambert" },
+  { 32099, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD27 / Louisiana Offshore" },
+  { 32100, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "MT", "NAD83 / Montana" },
+  { 32104, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NE", "NAD83 / Nebraska" },
+  { 32107, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NV_E", "NAD83 / Nevada East" },
+  { 32108, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NV_C", "NAD83 / Nevada Central" },
+  { 32109, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NV_W", "NAD83 / Nevada West" },
+  { 32110, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NH", "NAD83 / New Hampshire" },
+  { 32111, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NJ", "NAD83 / New Jersey" },
+  { 32112, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NM_E", "NAD83 / New Mexico East" },
+  { 32113, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NM_C", "NAD83 / New Mexico Central" },
+  { 32114, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NM_W", "NAD83 / New Mexico West" },
+  { 32115, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NY_E", "NAD83 / New York East" },
+  { 32116, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NY_C", "NAD83 / New York Central" },
+  { 32117, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NY_W", "NAD83 / New York West" },
+  { 32118, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NT_LI", "NAD83 / New York Long Island" },
+  { 32119, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "NC", "NAD83 / North Carolina" },
+  { 32120, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "ND_N", "NAD83 / North Dakota North" },
+  { 32121, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "ND_S", "NAD83 / North Dakota South" },
+  { 32122, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "OH_N", "NAD83 / Ohio North" },
+  { 32123, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "OH_S", "NAD83 / Ohio South" },
+  { 32124, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "OK_N", "NAD83 / Oklahoma North" },
+  { 32125, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "OK_S", "NAD83 / Oklahoma South" },
+  { 32126, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "OR_N", "NAD83 / Oregon North" },
+  { 32127, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "OR_S", "NAD83 / Oregon South" },
+  { 32128, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "PA_N", "NAD83 / Pennsylvania North" },
+  { 32129, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "PA_S", "NAD83 / Pennsylvania South" },
+  { 32130, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "RI", "NAD83 / Rhode Island" },
+  { 32133, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "SC", "NAD83 / South Carolina" },
+  { 32134, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "SD_N", "NAD83 / South Dakota North" },
+  { 32135, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "SD_S", "NAD83 / South Dakota South" },
+  { 32136, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "TN", "NAD83 / Tennessee" },
+  { 32137, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "TX_N", "NAD83 / Texas North" },
+  { 32138, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "TX_NC", "NAD83 / Texas North Central" },
+  { 32139, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "TX_C", "NAD83 / Texas Central" },
+  { 32140, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "TX_SC", "NAD83 / Texas South Central" },
+  { 32141, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "TX_S", "NAD83 / Texas South" },
+  { 32142, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "UT_N", "NAD83 / Utah North" },
+  { 32143, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "UT_C", "NAD83 / Utah Central" },
+  { 32144, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "UT_S", "NAD83 / Utah South" },
+  { 32145, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "VT", "NAD83 / Vermont" },
+  { 32146, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "VA_N", "NAD83 / Virginia North" },
+  { 32147, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "VA_S", "NAD83 / Virginia South" },
+  { 32148, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "WA_N", "NAD83 / Washington North" },
+  { 32149, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "WA_S", "NAD83 / Washington South" },
+  { 32150, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "WV_N", "NAD83 / West Virginia North" },
+  { 32151, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "WV_S", "NAD83 / West Virginia South" },
+  { 32152, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "WI_N", "NAD83 / Wisconsin North" },
+  { 32153, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "WI_C", "NAD83 / Wisconsin Central" },
+  { 32154, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "WI_S", "NAD83 / Wisconsin South" },
+  { 32155, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "WY_E", "NAD83 / Wyoming East" },
+  { 32156, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "WY_EC", "NAD83 / Wyoming East Central" },
+  { 32157, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "WY_WC", "NAD83 / Wyoming West Central" },
+  { 32158, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "WY_W", "NAD83 / Wyoming West" },
+  { 32161, CRS_EPSG_SP83, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_NAD83, 0, -1, "PR", "NAD83 / Puerto Rico & Virgin Is." },
+  { 32164, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 14N (ftUS)" },
+  { 32165, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 15N (ftUS)" },
+  { 32166, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 16N (ftUS)" },
+  { 32167, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / BLM 17N (ftUS)" },
+  { 32180, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / SCoPQ zone 2" },
+  { 32181, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 1" },
+  { 32182, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 2" },
+  { 32183, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 3" },
+  { 32184, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 4" },
+  { 32185, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 5" },
+  { 32186, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 6" },
+  { 32187, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 7" },
+  { 32188, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 8" },
+  { 32189, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 9" },
+  { 32190, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 10" },
+  { 32191, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 11" },
+  { 32192, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 12" },
+  { 32193, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 13" },
+  { 32194, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 14" },
+  { 32195, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 15" },
+  { 32196, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 16" },
+  { 32197, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / MTM zone 17" },
+  { 32198, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Quebec Lambert" },
+  { 32199, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "NAD83 / Louisiana Offshore" },
+  { 32201, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 1, -1, 0, "WGS 72 / UTM zone 1N" },
+  { 32202, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 2, -1, 0, "WGS 72 / UTM zone 2N" },
+  { 32203, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 3, -1, 0, "WGS 72 / UTM zone 3N" },
+  { 32204, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 4, -1, 0, "WGS 72 / UTM zone 4N" },
+  { 32205, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 5, -1, 0, "WGS 72 / UTM zone 5N" },
+  { 32206, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 6, -1, 0, "WGS 72 / UTM zone 6N" },
+  { 32207, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 7, -1, 0, "WGS 72 / UTM zone 7N" },
+  { 32208, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 8, -1, 0, "WGS 72 / UTM zone 8N" },
+  { 32209, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 9, -1, 0, "WGS 72 / UTM zone 9N" },
+  { 32210, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 10, -1, 0, "WGS 72 / UTM zone 10N" },
+  { 32211, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 11, -1, 0, "WGS 72 / UTM zone 11N" },
+  { 32212, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 12, -1, 0, "WGS 72 / UTM zone 12N" },
+  { 32213, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 13, -1, 0, "WGS 72 / UTM zone 13N" },
+  { 32214, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 14, -1, 0, "WGS 72 / UTM zone 14N" },
+  { 32215, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 15, -1, 0, "WGS 72 / UTM zone 15N" },
+  { 32216, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 16, -1, 0, "WGS 72 / UTM zone 16N" },
+  { 32217, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 17, -1, 0, "WGS 72 / UTM zone 17N" },
+  { 32218, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 18, -1, 0, "WGS 72 / UTM zone 18N" },
+  { 32219, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 19, -1, 0, "WGS 72 / UTM zone 19N" },
+  { 32220, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 20, -1, 0, "WGS 72 / UTM zone 20N" },
+  { 32221, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 21, -1, 0, "WGS 72 / UTM zone 21N" },
+  { 32222, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 22, -1, 0, "WGS 72 / UTM zone 22N" },
+  { 32223, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 23, -1, 0, "WGS 72 / UTM zone 23N" },
+  { 32224, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 24, -1, 0, "WGS 72 / UTM zone 24N" },
+  { 32225, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 25, -1, 0, "WGS 72 / UTM zone 25N" },
+  { 32226, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 26, -1, 0, "WGS 72 / UTM zone 26N" },
+  { 32227, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 27, -1, 0, "WGS 72 / UTM zone 27N" },
+  { 32228, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 28, -1, 0, "WGS 72 / UTM zone 28N" },
+  { 32229, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 29, -1, 0, "WGS 72 / UTM zone 29N" },
+  { 32230, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 30, -1, 0, "WGS 72 / UTM zone 30N" },
+  { 32231, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 31, -1, 0, "WGS 72 / UTM zone 31N" },
+  { 32232, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 32, -1, 0, "WGS 72 / UTM zone 32N" },
+  { 32233, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 33, -1, 0, "WGS 72 / UTM zone 33N" },
+  { 32234, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 34, -1, 0, "WGS 72 / UTM zone 34N" },
+  { 32235, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 35, -1, 0, "WGS 72 / UTM zone 35N" },
+  { 32236, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 36, -1, 0, "WGS 72 / UTM zone 36N" },
+  { 32237, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 37, -1, 0, "WGS 72 / UTM zone 37N" },
+  { 32238, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 38, -1, 0, "WGS 72 / UTM zone 38N" },
+  { 32239, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 39, -1, 0, "WGS 72 / UTM zone 39N" },
+  { 32240, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 40, -1, 0, "WGS 72 / UTM zone 40N" },
+  { 32241, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 41, -1, 0, "WGS 72 / UTM zone 41N" },
+  { 32242, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 42, -1, 0, "WGS 72 / UTM zone 42N" },
+  { 32243, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 43, -1, 0, "WGS 72 / UTM zone 43N" },
+  { 32244, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 44, -1, 0, "WGS 72 / UTM zone 44N" },
+  { 32245, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 45, -1, 0, "WGS 72 / UTM zone 45N" },
+  { 32246, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 46, -1, 0, "WGS 72 / UTM zone 46N" },
+  { 32247, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 47, -1, 0, "WGS 72 / UTM zone 47N" },
+  { 32248, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 48, -1, 0, "WGS 72 / UTM zone 48N" },
+  { 32249, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 49, -1, 0, "WGS 72 / UTM zone 49N" },
+  { 32250, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 50, -1, 0, "WGS 72 / UTM zone 50N" },
+  { 32251, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 51, -1, 0, "WGS 72 / UTM zone 51N" },
+  { 32252, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 52, -1, 0, "WGS 72 / UTM zone 52N" },
+  { 32253, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 53, -1, 0, "WGS 72 / UTM zone 53N" },
+  { 32254, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 54, -1, 0, "WGS 72 / UTM zone 54N" },
+  { 32255, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 55, -1, 0, "WGS 72 / UTM zone 55N" },
+  { 32256, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 56, -1, 0, "WGS 72 / UTM zone 56N" },
+  { 32257, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 57, -1, 0, "WGS 72 / UTM zone 57N" },
+  { 32258, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 58, -1, 0, "WGS 72 / UTM zone 58N" },
+  { 32259, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 59, -1, 0, "WGS 72 / UTM zone 59N" },
+  { 32260, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 60, -1, 0, "WGS 72 / UTM zone 60N" },
+  { 32301, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -1, -1, 0, "WGS 72 / UTM zone 1S" },
+  { 32302, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -2, -1, 0, "WGS 72 / UTM zone 2S" },
+  { 32303, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -3, -1, 0, "WGS 72 / UTM zone 3S" },
+  { 32304, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -4, -1, 0, "WGS 72 / UTM zone 4S" },
+  { 32305, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -5, -1, 0, "WGS 72 / UTM zone 5S" },
+  { 32306, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -6, -1, 0, "WGS 72 / UTM zone 6S" },
+  { 32307, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -7, -1, 0, "WGS 72 / UTM zone 7S" },
+  { 32308, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -8, -1, 0, "WGS 72 / UTM zone 8S" },
+  { 32309, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -9, -1, 0, "WGS 72 / UTM zone 9S" },
+  { 32310, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -10, -1, 0, "WGS 72 / UTM zone 10S" },
+  { 32311, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -11, -1, 0, "WGS 72 / UTM zone 11S" },
+  { 32312, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -12, -1, 0, "WGS 72 / UTM zone 12S" },
+  { 32313, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -13, -1, 0, "WGS 72 / UTM zone 13S" },
+  { 32314, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -14, -1, 0, "WGS 72 / UTM zone 14S" },
+  { 32315, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -15, -1, 0, "WGS 72 / UTM zone 15S" },
+  { 32316, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -16, -1, 0, "WGS 72 / UTM zone 16S" },
+  { 32317, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -17, -1, 0, "WGS 72 / UTM zone 17S" },
+  { 32318, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -18, -1, 0, "WGS 72 / UTM zone 18S" },
+  { 32319, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -19, -1, 0, "WGS 72 / UTM zone 19S" },
+  { 32320, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -20, -1, 0, "WGS 72 / UTM zone 20S" },
+  { 32321, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -21, -1, 0, "WGS 72 / UTM zone 21S" },
+  { 32322, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -22, -1, 0, "WGS 72 / UTM zone 22S" },
+  { 32323, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -23, -1, 0, "WGS 72 / UTM zone 23S" },
+  { 32324, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -24, -1, 0, "WGS 72 / UTM zone 24S" },
+  { 32325, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -25, -1, 0, "WGS 72 / UTM zone 25S" },
+  { 32326, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -26, -1, 0, "WGS 72 / UTM zone 26S" },
+  { 32327, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -27, -1, 0, "WGS 72 / UTM zone 27S" },
+  { 32328, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -28, -1, 0, "WGS 72 / UTM zone 28S" },
+  { 32329, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -29, -1, 0, "WGS 72 / UTM zone 29S" },
+  { 32330, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -30, -1, 0, "WGS 72 / UTM zone 30S" },
+  { 32331, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -31, -1, 0, "WGS 72 / UTM zone 31S" },
+  { 32332, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -32, -1, 0, "WGS 72 / UTM zone 32S" },
+  { 32333, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -33, -1, 0, "WGS 72 / UTM zone 33S" },
+  { 32334, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -34, -1, 0, "WGS 72 / UTM zone 34S" },
+  { 32335, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -35, -1, 0, "WGS 72 / UTM zone 35S" },
+  { 32336, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -36, -1, 0, "WGS 72 / UTM zone 36S" },
+  { 32337, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -37, -1, 0, "WGS 72 / UTM zone 37S" },
+  { 32338, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -38, -1, 0, "WGS 72 / UTM zone 38S" },
+  { 32339, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -39, -1, 0, "WGS 72 / UTM zone 39S" },
+  { 32340, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -40, -1, 0, "WGS 72 / UTM zone 40S" },
+  { 32341, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -41, -1, 0, "WGS 72 / UTM zone 41S" },
+  { 32342, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -42, -1, 0, "WGS 72 / UTM zone 42S" },
+  { 32343, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -43, -1, 0, "WGS 72 / UTM zone 43S" },
+  { 32344, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -44, -1, 0, "WGS 72 / UTM zone 44S" },
+  { 32345, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -45, -1, 0, "WGS 72 / UTM zone 45S" },
+  { 32346, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -46, -1, 0, "WGS 72 / UTM zone 46S" },
+  { 32347, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -47, -1, 0, "WGS 72 / UTM zone 47S" },
+  { 32348, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -48, -1, 0, "WGS 72 / UTM zone 48S" },
+  { 32349, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -49, -1, 0, "WGS 72 / UTM zone 49S" },
+  { 32350, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -50, -1, 0, "WGS 72 / UTM zone 50S" },
+  { 32351, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -51, -1, 0, "WGS 72 / UTM zone 51S" },
+  { 32352, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -52, -1, 0, "WGS 72 / UTM zone 52S" },
+  { 32353, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -53, -1, 0, "WGS 72 / UTM zone 53S" },
+  { 32354, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -54, -1, 0, "WGS 72 / UTM zone 54S" },
+  { 32355, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -55, -1, 0, "WGS 72 / UTM zone 55S" },
+  { 32356, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -56, -1, 0, "WGS 72 / UTM zone 56S" },
+  { 32357, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -57, -1, 0, "WGS 72 / UTM zone 57S" },
+  { 32358, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -58, -1, 0, "WGS 72 / UTM zone 58S" },
+  { 32359, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -59, -1, 0, "WGS 72 / UTM zone 59S" },
+  { 32360, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -60, -1, 0, "WGS 72 / UTM zone 60S" },
+  { 32401, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 1, -1, 0, "WGS 72BE / UTM zone 1N" },
+  { 32402, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 2, -1, 0, "WGS 72BE / UTM zone 2N" },
+  { 32403, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 3, -1, 0, "WGS 72BE / UTM zone 3N" },
+  { 32404, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 4, -1, 0, "WGS 72BE / UTM zone 4N" },
+  { 32405, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 5, -1, 0, "WGS 72BE / UTM zone 5N" },
+  { 32406, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 6, -1, 0, "WGS 72BE / UTM zone 6N" },
+  { 32407, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 7, -1, 0, "WGS 72BE / UTM zone 7N" },
+  { 32408, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 8, -1, 0, "WGS 72BE / UTM zone 8N" },
+  { 32409, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 9, -1, 0, "WGS 72BE / UTM zone 9N" },
+  { 32410, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 10, -1, 0, "WGS 72BE / UTM zone 10N" },
+  { 32411, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 11, -1, 0, "WGS 72BE / UTM zone 11N" },
+  { 32412, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 12, -1, 0, "WGS 72BE / UTM zone 12N" },
+  { 32413, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 13, -1, 0, "WGS 72BE / UTM zone 13N" },
+  { 32414, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 14, -1, 0, "WGS 72BE / UTM zone 14N" },
+  { 32415, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 15, -1, 0, "WGS 72BE / UTM zone 15N" },
+  { 32416, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 16, -1, 0, "WGS 72BE / UTM zone 16N" },
+  { 32417, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 17, -1, 0, "WGS 72BE / UTM zone 17N" },
+  { 32418, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 18, -1, 0, "WGS 72BE / UTM zone 18N" },
+  { 32419, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 19, -1, 0, "WGS 72BE / UTM zone 19N" },
+  { 32420, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 20, -1, 0, "WGS 72BE / UTM zone 20N" },
+  { 32421, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 21, -1, 0, "WGS 72BE / UTM zone 21N" },
+  { 32422, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 22, -1, 0, "WGS 72BE / UTM zone 22N" },
+  { 32423, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 23, -1, 0, "WGS 72BE / UTM zone 23N" },
+  { 32424, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 24, -1, 0, "WGS 72BE / UTM zone 24N" },
+  { 32425, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 25, -1, 0, "WGS 72BE / UTM zone 25N" },
+  { 32426, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 26, -1, 0, "WGS 72BE / UTM zone 26N" },
+  { 32427, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 27, -1, 0, "WGS 72BE / UTM zone 27N" },
+  { 32428, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 28, -1, 0, "WGS 72BE / UTM zone 28N" },
+  { 32429, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 29, -1, 0, "WGS 72BE / UTM zone 29N" },
+  { 32430, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 30, -1, 0, "WGS 72BE / UTM zone 30N" },
+  { 32431, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 31, -1, 0, "WGS 72BE / UTM zone 31N" },
+  { 32432, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 32, -1, 0, "WGS 72BE / UTM zone 32N" },
+  { 32433, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 33, -1, 0, "WGS 72BE / UTM zone 33N" },
+  { 32434, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 34, -1, 0, "WGS 72BE / UTM zone 34N" },
+  { 32435, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 35, -1, 0, "WGS 72BE / UTM zone 35N" },
+  { 32436, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 36, -1, 0, "WGS 72BE / UTM zone 36N" },
+  { 32437, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 37, -1, 0, "WGS 72BE / UTM zone 37N" },
+  { 32438, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 38, -1, 0, "WGS 72BE / UTM zone 38N" },
+  { 32439, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 39, -1, 0, "WGS 72BE / UTM zone 39N" },
+  { 32440, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 40, -1, 0, "WGS 72BE / UTM zone 40N" },
+  { 32441, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 41, -1, 0, "WGS 72BE / UTM zone 41N" },
+  { 32442, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 42, -1, 0, "WGS 72BE / UTM zone 42N" },
+  { 32443, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 43, -1, 0, "WGS 72BE / UTM zone 43N" },
+  { 32444, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 44, -1, 0, "WGS 72BE / UTM zone 44N" },
+  { 32445, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 45, -1, 0, "WGS 72BE / UTM zone 45N" },
+  { 32446, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 46, -1, 0, "WGS 72BE / UTM zone 46N" },
+  { 32447, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 47, -1, 0, "WGS 72BE / UTM zone 47N" },
+  { 32448, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 48, -1, 0, "WGS 72BE / UTM zone 48N" },
+  { 32449, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 49, -1, 0, "WGS 72BE / UTM zone 49N" },
+  { 32450, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 50, -1, 0, "WGS 72BE / UTM zone 50N" },
+  { 32451, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 51, -1, 0, "WGS 72BE / UTM zone 51N" },
+  { 32452, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 52, -1, 0, "WGS 72BE / UTM zone 52N" },
+  { 32453, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 53, -1, 0, "WGS 72BE / UTM zone 53N" },
+  { 32454, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 54, -1, 0, "WGS 72BE / UTM zone 54N" },
+  { 32455, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 55, -1, 0, "WGS 72BE / UTM zone 55N" },
+  { 32456, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 56, -1, 0, "WGS 72BE / UTM zone 56N" },
+  { 32457, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 57, -1, 0, "WGS 72BE / UTM zone 57N" },
+  { 32458, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 58, -1, 0, "WGS 72BE / UTM zone 58N" },
+  { 32459, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 59, -1, 0, "WGS 72BE / UTM zone 59N" },
+  { 32460, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, 60, -1, 0, "WGS 72BE / UTM zone 60N" },
+  { 32501, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -1, -1, 0, "WGS 72BE / UTM zone 1S" },
+  { 32502, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -2, -1, 0, "WGS 72BE / UTM zone 2S" },
+  { 32503, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -3, -1, 0, "WGS 72BE / UTM zone 3S" },
+  { 32504, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -4, -1, 0, "WGS 72BE / UTM zone 4S" },
+  { 32505, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -5, -1, 0, "WGS 72BE / UTM zone 5S" },
+  { 32506, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -6, -1, 0, "WGS 72BE / UTM zone 6S" },
+  { 32507, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -7, -1, 0, "WGS 72BE / UTM zone 7S" },
+  { 32508, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -8, -1, 0, "WGS 72BE / UTM zone 8S" },
+  { 32509, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -9, -1, 0, "WGS 72BE / UTM zone 9S" },
+  { 32510, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -10, -1, 0, "WGS 72BE / UTM zone 10S" },
+  { 32511, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -11, -1, 0, "WGS 72BE / UTM zone 11S" },
+  { 32512, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -12, -1, 0, "WGS 72BE / UTM zone 12S" },
+  { 32513, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -13, -1, 0, "WGS 72BE / UTM zone 13S" },
+  { 32514, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -14, -1, 0, "WGS 72BE / UTM zone 14S" },
+  { 32515, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -15, -1, 0, "WGS 72BE / UTM zone 15S" },
+  { 32516, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -16, -1, 0, "WGS 72BE / UTM zone 16S" },
+  { 32517, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -17, -1, 0, "WGS 72BE / UTM zone 17S" },
+  { 32518, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -18, -1, 0, "WGS 72BE / UTM zone 18S" },
+  { 32519, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -19, -1, 0, "WGS 72BE / UTM zone 19S" },
+  { 32520, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -20, -1, 0, "WGS 72BE / UTM zone 20S" },
+  { 32521, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -21, -1, 0, "WGS 72BE / UTM zone 21S" },
+  { 32522, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -22, -1, 0, "WGS 72BE / UTM zone 22S" },
+  { 32523, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -23, -1, 0, "WGS 72BE / UTM zone 23S" },
+  { 32524, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -24, -1, 0, "WGS 72BE / UTM zone 24S" },
+  { 32525, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -25, -1, 0, "WGS 72BE / UTM zone 25S" },
+  { 32526, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -26, -1, 0, "WGS 72BE / UTM zone 26S" },
+  { 32527, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -27, -1, 0, "WGS 72BE / UTM zone 27S" },
+  { 32528, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -28, -1, 0, "WGS 72BE / UTM zone 28S" },
+  { 32529, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -29, -1, 0, "WGS 72BE / UTM zone 29S" },
+  { 32530, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -30, -1, 0, "WGS 72BE / UTM zone 30S" },
+  { 32531, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -31, -1, 0, "WGS 72BE / UTM zone 31S" },
+  { 32532, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -32, -1, 0, "WGS 72BE / UTM zone 32S" },
+  { 32533, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -33, -1, 0, "WGS 72BE / UTM zone 33S" },
+  { 32534, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -34, -1, 0, "WGS 72BE / UTM zone 34S" },
+  { 32535, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -35, -1, 0, "WGS 72BE / UTM zone 35S" },
+  { 32536, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -36, -1, 0, "WGS 72BE / UTM zone 36S" },
+  { 32537, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -37, -1, 0, "WGS 72BE / UTM zone 37S" },
+  { 32538, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -38, -1, 0, "WGS 72BE / UTM zone 38S" },
+  { 32539, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -39, -1, 0, "WGS 72BE / UTM zone 39S" },
+  { 32540, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -40, -1, 0, "WGS 72BE / UTM zone 40S" },
+  { 32541, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -41, -1, 0, "WGS 72BE / UTM zone 41S" },
+  { 32542, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -42, -1, 0, "WGS 72BE / UTM zone 42S" },
+  { 32543, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -43, -1, 0, "WGS 72BE / UTM zone 43S" },
+  { 32544, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -44, -1, 0, "WGS 72BE / UTM zone 44S" },
+  { 32545, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -45, -1, 0, "WGS 72BE / UTM zone 45S" },
+  { 32546, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -46, -1, 0, "WGS 72BE / UTM zone 46S" },
+  { 32547, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -47, -1, 0, "WGS 72BE / UTM zone 47S" },
+  { 32548, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -48, -1, 0, "WGS 72BE / UTM zone 48S" },
+  { 32549, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -49, -1, 0, "WGS 72BE / UTM zone 49S" },
+  { 32550, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -50, -1, 0, "WGS 72BE / UTM zone 50S" },
+  { 32551, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -51, -1, 0, "WGS 72BE / UTM zone 51S" },
+  { 32552, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -52, -1, 0, "WGS 72BE / UTM zone 52S" },
+  { 32553, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -53, -1, 0, "WGS 72BE / UTM zone 53S" },
+  { 32554, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -54, -1, 0, "WGS 72BE / UTM zone 54S" },
+  { 32555, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -55, -1, 0, "WGS 72BE / UTM zone 55S" },
+  { 32556, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -56, -1, 0, "WGS 72BE / UTM zone 56S" },
+  { 32557, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -57, -1, 0, "WGS 72BE / UTM zone 57S" },
+  { 32558, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -58, -1, 0, "WGS 72BE / UTM zone 58S" },
+  { 32559, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -59, -1, 0, "WGS 72BE / UTM zone 59S" },
+  { 32560, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS72, -60, -1, 0, "WGS 72BE / UTM zone 60S" },
+  { 32600, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / UTM grid system (northern hemisphere)" },
+  { 32601, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 1, -1, 0, "WGS 84 / UTM zone 1N" },
+  { 32602, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 2, -1, 0, "WGS 84 / UTM zone 2N" },
+  { 32603, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 3, -1, 0, "WGS 84 / UTM zone 3N" },
+  { 32604, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 4, -1, 0, "WGS 84 / UTM zone 4N" },
+  { 32605, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 5, -1, 0, "WGS 84 / UTM zone 5N" },
+  { 32606, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 6, -1, 0, "WGS 84 / UTM zone 6N" },
+  { 32607, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 7, -1, 0, "WGS 84 / UTM zone 7N" },
+  { 32608, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 8, -1, 0, "WGS 84 / UTM zone 8N" },
+  { 32609, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 9, -1, 0, "WGS 84 / UTM zone 9N" },
+  { 32610, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 10, -1, 0, "WGS 84 / UTM zone 10N" },
+  { 32611, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 11, -1, 0, "WGS 84 / UTM zone 11N" },
+  { 32612, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 12, -1, 0, "WGS 84 / UTM zone 12N" },
+  { 32613, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 13, -1, 0, "WGS 84 / UTM zone 13N" },
+  { 32614, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 14, -1, 0, "WGS 84 / UTM zone 14N" },
+  { 32615, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 15, -1, 0, "WGS 84 / UTM zone 15N" },
+  { 32616, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 16, -1, 0, "WGS 84 / UTM zone 16N" },
+  { 32617, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 17, -1, 0, "WGS 84 / UTM zone 17N" },
+  { 32618, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 18, -1, 0, "WGS 84 / UTM zone 18N" },
+  { 32619, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 19, -1, 0, "WGS 84 / UTM zone 19N" },
+  { 32620, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 20, -1, 0, "WGS 84 / UTM zone 20N" },
+  { 32621, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 21, -1, 0, "WGS 84 / UTM zone 21N" },
+  { 32622, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 22, -1, 0, "WGS 84 / UTM zone 22N" },
+  { 32623, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 23, -1, 0, "WGS 84 / UTM zone 23N" },
+  { 32624, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 24, -1, 0, "WGS 84 / UTM zone 24N" },
+  { 32625, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 25, -1, 0, "WGS 84 / UTM zone 25N" },
+  { 32626, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 26, -1, 0, "WGS 84 / UTM zone 26N" },
+  { 32627, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 27, -1, 0, "WGS 84 / UTM zone 27N" },
+  { 32628, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 28, -1, 0, "WGS 84 / UTM zone 28N" },
+  { 32629, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 29, -1, 0, "WGS 84 / UTM zone 29N" },
+  { 32630, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 30, -1, 0, "WGS 84 / UTM zone 30N" },
+  { 32631, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 31, -1, 0, "WGS 84 / UTM zone 31N" },
+  { 32632, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 32, -1, 0, "WGS 84 / UTM zone 32N" },
+  { 32633, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 33, -1, 0, "WGS 84 / UTM zone 33N" },
+  { 32634, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 34, -1, 0, "WGS 84 / UTM zone 34N" },
+  { 32635, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 35, -1, 0, "WGS 84 / UTM zone 35N" },
+  { 32636, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 36, -1, 0, "WGS 84 / UTM zone 36N" },
+  { 32637, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 37, -1, 0, "WGS 84 / UTM zone 37N" },
+  { 32638, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 38, -1, 0, "WGS 84 / UTM zone 38N" },
+  { 32639, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 39, -1, 0, "WGS 84 / UTM zone 39N" },
+  { 32640, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 40, -1, 0, "WGS 84 / UTM zone 40N" },
+  { 32641, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 41, -1, 0, "WGS 84 / UTM zone 41N" },
+  { 32642, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 42, -1, 0, "WGS 84 / UTM zone 42N" },
+  { 32643, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 43, -1, 0, "WGS 84 / UTM zone 43N" },
+  { 32644, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 44, -1, 0, "WGS 84 / UTM zone 44N" },
+  { 32645, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 45, -1, 0, "WGS 84 / UTM zone 45N" },
+  { 32646, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 46, -1, 0, "WGS 84 / UTM zone 46N" },
+  { 32647, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 47, -1, 0, "WGS 84 / UTM zone 47N" },
+  { 32648, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 48, -1, 0, "WGS 84 / UTM zone 48N" },
+  { 32649, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 49, -1, 0, "WGS 84 / UTM zone 49N" },
+  { 32650, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 50, -1, 0, "WGS 84 / UTM zone 50N" },
+  { 32651, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 51, -1, 0, "WGS 84 / UTM zone 51N" },
+  { 32652, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 52, -1, 0, "WGS 84 / UTM zone 52N" },
+  { 32653, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 53, -1, 0, "WGS 84 / UTM zone 53N" },
+  { 32654, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 54, -1, 0, "WGS 84 / UTM zone 54N" },
+  { 32655, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 55, -1, 0, "WGS 84 / UTM zone 55N" },
+  { 32656, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 56, -1, 0, "WGS 84 / UTM zone 56N" },
+  { 32657, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 57, -1, 0, "WGS 84 / UTM zone 57N" },
+  { 32658, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 58, -1, 0, "WGS 84 / UTM zone 58N" },
+  { 32659, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 59, -1, 0, "WGS 84 / UTM zone 59N" },
+  { 32660, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, 60, -1, 0, "WGS 84 / UTM zone 60N" },
+  { 32661, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / UPS North (N,E)" },
+  { 32662, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / Plate Carree" },
+  { 32663, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / World Equidistant Cylindrical" },
+  { 32664, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / BLM 14N (ftUS)" },
+  { 32665, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / BLM 15N (ftUS)" },
+  { 32666, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / BLM 16N (ftUS)" },
+  { 32667, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / BLM 17N (ftUS)" },
+  { 32700, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / UTM grid system (southern hemisphere)" },
+  { 32701, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -1, -1, 0, "WGS 84 / UTM zone 1S" },
+  { 32702, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -2, -1, 0, "WGS 84 / UTM zone 2S" },
+  { 32703, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -3, -1, 0, "WGS 84 / UTM zone 3S" },
+  { 32704, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -4, -1, 0, "WGS 84 / UTM zone 4S" },
+  { 32705, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -5, -1, 0, "WGS 84 / UTM zone 5S" },
+  { 32706, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -6, -1, 0, "WGS 84 / UTM zone 6S" },
+  { 32707, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -7, -1, 0, "WGS 84 / UTM zone 7S" },
+  { 32708, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -8, -1, 0, "WGS 84 / UTM zone 8S" },
+  { 32709, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -9, -1, 0, "WGS 84 / UTM zone 9S" },
+  { 32710, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -10, -1, 0, "WGS 84 / UTM zone 10S" },
+  { 32711, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -11, -1, 0, "WGS 84 / UTM zone 11S" },
+  { 32712, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -12, -1, 0, "WGS 84 / UTM zone 12S" },
+  { 32713, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -13, -1, 0, "WGS 84 / UTM zone 13S" },
+  { 32714, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -14, -1, 0, "WGS 84 / UTM zone 14S" },
+  { 32715, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -15, -1, 0, "WGS 84 / UTM zone 15S" },
+  { 32716, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -16, -1, 0, "WGS 84 / UTM zone 16S" },
+  { 32717, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -17, -1, 0, "WGS 84 / UTM zone 17S" },
+  { 32718, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -18, -1, 0, "WGS 84 / UTM zone 18S" },
+  { 32719, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -19, -1, 0, "WGS 84 / UTM zone 19S" },
+  { 32720, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -20, -1, 0, "WGS 84 / UTM zone 20S" },
+  { 32721, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -21, -1, 0, "WGS 84 / UTM zone 21S" },
+  { 32722, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -22, -1, 0, "WGS 84 / UTM zone 22S" },
+  { 32723, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -23, -1, 0, "WGS 84 / UTM zone 23S" },
+  { 32724, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -24, -1, 0, "WGS 84 / UTM zone 24S" },
+  { 32725, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -25, -1, 0, "WGS 84 / UTM zone 25S" },
+  { 32726, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -26, -1, 0, "WGS 84 / UTM zone 26S" },
+  { 32727, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -27, -1, 0, "WGS 84 / UTM zone 27S" },
+  { 32728, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -28, -1, 0, "WGS 84 / UTM zone 28S" },
+  { 32729, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -29, -1, 0, "WGS 84 / UTM zone 29S" },
+  { 32730, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -30, -1, 0, "WGS 84 / UTM zone 30S" },
+  { 32731, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -31, -1, 0, "WGS 84 / UTM zone 31S" },
+  { 32732, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -32, -1, 0, "WGS 84 / UTM zone 32S" },
+  { 32733, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -33, -1, 0, "WGS 84 / UTM zone 33S" },
+  { 32734, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -34, -1, 0, "WGS 84 / UTM zone 34S" },
+  { 32735, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -35, -1, 0, "WGS 84 / UTM zone 35S" },
+  { 32736, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -36, -1, 0, "WGS 84 / UTM zone 36S" },
+  { 32737, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -37, -1, 0, "WGS 84 / UTM zone 37S" },
+  { 32738, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -38, -1, 0, "WGS 84 / UTM zone 38S" },
+  { 32739, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -39, -1, 0, "WGS 84 / UTM zone 39S" },
+  { 32740, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -40, -1, 0, "WGS 84 / UTM zone 40S" },
+  { 32741, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -41, -1, 0, "WGS 84 / UTM zone 41S" },
+  { 32742, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -42, -1, 0, "WGS 84 / UTM zone 42S" },
+  { 32743, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -43, -1, 0, "WGS 84 / UTM zone 43S" },
+  { 32744, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -44, -1, 0, "WGS 84 / UTM zone 44S" },
+  { 32745, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -45, -1, 0, "WGS 84 / UTM zone 45S" },
+  { 32746, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -46, -1, 0, "WGS 84 / UTM zone 46S" },
+  { 32747, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -47, -1, 0, "WGS 84 / UTM zone 47S" },
+  { 32748, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -48, -1, 0, "WGS 84 / UTM zone 48S" },
+  { 32749, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -49, -1, 0, "WGS 84 / UTM zone 49S" },
+  { 32750, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -50, -1, 0, "WGS 84 / UTM zone 50S" },
+  { 32751, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -51, -1, 0, "WGS 84 / UTM zone 51S" },
+  { 32752, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -52, -1, 0, "WGS 84 / UTM zone 52S" },
+  { 32753, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -53, -1, 0, "WGS 84 / UTM zone 53S" },
+  { 32754, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -54, -1, 0, "WGS 84 / UTM zone 54S" },
+  { 32755, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -55, -1, 0, "WGS 84 / UTM zone 55S" },
+  { 32756, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -56, -1, 0, "WGS 84 / UTM zone 56S" },
+  { 32757, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -57, -1, 0, "WGS 84 / UTM zone 57S" },
+  { 32758, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -58, -1, 0, "WGS 84 / UTM zone 58S" },
+  { 32759, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -59, -1, 0, "WGS 84 / UTM zone 59S" },
+  { 32760, CRS_EPSG_UTM, CRS_EPSG_UNITS_NONE, CRS_ELLIPSOID_WGS84, -60, -1, 0, "WGS 84 / UTM zone 60S" },
+  { 32761, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / UPS South (N,E)" },
+  { 32766, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "WGS 84 / TM 36 SE" },
+};
+
+static constexpr BOOL crs_epsg_sorted()
+{
+  for (U32 i = 1; i < crs_epsg_number; i++)
+  {
+    if (crs_epsg_table[i-1].code >= crs_epsg_table[i].code) return FALSE;
+  }
+  return TRUE;
+}
+
+static_assert(crs_epsg_sorted(), "crs_epsg_table must be sorted by code");
+
+// a binary search for the code in a table that is sorted by code
+
+static inline const CRSepsg* crs_epsg_search(const CRSepsg* table, const U32 number, const U16 code)
+{
+  U32 low = 0;
+  U32 high = number;
+  while (low < high)
+  {
+    U32 mid = (low + high) / 2;
+    if (table[mid].code < code)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+  if ((low < number) && (table[low].code == code))
+  {
+    return &table[low];
+  }
+  return 0;
+}
+
+static inline const CRSepsg* crs_epsg_find(const U16 code)
+{
+  return crs_epsg_search(crs_epsg_table, crs_epsg_number, code);
+}
+
+#endif
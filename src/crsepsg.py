@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+#
+# FILE:  crsepsg.py
+#
+# CONTENTS:
+#
+#   Generates crsepsg.hpp, the table of EPSG codes for projected coordinate
+#   systems that CRScheck knows, from crsepsg.csv. To add a code, add a line
+#   to crsepsg.csv and run
+#
+#     python3 crsepsg.py crsepsg.csv crsepsg.hpp
+#
+#   The columns of crsepsg.csv are
+#
+#     code         EPSG code (1 to 65535)
+#     projection   UTM, MGA, SP27, SP83, TM, LCC, or NAME (only a description)
+#     ellipsoid    NAD27, NAD83, Inter, SAD69, WGS72, WGS84, ID74, GDA94, an
+#                  ellipsoid number, or empty to not set the ellipsoid
+#     zone         UTM and MGA zone with hemisphere (e.g. 56S) or the name of
+#                  the NAD27 or NAD83 state plane zone (e.g. CA_I)
+#     units        m, ft, ftUS, or empty. a code with units defines the entire
+#                  CRS and is described by its description. one without units
+#                  is described by its projection and by its description only
+#                  when the projection cannot be set
+#     parameters   TM: false easting, false northing, latitude of origin,
+#                  central meridian, scale factor
+#                  LCC: false easting, false northing, latitude of origin,
+#                  central meridian, first and second standard parallel
+#     description  name of the EPSG code (latin-1)
+#
+# COPYRIGHT:
+#
+#   (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+#
+#   This is free software; you can redistribute and/or modify it under the
+#   terms of the GNU Lesser General Licence as published by the Free Software
+#   Foundation. See the COPYING.txt file for more information.
+#
+# CHANGE HISTORY:
+#
+#   18 October 2026 -- the binary search takes any sorted table
+#   18 October 2026 -- created to replace the switch and the list of EPSG codes
+#
+
+import csv
+import re
+import sys
+
+PROJECTIONS = ('NAME', 'UTM', 'MGA', 'SP27', 'SP83', 'TM', 'LCC')
+PARAMETERS = {'TM': 5, 'LCC': 6}
+UNITS = {'': 'CRS_EPSG_UNITS_NONE', 'm': 'CRS_EPSG_UNITS_METER', 'ft': 'CRS_EPSG_UNITS_FEET', 'ftUS': 'CRS_EPSG_UNITS_SURVEY_FEET'}
+ELLIPSOIDS = ('NAD27', 'NAD83', 'Inter', 'SAD69', 'WGS72', 'WGS84', 'ID74', 'GDA94')
+
+def fail(line, message):
+    sys.exit('ERROR: line %d of %s: %s' % (line, sys.argv[1], message))
+
+def c_string(text):
+    # octal escapes for everything that is not printable ASCII
+    out = []
+    for byte in text.encode('latin-1'):
+        if byte in (0x22, 0x5C):
+            out.append('\\' + chr(byte))
+        elif 0x20 <= byte < 0x7F and byte != 0x3F:
+            out.append(chr(byte))
+        else:
+            out.append('\\%03o' % byte)
+    return '"' + ''.join(out) + '"'
+
+def c_double(value):
+    # repr() is the shortest string that reads back as the same double
+    text = repr(float(value))
+    return text if ('e' in text or '.' in text) else text + '.0'
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: python3 crsepsg.py crsepsg.csv crsepsg.hpp')
+
+    rows = []
+    with open(sys.argv[1], newline='', encoding='latin-1') as f:
+        reader = csv.DictReader(f)
+        for row in reader:
+            line = reader.line_num
+            try:
+                code = int(row['code'])
+            except ValueError:
+                fail(line, "code '%s' is not a number" % row['code'])
+            if not (0 < code < 65536):
+                fail(line, 'code %d does not fit a GeoKey' % code)
+            projection = row['projection']
+            if projection not in PROJECTIONS:
+                fail(line, "unknown projection '%s'" % projection)
+            ellipsoid = row['ellipsoid']
+            if ellipsoid == '':
+                ellipsoid = '-1'
+            elif ellipsoid in ELLIPSOIDS:
+                ellipsoid = 'CRS_ELLIPSOID_' + ellipsoid
+            elif not (ellipsoid.isdigit() and 0 < int(ellipsoid) < 25):
+                fail(line, "unknown ellipsoid '%s'" % ellipsoid)
+            zone = row['zone']
+            utm_zone = 0
+            state_plane = '0'
+            if projection in ('UTM', 'MGA'):
+                m = re.match(r'^(\d+)([NS])$', zone)
+                if not m:
+                    fail(line, "zone '%s' is not a UTM zone like 56S" % zone)
+                utm_zone = int(m.group(1)) * (1 if m.group(2) == 'N' else -1)
+            elif projection in ('SP27', 'SP83'):
+                if zone == '':
+                    fail(line, 'state plane projection without zone')
+                state_plane = c_string(zone)
+            elif zone != '':
+                fail(line, "projection '%s' has no zone" % projection)
+            if row['units'] not in UNITS:
+                fail(line, "unknown units '%s'" % row['units'])
+            parameters = row['parameters'].split()
+            if len(parameters) != PARAMETERS.get(projection, 0):
+                fail(line, "projection '%s' needs %d parameters" % (projection, PARAMETERS.get(projection, 0)))
+            if (projection in PARAMETERS) and (row['units'] == ''):
+                fail(line, "projection '%s' needs units" % projection)
+            if (projection == 'NAME') and (row['description'] == ''):
+                fail(line, 'code without projection needs a description')
+            description = (c_string(row['description']) if row['description'] else '0')
+            rows.append((code, line, projection, ellipsoid, utm_zone, state_plane, UNITS[row['units']], [float(p) for p in parameters], description))
+
+    rows.sort()
+    for a, b in zip(rows, rows[1:]):
+        if a[0] == b[0]:
+            fail(b[1], 'code %d is also on line %d' % (b[0], a[1]))
+
+    # the parameters are shared by all codes that use the same ones
+
+    parameter_sets = []
+    parameter_index = {}
+    for row in rows:
+        if row[7]:
+            key = tuple(row[7] + [0.0] * (6 - len(row[7])))
+            if key not in parameter_index:
+                parameter_index[key] = len(parameter_sets)
+                parameter_sets.append(key)
+
+    with open(sys.argv[2], 'w', newline='\n', encoding='ascii') as out:
+        out.write('''/*
+===============================================================================
+
+  FILE:  crsepsg.hpp
+
+  CONTENTS:
+
+    The EPSG codes of projected coordinate systems that CRScheck knows sorted
+    by code for a binary search.
+
+    GENERATED by crsepsg.py from crsepsg.csv. DO NOT EDIT. add codes to
+    crsepsg.csv instead and run 'python3 crsepsg.py crsepsg.csv crsepsg.hpp'
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- the binary search takes any sorted table
+    18 October 2026 -- created to replace the switch and the list of EPSG codes
+
+===============================================================================
+*/
+#ifndef CRS_EPSG_HPP
+#define CRS_EPSG_HPP
+
+#include "mydefs.hpp"
+
+// needs the CRS_ELLIPSOID_ definitions of crscheck.hpp
+
+#define CRS_EPSG_NAME   0
+#define CRS_EPSG_UTM    1
+#define CRS_EPSG_MGA    2
+#define CRS_EPSG_SP27   3
+#define CRS_EPSG_SP83   4
+#define CRS_EPSG_TM     5
+#define CRS_EPSG_LCC    6
+
+#define CRS_EPSG_UNITS_NONE         0
+#define CRS_EPSG_UNITS_METER        1
+#define CRS_EPSG_UNITS_FEET         2
+#define CRS_EPSG_UNITS_SURVEY_FEET  3
+
+class CRSepsg
+{
+public:
+  U16 code;
+  U8 projection;
+  U8 units;
+  I8 ellipsoid;           // -1 does not set the ellipsoid
+  I8 utm_zone;            // negative for the southern hemisphere
+  I16 parameters;         // index into crs_epsg_parameters or -1
+  const CHAR* state_plane;
+  const CHAR* description;
+};
+
+''')
+        out.write('static constexpr F64 crs_epsg_parameters[%d][6] =\n{\n' % max(1, len(parameter_sets)))
+        for key in parameter_sets:
+            out.write('  { %s },\n' % ', '.join(c_double(p) for p in key))
+        if not parameter_sets:
+            out.write('  { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },\n')
+        out.write('};\n\n')
+        out.write('static constexpr U32 crs_epsg_number = %d;\n\n' % len(rows))
+        out.write('static constexpr CRSepsg crs_epsg_table[crs_epsg_number] =\n{\n')
+        for code, line, projection, ellipsoid, utm_zone, state_plane, units, parameters, description in rows:
+            index = (parameter_index[tuple(parameters + [0.0] * (6 - len(parameters)))] if parameters else -1)
+            out.write('  { %d, CRS_EPSG_%s, %s, %s, %d, %d, %s, %s },\n' % (code, projection, units, ellipsoid, utm_zone, index, state_plane, description))
+        out.write('''};
+
+static constexpr BOOL crs_epsg_sorted()
+{
+  for (U32 i = 1; i < crs_epsg_number; i++)
+  {
+    if (crs_epsg_table[i-1].code >= crs_epsg_table[i].code) return FALSE;
+  }
+  return TRUE;
+}
+
+static_assert(crs_epsg_sorted(), "crs_epsg_table must be sorted by code");
+
+// a binary search for the code in a table that is sorted by code
+
+static inline const CRSepsg* crs_epsg_search(const CRSepsg* table, const U32 number, const U16 code)
+{
+  U32 low = 0;
+  U32 high = number;
+  while (low < high)
+  {
+    U32 mid = (low + high) / 2;
+    if (table[mid].code < code)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+  if ((low < number) && (table[low].code == code))
+  {
+    return &table[low];
+  }
+  return 0;
+}
+
+static inline const CRSepsg* crs_epsg_find(const U16 code)
+{
+  return crs_epsg_search(crs_epsg_table, crs_epsg_number, code);
+}
+
+#endif
+''')
+
+if __name__ == '__main__':
+    main()
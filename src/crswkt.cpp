@@ -0,0 +1,748 @@
+/*
+===============================================================================
+
+  FILE:  crswkt.cpp
+
+  CONTENTS:
+
+    see corresponding header file
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    see corresponding header file
+
+===============================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crswkt.hpp"
+
+static const F64 deg2rad = 3.141592653589793238462643383279502884197169 / 180.0;
+
+// deeper nesting is not found in real CRSs and would only risk the stack
+
+#define CRS_WKT_MAX_DEPTH  32
+
+// the values of an element beyond this many are parsed but not kept
+
+#define CRS_WKT_MAX_VALUES 8
+
+#define CRS_WKT_VALUE_STRING 0
+#define CRS_WKT_VALUE_NUMBER 1
+#define CRS_WKT_VALUE_ENUM   2
+#define CRS_WKT_VALUE_DATETIME 3
+
+// the keywords of WKT1 and WKT2 that matter for the check. all others are
+// parsed but ignored
+
+enum
+{
+  CRS_WKT_KEYWORD_OTHER = 0,
+  CRS_WKT_KEYWORD_PROJECTED,
+  CRS_WKT_KEYWORD_GEOGRAPHIC,
+  CRS_WKT_KEYWORD_GEODETIC,
+  CRS_WKT_KEYWORD_GEOCENTRIC,
+  CRS_WKT_KEYWORD_LOCAL,
+  CRS_WKT_KEYWORD_BASE,
+  CRS_WKT_KEYWORD_VERTICAL,
+  CRS_WKT_KEYWORD_COMPOUND,
+  CRS_WKT_KEYWORD_BOUND,
+  CRS_WKT_KEYWORD_IGNORED,
+  CRS_WKT_KEYWORD_DATUM,
+  CRS_WKT_KEYWORD_ELLIPSOID,
+  CRS_WKT_KEYWORD_CONVERSION,
+  CRS_WKT_KEYWORD_METHOD,
+  CRS_WKT_KEYWORD_PARAMETER,
+  CRS_WKT_KEYWORD_UNIT,
+  CRS_WKT_KEYWORD_AUTHORITY,
+  CRS_WKT_KEYWORD_AXIS,
+  CRS_WKT_KEYWORD_CS
+};
+
+class CRSwktKeyword
+{
+public:
+  const CHAR* name;
+  I32 keyword;
+};
+
+static const CRSwktKeyword crs_wkt_keywords[] =
+{
+  { "PROJCS", CRS_WKT_KEYWORD_PROJECTED },
+  { "PROJCRS", CRS_WKT_KEYWORD_PROJECTED },
+  { "PROJECTEDCRS", CRS_WKT_KEYWORD_PROJECTED },
+  { "GEOGCS", CRS_WKT_KEYWORD_GEOGRAPHIC },
+  { "GEOGCRS", CRS_WKT_KEYWORD_GEOGRAPHIC },
+  { "GEOGRAPHICCRS", CRS_WKT_KEYWORD_GEOGRAPHIC },
+  { "GEODCRS", CRS_WKT_KEYWORD_GEODETIC },
+  { "GEODETICCRS", CRS_WKT_KEYWORD_GEODETIC },
+  { "GEOCCS", CRS_WKT_KEYWORD_GEOCENTRIC },
+  { "LOCAL_CS", CRS_WKT_KEYWORD_LOCAL },
+  { "ENGCRS", CRS_WKT_KEYWORD_LOCAL },
+  { "ENGINEERINGCRS", CRS_WKT_KEYWORD_LOCAL },
+  { "BASEGEOGCRS", CRS_WKT_KEYWORD_BASE },
+  { "BASEGEODCRS", CRS_WKT_KEYWORD_BASE },
+  { "VERT_CS", CRS_WKT_KEYWORD_VERTICAL },
+  { "VERTCRS", CRS_WKT_KEYWORD_VERTICAL },
+  { "VERTICALCRS", CRS_WKT_KEYWORD_VERTICAL },
+  { "COMPD_CS", CRS_WKT_KEYWORD_COMPOUND },
+  { "COMPOUNDCRS", CRS_WKT_KEYWORD_COMPOUND },
+  { "BOUNDCRS", CRS_WKT_KEYWORD_BOUND },
+  { "SOURCECRS", CRS_WKT_KEYWORD_BOUND },
+  { "TARGETCRS", CRS_WKT_KEYWORD_IGNORED },
+  { "ABRIDGEDTRANSFORMATION", CRS_WKT_KEYWORD_IGNORED },
+  { "DATUM", CRS_WKT_KEYWORD_DATUM },
+  { "GEODETICDATUM", CRS_WKT_KEYWORD_DATUM },
+  { "TRF", CRS_WKT_KEYWORD_DATUM },
+  { "SPHEROID", CRS_WKT_KEYWORD_ELLIPSOID },
+  { "ELLIPSOID", CRS_WKT_KEYWORD_ELLIPSOID },
+  { "CONVERSION", CRS_WKT_KEYWORD_CONVERSION },
+  { "PROJECTION", CRS_WKT_KEYWORD_METHOD },
+  { "METHOD", CRS_WKT_KEYWORD_METHOD },
+  { "PARAMETER", CRS_WKT_KEYWORD_PARAMETER },
+  { "UNIT", CRS_WKT_KEYWORD_UNIT },
+  { "LENGTHUNIT", CRS_WKT_KEYWORD_UNIT },
+  { "ANGLEUNIT", CRS_WKT_KEYWORD_UNIT },
+  { "SCALEUNIT", CRS_WKT_KEYWORD_UNIT },
+  { "AUTHORITY", CRS_WKT_KEYWORD_AUTHORITY },
+  { "ID", CRS_WKT_KEYWORD_AUTHORITY },
+  { "AXIS", CRS_WKT_KEYWORD_AXIS },
+  { "CS", CRS_WKT_KEYWORD_CS },
+  { 0, CRS_WKT_KEYWORD_OTHER }
+};
+
+// the names of methods and parameters differ between WKT1, ESRI, and WKT2 in
+// case, in '_' or ' ', and in brackets. they are compared by their letters
+// and digits only
+
+class CRSwktName
+{
+public:
+  const CHAR* name;
+  I32 value;
+};
+
+static const CRSwktName crs_wkt_methods[] =
+{
+  { "transversemercator", CRS_WKT_METHOD_TM },
+  { "gausskruger", CRS_WKT_METHOD_TM },
+  { "lambertconformalconic2sp", CRS_WKT_METHOD_LCC_2SP },
+  { "lambertconicconformal2sp", CRS_WKT_METHOD_LCC_2SP },
+  { "lambertconformalconic", CRS_WKT_METHOD_LCC_2SP },
+  { "lambertconformalconic1sp", CRS_WKT_METHOD_LCC_1SP },
+  { "lambertconicconformal1sp", CRS_WKT_METHOD_LCC_1SP },
+  { 0, CRS_WKT_METHOD_OTHER }
+};
+
+static const CRSwktName crs_wkt_parameters[] =
+{
+  { "falseeasting", CRS_WKT_FALSE_EASTING },
+  { "eastingatfalseorigin", CRS_WKT_FALSE_EASTING },
+  { "falsenorthing", CRS_WKT_FALSE_NORTHING },
+  { "northingatfalseorigin", CRS_WKT_FALSE_NORTHING },
+  { "latitudeoforigin", CRS_WKT_LATITUDE_OF_ORIGIN },
+  { "latitudeofnaturalorigin", CRS_WKT_LATITUDE_OF_ORIGIN },
+  { "latitudeoffalseorigin", CRS_WKT_LATITUDE_OF_ORIGIN },
+  { "centralmeridian", CRS_WKT_CENTRAL_MERIDIAN },
+  { "longitudeofnaturalorigin", CRS_WKT_CENTRAL_MERIDIAN },
+  { "longitudeoffalseorigin", CRS_WKT_CENTRAL_MERIDIAN },
+  { "longitudeoforigin", CRS_WKT_CENTRAL_MERIDIAN },
+  { "scalefactor", CRS_WKT_SCALE_FACTOR },
+  { "scalefactoratnaturalorigin", CRS_WKT_SCALE_FACTOR },
+  { "standardparallel1", CRS_WKT_STANDARD_PARALLEL_1 },
+  { "latitudeof1ststandardparallel", CRS_WKT_STANDARD_PARALLEL_1 },
+  { "standardparallel2", CRS_WKT_STANDARD_PARALLEL_2 },
+  { "latitudeof2ndstandardparallel", CRS_WKT_STANDARD_PARALLEL_2 },
+  { 0, -1 }
+};
+
+class CRSwktElement
+{
+public:
+  CRSwktElement* parent;
+  I32 keyword;
+  BOOL ignore;
+  U32 value_number;
+  U8 value_type[CRS_WKT_MAX_VALUES];
+  const CHAR* value_string[CRS_WKT_MAX_VALUES];
+  U32 value_length[CRS_WKT_MAX_VALUES];
+  F64 value[CRS_WKT_MAX_VALUES];
+  U16 epsg;
+  F64 unit;
+  BOOL cartesian;
+};
+
+static inline BOOL is_space(const CHAR c)
+{
+  return ((c == ' ') || (c == '\t') || (c == '\n') || (c == '\r'));
+}
+
+static inline BOOL is_letter(const CHAR c)
+{
+  return (((c >= 'A') && (c <= 'Z')) || ((c >= 'a') && (c <= 'z')) || (c == '_'));
+}
+
+static inline BOOL is_digit(const CHAR c)
+{
+  return ((c >= '0') && (c <= '9'));
+}
+
+// the length of an unquoted ISO 8601 date or datetime such as 2013-01-01 or
+// 2013-01-01T12:00:00.5+01:00 that WKT2 allows in TIMEEXTENT. a year alone
+// is a number and gives 0 like everything else that is not a date
+
+static U32 datetime_length(const CHAR* s, const U32 length)
+{
+  U32 i = 0;
+  while ((i < length) && is_digit(s[i])) i++;
+  if ((i != 4) || (i == length) || (s[i] != '-')) return 0;
+  while ((i < length) && (s[i] == '-'))
+  {
+    U32 digits = ++i;
+    while ((i < length) && is_digit(s[i])) i++;
+    if ((i - digits) < 2) return 0;
+  }
+  if ((i < length) && (s[i] == 'T'))
+  {
+    i++;
+    while ((i < length) && (is_digit(s[i]) || (s[i] == ':') || (s[i] == '.') || (s[i] == '+') || (s[i] == '-') || (s[i] == 'Z'))) i++;
+  }
+  return i;
+}
+
+static inline CHAR to_lower(const CHAR c)
+{
+  return (((c >= 'A') && (c <= 'Z')) ? (c - 'A' + 'a') : c);
+}
+
+// compares the letters and digits of a name with a lower-case literal
+
+static BOOL same_name(const CHAR* name, const U32 length, const CHAR* literal)
+{
+  U32 i;
+  for (i = 0; i < length; i++)
+  {
+    CHAR c = to_lower(name[i]);
+    if (((c >= 'a') && (c <= 'z')) || is_digit(c))
+    {
+      if (*literal != c) return FALSE;
+      literal++;
+    }
+  }
+  return (*literal == '\0');
+}
+
+static I32 find_name(const CRSwktName* names, const CHAR* name, const U32 length)
+{
+  while (names->name)
+  {
+    if (same_name(name, length, names->name)) break;
+    names++;
+  }
+  return names->value;
+}
+
+static I32 find_keyword(const CHAR* keyword, const U32 length)
+{
+  const CRSwktKeyword* k;
+  for (k = crs_wkt_keywords; k->name; k++)
+  {
+    U32 i;
+    for (i = 0; i < length; i++)
+    {
+      CHAR c = keyword[i];
+      if ((c >= 'a') && (c <= 'z')) c = c - 'a' + 'A';
+      if (k->name[i] != c) break;
+    }
+    if ((i == length) && (k->name[i] == '\0')) return k->keyword;
+  }
+  return CRS_WKT_KEYWORD_OTHER;
+}
+
+// EPSG codes in WKT1 are strings and in WKT2 numbers
+
+static U16 get_epsg(const CRSwktElement* element)
+{
+  if ((element->value_number < 2) || (element->value_type[0] != CRS_WKT_VALUE_STRING) || !same_name(element->value_string[0], element->value_length[0], "epsg"))
+  {
+    return 0;
+  }
+  F64 code = 0.0;
+  if (element->value_type[1] == CRS_WKT_VALUE_NUMBER)
+  {
+    code = element->value[1];
+  }
+  else if (element->value_type[1] == CRS_WKT_VALUE_STRING)
+  {
+    U32 i;
+    for (i = 0; i < element->value_length[1]; i++)
+    {
+      if (!is_digit(element->value_string[1][i])) return 0;
+      code = 10.0*code + (element->value_string[1][i] - '0');
+    }
+  }
+  if ((code < 1.0) || (code > 65535.0) || (code != (F64)((U32)code)))
+  {
+    return 0;
+  }
+  return (U16)code;
+}
+
+// a horizontal CRS is the outermost one, part of a compound CRS, or the source
+// of a bound CRS
+
+static BOOL is_horizontal(const CRSwktElement* element)
+{
+  return ((element->parent == 0) || (element->parent->keyword == CRS_WKT_KEYWORD_COMPOUND) || (element->parent->keyword == CRS_WKT_KEYWORD_BOUND));
+}
+
+BOOL CRSwkt::fail(const CHAR* message)
+{
+  snprintf(error, 256, "%s at character %u", message, position);
+  return FALSE;
+}
+
+void CRSwkt::finish_element(CRSwktElement* element)
+{
+  if (element->ignore)
+  {
+    return;
+  }
+
+  CRSwktElement* parent = element->parent;
+
+  switch (element->keyword)
+  {
+  case CRS_WKT_KEYWORD_AUTHORITY:
+    if (parent && (parent->epsg == 0)) parent->epsg = get_epsg(element);
+    break;
+  case CRS_WKT_KEYWORD_UNIT:
+    if (parent && (element->value_number >= 2) && (element->value_type[1] == CRS_WKT_VALUE_NUMBER)) parent->unit = element->value[1];
+    break;
+  case CRS_WKT_KEYWORD_AXIS:
+    // WKT2 may give the unit with each axis instead of once for the CRS
+    if (parent && (element->unit != 0.0) && (parent->unit == 0.0)) parent->unit = element->unit;
+    break;
+  case CRS_WKT_KEYWORD_CS:
+    if (parent && (element->value_number >= 1) && (element->value_type[0] == CRS_WKT_VALUE_ENUM)) parent->cartesian = same_name(element->value_string[0], element->value_length[0], "cartesian");
+    break;
+  case CRS_WKT_KEYWORD_ELLIPSOID:
+    if ((element->value_number >= 3) && (element->value_type[1] == CRS_WKT_VALUE_NUMBER) && (element->value_type[2] == CRS_WKT_VALUE_NUMBER))
+    {
+      semi_major_axis = element->value[1] * (element->unit != 0.0 ? element->unit : 1.0);
+      inverse_flattening = element->value[2];
+      ellipsoid_epsg = element->epsg;
+    }
+    break;
+  case CRS_WKT_KEYWORD_DATUM:
+    datum_epsg = element->epsg;
+    break;
+  case CRS_WKT_KEYWORD_METHOD:
+    if (parent && ((parent->keyword == CRS_WKT_KEYWORD_PROJECTED) || (parent->keyword == CRS_WKT_KEYWORD_CONVERSION)) && (element->value_number >= 1) && (element->value_type[0] == CRS_WKT_VALUE_STRING))
+    {
+      method_name = element->value_string[0];
+      method_name_length = element->value_length[0];
+      method = find_name(crs_wkt_methods, method_name, method_name_length);
+      if (method == CRS_WKT_METHOD_OTHER)
+      {
+        if (element->epsg == 9807) method = CRS_WKT_METHOD_TM;
+        else if (element->epsg == 9802) method = CRS_WKT_METHOD_LCC_2SP;
+        else if (element->epsg == 9801) method = CRS_WKT_METHOD_LCC_1SP;
+      }
+    }
+    break;
+  case CRS_WKT_KEYWORD_PARAMETER:
+    // the units are applied when the projected CRS is complete
+    if (parent && ((parent->keyword == CRS_WKT_KEYWORD_PROJECTED) || (parent->keyword == CRS_WKT_KEYWORD_CONVERSION)) && (element->value_number >= 2) && (element->value_type[0] == CRS_WKT_VALUE_STRING) && (element->value_type[1] == CRS_WKT_VALUE_NUMBER))
+    {
+      I32 p = find_name(crs_wkt_parameters, element->value_string[0], element->value_length[0]);
+      if (p >= 0)
+      {
+        parameters[p] = element->value[1];
+        parameter_units[p] = element->unit;
+        has_parameter |= (1u << p);
+      }
+    }
+    break;
+  case CRS_WKT_KEYWORD_BASE:
+    geographic_epsg = element->epsg;
+    if (element->unit != 0.0) geographic_angular_unit = element->unit;
+    break;
+  case CRS_WKT_KEYWORD_GEOGRAPHIC:
+  case CRS_WKT_KEYWORD_GEODETIC:
+    if (parent && (parent->keyword == CRS_WKT_KEYWORD_PROJECTED))
+    {
+      geographic_epsg = element->epsg;
+      if (element->unit != 0.0) geographic_angular_unit = element->unit;
+    }
+    else if (is_horizontal(element))
+    {
+      name = element->value_string[0];
+      name_length = element->value_length[0];
+      epsg = element->epsg;
+      if ((element->keyword == CRS_WKT_KEYWORD_GEODETIC) && element->cartesian)
+      {
+        type = CRS_WKT_GEOCENTRIC;
+        linear_unit = element->unit;
+      }
+      else
+      {
+        type = CRS_WKT_GEOGRAPHIC;
+        geographic_epsg = element->epsg;
+        if (element->unit != 0.0) geographic_angular_unit = element->unit;
+      }
+    }
+    break;
+  case CRS_WKT_KEYWORD_GEOCENTRIC:
+    if (is_horizontal(element))
+    {
+      type = CRS_WKT_GEOCENTRIC;
+      name = element->value_string[0];
+      name_length = element->value_length[0];
+      epsg = element->epsg;
+      linear_unit = element->unit;
+    }
+    break;
+  case CRS_WKT_KEYWORD_LOCAL:
+    if (is_horizontal(element))
+    {
+      type = CRS_WKT_LOCAL;
+      name = element->value_string[0];
+      name_length = element->value_length[0];
+      epsg = element->epsg;
+      linear_unit = element->unit;
+    }
+    break;
+  case CRS_WKT_KEYWORD_PROJECTED:
+    if (is_horizontal(element))
+    {
+      type = CRS_WKT_PROJECTED;
+      name = element->value_string[0];
+      name_length = element->value_length[0];
+      epsg = element->epsg;
+      linear_unit = element->unit;
+      // to meter and degree
+      U32 p;
+      for (p = 0; p < CRS_WKT_PARAMETERS; p++)
+      {
+        if (has_parameter & (1u << p))
+        {
+          if ((p == CRS_WKT_FALSE_EASTING) || (p == CRS_WKT_FALSE_NORTHING))
+          {
+            parameters[p] *= (parameter_units[p] != 0.0 ? parameter_units[p] : (linear_unit != 0.0 ? linear_unit : 1.0));
+          }
+          else if (p == CRS_WKT_SCALE_FACTOR)
+          {
+            if (parameter_units[p] != 0.0) parameters[p] *= parameter_units[p];
+          }
+          else
+          {
+            parameters[p] *= (parameter_units[p] != 0.0 ? parameter_units[p] : geographic_angular_unit) / deg2rad;
+          }
+        }
+      }
+      // the ESRI name is the same for both variants
+      if ((method == CRS_WKT_METHOD_LCC_2SP) && !(has_parameter & (1u << CRS_WKT_STANDARD_PARALLEL_2)))
+      {
+        method = CRS_WKT_METHOD_LCC_1SP;
+      }
+    }
+    break;
+  case CRS_WKT_KEYWORD_VERTICAL:
+    vertical = TRUE;
+    vertical_name = element->value_string[0];
+    vertical_name_length = element->value_length[0];
+    vertical_epsg = element->epsg;
+    vertical_unit = element->unit;
+    break;
+  }
+}
+
+// parses an element whose keyword starts at the current position
+
+BOOL CRSwkt::parse_element(CRSwktElement* element, U32 depth)
+{
+  if (depth >= CRS_WKT_MAX_DEPTH)
+  {
+    return fail("elements nested too deeply");
+  }
+
+  U32 start = position;
+  while ((position < length) && (is_letter(wkt[position]) || is_digit(wkt[position]))) position++;
+  element->keyword = find_keyword(wkt + start, position - start);
+  element->ignore = (element->ignore || (element->keyword == CRS_WKT_KEYWORD_IGNORED));
+  element->value_number = 0;
+  element->epsg = 0;
+  element->unit = 0.0;
+  element->cartesian = FALSE;
+
+  while ((position < length) && is_space(wkt[position])) position++;
+  if ((position == length) || ((wkt[position] != '[') && (wkt[position] != '(')))
+  {
+    return fail("expected '[' after keyword");
+  }
+  CHAR close = (wkt[position] == '[' ? ']' : ')');
+  position++;
+
+  U32 items = 0;
+  while (TRUE)
+  {
+    while ((position < length) && is_space(wkt[position])) position++;
+    if (position == length)
+    {
+      return fail("unexpected end of string");
+    }
+    if (wkt[position] == close)
+    {
+      position++;
+      break;
+    }
+    if (items)
+    {
+      if (wkt[position] != ',')
+      {
+        return fail("expected ',' or closing bracket");
+      }
+      position++;
+      while ((position < length) && is_space(wkt[position])) position++;
+      if (position == length)
+      {
+        return fail("unexpected end of string");
+      }
+    }
+    items++;
+
+    CHAR c = wkt[position];
+    if (c == '"')
+    {
+      // a quote in a string is written as two quotes
+      start = ++position;
+      while (TRUE)
+      {
+        if (position == length)
+        {
+          return fail("string is not terminated");
+        }
+        if (wkt[position] == '"')
+        {
+          if (((position + 1) < length) && (wkt[position+1] == '"'))
+          {
+            position += 2;
+            continue;
+          }
+          break;
+        }
+        position++;
+      }
+      if (element->value_number < CRS_WKT_MAX_VALUES)
+      {
+        element->value_type[element->value_number] = CRS_WKT_VALUE_STRING;
+        element->value_string[element->value_number] = wkt + start;
+        element->value_length[element->value_number] = position - start;
+        element->value_number++;
+      }
+      position++;
+    }
+    else if (is_digit(c) && datetime_length(wkt + position, length - position))
+    {
+      start = position;
+      position += datetime_length(wkt + position, length - position);
+      if (element->value_number < CRS_WKT_MAX_VALUES)
+      {
+        element->value_type[element->value_number] = CRS_WKT_VALUE_DATETIME;
+        element->value_string[element->value_number] = wkt + start;
+        element->value_length[element->value_number] = position - start;
+        element->value_number++;
+      }
+    }
+    else if (is_digit(c) || (c == '-') || (c == '+') || (c == '.'))
+    {
+      start = position;
+      while ((position < length) && (is_digit(wkt[position]) || (wkt[position] == '-') || (wkt[position] == '+') || (wkt[position] == '.') || (wkt[position] == 'e') || (wkt[position] == 'E'))) position++;
+      CHAR number[64];
+      CHAR* end;
+      if ((position - start) >= 64)
+      {
+        return fail("number is too long");
+      }
+      memcpy(number, wkt + start, position - start);
+      number[position - start] = '\0';
+      F64 value = strtod(number, &end);
+      if (*end != '\0')
+      {
+        position = start;
+        return fail("malformed number");
+      }
+      if (element->value_number < CRS_WKT_MAX_VALUES)
+      {
+        element->value_type[element->value_number] = CRS_WKT_VALUE_NUMBER;
+        element->value_string[element->value_number] = wkt + start;
+        element->value_length[element->value_number] = position - start;
+        element->value[element->value_number] = value;
+        element->value_number++;
+      }
+    }
+    else if (is_letter(c))
+    {
+      // a nested element or a bare word such as EAST in AXIS["Easting",EAST]
+      start = position;
+      U32 end = position;
+      while ((end < length) && (is_letter(wkt[end]) || is_digit(wkt[end]))) end++;
+      U32 next = end;
+      while ((next < length) && is_space(wkt[next])) next++;
+      if ((next < length) && ((wkt[next] == '[') || (wkt[next] == '(')))
+      {
+        CRSwktElement child;
+        child.parent = element;
+        child.ignore = element->ignore;
+        if (!parse_element(&child, depth + 1))
+        {
+          return FALSE;
+        }
+      }
+      else
+      {
+        if (element->value_number < CRS_WKT_MAX_VALUES)
+        {
+          element->value_type[element->value_number] = CRS_WKT_VALUE_ENUM;
+          element->value_string[element->value_number] = wkt + start;
+          element->value_length[element->value_number] = end - start;
+          element->value_number++;
+        }
+        position = end;
+      }
+    }
+    else
+    {
+      return fail("unexpected character");
+    }
+  }
+
+  // a CRS needs a name
+
+  if ((element->keyword >= CRS_WKT_KEYWORD_PROJECTED) && (element->keyword <= CRS_WKT_KEYWORD_COMPOUND))
+  {
+    if ((element->value_number == 0) || (element->value_type[0] != CRS_WKT_VALUE_STRING))
+    {
+      return fail("coordinate reference system without name");
+    }
+  }
+  else if ((element->keyword == CRS_WKT_KEYWORD_ELLIPSOID) && !element->ignore)
+  {
+    if ((element->value_number < 3) || (element->value_type[1] != CRS_WKT_VALUE_NUMBER) || (element->value_type[2] != CRS_WKT_VALUE_NUMBER) || (element->value[1] <= 0.0) || (element->value[2] < 0.0))
+    {
+      return fail("ellipsoid without positive semi-major axis and inverse flattening");
+    }
+  }
+  else if ((element->keyword == CRS_WKT_KEYWORD_UNIT) && !element->ignore)
+  {
+    if ((element->value_number < 2) || (element->value_type[1] != CRS_WKT_VALUE_NUMBER) || (element->value[1] <= 0.0))
+    {
+      return fail("unit without positive conversion factor");
+    }
+  }
+
+  finish_element(element);
+  return TRUE;
+}
+
+BOOL CRSwkt::parse(const CHAR* wkt, U32 length)
+{
+  clear();
+  this->wkt = wkt;
+  this->length = 0;
+  while ((this->length < length) && wkt[this->length]) this->length++;
+
+  while ((position < this->length) && is_space(wkt[position])) position++;
+  if ((position == this->length) || !is_letter(wkt[position]))
+  {
+    return fail("expected keyword");
+  }
+  U32 start = position;
+  while ((start < this->length) && (is_letter(wkt[start]) || is_digit(wkt[start]))) start++;
+  I32 keyword = find_keyword(wkt + position, start - position);
+  if ((keyword < CRS_WKT_KEYWORD_PROJECTED) || (keyword > CRS_WKT_KEYWORD_BOUND) || (keyword == CRS_WKT_KEYWORD_BASE))
+  {
+    return fail("not a coordinate reference system");
+  }
+
+  CRSwktElement element;
+  element.parent = 0;
+  element.ignore = FALSE;
+  if (!parse_element(&element, 0))
+  {
+    return FALSE;
+  }
+
+  while ((position < this->length) && is_space(wkt[position])) position++;
+  if (position < this->length)
+  {
+    return fail("unexpected characters after the end");
+  }
+  if ((type == CRS_WKT_NONE) && !vertical)
+  {
+    return fail("no horizontal or vertical coordinate reference system");
+  }
+  if ((type == CRS_WKT_PROJECTED) && (method == CRS_WKT_METHOD_NONE))
+  {
+    return fail("projected coordinate reference system without projection");
+  }
+  return TRUE;
+}
+
+void CRSwkt::clear()
+{
+  type = CRS_WKT_NONE;
+  name = 0;
+  name_length = 0;
+  epsg = 0;
+  geographic_epsg = 0;
+  datum_epsg = 0;
+  ellipsoid_epsg = 0;
+  semi_major_axis = 0.0;
+  inverse_flattening = 0.0;
+  linear_unit = 0.0;
+  method = CRS_WKT_METHOD_NONE;
+  method_name = 0;
+  method_name_length = 0;
+  has_parameter = 0;
+  U32 p;
+  for (p = 0; p < CRS_WKT_PARAMETERS; p++)
+  {
+    parameters[p] = 0.0;
+    parameter_units[p] = 0.0;
+  }
+  vertical = FALSE;
+  vertical_name = 0;
+  vertical_name_length = 0;
+  vertical_epsg = 0;
+  vertical_unit = 0.0;
+  wkt = 0;
+  length = 0;
+  position = 0;
+  geographic_angular_unit = deg2rad;
+  error[0] = '\0';
+}
+
+CRSwkt::CRSwkt()
+{
+  clear();
+}
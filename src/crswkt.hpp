@@ -0,0 +1,120 @@
+/*
+===============================================================================
+
+  FILE:  crswkt.hpp
+
+  CONTENTS:
+
+    A parser for the OGC WKT strings of LAS 1.4 files that understands WKT1
+    (including the ESRI dialect) and WKT2. It extracts what CRScheck needs to
+    compare the OGC WKT with the GEOTIFF tags: the kind of CRS, its EPSG code
+    and name, the ellipsoid, the linear units, the Transverse Mercator or the
+    Lambert Conformal Conic parameters, and the vertical CRS.
+
+    The parser runs directly over the string. It does not allocate memory and
+    does not copy the string so that it can check the headers of many files
+    quickly. Names point into the string and are not zero-terminated.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- unquoted WKT2 dates such as in TIMEEXTENT are no malformed numbers
+    18 October 2026 -- created to check the OGC WKT of point formats 6 to 10
+
+===============================================================================
+*/
+#ifndef CRS_WKT_HPP
+#define CRS_WKT_HPP
+
+#include "mydefs.hpp"
+
+#define CRS_WKT_NONE        0
+#define CRS_WKT_PROJECTED   1
+#define CRS_WKT_GEOGRAPHIC  2
+#define CRS_WKT_GEOCENTRIC  3
+#define CRS_WKT_LOCAL       4
+
+#define CRS_WKT_METHOD_NONE     0
+#define CRS_WKT_METHOD_TM       1
+#define CRS_WKT_METHOD_LCC_2SP  2
+#define CRS_WKT_METHOD_LCC_1SP  3
+#define CRS_WKT_METHOD_OTHER    4
+
+// the projection parameters that CRScheck compares
+
+#define CRS_WKT_FALSE_EASTING       0
+#define CRS_WKT_FALSE_NORTHING      1
+#define CRS_WKT_LATITUDE_OF_ORIGIN  2
+#define CRS_WKT_CENTRAL_MERIDIAN    3
+#define CRS_WKT_SCALE_FACTOR        4
+#define CRS_WKT_STANDARD_PARALLEL_1 5
+#define CRS_WKT_STANDARD_PARALLEL_2 6
+#define CRS_WKT_PARAMETERS          7
+
+class CRSwktElement;
+
+class CRSwkt
+{
+public:
+  // parses 'length' characters or up to the first '\0'. on failure get_error()
+  // tells what was wrong and where
+  BOOL parse(const CHAR* wkt, U32 length);
+  const CHAR* get_error() const { return error; };
+
+  // the horizontal CRS: projected, geographic, geocentric, or local (or none
+  // when the string only has a vertical CRS)
+  I32 type;
+  const CHAR* name;
+  U32 name_length;
+  U16 epsg;                 // 0 when there is no EPSG authority
+  U16 geographic_epsg;      // of the GEOGCS that a projected CRS is based on
+  U16 datum_epsg;
+  U16 ellipsoid_epsg;
+  F64 semi_major_axis;      // meter. 0.0 when there is no ellipsoid
+  F64 inverse_flattening;   // 0.0 for a sphere
+  F64 linear_unit;          // meter per unit. 0.0 when not given
+
+  // the projection of a projected CRS. the parameters are in meter and degree
+  I32 method;
+  const CHAR* method_name;
+  U32 method_name_length;
+  U32 has_parameter;        // bit i is set when parameter i was given
+  F64 parameters[CRS_WKT_PARAMETERS];
+
+  // the vertical CRS
+  BOOL vertical;
+  const CHAR* vertical_name;
+  U32 vertical_name_length;
+  U16 vertical_epsg;
+  F64 vertical_unit;        // meter per unit. 0.0 when not given
+
+  CRSwkt();
+
+private:
+  void clear();
+  BOOL parse_element(CRSwktElement* element, U32 depth);
+  void finish_element(CRSwktElement* element);
+  BOOL fail(const CHAR* message);
+  const CHAR* wkt;
+  U32 length;
+  U32 position;
+  F64 geographic_angular_unit;
+  F64 parameter_units[CRS_WKT_PARAMETERS];
+  CHAR error[256];
+};
+
+#endif
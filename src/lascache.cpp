@@ -0,0 +1,442 @@
+/*
+===============================================================================
+
+  FILE:  lascache.cpp
+
+  CONTENTS:
+
+    see corresponding header file
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    see corresponding header file
+
+===============================================================================
+*/
+#include "lascache.hpp"
+#include "lascheck.hpp"
+#include "bytestreamin_file.hpp"
+
+#include <vector>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+// the file starts with a signature and the versions that produced the verdicts
+// followed by records that each start with their size in bytes. all numbers are
+// little endian. a record that was not written completely ends the cache.
+
+#define LASCACHE_SIGNATURE "LASVCACH"
+#define LASCACHE_FORMAT    2
+
+#define LASCACHE_FNV_OFFSET 14695981039346656037ull
+#define LASCACHE_FNV_PRIME  1099511628211ull
+
+static void put_U32(std::string& record, const U32 value)
+{
+  U32 i;
+  for (i = 0; i < 4; i++) record.push_back((CHAR)((value >> (8*i)) & 0xFF));
+}
+
+static void put_U64(std::string& record, const U64 value)
+{
+  U32 i;
+  for (i = 0; i < 8; i++) record.push_back((CHAR)((value >> (8*i)) & 0xFF));
+}
+
+static void put_string(std::string& record, const CHAR* string)
+{
+  U32 length = (U32)strlen(string);
+  put_U32(record, length);
+  record.append(string, length);
+}
+
+static U32 get_U32(const U8* bytes)
+{
+  return ((U32)bytes[0]) | ((U32)bytes[1] << 8) | ((U32)bytes[2] << 16) | ((U32)bytes[3] << 24);
+}
+
+static U64 get_U64(const U8* bytes)
+{
+  return ((U64)get_U32(bytes)) | ((U64)get_U32(bytes+4) << 32);
+}
+
+class LAScacheRecord
+{
+public:
+  LAScacheRecord(const U8* bytes, U32 size) { this->bytes = bytes; this->size = size; this->pos = 0; };
+  BOOL get_U32(U32* value) { if ((pos + 4) > size) return FALSE; *value = ::get_U32(bytes + pos); pos += 4; return TRUE; };
+  BOOL get_U64(U64* value) { if ((pos + 8) > size) return FALSE; *value = ::get_U64(bytes + pos); pos += 8; return TRUE; };
+  BOOL get_string(std::string& string)
+  {
+    U32 length;
+    if (!get_U32(&length) || ((pos + length) > size)) return FALSE;
+    string.assign((const CHAR*)(bytes + pos), length);
+    pos += length;
+    return TRUE;
+  };
+private:
+  const U8* bytes;
+  U32 size;
+  U32 pos;
+};
+
+static void put_list(std::string& record, const U32 num, CHAR* const* list)
+{
+  U32 i;
+  put_U32(record, num);
+  for (i = 0; i < num; i++) put_string(record, list[i]);
+}
+
+static std::string make_record(const CHAR* file_name, const LAScacheEntry* entry)
+{
+  std::string record;
+  put_string(record, file_name);
+  put_U64(record, (U64)entry->fingerprint.size);
+  put_U64(record, (U64)entry->fingerprint.mtime);
+  put_U64(record, entry->fingerprint.hash);
+  put_U32(record, entry->options);
+  put_U32(record, entry->pass);
+  put_string(record, entry->crsdescription);
+  put_U32(record, entry->header.version_major);
+  put_U32(record, entry->header.version_minor);
+  put_string(record, entry->header.system_identifier);
+  put_string(record, entry->header.generating_software);
+  put_U32(record, entry->header.point_data_format);
+  put_list(record, entry->fail_num, entry->fails);
+  put_list(record, entry->warning_num, entry->warnings);
+  put_list(record, entry->unevaluated_num, entry->unevaluated);
+  return record;
+}
+
+static BOOL get_list(LAScacheRecord& record, LAScacheEntry* entry, U32 which)
+{
+  U32 i, num;
+  std::string check, note;
+  if (!record.get_U32(&num) || (num & 1)) return FALSE;
+  for (i = 0; i < num; i += 2)
+  {
+    if (!record.get_string(check) || !record.get_string(note)) return FALSE;
+    if (which == 0) entry->add_fail(check.c_str(), note.c_str());
+    else if (which == 1) entry->add_warning(check.c_str(), note.c_str());
+    else entry->add_unevaluated(check.c_str(), note.c_str());
+  }
+  return TRUE;
+}
+
+static LAScacheEntry* parse_record(LAScacheRecord& record, std::string& file_name)
+{
+  U64 size, mtime;
+  U32 version_major, version_minor, point_data_format;
+  std::string crsdescription, system_identifier, generating_software;
+  LAScacheEntry* entry = new LAScacheEntry();
+  if (record.get_string(file_name) && record.get_U64(&size) && record.get_U64(&mtime) && record.get_U64(&entry->fingerprint.hash) && record.get_U32(&entry->options) && record.get_U32(&entry->pass) && record.get_string(crsdescription) && (crsdescription.size() < 512) &&
+      record.get_U32(&version_major) && record.get_U32(&version_minor) && record.get_string(system_identifier) && (system_identifier.size() < 33) && record.get_string(generating_software) && (generating_software.size() < 33) && record.get_U32(&point_data_format))
+  {
+    entry->fingerprint.size = (I64)size;
+    entry->fingerprint.mtime = (I64)mtime;
+    strcpy(entry->crsdescription, crsdescription.c_str());
+    entry->header.version_major = (U8)version_major;
+    entry->header.version_minor = (U8)version_minor;
+    strcpy(entry->header.system_identifier, system_identifier.c_str());
+    strcpy(entry->header.generating_software, generating_software.c_str());
+    entry->header.point_data_format = (U8)point_data_format;
+    if (get_list(record, entry, 0) && get_list(record, entry, 1) && get_list(record, entry, 2))
+    {
+      return entry;
+    }
+  }
+  delete entry;
+  return 0;
+}
+
+static std::string make_preamble()
+{
+  std::string preamble(LASCACHE_SIGNATURE);
+  put_U32(preamble, LASCACHE_FORMAT);
+  put_U32(preamble, LASCHECK_VERSION_MAJOR);
+  put_U32(preamble, LASCHECK_VERSION_MINOR);
+  put_U32(preamble, LASCHECK_BUILD_DATE);
+  put_U32(preamble, LASREAD_VERSION_MAJOR);
+  put_U32(preamble, LASREAD_VERSION_MINOR);
+  put_U32(preamble, LASREAD_BUILD_DATE);
+  return preamble;
+}
+
+BOOL LAScache::open(const CHAR* file_name, BOOL rebuild)
+{
+  close();
+  this->file_name = strdup(file_name);
+
+  U32 records = 0;
+  BOOL complete = TRUE;
+
+  if (!rebuild)
+  {
+    FILE* in = fopen(file_name, "rb");
+    if (in)
+    {
+      std::string preamble = make_preamble();
+      std::vector<U8> bytes(preamble.size());
+      if ((fread(&bytes[0], 1, preamble.size(), in) == preamble.size()) && (memcmp(&bytes[0], preamble.data(), preamble.size()) == 0))
+      {
+        U8 size_bytes[4];
+        while (fread(size_bytes, 1, 4, in) == 4)
+        {
+          U32 size = get_U32(size_bytes);
+          bytes.resize(size ? size : 1);
+          if (fread(&bytes[0], 1, size, in) != size)
+          {
+            complete = FALSE;
+            break;
+          }
+          LAScacheRecord record(&bytes[0], size);
+          std::string name;
+          LAScacheEntry* entry = parse_record(record, name);
+          if (entry == 0)
+          {
+            complete = FALSE;
+            break;
+          }
+          // later records replace earlier ones for the same file and options
+          std::pair<std::string, U32> key(name, entry->options);
+          std::map<std::pair<std::string, U32>, LAScacheEntry*>::iterator it = entries.find(key);
+          if (it != entries.end())
+          {
+            delete it->second;
+            it->second = entry;
+          }
+          else
+          {
+            entries[key] = entry;
+          }
+          records++;
+        }
+      }
+      else
+      {
+        fprintf(stderr, "WARNING: cache '%s' is from another version of lasvalidate. rebuilding it.\n", file_name);
+        complete = FALSE;
+      }
+      fclose(in);
+    }
+  }
+
+  // a cache that is damaged or mostly made of replaced records is written anew
+
+  if (rebuild || !complete || (records > 2*entries.size()) || (records == 0))
+  {
+    return rewrite();
+  }
+
+  file = fopen(file_name, "ab");
+  if (file == 0)
+  {
+    fprintf(stderr, "ERROR: cannot open cache '%s'\n", file_name);
+    return FALSE;
+  }
+  return TRUE;
+}
+
+BOOL LAScache::rewrite()
+{
+  file = fopen(file_name, "wb");
+  if (file == 0)
+  {
+    fprintf(stderr, "ERROR: cannot create cache '%s'\n", file_name);
+    return FALSE;
+  }
+  std::string bytes = make_preamble();
+  std::map<std::pair<std::string, U32>, LAScacheEntry*>::const_iterator it;
+  for (it = entries.begin(); it != entries.end(); it++)
+  {
+    std::string record = make_record(it->first.first.c_str(), it->second);
+    put_U32(bytes, (U32)record.size());
+    bytes.append(record);
+  }
+  if (fwrite(bytes.data(), 1, bytes.size(), file) != bytes.size())
+  {
+    fprintf(stderr, "ERROR: cannot write cache '%s'\n", file_name);
+    fclose(file);
+    file = 0;
+    return FALSE;
+  }
+  fflush(file);
+  return TRUE;
+}
+
+// hash the bytes in [start,end) of the stream
+
+static BOOL hash_bytes(ByteStreamIn* stream, U64 start, U64 end, U64* hash)
+{
+  U8 buffer[65536];
+  if (!stream->seek((I64)start)) return FALSE;
+  while (start < end)
+  {
+    U32 n = (U32)((end - start) < sizeof(buffer) ? (end - start) : sizeof(buffer));
+    try { stream->getBytes(buffer, n); } catch (...) { return FALSE; }
+    U32 i;
+    for (i = 0; i < n; i++)
+    {
+      *hash = (*hash ^ buffer[i]) * LASCACHE_FNV_PRIME;
+    }
+    start += n;
+  }
+  return TRUE;
+}
+
+BOOL LAScache::fingerprint(const CHAR* file_name, LASfingerprint* fingerprint)
+{
+#ifdef _WIN32
+  struct _stat64 file_stat;
+  if (_stat64(file_name, &file_stat) != 0) return FALSE;
+#else
+  struct stat file_stat;
+  if (stat(file_name, &file_stat) != 0) return FALSE;
+#endif
+  fingerprint->size = (I64)file_stat.st_size;
+  fingerprint->mtime = (I64)file_stat.st_mtime;
+
+  FILE* file = fopen(file_name, "rb");
+  if (file == 0) return FALSE;
+  ByteStreamInFileLE stream(file);
+
+  // the header says how far the VLRs go and where the LAZ chunk table or
+  // the EVLRs start. these follow the point records up to the end of file
+
+  U64 size = (U64)fingerprint->size;
+  U8 header[375];
+  U32 n = (U32)(size < 375 ? size : 375);
+  U64 header_end = n;
+  U64 tail_start = 0;
+  try
+  {
+    stream.getBytes(header, n);
+    if (n >= 227)
+    {
+      header_end = get_U32(header + 96);
+      if (header[104] & 0xC0)
+      {
+        U8 bytes[8];
+        if (stream.seek(header_end))
+        {
+          stream.getBytes(bytes, 8);
+          tail_start = get_U64(bytes);
+          // a chunk table that was written last is pointed to by the last 8 bytes
+          if (((I64)tail_start == -1) && stream.seek(fingerprint->size - 8))
+          {
+            stream.getBytes(bytes, 8);
+            tail_start = get_U64(bytes);
+          }
+        }
+      }
+      else if ((header[24] == 1) && (header[25] >= 4) && (n >= 247))
+      {
+        tail_start = get_U64(header + 235);
+      }
+    }
+  }
+  catch (...)
+  {
+  }
+  if (header_end > size) header_end = size;
+  if ((tail_start <= header_end) || (tail_start >= size)) tail_start = 0;
+
+  U64 hash = LASCACHE_FNV_OFFSET;
+  hash = (hash ^ tail_start) * LASCACHE_FNV_PRIME;
+  BOOL success = hash_bytes(&stream, 0, header_end, &hash);
+  if (success && tail_start)
+  {
+    success = hash_bytes(&stream, tail_start, size, &hash);
+  }
+  fclose(file);
+  fingerprint->hash = hash;
+  return success;
+}
+
+const LAScacheEntry* LAScache::lookup(const CHAR* file_name, const LASfingerprint* fingerprint, U32 options) const
+{
+  std::map<std::pair<std::string, U32>, LAScacheEntry*>::const_iterator it = entries.find(std::pair<std::string, U32>(file_name, options));
+  if (it == entries.end()) return 0;
+  const LAScacheEntry* entry = it->second;
+  if ((entry->fingerprint.size != fingerprint->size) || (entry->fingerprint.mtime != fingerprint->mtime) || (entry->fingerprint.hash != fingerprint->hash))
+  {
+    return 0;
+  }
+  return entry;
+}
+
+BOOL LAScache::add(const CHAR* file_name, const LASfingerprint* fingerprint, U32 options, U32 pass, const LASerror* error, const CHAR* crsdescription, const LASreportHeader* header)
+{
+  if (file == 0) return FALSE;
+
+  LAScacheEntry entry;
+  entry.fingerprint = *fingerprint;
+  entry.options = options;
+  entry.pass = pass;
+  strncpy(entry.crsdescription, (crsdescription ? crsdescription : ""), 511);
+  entry.crsdescription[511] = '\0';
+  if (header) entry.header = *header;
+  U32 i;
+  for (i = 0; i < error->fail_num; i += 2) entry.add_fail(error->fails[i], error->fails[i+1]);
+  for (i = 0; i < error->warning_num; i += 2) entry.add_warning(error->warnings[i], error->warnings[i+1]);
+  for (i = 0; i < error->unevaluated_num; i += 2) entry.add_unevaluated(error->unevaluated[i], error->unevaluated[i+1]);
+
+  std::string record = make_record(file_name, &entry);
+  std::string bytes;
+  put_U32(bytes, (U32)record.size());
+  bytes.append(record);
+
+  BOOL success;
+#pragma omp critical (lascache)
+  {
+    success = (fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size());
+    fflush(file);
+  }
+  return success;
+}
+
+void LAScache::close()
+{
+  if (file)
+  {
+    fclose(file);
+    file = 0;
+  }
+  if (file_name)
+  {
+    free(file_name);
+    file_name = 0;
+  }
+  std::map<std::pair<std::string, U32>, LAScacheEntry*>::iterator it;
+  for (it = entries.begin(); it != entries.end(); it++)
+  {
+    delete it->second;
+  }
+  entries.clear();
+}
+
+LAScache::LAScache()
+{
+  file = 0;
+  file_name = 0;
+}
+
+LAScache::~LAScache()
+{
+  close();
+}
@@ -0,0 +1,104 @@
+/*
+===============================================================================
+
+  FILE:  lascache.hpp
+
+  CONTENTS:
+
+    An append-only file that remembers the verdicts of earlier validations so
+    that unchanged files need not be validated again. A file is considered to
+    be unchanged when its size, its modification time, and a hash of header,
+    VLRs, LAZ chunk table, and EVLRs are the same. The whole cache is ignored
+    and rebuilt when it was written by another version of LAScheck or LASread.
+    Each entry also keeps the header fields of the report so that cached files
+    can be reported without opening them.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- entries keep the header fields of the report
+    18 October 2026 -- created to not revalidate the unchanged files of an archive
+
+===============================================================================
+*/
+#ifndef LAS_CACHE_HPP
+#define LAS_CACHE_HPP
+
+#include "lasdefinitions.hpp"
+#include "lasreport.hpp"
+
+#include <map>
+#include <string>
+#include <utility>
+
+// the options that change the verdict of a file
+
+#define LASCACHE_NO_CRS_FAIL  0x0001
+#define LASCACHE_HEADER_ONLY  0x0002
+#define LASCACHE_CHUNKS_ONLY  0x0004
+
+class LASfingerprint
+{
+public:
+  I64 size;
+  I64 mtime;
+  U64 hash;
+  LASfingerprint() { size = -1; mtime = 0; hash = 0; };
+};
+
+class LAScacheEntry : public LASerror
+{
+public:
+  LASfingerprint fingerprint;
+  U32 options;
+  U32 pass;
+  CHAR crsdescription[512];
+  // a version_major of zero means the header could not be read
+  LASreportHeader header;
+  LAScacheEntry() { options = 0; pass = 0; crsdescription[0] = '\0'; };
+};
+
+class LAScache
+{
+public:
+  // loads the entries of an existing cache file or creates a new one
+  BOOL open(const CHAR* file_name, BOOL rebuild=FALSE);
+
+  // size, modification time, and hash of everything but the point records
+  static BOOL fingerprint(const CHAR* file_name, LASfingerprint* fingerprint);
+
+  // the entry for an unchanged file that was validated with the same options
+  const LAScacheEntry* lookup(const CHAR* file_name, const LASfingerprint* fingerprint, U32 options) const;
+
+  // appends the outcome of a validation. may be called by several threads.
+  // the header is zero when the file could not be read
+  BOOL add(const CHAR* file_name, const LASfingerprint* fingerprint, U32 options, U32 pass, const LASerror* error, const CHAR* crsdescription, const LASreportHeader* header);
+
+  void close();
+
+  LAScache();
+  ~LAScache();
+
+private:
+  BOOL rewrite();
+  FILE* file;
+  CHAR* file_name;
+  // the entries by file name and options
+  std::map<std::pair<std::string, U32>, LAScacheEntry*> entries;
+};
+
+#endif
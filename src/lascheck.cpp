@@ -31,6 +31,8 @@
 
 #include <time.h>
 #include <string.h>
+#include <math.h>
+#include <chrono>
 
 #include "lascheck.hpp"
 
@@ -77,20 +79,325 @@ static I32 lidardouble2string(CHAR* string, F64 value, F64 scale)
   return strlen(string)-1;
 };
 
+// the coordinate of an integer exactly as LASquantizer::get_x() computes it
+
+static inline F64 integer2coordinate(const F64 scale, const F64 offset, const I64 integer)
+{
+  return scale*(I32)integer+offset;
+}
+
+// finds the range of integers whose coordinate is inside [min,max] in double
+// arithmetic. for a positive and finite scale factor and offset the coordinate
+// never decreases as the integer grows (every rounding step is monotonic) so
+// these integers are contiguous and the ends can be found with binary search.
+// an empty range has min_integer > max_integer.
+
+static BOOL coordinate2integer_range(const F64 scale, const F64 offset, const F64 min, const F64 max, I32* min_integer, I32* max_integer)
+{
+  if (!(scale > 0.0) || !isfinite(scale) || !isfinite(offset) || isnan(min) || isnan(max))
+  {
+    return FALSE;
+  }
+  I64 lo, hi, mid;
+  // the smallest integer whose coordinate is not below min
+  if (integer2coordinate(scale, offset, I32_MIN) >= min)
+  {
+    *min_integer = I32_MIN;
+  }
+  else if (integer2coordinate(scale, offset, I32_MAX) < min)
+  {
+    *min_integer = 1;
+    *max_integer = 0;
+    return TRUE;
+  }
+  else
+  {
+    lo = I32_MIN; // below min
+    hi = I32_MAX; // not below min
+    while ((hi - lo) > 1)
+    {
+      mid = lo + (hi - lo) / 2;
+      if (integer2coordinate(scale, offset, mid) < min) lo = mid; else hi = mid;
+    }
+    *min_integer = (I32)hi;
+  }
+  // the largest integer whose coordinate is not above max
+  if (integer2coordinate(scale, offset, I32_MAX) <= max)
+  {
+    *max_integer = I32_MAX;
+  }
+  else if (integer2coordinate(scale, offset, I32_MIN) > max)
+  {
+    *min_integer = 1;
+    *max_integer = 0;
+  }
+  else
+  {
+    lo = I32_MIN; // not above max
+    hi = I32_MAX; // above max
+    while ((hi - lo) > 1)
+    {
+      mid = lo + (hi - lo) / 2;
+      if (integer2coordinate(scale, offset, mid) > max) hi = mid; else lo = mid;
+    }
+    *max_integer = (I32)lo;
+  }
+  return TRUE;
+}
+
 void LAScheck::parse(const LASpoint* laspoint)
 {
   // add point to inventory
 
   lasinventory.add(laspoint);
 
+  // keep every so many points (by index in the file) for checking their location
+
+  if ((point_index % location_sample_stride) == 0)
+  {
+    add_location_sample(point_index, laspoint->X, laspoint->Y);
+  }
+  point_index++;
+
   // check point against bounding box
 
-  if (!laspoint->inside_bounding_box(min_x, min_y, min_z, max_x, max_y, max_z))
+  if (integer_bounding_box)
+  {
+    if ((laspoint->X < min_X) || (laspoint->X > max_X) || (laspoint->Y < min_Y) || (laspoint->Y > max_Y) || (laspoint->Z < min_Z) || (laspoint->Z > max_Z))
+    {
+      points_outside_bounding_box++;
+    }
+  }
+  else if (!laspoint->inside_bounding_box(min_x, min_y, min_z, max_x, max_y, max_z))
   {
     points_outside_bounding_box++;
   }
 }
 
+void LAScheck::parse_batch(const LASpointBatch* laspointbatch)
+{
+  // add points to inventory
+
+  lasinventory.add(laspointbatch);
+
+  // keep every so many points (by index in the file) for checking their location
+
+  U32 i;
+  I64 index = ((point_index + location_sample_stride - 1) / location_sample_stride) * location_sample_stride;
+  for (; index < point_index + laspointbatch->number; index += location_sample_stride)
+  {
+    i = (U32)(index - point_index);
+    add_location_sample(index, laspointbatch->X[i], laspointbatch->Y[i]);
+  }
+  point_index += laspointbatch->number;
+
+  // check points against bounding box (the same test as LASpoint::inside_bounding_box())
+
+  if (integer_bounding_box)
+  {
+    // without branches so that the compiler can vectorize the loop
+    U32 outside = 0;
+    const I32* X = laspointbatch->X;
+    const I32* Y = laspointbatch->Y;
+    const I32* Z = laspointbatch->Z;
+    for (i = 0; i < laspointbatch->number; i++)
+    {
+      outside += (U32)((X[i] < min_X) | (X[i] > max_X) | (Y[i] < min_Y) | (Y[i] > max_Y) | (Z[i] < min_Z) | (Z[i] > max_Z));
+    }
+    points_outside_bounding_box += outside;
+    return;
+  }
+
+  F64 xyz;
+  const LASquantizer* quantizer = laspointbatch->quantizer;
+  for (i = 0; i < laspointbatch->number; i++)
+  {
+    xyz = quantizer->get_x(laspointbatch->X[i]);
+    if (xyz < min_x || xyz > max_x)
+    {
+      points_outside_bounding_box++;
+      continue;
+    }
+    xyz = quantizer->get_y(laspointbatch->Y[i]);
+    if (xyz < min_y || xyz > max_y)
+    {
+      points_outside_bounding_box++;
+      continue;
+    }
+    xyz = quantizer->get_z(laspointbatch->Z[i]);
+    if (xyz < min_z || xyz > max_z)
+    {
+      points_outside_bounding_box++;
+    }
+  }
+}
+
+U32 LAScheck::get_decompress_selective()
+{
+  // the inventory has the return counts, the ranges of coordinates, intensity,
+  // point source ID, scan angle, GPS time, RGB, and NIR, and the wave packet
+  // indices. classification, flags, user data, and extra bytes are not used.
+
+  return LASZIP_DECOMPRESS_SELECTIVE_CHANNEL_RETURNS_XY |
+         LASZIP_DECOMPRESS_SELECTIVE_Z |
+         LASZIP_DECOMPRESS_SELECTIVE_INTENSITY |
+         LASZIP_DECOMPRESS_SELECTIVE_SCAN_ANGLE |
+         LASZIP_DECOMPRESS_SELECTIVE_POINT_SOURCE |
+         LASZIP_DECOMPRESS_SELECTIVE_GPS_TIME |
+         LASZIP_DECOMPRESS_SELECTIVE_RGB |
+         LASZIP_DECOMPRESS_SELECTIVE_NIR |
+         LASZIP_DECOMPRESS_SELECTIVE_WAVEPACKET;
+}
+
+void LAScheck::merge(const LAScheck& lascheck)
+{
+  // add inventory and bounding box count of another parse of the same file
+
+  lasinventory.merge(lascheck.lasinventory);
+  points_outside_bounding_box += lascheck.points_outside_bounding_box;
+  U32 i;
+  for (i = 0; i < lascheck.location_sample_num; i++)
+  {
+    add_location_sample(lascheck.location_sample_index[i], lascheck.location_sample_X[i], lascheck.location_sample_Y[i]);
+  }
+}
+
+void LAScheck::add_location_sample(const I64 index, const I32 X, const I32 Y)
+{
+  // the points are kept sorted by index. with more points than the header says
+  // those with the lowest indices are kept so that the sample does not depend on
+  // how the points were split into ranges
+
+  U32 i = location_sample_num;
+  while ((i > 0) && (location_sample_index[i-1] > index)) i--;
+  if (i == LASCHECK_LOCATION_SAMPLE) return;
+  U32 j = (location_sample_num < LASCHECK_LOCATION_SAMPLE ? location_sample_num : LASCHECK_LOCATION_SAMPLE-1);
+  for (; j > i; j--)
+  {
+    location_sample_index[j] = location_sample_index[j-1];
+    location_sample_X[j] = location_sample_X[j-1];
+    location_sample_Y[j] = location_sample_Y[j-1];
+  }
+  location_sample_index[i] = index;
+  location_sample_X[i] = X;
+  location_sample_Y[i] = Y;
+  if (location_sample_num < LASCHECK_LOCATION_SAMPLE) location_sample_num++;
+}
+
+// the corners of the header bounding box and the sampled points must map to
+// latitudes and longitudes where the CRS can be used
+
+void LAScheck::check_location(LASheader* lasheader, const CRSlocation* crslocation) const
+{
+  F64 x[LASCHECK_LOCATION_SAMPLE];
+  F64 y[LASCHECK_LOCATION_SAMPLE];
+
+  x[0] = lasheader->min_x; y[0] = lasheader->min_y;
+  x[1] = lasheader->max_x; y[1] = lasheader->min_y;
+  x[2] = lasheader->min_x; y[2] = lasheader->max_y;
+  x[3] = lasheader->max_x; y[3] = lasheader->max_y;
+  crslocation->check(lasheader, x, y, 4, "corners of the header bounding box");
+
+  if (!header_only)
+  {
+    U32 i;
+    for (i = 0; i < location_sample_num; i++)
+    {
+      x[i] = lasheader->get_x(location_sample_X[i]);
+      y[i] = lasheader->get_y(location_sample_Y[i]);
+    }
+    crslocation->check(lasheader, x, y, location_sample_num, "sampled points");
+  }
+}
+
+void LAScheck::sample(U32 number_chunks)
+{
+  sample_chunks = number_chunks;
+}
+
+void LAScheck::merge_sample(const LAScheck& lascheck, BOOL complete)
+{
+  merge(lascheck);
+
+  // keep the counts of the chunk for estimating the counts of the whole file
+
+  sampled_counts = (I64*)realloc(sampled_counts, sizeof(I64)*LASCHECK_SAMPLE_COUNTS*(sampled_num+1));
+  I64* counts = sampled_counts + LASCHECK_SAMPLE_COUNTS*sampled_num;
+  counts[0] = lascheck.lasinventory.number_of_point_records;
+  U32 r;
+  for (r = 0; r < 16; r++)
+  {
+    counts[1+r] = lascheck.lasinventory.number_of_points_by_return[r];
+  }
+  counts[17] = lascheck.points_outside_bounding_box;
+  sampled_num++;
+  if (!complete) sampled_complete = FALSE;
+}
+
+BOOL LAScheck::estimate(U32 count, I64 number_points, I64* estimate, I64* lower, I64* upper) const
+{
+  // the chunks are the sampling units. the count of all points is estimated with the
+  // ratio of the count to the points in the sampled chunks. the variance of the ratio
+  // comes from how it varies across chunks with the finite population correction for
+  // sampling chunks without replacement
+
+  U32 i;
+  F64 m = 0.0;
+  F64 y = 0.0;
+  for (i = 0; i < sampled_num; i++)
+  {
+    m += (F64)sampled_counts[LASCHECK_SAMPLE_COUNTS*i];
+    y += (F64)sampled_counts[LASCHECK_SAMPLE_COUNTS*i+count];
+  }
+  if (m == 0.0) return FALSE;
+
+  F64 N = (F64)number_points;
+  F64 ratio = y / m;
+  F64 half;
+  if (sampled_num >= sample_chunks)
+  {
+    half = 0.0;
+  }
+  else if (sampled_num < 2)
+  {
+    half = N;
+  }
+  else
+  {
+    F64 s2 = 0.0;
+    for (i = 0; i < sampled_num; i++)
+    {
+      F64 d = (F64)sampled_counts[LASCHECK_SAMPLE_COUNTS*i+count] - ratio*(F64)sampled_counts[LASCHECK_SAMPLE_COUNTS*i];
+      s2 += d*d;
+    }
+    s2 /= (sampled_num - 1);
+    F64 mean_m = m / sampled_num;
+    F64 variance = (1.0 - (F64)sampled_num/(F64)sample_chunks) * s2 / (sampled_num * mean_m * mean_m);
+    half = 1.96 * N * sqrt(variance);
+    // a count that is zero (or all points) in every chunk has no spread. then the
+    // rule of three bounds the fraction of points that the sample could have missed
+    if ((y == 0.0) || (y == m))
+    {
+      F64 missed = 3.0 * N / m;
+      if (half < missed) half = missed;
+    }
+  }
+
+  // the points of the sampled chunks are known exactly
+
+  F64 low = ratio*N - half;
+  F64 high = ratio*N + half;
+  if (low < y) low = y;
+  if (high > N - (m - y)) high = N - (m - y);
+  if (high < low) high = low;
+  *estimate = (I64)(ratio*N + 0.5);
+  if (*estimate < (I64)low) *estimate = (I64)low;
+  if (*estimate > (I64)high) *estimate = (I64)high;
+  *lower = (I64)floor(low);
+  *upper = (I64)ceil(high);
+  return TRUE;
+}
+
 void LAScheck::check(LASheader* lasheader, CHAR* crsdescription, BOOL no_CRS_fail, F64 tile_size)
 {
   U32 i,j;
@@ -345,7 +652,13 @@ void LAScheck::check(LASheader* lasheader, CHAR* crsdescription, BOOL no_CRS_fai
 
     time_t date;
     time(&date);
-    struct tm* tm_date = gmtime(&date);
+    struct tm tm_buffer;
+#ifdef _WIN32
+    gmtime_s(&tm_buffer, &date);
+#else
+    gmtime_r(&date, &tm_buffer); // reentrant because files may be checked concurrently
+#endif
+    struct tm* tm_date = &tm_buffer;
     int today_year = tm_date->tm_year + 1900;
 
     // does the year fall into the expected range
@@ -656,7 +969,22 @@ void LAScheck::check(LASheader* lasheader, CHAR* crsdescription, BOOL no_CRS_fai
 
   // check number of point records in header against the counted inventory
 
-  if (lasinventory.is_active())
+  if (sample_chunks)
+  {
+    // the points of the chunks that were not sampled are not counted
+
+    if (!sampled_complete)
+    {
+      sprintf(note, "a sampled chunk has fewer point records than the chunk table lists");
+      lasheader->add_fail("number of point records", note);
+    }
+    else
+    {
+      sprintf(note, "not counted when only %u of %u chunks are sampled", sampled_num, sample_chunks);
+      lasheader->add_unevaluated("number of point records", note);
+    }
+  }
+  else if (lasinventory.is_active())
   {
     if ((lasheader->version_major == 1) && (lasheader->version_minor >= 4))
     {
@@ -682,7 +1010,40 @@ void LAScheck::check(LASheader* lasheader, CHAR* crsdescription, BOOL no_CRS_fai
 
   // check number of points by return in header against the counted inventory
 
-  if (lasinventory.is_active())
+  if (sample_chunks)
+  {
+    // with sampled chunks the header fails only when it is outside the confidence bounds
+
+    I64 number_points = (lasheader->legacy_number_of_point_records ? lasheader->legacy_number_of_point_records : lasheader->number_of_point_records);
+    U32 number_returns = (((lasheader->version_major == 1) && (lasheader->version_minor >= 4)) ? 15 : 5);
+    for (i = 0; i < number_returns; i++)
+    {
+      I64 header_count = (number_returns == 15 ? (I64)lasheader->number_of_points_by_return[i] : (I64)lasheader->legacy_number_of_points_by_return[i]);
+      I64 estimated, lower, upper;
+      if (!estimate(2+i, number_points, &estimated, &lower, &upper)) break;
+      if ((header_count == 0) && (upper == 0)) continue;
+      sprintf(problem, "number of points by return[%d]", i);
+#ifdef _WIN32
+      sprintf(note, "the number of %d%s returns is estimated as %I64d (95%% bounds %I64d to %I64d) from %u of %u chunks", i+1, (i == 0 ? "st" : (i == 1 ? "nd" : (i == 2 ? "rd" : "th"))), estimated, lower, upper, sampled_num, sample_chunks);
+#else
+      sprintf(note, "the number of %d%s returns is estimated as %lld (95%% bounds %lld to %lld) from %u of %u chunks", i+1, (i == 0 ? "st" : (i == 1 ? "nd" : (i == 2 ? "rd" : "th"))), estimated, lower, upper, sampled_num, sample_chunks);
+#endif
+      if ((header_count < lower) || (header_count > upper))
+      {
+#ifdef _WIN32
+        sprintf(note + strlen(note), " and not %I64d", header_count);
+#else
+        sprintf(note + strlen(note), " and not %lld", header_count);
+#endif
+        lasheader->add_fail(problem, note);
+      }
+      else
+      {
+        lasheader->add_unevaluated(problem, note);
+      }
+    }
+  }
+  else if (lasinventory.is_active())
   {
     if ((lasheader->version_major == 1) && (lasheader->version_minor >= 4))
     {
@@ -900,7 +1261,28 @@ void LAScheck::check(LASheader* lasheader, CHAR* crsdescription, BOOL no_CRS_fai
 
   // check bounding box x y z
 
-  if (points_outside_bounding_box)
+  if (sample_chunks)
+  {
+    I64 estimated, lower, upper;
+    I64 number_points = (lasheader->legacy_number_of_point_records ? lasheader->legacy_number_of_point_records : lasheader->number_of_point_records);
+    if (estimate(17, number_points, &estimated, &lower, &upper))
+    {
+#ifdef _WIN32
+      sprintf(note, "%I64d points of %u sampled chunks are outside of the bounding box specified in the LAS file header. estimated are %I64d (95%% bounds %I64d to %I64d) of all points", points_outside_bounding_box, sampled_num, estimated, lower, upper);
+#else
+      sprintf(note, "%lld points of %u sampled chunks are outside of the bounding box specified in the LAS file header. estimated are %lld (95%% bounds %lld to %lld) of all points", points_outside_bounding_box, sampled_num, estimated, lower, upper);
+#endif
+      if (points_outside_bounding_box)
+      {
+        lasheader->add_fail("bounding box", note);
+      }
+      else
+      {
+        lasheader->add_unevaluated("bounding box", note);
+      }
+    }
+  }
+  else if (points_outside_bounding_box)
   {
 #ifdef _WIN32
     sprintf(note, "there are %I64d points outside of the bounding box specified in the LAS file header", points_outside_bounding_box);
@@ -1227,22 +1609,73 @@ void LAScheck::check(LASheader* lasheader, CHAR* crsdescription, BOOL no_CRS_fai
 
   if (lasheader->geokeys || lasheader->ogc_wkt)
   {
-    CRScheck crscheck;
-    crscheck.check(lasheader, crsdescription, no_CRS_fail);
+    std::chrono::steady_clock::time_point crs_start = std::chrono::steady_clock::now();
+    CRSlocation crslocation;
+    CRScache::check(lasheader, crsdescription, no_CRS_fail, &crslocation);
+    check_location(lasheader, &crslocation);
+    crs_seconds = std::chrono::duration<F64>(std::chrono::steady_clock::now() - crs_start).count();
+  }
+
+  // the checks above that compare against the inventory were skipped
+
+  if (header_only)
+  {
+    if (((lasheader->global_encoding & 1) == 0) && (lasheader->point_data_format > 0))
+    {
+      lasheader->add_unevaluated("global encoding", "GPS week time range of points not evaluated without reading the points");
+    }
+    lasheader->add_unevaluated("number of point records", "not counted without reading the points");
+    lasheader->add_unevaluated("number of points by return", "not counted without reading the points");
+    lasheader->add_unevaluated("coordinate values", "resolution fluff not evaluated without reading the points");
+    lasheader->add_unevaluated("bounding box", "points outside of header bounding box not evaluated without reading the points");
+    lasheader->add_unevaluated("return number", "not evaluated without reading the points");
+    lasheader->add_unevaluated("number of returns of given pulse", "not evaluated without reading the points");
+    lasheader->add_unevaluated("intensity", "not evaluated without reading the points");
+    lasheader->add_unevaluated("scan angle", "not evaluated without reading the points");
+    lasheader->add_unevaluated("point source ID", "not evaluated without reading the points");
+    if ((lasheader->point_data_format != 0) && (lasheader->point_data_format != 2))
+    {
+      lasheader->add_unevaluated("GPS time", "not evaluated without reading the points");
+    }
+    if ((lasheader->point_data_format == 2) || (lasheader->point_data_format == 3) || (lasheader->point_data_format == 7) || (lasheader->point_data_format == 8) || (lasheader->point_data_format == 10))
+    {
+      lasheader->add_unevaluated("RGB", "not evaluated without reading the points");
+    }
+    if ((lasheader->point_data_format == 4) || (lasheader->point_data_format == 5) || (lasheader->point_data_format == 9) || (lasheader->point_data_format == 10))
+    {
+      lasheader->add_unevaluated("wave packet", "indices of points not evaluated without reading the points");
+    }
   }
 }
 
-LAScheck::LAScheck(const LASheader* lasheader)
+LAScheck::LAScheck(const LASheader* lasheader, BOOL header_only)
 {
+  this->header_only = header_only;
+  crs_seconds = 0.0;
   min_x = lasheader->min_x - lasheader->x_scale_factor;
   min_y = lasheader->min_y - lasheader->y_scale_factor;
   min_z = lasheader->min_z - lasheader->z_scale_factor;
   max_x = lasheader->max_x + lasheader->x_scale_factor;
   max_y = lasheader->max_y + lasheader->y_scale_factor;
   max_z = lasheader->max_z + lasheader->z_scale_factor;
+  // the same bounds for the integer coordinates so that no point needs to be
+  // converted. not possible for negative, zero, or not finite scale factors
+  integer_bounding_box = coordinate2integer_range(lasheader->x_scale_factor, lasheader->x_offset, min_x, max_x, &min_X, &max_X) &&
+                         coordinate2integer_range(lasheader->y_scale_factor, lasheader->y_offset, min_y, max_y, &min_Y, &max_Y) &&
+                         coordinate2integer_range(lasheader->z_scale_factor, lasheader->z_offset, min_z, max_z, &min_Z, &max_Z);
   points_outside_bounding_box = 0;
+  sample_chunks = 0;
+  sampled_num = 0;
+  sampled_counts = 0;
+  sampled_complete = TRUE;
+  location_sample_num = 0;
+  I64 npoints = (lasheader->legacy_number_of_point_records ? lasheader->legacy_number_of_point_records : (I64)lasheader->number_of_point_records);
+  location_sample_stride = (npoints + LASCHECK_LOCATION_SAMPLE - 1) / LASCHECK_LOCATION_SAMPLE;
+  if (location_sample_stride < 1) location_sample_stride = 1;
+  point_index = 0;
 }
 
 LAScheck::~LAScheck()
 {
+  if (sampled_counts) free(sampled_counts);
 }
@@ -25,6 +25,19 @@
   
   CHANGE HISTORY:
   
+    18 October 2026 -- how many points were outside of the bounding box (for testing)
+    18 October 2026 -- the points for the CRS location are picked by their index in the file
+    18 October 2026 -- new minor version because the coordinates are located with the CRS (invalidates caches)
+    18 October 2026 -- new build date because the OGC WKT is checked (invalidates caches)
+    18 October 2026 -- the CRS of identical GeoKeys and OGC WKT is checked only once
+    18 October 2026 -- how long check() took for the CRS
+    18 October 2026 -- check points against the bounding box with integer coordinates
+    18 October 2026 -- estimate counts with confidence bounds when only some chunks are parsed
+    18 October 2026 -- report point checks as not evaluated for a header-only validation
+    18 October 2026 -- access to the inventory for the header repair
+    18 October 2026 -- publish which point attributes are checked
+    18 October 2026 -- parse blocks of points with parse_batch()
+    18 October 2026 -- merge the parse results of chunks read in parallel
      4 January 2020 -- optional check for heaber bounding box matching tile size
      1 April 2013 -- on Easter Monday all-nighting in Perth airport for PER->SYD
   
@@ -36,25 +49,84 @@
 #include "lasheader.hpp"
 #include "laspoint.hpp"
 #include "lasutility.hpp"
+#include "laszip_decompress_selective_v3.hpp"
 
 #define LASCHECK_VERSION_MAJOR 1
-#define LASCHECK_VERSION_MINOR 1
-#define LASCHECK_BUILD_DATE 200104
+#define LASCHECK_VERSION_MINOR 2
+#define LASCHECK_BUILD_DATE 261018
+
+// the counts kept for each sampled chunk: points, points by return 0 to 15,
+// and points outside of the bounding box
+
+#define LASCHECK_SAMPLE_COUNTS 18
+
+// at most this many points are kept (evenly spread over the point count of the
+// header) to see if their coordinates are plausible for the CRS
+
+#define LASCHECK_LOCATION_SAMPLE 64
+
+class CRSlocation;
 
 class LAScheck
 {
 public:
 
   void parse(const LASpoint* laspoint);
+  void parse_batch(const LASpointBatch* laspointbatch);
+  void merge(const LAScheck& lascheck);
+
+  // the index in the file of the point that is parsed next. needed when a check
+  // parses a range or chunk of the points so that it keeps the same points for
+  // the CRS location as a parse of all points would
+  void set_point_index(I64 point_index) { this->point_index = point_index; };
+
+  // when only a random sample of the chunks is parsed, each chunk is parsed by
+  // its own LAScheck and added with merge_sample(). check() then estimates the
+  // counts of all points from those of the chunks with 95% confidence bounds
+  void sample(U32 number_chunks);
+  void merge_sample(const LAScheck& lascheck, BOOL complete=TRUE);
   void check(LASheader* lasheader, CHAR* crsdescription=0, BOOL no_CRS_fail=FALSE, F64 tile_size=0.0);
 
-  LAScheck(const LASheader* lasheader);
+  // the point attributes that parse() and parse_batch() look at as a mask of
+  // LASZIP_DECOMPRESS_SELECTIVE flags so that LAZ readers can skip the others
+  static U32 get_decompress_selective();
+
+  // what parse() and parse_batch() collected (e.g. for repairing the header)
+  const LASinventory* get_inventory() const { return &lasinventory; };
+
+  // how many of the parsed points were outside of the header bounding box
+  I64 get_points_outside_bounding_box() const { return points_outside_bounding_box; };
+
+  // seconds (of a monotonic clock) that check() spent checking the CRS
+  F64 get_crs_seconds() const { return crs_seconds; };
+
+  // with header_only no points are parsed and check() reports the checks that
+  // need the points as not evaluated instead of failing or passing them
+  LAScheck(const LASheader* lasheader, BOOL header_only=FALSE);
   ~LAScheck();
 
 private:
+  BOOL estimate(U32 count, I64 number_points, I64* estimate, I64* lower, I64* upper) const;
+  void add_location_sample(const I64 index, const I32 X, const I32 Y);
+  void check_location(LASheader* lasheader, const CRSlocation* crslocation) const;
   F64 min_x, min_y, min_z;
   F64 max_x, max_y, max_z;
+  BOOL integer_bounding_box;
+  I32 min_X, min_Y, min_Z;
+  I32 max_X, max_Y, max_Z;
   I64 points_outside_bounding_box;
+  BOOL header_only;
+  U32 sample_chunks;
+  U32 sampled_num;
+  I64* sampled_counts;
+  BOOL sampled_complete;
+  F64 crs_seconds;
+  I64 location_sample_index[LASCHECK_LOCATION_SAMPLE];
+  I32 location_sample_X[LASCHECK_LOCATION_SAMPLE];
+  I32 location_sample_Y[LASCHECK_LOCATION_SAMPLE];
+  U32 location_sample_num;
+  I64 location_sample_stride;
+  I64 point_index;
   LASinventory lasinventory;
 };
 
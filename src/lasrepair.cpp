@@ -26,6 +26,7 @@
 
   CHANGE HISTORY:
 
+    18 October 2026 -- repair from the inventory of the validation pass without rereading points
      November 5 2023 -- Added to repo
 
 ===============================================================================
@@ -71,29 +72,18 @@ static const char* LASpointClassification [32] = {
   "Reserved for ASPRS Definition"
 };
 
-BOOL LASrepair::repair_header(LASreader* lasreader, const char* file_name)
+BOOL LASrepair::repair_header(const LASheader* lasheader, const LASinventory* lasinventory, const char* file_name)
 {
-    // open file and header
+    // the inventory was collected while validating so the points are not read again
 
     BOOL success = FALSE;
     FILE* file = fopen(file_name, "rb+");
-    LASheader* lasheader = &lasreader->header;
-
-    // fill summary
-
-    LASsummary lassummary;
-    I64 init_p_count = 0;
-    while (init_p_count < lasreader->p_count)
+    if (file == 0)
     {
-      lassummary.add(&lasreader->point);
-      init_p_count++;
+      fprintf(stderr, "ERROR: cannot open '%s' for repairing the header\n", file_name);
+      return FALSE;
     }
 
-      while (lasreader->read_point())
-      {
-        lascheck.parse(&lasreader->point);
-      }
-
 //    // check if LAS is buffered
 //    if (lasheader->vlr_lastiling->buffer)
 //    {
@@ -116,15 +106,6 @@ BOOL LASrepair::repair_header(LASreader* lasreader, const char* file_name)
 
       // check number_of_point_records
 
-      fprintf(stdout, "format : %d\n", lasheader->point_data_format);
-      fprintf(stdout, "summary_points : %lld\n", lassummary.number_of_point_records);
-      fprintf(stdout, "npoints : %lld\n", lasheader->number_of_point_records);
-      fprintf(stdout, "summary_preturns : %lld\n", lassummary.number_of_points_by_return[0]);
-      fprintf(stdout, "summary_nreturns : %lld\n", lassummary.number_of_returns[0]);
-      fprintf(stdout, "npoints_return : %lld\n", lasheader->number_of_points_by_return[0]);
-      fprintf(stdout, "legacy : %u\n", lasheader->legacy_number_of_point_records);
-      fprintf(stdout, "version : %u\n", lasheader->version_minor);
-
 //      // get unique value for all LAS versions
 //      U64 local_number_of_point_records;
 //      if (lasheader->version_minor < 4)
@@ -143,12 +124,11 @@ BOOL LASrepair::repair_header(LASreader* lasreader, const char* file_name)
 
       // start checks
 
-      if ((lasheader->point_data_format < 6) && (lassummary.number_of_point_records != lasheader->number_of_point_records))
+      if ((lasheader->point_data_format < 6) && (lasinventory->number_of_point_records != lasheader->number_of_point_records))
       {
-        fprintf(stdout, "number_of_point_records: %lld", lassummary.number_of_point_records);
-        if (lassummary.number_of_point_records <= U32_MAX)
+        if (lasinventory->number_of_point_records <= U32_MAX)
         {
-          U32 number_of_point_records = (U32)lassummary.number_of_point_records;
+          U32 number_of_point_records = (U32)lasinventory->number_of_point_records;
           fseek(file, 107, SEEK_SET);
           if (fwrite(&number_of_point_records, sizeof(U32), 1, file) == 1) {
             success = TRUE;
@@ -164,9 +144,9 @@ BOOL LASrepair::repair_header(LASreader* lasreader, const char* file_name)
         else if (lasheader->version_minor < 4)
         {
 #ifdef _WIN32
-          fprintf(stderr, "WARNING: real number of point records (%I64d) exceeds 4,294,967,295. cannot repair. too big.\n", lassummary.number_of_point_records);
+          fprintf(stderr, "WARNING: real number of point records (%I64d) exceeds 4,294,967,295. cannot repair. too big.\n", lasinventory->number_of_point_records);
 #else
-          fprintf(stderr, "WARNING: real number of point records (%lld) exceeds 4,294,967,295. cannot repair. too big.\n", lassummary.number_of_point_records);
+          fprintf(stderr, "WARNING: real number of point records (%lld) exceeds 4,294,967,295. cannot repair. too big.\n", lasinventory->number_of_point_records);
 #endif
         }
         else if (lasheader->number_of_point_records != 0)
@@ -190,28 +170,28 @@ BOOL LASrepair::repair_header(LASreader* lasreader, const char* file_name)
         }
         else
         {
-          if (lassummary.number_of_point_records <= U32_MAX)
+          if (lasinventory->number_of_point_records <= U32_MAX)
           {
 #ifdef _WIN32
-            fprintf(stderr, "WARNING: real number of point records (%I64d) is different from header entry (%u).\n", lassummary.number_of_point_records, lasheader->number_of_point_records);
+            fprintf(stderr, "WARNING: real number of point records (%I64d) is different from header entry (%u).\n", lasinventory->number_of_point_records, lasheader->number_of_point_records);
 #else
-            fprintf(stderr, "WARNING: real number of point records (%lld) is different from header entry (%llu).\n", lassummary.number_of_point_records, lasheader->number_of_point_records);
+            fprintf(stderr, "WARNING: real number of point records (%lld) is different from header entry (%llu).\n", lasinventory->number_of_point_records, lasheader->number_of_point_records);
 #endif
           }
           else if (lasheader->version_minor < 4)
           {
 #ifdef _WIN32
-            fprintf(stderr, "WARNING: real number of point records (%I64d) exceeds 4,294,967,295.\n", lassummary.number_of_point_records);
+            fprintf(stderr, "WARNING: real number of point records (%I64d) exceeds 4,294,967,295.\n", lasinventory->number_of_point_records);
 #else
-            fprintf(stderr, "WARNING: real number of point records (%lld) exceeds 4,294,967,295.\n", lassummary.number_of_point_records);
+            fprintf(stderr, "WARNING: real number of point records (%lld) exceeds 4,294,967,295.\n", lasinventory->number_of_point_records);
 #endif
           }
           else if (lasheader->number_of_point_records != 0)
           {
 #ifdef _WIN32
-            fprintf(stderr, "WARNING: real number of point records (%I64d) exceeds 4,294,967,295. but header entry is %u instead of zero.\n", lassummary.number_of_point_records, lasheader->number_of_point_records);
+            fprintf(stderr, "WARNING: real number of point records (%I64d) exceeds 4,294,967,295. but header entry is %u instead of zero.\n", lasinventory->number_of_point_records, lasheader->number_of_point_records);
 #else
-            fprintf(stderr, "WARNING: real number of point records (%lld) exceeds 4,294,967,295. but header entry is %llu instead of zero.\n", lassummary.number_of_point_records, lasheader->number_of_point_records);
+            fprintf(stderr, "WARNING: real number of point records (%lld) exceeds 4,294,967,295. but header entry is %llu instead of zero.\n", lasinventory->number_of_point_records, lasheader->number_of_point_records);
 #endif
           }
         }
@@ -246,9 +226,9 @@ BOOL LASrepair::repair_header(LASreader* lasreader, const char* file_name)
 
       if (lasheader->version_minor > 3)
       {
-        if (lassummary.number_of_point_records != (I64)lasheader->extended_number_of_point_records)
+        if (lasinventory->number_of_point_records != (I64)lasheader->extended_number_of_point_records)
         {
-          I64 extended_number_of_point_records = lassummary.number_of_point_records;
+          I64 extended_number_of_point_records = lasinventory->number_of_point_records;
           fseek(file, 235 + 12, SEEK_SET);
           if (fwrite(&extended_number_of_point_records, sizeof(I64), 1, file) == 1) {
             success = TRUE;
@@ -287,11 +267,11 @@ BOOL LASrepair::repair_header(LASreader* lasreader, const char* file_name)
       U32 number_of_points_by_return[5];
       for (int i = 1; i < 6; i++)
       {
-        if ((lasheader->point_data_format < 6) && ((I64)(lasheader->number_of_points_by_return[i-1]) != lassummary.number_of_points_by_return[i]))
+        if ((lasheader->point_data_format < 6) && ((I64)(lasheader->number_of_points_by_return[i-1]) != lasinventory->number_of_points_by_return[i]))
         {
-          if (lassummary.number_of_points_by_return[i] <= U32_MAX)
+          if (lasinventory->number_of_points_by_return[i] <= U32_MAX)
           {
-            number_of_points_by_return[i-1] = (U32)lassummary.number_of_points_by_return[i];
+            number_of_points_by_return[i-1] = (U32)lasinventory->number_of_points_by_return[i];
             wrong_entry = TRUE;
 //            if (!no_warnings && file_out)
 //            {
@@ -310,9 +290,9 @@ BOOL LASrepair::repair_header(LASreader* lasreader, const char* file_name)
 //            if (!no_warnings && file_out)
 //            {
 #ifdef _WIN32
-            fprintf(stderr, "WARNING: for return %d real number of points by return (%I64d) exceeds 4,294,967,295.%s\n", i, lassummary.number_of_points_by_return[i], (repair_me ? " cannot repair. too big." : ""));
+            fprintf(stderr, "WARNING: for return %d real number of points by return (%I64d) exceeds 4,294,967,295.%s\n", i, lasinventory->number_of_points_by_return[i], " cannot repair. too big.");
 #else
-            fprintf(stderr, "WARNING: for return %d real number of points by return (%lld) exceeds 4,294,967,295.%s\n", i, lassummary.number_of_points_by_return[i], (repair_me ? " cannot repair. too big." : ""));
+            fprintf(stderr, "WARNING: for return %d real number of points by return (%lld) exceeds 4,294,967,295.%s\n", i, lasinventory->number_of_points_by_return[i], " cannot repair. too big.");
 #endif
 //            }
           }
@@ -345,14 +325,14 @@ BOOL LASrepair::repair_header(LASreader* lasreader, const char* file_name)
         }
         else
         {
-          number_of_points_by_return[i-1] = (U32)lassummary.number_of_points_by_return[i];
+          number_of_points_by_return[i-1] = (U32)lasinventory->number_of_points_by_return[i];
         }
       }
 
       if (wrong_entry)
       {
         fseek(file, 111, SEEK_SET);
-        if (fwrite(&(number_of_points_by_return[0]), sizeof(U32), 5, file) == 1) {
+        if (fwrite(&(number_of_points_by_return[0]), sizeof(U32), 5, file) == 5) {
             success = TRUE;
           } else {
             fprintf(stderr, "ERROR: Cannot repair header for '%s'", file_name);
@@ -377,8 +357,8 @@ BOOL LASrepair::repair_header(LASreader* lasreader, const char* file_name)
 
         for (int i = 1; i < 16; i++)
         {
-          extended_number_of_points_by_return[i-1] = lassummary.number_of_points_by_return[i];
-          if ((I64)lasheader->extended_number_of_points_by_return[i-1] != lassummary.number_of_points_by_return[i])
+          extended_number_of_points_by_return[i-1] = lasinventory->number_of_points_by_return[i];
+          if ((I64)lasheader->extended_number_of_points_by_return[i-1] != lasinventory->number_of_points_by_return[i])
           {
             wrong_entry = TRUE;
 //            if (!no_warnings && file_out)
@@ -406,7 +386,7 @@ BOOL LASrepair::repair_header(LASreader* lasreader, const char* file_name)
         if (wrong_entry)
         {
           fseek(file, 235 + 20, SEEK_SET);
-          if (fwrite(&(extended_number_of_points_by_return[0]), sizeof(I64), 15, file) == 1) {
+          if (fwrite(&(extended_number_of_points_by_return[0]), sizeof(I64), 15, file) == 15) {
             success = TRUE;
           } else {
             fprintf(stderr, "ERROR: Cannot repair header for '%s'", file_name);
@@ -559,23 +539,28 @@ BOOL LASrepair::repair_header(LASreader* lasreader, const char* file_name)
 //        }
 //      }
 
+      // without points there is no bounding box to repair it with
+
       double value;
       wrong_entry = FALSE;
-      if (lasheader->get_x(lassummary.max.get_X()) != lasheader->max_x) wrong_entry = TRUE;
-      if (lasheader->get_x(lassummary.min.get_X()) != lasheader->min_x) wrong_entry = TRUE;
-      if (lasheader->get_y(lassummary.max.get_Y()) != lasheader->max_y) wrong_entry = TRUE;
-      if (lasheader->get_y(lassummary.min.get_Y()) != lasheader->min_y) wrong_entry = TRUE;
-      if (lasheader->get_z(lassummary.max.get_Z()) != lasheader->max_z) wrong_entry = TRUE;
-      if (lasheader->get_z(lassummary.min.get_Z()) != lasheader->min_z) wrong_entry = TRUE;
+      if (lasinventory->is_active())
+      {
+        if (lasheader->get_x(lasinventory->max_X) != lasheader->max_x) wrong_entry = TRUE;
+        if (lasheader->get_x(lasinventory->min_X) != lasheader->min_x) wrong_entry = TRUE;
+        if (lasheader->get_y(lasinventory->max_Y) != lasheader->max_y) wrong_entry = TRUE;
+        if (lasheader->get_y(lasinventory->min_Y) != lasheader->min_y) wrong_entry = TRUE;
+        if (lasheader->get_z(lasinventory->max_Z) != lasheader->max_z) wrong_entry = TRUE;
+        if (lasheader->get_z(lasinventory->min_Z) != lasheader->min_z) wrong_entry = TRUE;
+      }
       if (wrong_entry)
       {
         fseek(file, 179, SEEK_SET);
-        value = lasheader->get_x(lassummary.max.get_X()); if (fwrite(&value, sizeof(double), 1, file) == 1) {success = TRUE;} else {success = FALSE;}
-        value = lasheader->get_x(lassummary.min.get_X()); if (fwrite(&value, sizeof(double), 1, file) == 1) {success = TRUE;} else {success = FALSE;}
-        value = lasheader->get_y(lassummary.max.get_Y()); if (fwrite(&value, sizeof(double), 1, file) == 1) {success = TRUE;} else {success = FALSE;}
-        value = lasheader->get_y(lassummary.min.get_Y()); if (fwrite(&value, sizeof(double), 1, file) == 1) {success = TRUE;} else {success = FALSE;}
-        value = lasheader->get_z(lassummary.max.get_Z()); if (fwrite(&value, sizeof(double), 1, file) == 1) {success = TRUE;} else {success = FALSE;}
-        value = lasheader->get_z(lassummary.min.get_Z()); if (fwrite(&value, sizeof(double), 1, file) == 1) {success = TRUE;} else {success = FALSE;}
+        value = lasheader->get_x(lasinventory->max_X); if (fwrite(&value, sizeof(double), 1, file) == 1) {success = TRUE;} else {success = FALSE;}
+        value = lasheader->get_x(lasinventory->min_X); if (fwrite(&value, sizeof(double), 1, file) == 1) {success = TRUE;} else {success = FALSE;}
+        value = lasheader->get_y(lasinventory->max_Y); if (fwrite(&value, sizeof(double), 1, file) == 1) {success = TRUE;} else {success = FALSE;}
+        value = lasheader->get_y(lasinventory->min_Y); if (fwrite(&value, sizeof(double), 1, file) == 1) {success = TRUE;} else {success = FALSE;}
+        value = lasheader->get_z(lasinventory->max_Z); if (fwrite(&value, sizeof(double), 1, file) == 1) {success = TRUE;} else {success = FALSE;}
+        value = lasheader->get_z(lasinventory->min_Z); if (fwrite(&value, sizeof(double), 1, file) == 1) {success = TRUE;} else {success = FALSE;}
 
 
 //        if (file_out) fprintf(file_out, "bounding box was repaired.\n");
@@ -623,7 +608,6 @@ BOOL LASrepair::repair_header(LASreader* lasreader, const char* file_name)
 //    if (file_out && (file_out != stdout) && (file_out != stderr)) fclose(file_out);
 //    laswriteopener.set_file_name(0);
 
-    delete lasheader;
     fclose(file);
     return success;
 }
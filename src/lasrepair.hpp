@@ -30,6 +30,7 @@
 
   CHANGE HISTORY:
 
+    18 October 2026 -- repair_header() takes the LASinventory collected by LAScheck
      2 August 2015 -- not failing but warning if OCG WRT has an empty payload
     12 April 2015 -- not failing but warning for certain empty VLR payloads
     27 April 2013 -- adapted from the LASlib library for the ASPRS LASvalidator
@@ -61,7 +62,7 @@
 class LASrepair
 {
 public:
-    BOOL repair_header(LASreader* lasreader, const char* file_name);
+    BOOL repair_header(const LASheader* lasheader, const LASinventory* lasinventory, const char* file_name);
 //    LASrepair();
 //    ~LASrepair();
 private:
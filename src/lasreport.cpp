@@ -0,0 +1,331 @@
+/*
+===============================================================================
+
+  FILE:  lasreport.cpp
+  
+  CONTENTS:
+  
+    see corresponding header file
+  
+  PROGRAMMERS:
+  
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+  
+  COPYRIGHT:
+  
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  
+  CHANGE HISTORY:
+  
+    see corresponding header file
+  
+===============================================================================
+*/
+#include "lasreport.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+// appends a JSON string. bytes that are not ASCII are taken to be Latin-1 so
+// that the output is valid UTF-8 whatever the header strings contain
+
+static void json_string(std::string& json, const CHAR* value)
+{
+  CHAR escaped[8];
+  json.push_back('"');
+  for (; *value; value++)
+  {
+    U8 c = (U8)*value;
+    if (c == '"')
+    {
+      json.append("\\\"");
+    }
+    else if (c == '\\')
+    {
+      json.append("\\\\");
+    }
+    else if ((c < 0x20) || (c > 0x7E))
+    {
+      sprintf(escaped, "\\u%04x", c);
+      json.append(escaped);
+    }
+    else
+    {
+      json.push_back((CHAR)c);
+    }
+  }
+  json.push_back('"');
+}
+
+static void json_key(std::string& json, const CHAR* key)
+{
+  if (json.size() && (json[json.size()-1] != '{') && (json[json.size()-1] != '[')) json.push_back(',');
+  json_string(json, key);
+  json.push_back(':');
+}
+
+static void json_list(std::string& json, const CHAR* key, CHAR** list, U32 num)
+{
+  U32 i;
+  json_key(json, key);
+  json.push_back('[');
+  for (i = 0; i < num; i+=2)
+  {
+    if (i) json.push_back(',');
+    json.append("{\"variable\":");
+    json_string(json, list[i]);
+    json.append(",\"note\":");
+    json_string(json, list[i+1]);
+    json.push_back('}');
+  }
+  json.push_back(']');
+}
+
+LASreport::LASreport()
+{
+  json_file = 0;
+  queue_head = 0;
+  queue_tail = 0;
+  closing = FALSE;
+}
+
+LASreport::~LASreport()
+{
+  if (writer.joinable())
+  {
+    closing = TRUE;
+    writer.join();
+  }
+  if (json_file) fclose(json_file);
+}
+
+BOOL LASreport::open_xml(const CHAR* file_name)
+{
+  return xmlwriter.open(file_name, "LASvalidator");
+}
+
+BOOL LASreport::open_json(const CHAR* file_name)
+{
+  json_file = fopen(file_name, "w");
+  if (json_file == 0)
+  {
+    fprintf(stderr,"ERROR: cannot open JSON file '%s'\n", file_name);
+    return FALSE;
+  }
+  // reports of large batches are written in big blocks
+  setvbuf(json_file, 0, _IOFBF, 1 << 20);
+  return TRUE;
+}
+
+BOOL LASreport::start()
+{
+  if (!is_open() || writer.joinable())
+  {
+    return FALSE;
+  }
+  writer = std::thread(&LASreport::run, this);
+  return TRUE;
+}
+
+// the header strings need not be terminated
+
+void LASreportHeader::set(const LASheader* lasheader)
+{
+  version_major = lasheader->version_major;
+  version_minor = lasheader->version_minor;
+  strncpy(system_identifier, lasheader->system_identifier, 32);
+  system_identifier[32] = '\0';
+  strncpy(generating_software, lasheader->generating_software, 32);
+  generating_software[32] = '\0';
+  point_data_format = lasheader->point_data_format;
+}
+
+void LASreport::format(LASreportRecord* record, const CHAR* file_name, const CHAR* path, const LASreportHeader* header, const LASerror* error, const CHAR* crsdescription, const CHAR* summary) const
+{
+  CHAR version[16];
+
+  if (header)
+  {
+    sprintf(version, "%d.%d", header->version_major, header->version_minor);
+  }
+
+  U32 i;
+
+  if (xmlwriter.is_open())
+  {
+    XMLwriter xmlreport;
+    xmlreport.open(&record->xml);
+    xmlreport.begin("report");
+    xmlreport.beginsub("file");
+    xmlreport.write("name", file_name);
+    xmlreport.write("path", path);
+    if (header)
+    {
+      xmlreport.write("version", version);
+      xmlreport.write("system_identifier", header->system_identifier);
+      xmlreport.write("generating_software", header->generating_software);
+      xmlreport.write("point_data_format", (I32)header->point_data_format);
+    }
+    xmlreport.write("CRS", crsdescription);
+    xmlreport.endsub("file");
+    xmlreport.beginsub("summary");
+    xmlreport.write(summary);
+    xmlreport.endsub("summary");
+    if (error->fail_num || error->warning_num || error->unevaluated_num)
+    {
+      xmlreport.beginsub("details");
+      for (i = 0; i < error->fail_num; i+=2)
+      {
+        xmlreport.write(error->fails[i], "fail", error->fails[i+1]);
+      }
+      for (i = 0; i < error->warning_num; i+=2)
+      {
+        xmlreport.write(error->warnings[i], "warning", error->warnings[i+1]);
+      }
+      for (i = 0; i < error->unevaluated_num; i+=2)
+      {
+        xmlreport.write(error->unevaluated[i], "not_evaluated", error->unevaluated[i+1]);
+      }
+      xmlreport.endsub("details");
+    }
+    xmlreport.end("report");
+    xmlreport.close("report");
+  }
+
+  if (json_file)
+  {
+    std::string& json = record->json;
+    json.push_back('{');
+    json_key(json, "name");
+    json_string(json, file_name);
+    json_key(json, "path");
+    json_string(json, path);
+    if (header)
+    {
+      json_key(json, "version");
+      json_string(json, version);
+      json_key(json, "system_identifier");
+      json_string(json, header->system_identifier);
+      json_key(json, "generating_software");
+      json_string(json, header->generating_software);
+      json_key(json, "point_data_format");
+      json.append(std::to_string((I32)header->point_data_format));
+    }
+    json_key(json, "CRS");
+    json_string(json, crsdescription);
+    json_key(json, "summary");
+    json_string(json, summary);
+    json_list(json, "fail", error->fails, error->fail_num);
+    json_list(json, "warning", error->warnings, error->warning_num);
+    json_list(json, "not_evaluated", error->unevaluated, error->unevaluated_num);
+    json.append("}\n");
+  }
+}
+
+void LASreport::write(LASreportRecord* record)
+{
+  // only this function advances the tail so it can be read without ordering
+
+  U32 tail = queue_tail.load(std::memory_order_relaxed);
+
+  // a full queue means the disk is slower than the validation
+
+  while ((tail - queue_head.load(std::memory_order_acquire)) >= LASREPORT_QUEUE_SIZE)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  queue[tail % LASREPORT_QUEUE_SIZE] = record;
+  queue_tail.store(tail + 1, std::memory_order_release);
+}
+
+void LASreport::run()
+{
+  U32 head = queue_head.load(std::memory_order_relaxed);
+  while (TRUE)
+  {
+    if (head == queue_tail.load(std::memory_order_acquire))
+    {
+      // all records are written once close() was called and the queue is empty
+
+      if (closing.load(std::memory_order_acquire))
+      {
+        if (head == queue_tail.load(std::memory_order_acquire)) break;
+        continue;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      continue;
+    }
+    LASreportRecord* record = queue[head % LASREPORT_QUEUE_SIZE];
+    if (xmlwriter.is_open())
+    {
+      xmlwriter.insert(record->xml);
+    }
+    if (json_file)
+    {
+      fwrite(record->json.c_str(), 1, record->json.size(), json_file);
+    }
+    delete record;
+    queue_head.store(++head, std::memory_order_release);
+  }
+}
+
+void LASreport::close(const CHAR* summary, U32 num_pass, U32 num_warning, U32 num_fail, const CHAR* version, const CHAR* command_line)
+{
+  if (writer.joinable())
+  {
+    closing.store(TRUE, std::memory_order_release);
+    writer.join();
+  }
+
+  if (xmlwriter.is_open())
+  {
+    xmlwriter.begin("total");
+    xmlwriter.beginsub("summary");
+    xmlwriter.write(summary);
+    xmlwriter.endsub("summary");
+    xmlwriter.beginsub("details");
+    xmlwriter.write("pass", (I32)num_pass);
+    xmlwriter.write("warning", (I32)num_warning);
+    xmlwriter.write("fail", (I32)num_fail);
+    xmlwriter.endsub("details");
+    xmlwriter.end("total");
+    xmlwriter.begin("version");
+    xmlwriter.write(version);
+    xmlwriter.end("version");
+    xmlwriter.begin("command_line");
+    xmlwriter.write(command_line);
+    xmlwriter.end("command_line");
+    xmlwriter.close("LASvalidator");
+  }
+
+  if (json_file)
+  {
+    std::string json;
+    json.append("{\"total\":{");
+    json_key(json, "summary");
+    json_string(json, summary);
+    json_key(json, "pass");
+    json.append(std::to_string(num_pass));
+    json_key(json, "warning");
+    json.append(std::to_string(num_warning));
+    json_key(json, "fail");
+    json.append(std::to_string(num_fail));
+    json.push_back('}');
+    json_key(json, "version");
+    json_string(json, version);
+    json_key(json, "command_line");
+    json_string(json, command_line);
+    json.append("}\n");
+    fwrite(json.c_str(), 1, json.size(), json_file);
+    fclose(json_file);
+    json_file = 0;
+  }
+}
@@ -0,0 +1,109 @@
+/*
+===============================================================================
+
+  FILE:  lasreport.hpp
+  
+  CONTENTS:
+  
+    Writes the validation report of every file to an XML file and/or to a
+    file with one JSON object per line (NDJSON). The reports are formatted by
+    the threads that validate the files and handed in input order through a
+    bounded lock-free queue to a single writer thread that does buffered
+    writes. Hence the validation never waits for the disk and the memory
+    needed does not grow with the number of files.
+
+  PROGRAMMERS:
+  
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+  
+  COPYRIGHT:
+  
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  
+  CHANGE HISTORY:
+  
+    18 October 2026 -- reports take the header fields from LASreportHeader
+    18 October 2026 -- created for machine-readable reports of large batches
+
+===============================================================================
+*/
+#ifndef LAS_REPORT_HPP
+#define LAS_REPORT_HPP
+
+#include "lasheader.hpp"
+#include "xmlwriter.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+// the number of formatted reports that can wait for the writer thread
+
+#define LASREPORT_QUEUE_SIZE 1024
+
+// the fields of the LAS header that the report lists for each file. the
+// strings are terminated copies of those in the header
+
+class LASreportHeader
+{
+public:
+  U8 version_major;
+  U8 version_minor;
+  CHAR system_identifier[33];
+  CHAR generating_software[33];
+  U8 point_data_format;
+  void set(const LASheader* lasheader);
+  LASreportHeader() { version_major = version_minor = 0; system_identifier[0] = generating_software[0] = '\0'; point_data_format = 0; };
+};
+
+class LASreportRecord
+{
+public:
+  std::string xml;
+  std::string json;
+};
+
+class LASreport
+{
+public:
+  BOOL open_xml(const CHAR* file_name);
+  BOOL open_json(const CHAR* file_name);
+  BOOL is_open() const { return (xmlwriter.is_open() || json_file); };
+
+  // starts the writer thread once the files are open
+  BOOL start();
+
+  // formats the report of one file. may be called by several threads. the
+  // header fields may be zero when they are unknown
+  void format(LASreportRecord* record, const CHAR* file_name, const CHAR* path, const LASreportHeader* header, const LASerror* error, const CHAR* crsdescription, const CHAR* summary) const;
+
+  // hands a record over to the writer thread that deletes it when written.
+  // must be called by one thread at a time in the order of the files. waits
+  // while the queue is full
+  void write(LASreportRecord* record);
+
+  // writes the remaining records and the totals and closes the files
+  void close(const CHAR* summary, U32 num_pass, U32 num_warning, U32 num_fail, const CHAR* version, const CHAR* command_line);
+
+  LASreport();
+  ~LASreport();
+
+private:
+  void run();
+  FILE* json_file;
+  XMLwriter xmlwriter;
+  std::thread writer;
+  LASreportRecord* queue[LASREPORT_QUEUE_SIZE];
+  std::atomic<U32> queue_head;    // advanced by the writer thread only
+  std::atomic<U32> queue_tail;    // advanced by the calls to write() only
+  std::atomic<BOOL> closing;
+};
+
+#endif
@@ -24,6 +24,25 @@
   
   CHANGE HISTORY:
   
+    18 October 2026 -- a file whose point ranges cannot be opened or seeked is read sequentially
+    18 October 2026 -- '-v' reports how many CRS checks were replayed from identical files
+    18 October 2026 -- '-v' and '-timing_csv' report the time of each phase with a monotonic clock
+    18 October 2026 -- '-i_dir' validates the files of a directory tree largest first
+    18 October 2026 -- the outcomes of the files are kept in a ring of VALIDATE_REPORT_WINDOW entries
+    18 October 2026 -- '-cache' reports unchanged files without opening them
+    18 October 2026 -- '-lof' reads the file names from a list file or from stdin
+    18 October 2026 -- '-o' and '-json' write XML and NDJSON reports with a writer thread
+    18 October 2026 -- '-chunks_only' checks the structure of LAZ chunks without decoding points
+    18 October 2026 -- '-sample_chunks' checks a seeded random subset of the chunks of LAZ files
+    18 October 2026 -- '-cache' answers unchanged files with the verdict of an earlier run
+    18 October 2026 -- '-header_only' checks header, VLRs, EVLRs, and CRS without reading points
+    18 October 2026 -- '-repair_unbuffered' uses the inventory of the validation pass
+    18 October 2026 -- LAZ files decompress only the point layers that are checked
+    18 October 2026 -- points are read and checked in blocks of VALIDATE_BATCH_SIZE
+    18 October 2026 -- '-mmap' reads the files through memory mappings
+    18 October 2026 -- spare '-cores' also read ranges of LAS point records in parallel
+    18 October 2026 -- spare '-cores' read the chunks of large LAZ files in parallel
+    18 October 2026 -- '-cores' validates files in parallel and reports them in input order
      2 August 2015 -- not failing but warning if OCG WRT has intentional empty payload 
     12 April 2015 -- not failing but warning for certain empty VLR payloads 
     20 March 2015 -- fail on files containing zero point records
@@ -37,19 +56,45 @@
 #include <ctime>
 #include <cstdlib>
 #include <cstring>
+#include <cmath>
 #include <vector>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "lasrepair.hpp"
 
 #include "lasreadopener.hpp"
 #include "xmlwriter.hpp"
 #include "lascheck.hpp"
+#include "crscheck.hpp"
+#include "lascache.hpp"
+#include "lasreport.hpp"
 
 #define VALIDATE_VERSION  200104
 
+#define VALIDATE_BATCH_SIZE 4096
+
+// how many files may be validated ahead of the first one that is not reported
+// yet. this bounds the memory for the outcomes and the reports that wait to be
+// reported in order, which are kept in a ring of this many entries
+
+#define VALIDATE_REPORT_WINDOW 4096
+
 #define VALIDATE_PASS     0x0000
 #define VALIDATE_FAIL     0x0001
 #define VALIDATE_WARNING  0x0002
 
+// why a range of points was not read by its thread
+
+#define VALIDATE_RANGE_READ   0
+#define VALIDATE_RANGE_OPEN   1
+#define VALIDATE_RANGE_BATCH  2
+#define VALIDATE_RANGE_SEEK   3
+
 static void byebye(int return_code, BOOL wait = TRUE)
 {
   if (wait)
@@ -67,14 +112,30 @@ static void usage(int return_code, BOOL wait = FALSE)
   fprintf(stderr,"lasvalidate -i lidar.las\n");
   fprintf(stderr,"lasvalidate -i lidar.laz -no_CRS_fail\n");
   fprintf(stderr,"lasvalidate -i *.laz -cores 4 -v \n");
+  fprintf(stderr,"lasvalidate -i *.las -o report.xml\n");
+  fprintf(stderr,"lasvalidate -lof file_list.txt -cores 8 -json report.ndjson\n");
+  fprintf(stderr,"lasvalidate -i_dir archive -recursive -cores 8\n");
+  fprintf(stderr,"lasvalidate -i_dir archive -recursive -ext laz -exclude \"*_old*\" -exclude \"archive/tmp*\"\n");
+  fprintf(stderr,"find archive -name \"*.laz\" | lasvalidate -lof - -cores 8\n");
+  fprintf(stderr,"lasvalidate -i *.laz -cores 8 -json report.ndjson\n");
+  fprintf(stderr,"lasvalidate -i huge.laz -cores 8\n");
+  fprintf(stderr,"lasvalidate -i *.las -mmap\n");
+  fprintf(stderr,"lasvalidate -i *.laz -cores 8 -timing_csv timing.csv\n");
   fprintf(stderr,"lasvalidate -i *.laz -repair_unbuffered\n");
+  fprintf(stderr,"lasvalidate -i *.laz -header_only -cores 8\n");
+  fprintf(stderr,"lasvalidate -i archive/*.laz -cache archive/lasvalidate.cache\n");
+  fprintf(stderr,"lasvalidate -i archive/*.laz -cache archive/lasvalidate.cache -rebuild_cache\n");
+  fprintf(stderr,"lasvalidate -i archive/*.laz -chunks_only -cores 8\n");
+  fprintf(stderr,"lasvalidate -i delivery/*.laz -sample_chunks 5%% -v\n");
+  fprintf(stderr,"lasvalidate -i delivery/*.laz -sample_chunks 20 -sample_seed 7\n");
   fprintf(stderr,"lasvalidate -h\n");
   byebye(return_code, wait);
 }
 
 static double taketime()
 {
-  return (double)(clock())/CLOCKS_PER_SEC;
+  // a monotonic wall clock. the CPU time of clock() adds up all threads and misses I/O waits
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
 }
 
 #define LAS_VALIDATE_SUCCESS                    (0)  // Program successfully executed all phases
@@ -83,18 +144,543 @@ static double taketime()
 #define LAS_VALIDATE_NO_INPUT_SPECIFIED        (-3)  // The command line does not specify any LAS or LAZ files as input
 #define LAS_VALIDATE_INPUT_FILE_NOT_FOUND      (-4)  // The input file specified on the command line was not found
 
+// the phases of validating a file that are timed. the phases of points read
+// by several threads are the sum of the times of all threads
+
+#define VALIDATE_PHASE_HEADER   0  // opening the file and loading the header
+#define VALIDATE_PHASE_VLRS     1  // loading the VLRs and EVLRs
+#define VALIDATE_PHASE_DECODE   2  // reading and decoding the points (or the LAZ chunks)
+#define VALIDATE_PHASE_PARSE    3  // LAScheck::parse_batch()
+#define VALIDATE_PHASE_CHECK    4  // LAScheck::check() without the CRS
+#define VALIDATE_PHASE_CRS      5  // the CRS check of LAScheck::check()
+#define VALIDATE_PHASE_REPAIR   6  // LASrepair::repair_header()
+#define VALIDATE_PHASES         7
+
+static const CHAR* validate_phase_names[VALIDATE_PHASES] = { "header", "vlrs", "decode", "parse", "check", "crs", "repair" };
+
+class LASvalidateTiming
+{
+public:
+  F64 seconds[VALIDATE_PHASES];
+  I64 points;
+  void add(const LASvalidateTiming& timing)
+  {
+    for (I32 p = 0; p < VALIDATE_PHASES; p++) seconds[p] += timing.seconds[p];
+    points += timing.points;
+  };
+  LASvalidateTiming() { for (I32 p = 0; p < VALIDATE_PHASES; p++) seconds[p] = 0.0; points = 0; };
+};
+
+class LASvalidateFile
+{
+public:
+  U32 pass;
+  BOOL repaired;
+  BOOL cached;
+  BOOL sampled;
+  BOOL missing;
+  BOOL done;
+  F64 time;
+  LASvalidateTiming timing;
+  LASreportRecord* record;
+  LASvalidateFile() { pass = VALIDATE_PASS; repaired = FALSE; cached = FALSE; sampled = FALSE; missing = FALSE; done = FALSE; time = 0.0; record = 0; };
+};
+
+static const CHAR* verdict(U32 pass)
+{
+  return (pass == VALIDATE_PASS ? "pass" : ((pass & VALIDATE_FAIL) ? "fail" : "warning"));
+}
+
+// reads up to n points into the batch and parses them. with a timing the time
+// spent reading and parsing is added to it
+
+static U32 read_and_parse(LASreader* lasreader, U32 n, LASpointBatch* laspointbatch, LAScheck* lascheck, LASvalidateTiming* timing)
+{
+  if (timing == 0)
+  {
+    n = lasreader->read_points(n, laspointbatch);
+    lascheck->parse_batch(laspointbatch);
+    return n;
+  }
+  F64 start_time = taketime();
+  n = lasreader->read_points(n, laspointbatch);
+  F64 read_time = taketime();
+  lascheck->parse_batch(laspointbatch);
+  timing->seconds[VALIDATE_PHASE_DECODE] += read_time-start_time;
+  timing->seconds[VALIDATE_PHASE_PARSE] += taketime()-read_time;
+  timing->points += n;
+  return n;
+}
+
+// the points of a file can be split into ranges that are read by several threads.
+// for LAZ files the ranges are made of whole chunks and for LAS files of complete
+// point records. the last range always ends at the point count from the header.
+
+static I32 split_points(LASreader* lasreader, I32 threads, std::vector<I64>& starts)
+{
+  I32 t;
+  starts.clear();
+  U32 number_chunks = lasreader->get_number_chunks();
+  if (number_chunks > 1)
+  {
+    if ((U32)threads > number_chunks) threads = number_chunks;
+    for (t = 0; t < threads; t++)
+    {
+      starts.push_back(lasreader->get_chunk_first_point((U32)(((U64)number_chunks*t)/threads)));
+    }
+  }
+  else if (!lasreader->is_compressed())
+  {
+    I64 number_points = lasreader->get_number_stored_points();
+    if (number_points < 2) return 1;
+    if (threads > number_points) threads = (I32)number_points;
+    for (t = 0; t < threads; t++)
+    {
+      starts.push_back((number_points*t)/threads);
+    }
+  }
+  else
+  {
+    return 1;
+  }
+  starts.push_back(lasreader->npoints);
+  return threads;
+}
+
+// each thread reads a contiguous range of points with its own LASreader into its own
+// LAScheck. the ranges are merged in order up to the first one that could not be read
+// completely, so that the outcome is the same as that of reading the file sequentially.
+// the range readers are quiet and only the end-of-file warning that a sequential read
+// would print is printed. when a range cannot be opened or seeked to its first point
+// nothing is merged and FALSE is returned so that the file is read sequentially
+
+static BOOL parse_ranges(LASreadOpener& lasreadopener, U32 number, const LASreader* lasreader, LAScheck& lascheck, const std::vector<I64>& starts, LASvalidateTiming* timing)
+{
+  I32 t;
+  I32 threads = (I32)starts.size() - 1;
+  std::vector<LAScheck*> laschecks(threads);
+  std::vector<BOOL> complete(threads, FALSE);
+  std::vector<I32> failed(threads, VALIDATE_RANGE_READ);
+  std::vector<I64> unreadable(threads, -1);
+  std::vector<LASvalidateTiming> timings(threads);
+
+#pragma omp parallel for schedule(static, 1) num_threads(threads)
+  for (t = 0; t < threads; t++)
+  {
+    I64 start = starts[t];
+    I64 end = starts[t+1];
+    laschecks[t] = new LAScheck(&lasreader->header);
+    LASreader* rangereader = lasreadopener.open(number);
+    if (rangereader == 0)
+    {
+      failed[t] = VALIDATE_RANGE_OPEN;
+      continue;
+    }
+    rangereader->set_quiet(TRUE);
+    LASpointBatch laspointbatch;
+    BOOL success = laspointbatch.init(&rangereader->point, VALIDATE_BATCH_SIZE);
+    if (!success)
+    {
+      failed[t] = VALIDATE_RANGE_BATCH;
+    }
+    else if (start < end)
+    {
+      success = rangereader->seek(start);
+      if (!success) failed[t] = VALIDATE_RANGE_SEEK;
+    }
+    laschecks[t]->set_point_index(start);
+    while (success && (rangereader->p_count < end))
+    {
+      U32 n = (U32)((end - rangereader->p_count) < VALIDATE_BATCH_SIZE ? (end - rangereader->p_count) : VALIDATE_BATCH_SIZE);
+      if (read_and_parse(rangereader, n, &laspointbatch, laschecks[t], (timing ? &timings[t] : 0)) < n)
+      {
+        unreadable[t] = rangereader->p_count;
+        success = FALSE;
+      }
+    }
+    // reading the first point of the next range checks that a last LAZ chunk ended where the next one starts
+    if (success && (end < rangereader->npoints))
+    {
+      success = rangereader->read_point();
+      if (!success) unreadable[t] = rangereader->p_count;
+    }
+    complete[t] = success;
+    rangereader->close();
+    delete rangereader;
+  }
+
+  // a range that was not read says nothing about the points of the file
+
+  BOOL merged = TRUE;
+  for (t = 0; t < threads; t++)
+  {
+    if (failed[t] != VALIDATE_RANGE_READ)
+    {
+      if (failed[t] == VALIDATE_RANGE_OPEN)
+      {
+        fprintf(stderr,"WARNING: cannot open '%s' again for points %u to %u of %u. reading it sequentially\n", lasreadopener.get_path(number), (U32)starts[t], (U32)starts[t+1], (U32)lasreader->npoints);
+      }
+      else if (failed[t] == VALIDATE_RANGE_BATCH)
+      {
+        fprintf(stderr,"WARNING: cannot allocate a batch of %u points for points %u to %u of %u. reading it sequentially\n", VALIDATE_BATCH_SIZE, (U32)starts[t], (U32)starts[t+1], (U32)lasreader->npoints);
+      }
+      else
+      {
+        fprintf(stderr,"WARNING: cannot seek to point %u of %u in '%s'. reading it sequentially\n", (U32)starts[t], (U32)lasreader->npoints, lasreadopener.get_path(number));
+      }
+      merged = FALSE;
+      break;
+    }
+  }
+
+  for (t = 0; merged && (t < threads); t++)
+  {
+    lascheck.merge(*laschecks[t]);
+    if (!complete[t])
+    {
+      if (unreadable[t] >= 0) fprintf(stderr,"WARNING: end-of-file after %u of %u points\n", (U32)unreadable[t], (U32)lasreader->npoints);
+      break;
+    }
+  }
+  if (timing && merged)
+  {
+    for (t = 0; t < threads; t++) timing->add(timings[t]);
+  }
+  for (t = 0; t < threads; t++)
+  {
+    delete laschecks[t];
+  }
+  return merged;
+}
+
+// the structure of a LAZ file is checked without decoding any points. the chunk
+// table has to fit the file and the point count and the header of every chunk
+// its size. the chunks can be probed in ranges by several threads. for LAS
+// files the file has to be long enough for all point records.
+
+static void check_structure(LASreadOpener& lasreadopener, U32 number, LASreader* lasreader, LASheader* lasheader, I32 point_cores)
+{
+  CHAR note[512];
+
+  if (!lasreader->is_compressed())
+  {
+    I64 number_points = lasreader->get_number_stored_points();
+    if (number_points < lasreader->npoints)
+    {
+#ifdef _WIN32
+      sprintf(note, "file is truncated and stores only %I64d of %I64d point records", number_points, lasreader->npoints);
+#else
+      sprintf(note, "file is truncated and stores only %lld of %lld point records", number_points, lasreader->npoints);
+#endif
+      lasheader->add_fail("point records", note);
+    }
+    return;
+  }
+
+  if (!lasreader->check_chunk_table())
+  {
+    lasheader->add_fail("chunk table", lasreader->get_error());
+    return;
+  }
+
+  I32 t;
+  U32 number_chunks = lasreader->get_number_chunks();
+  I32 threads = ((U32)point_cores > number_chunks ? (I32)number_chunks : point_cores);
+  if (threads < 1) threads = 1;
+  std::vector<U32> failed(threads, U32_MAX);
+  std::vector<std::string> errors(threads);
+
+#pragma omp parallel for schedule(static, 1) num_threads(threads)
+  for (t = 0; t < threads; t++)
+  {
+    U32 first = (U32)(((U64)number_chunks*t)/threads);
+    U32 end = (U32)(((U64)number_chunks*(t+1))/threads);
+    LASreader* chunkreader = (t == 0 ? lasreader : lasreadopener.open(number));
+    if (chunkreader == 0)
+    {
+      failed[t] = first;
+      errors[t] = "cannot open file again";
+      continue;
+    }
+    U32 chunk;
+    for (chunk = first; chunk < end; chunk++)
+    {
+      if (!chunkreader->check_chunks(chunk, chunk+1))
+      {
+        failed[t] = chunk;
+        errors[t] = chunkreader->get_error();
+        break;
+      }
+    }
+    if (t != 0)
+    {
+      chunkreader->close();
+      delete chunkreader;
+    }
+  }
+
+  // report the first chunk that failed
+
+  for (t = 0; t < threads; t++)
+  {
+    if (failed[t] != U32_MAX)
+    {
+      lasheader->add_fail("chunk", errors[t].c_str());
+      break;
+    }
+  }
+}
+
+// a random sample of the chunks of a LAZ file selected with a seeded generator
+// (splitmix64) so that the same chunks are checked every time. each chunk goes
+// into its own LAScheck so that counts can be estimated for the whole file.
+// negative chunks are a percentage of the chunks and positive ones a count.
+
+class LASvalidateSample
+{
+public:
+  F64 chunks;
+  U64 seed;
+  LASvalidateSample() { chunks = 0.0; seed = 0x4C415376616C6964ull; };
+};
+
+static U64 splitmix64(U64& state)
+{
+  U64 z = (state += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+static BOOL parse_sample(LASreader* lasreader, LAScheck& lascheck, const LASvalidateSample& sample, LASvalidateTiming* timing)
+{
+  U32 number_chunks = lasreader->get_number_chunks();
+  if (number_chunks < 2) return FALSE;
+
+  U32 number_sampled = (U32)(sample.chunks < 0.0 ? ceil(-sample.chunks*number_chunks/100.0) : sample.chunks);
+  if (number_sampled < 1) number_sampled = 1;
+
+  // a sample of all chunks is a complete read
+
+  if (number_sampled >= number_chunks) return FALSE;
+
+  // partial Fisher-Yates shuffle. the chunks are then read in file order
+
+  U32 c;
+  U64 state = sample.seed;
+  std::vector<U32> chunks(number_chunks);
+  for (c = 0; c < number_chunks; c++) chunks[c] = c;
+  for (c = 0; c < number_sampled; c++)
+  {
+    U32 r = c + (U32)(splitmix64(state) % (number_chunks - c));
+    U32 swap = chunks[c]; chunks[c] = chunks[r]; chunks[r] = swap;
+  }
+  std::sort(chunks.begin(), chunks.begin() + number_sampled);
+
+  lascheck.sample(number_chunks);
+  LASpointBatch laspointbatch;
+  if (!laspointbatch.init(&lasreader->point, VALIDATE_BATCH_SIZE)) return FALSE;
+
+  for (c = 0; c < number_sampled; c++)
+  {
+    I64 start = lasreader->get_chunk_first_point(chunks[c]);
+    I64 end = ((chunks[c] + 1) < number_chunks ? lasreader->get_chunk_first_point(chunks[c] + 1) : lasreader->npoints);
+    LAScheck chunkcheck(&lasreader->header);
+    chunkcheck.set_point_index(start);
+    BOOL success = lasreader->seek(start);
+    while (success && (lasreader->p_count < end))
+    {
+      U32 n = (U32)((end - lasreader->p_count) < VALIDATE_BATCH_SIZE ? (end - lasreader->p_count) : VALIDATE_BATCH_SIZE);
+      if (read_and_parse(lasreader, n, &laspointbatch, &chunkcheck, timing) < n)
+      {
+        success = FALSE;
+      }
+    }
+    lascheck.merge_sample(chunkcheck, success);
+
+    // a chunk that cannot be decoded may have left the decoder in any state
+
+    if (!success) break;
+  }
+  return TRUE;
+}
+
+static void validate_file(LASreadOpener& lasreadopener, U32 number, LASvalidateFile& file, BOOL no_CRS_fail, BOOL header_only, BOOL chunks_only, const LASvalidateSample& sample, BOOL repair, BOOL timed, I32 point_cores, LAScache* lascache, const LASreport* lasreport)
+{
+  // in verbose mode or for the timing CSV we measure the time for each file and phase
+
+  F64 start_time = 0.0;
+  F64 phase_time = 0.0;
+  LASvalidateTiming* timing = (timed ? &file.timing : 0);
+  if (timed) start_time = taketime();
+
+  // an unchanged file that was validated with the same options is answered from the
+  // cache. a file that did not pass is validated again when it is to be repaired
+
+  U32 options = (no_CRS_fail ? LASCACHE_NO_CRS_FAIL : 0) | (header_only ? LASCACHE_HEADER_ONLY : 0) | (chunks_only ? LASCACHE_CHUNKS_ONLY : 0);
+  LASfingerprint fingerprint;
+  BOOL fingerprinted = (lascache && (sample.chunks == 0.0) && LAScache::fingerprint(lasreadopener.get_path(number), &fingerprint));
+
+  if (fingerprinted)
+  {
+    const LAScacheEntry* entry = lascache->lookup(lasreadopener.get_path(number), &fingerprint, options);
+    if (entry && ((entry->pass == VALIDATE_PASS) || !repair))
+    {
+      file.pass = entry->pass;
+      file.cached = TRUE;
+      if (lasreport)
+      {
+        file.record = new LASreportRecord;
+        lasreport->format(file.record, lasreadopener.get_file_name(number), lasreadopener.get_path(number), (entry->header.version_major ? &entry->header : 0), entry, entry->crsdescription, verdict(file.pass));
+      }
+      if (timed) file.time = taketime()-start_time;
+      return;
+    }
+  }
+
+  // open lasreader
+
+  if (timed) phase_time = taketime();
+  LASreader* lasreader = lasreadopener.open(number);
+  if (!lasreader)
+  {
+    file.missing = TRUE;
+    return;
+  }
+  if (timed)
+  {
+    file.timing.seconds[VALIDATE_PHASE_HEADER] = taketime()-phase_time-lasreader->vlrs_seconds;
+    file.timing.seconds[VALIDATE_PHASE_VLRS] = lasreader->vlrs_seconds;
+  }
+
+  // get a pointer to the header
+
+  LASheader* lasheader = &lasreader->header;
+
+  CHAR crsdescription[512];
+  strcpy(crsdescription, "not valid or not specified");
+
+  // the inventory of the points that LAScheck collects is also what a repair needs
+
+  LAScheck* lascheck = 0;
+
+  if (!lasheader->fails)
+  {
+    // header was loaded. now parse and check.
+
+    lascheck = new LAScheck(lasheader, header_only || chunks_only);
+
+    // the points can be read in ranges by several threads
+
+    std::vector<I64> starts;
+
+    if (header_only)
+    {
+      // the checks that need the points are reported as not evaluated
+    }
+    else if (chunks_only)
+    {
+      if (timed) phase_time = taketime();
+      check_structure(lasreadopener, number, lasreader, lasheader, point_cores);
+      if (timed) file.timing.seconds[VALIDATE_PHASE_DECODE] = taketime()-phase_time;
+    }
+    else if ((sample.chunks != 0.0) && parse_sample(lasreader, *lascheck, sample, timing))
+    {
+      file.sampled = TRUE;
+    }
+    else if ((point_cores > 1) && (split_points(lasreader, point_cores, starts) > 1) && parse_ranges(lasreadopener, number, lasreader, *lascheck, starts, timing))
+    {
+      // the ranges were read by several threads
+    }
+    else
+    {
+      // a short batch means that all points were read or that reading failed
+
+      LASpointBatch laspointbatch;
+      if (laspointbatch.init(&lasreader->point, VALIDATE_BATCH_SIZE))
+      {
+        U32 n;
+        do
+        {
+          n = read_and_parse(lasreader, VALIDATE_BATCH_SIZE, &laspointbatch, lascheck, timing);
+        } while (n == VALIDATE_BATCH_SIZE);
+      }
+    }
+
+    // check header and points and get CRS description
+
+    if (timed) phase_time = taketime();
+    lascheck->check(lasheader, crsdescription, no_CRS_fail);
+    if (timed)
+    {
+      file.timing.seconds[VALIDATE_PHASE_CHECK] = taketime()-phase_time-lascheck->get_crs_seconds();
+      file.timing.seconds[VALIDATE_PHASE_CRS] = lascheck->get_crs_seconds();
+    }
+  }
+
+  // the verdict
+
+  file.pass = (lasheader->fails ? VALIDATE_FAIL : VALIDATE_PASS);
+  if (lasheader->warnings) file.pass |= VALIDATE_WARNING;
+
+  // the report is formatted here so that the writer thread only writes
+
+  LASreportHeader reportheader;
+  reportheader.set(lasheader);
+
+  if (lasreport)
+  {
+    file.record = new LASreportRecord;
+    lasreport->format(file.record, lasreadopener.get_file_name(number), lasreadopener.get_path(number), &reportheader, lasheader, crsdescription, verdict(file.pass));
+  }
+
+  // a header that could not be loaded has no points to repair it with
+
+  if ((file.pass != VALIDATE_PASS) && repair && lascheck)
+  {
+    if (timed) phase_time = taketime();
+    LASrepair lasrepair;
+    file.repaired = lasrepair.repair_header(lasheader, lascheck->get_inventory(), lasreadopener.get_path(number));
+    if (timed) file.timing.seconds[VALIDATE_PHASE_REPAIR] = taketime()-phase_time;
+  }
+
+  // a repaired file has changed and is validated again next time
+
+  if (fingerprinted && !file.repaired)
+  {
+    lascache->add(lasreadopener.get_path(number), &fingerprint, options, file.pass, lasheader, crsdescription, &reportheader);
+  }
+
+  if (lascheck) delete lascheck;
+
+  lasreader->close();
+  delete lasreader;
+
+  if (timed) file.time = taketime()-start_time;
+}
+
 int main(int argc, char *argv[])
 {
   int i;
   BOOL verbose = FALSE;
-  F64 start_time = 0.0;
   F64 full_start_time = 0.0;
   BOOL no_CRS_fail = FALSE;
   U32 num_pass = 0;
   U32 num_fail = 0;
   U32 num_warning = 0;
   BOOL repair = FALSE;
+  BOOL header_only = FALSE;
+  BOOL chunks_only = FALSE;
   I32 cores = 1;
+  CHAR* cache_file_name = 0;
+  BOOL rebuild_cache = FALSE;
+  CHAR* xml_file_name = 0;
+  CHAR* json_file_name = 0;
+  CHAR* timing_file_name = 0;
+  LASvalidateSample sample;
+  std::vector<CHAR*> directories;
+  BOOL recursive = FALSE;
+  BOOL filtered = FALSE;
 
   LASreadOpener lasreadopener;
 
@@ -128,6 +714,86 @@ int main(int argc, char *argv[])
       } while (i < argc && *argv[i] != '-');
       i-=1;
     }
+    else if (strcmp(argv[i],"-lof") == 0)
+    {
+      if ((i+1) >= argc)
+      {
+        fprintf(stderr,"ERROR: '%s' needs 1 argument: list_of_files or '-' for stdin\n", argv[i]);
+        usage(LAS_VALIDATE_WRONG_COMMAND_LINE_SYNTAX);
+      }
+      i++;
+      // files listed more than once are validated only once
+      if (!lasreadopener.add_list_of_files(argv[i], TRUE))
+      {
+        byebye(LAS_VALIDATE_INPUT_FILE_NOT_FOUND);
+      }
+    }
+    else if (strcmp(argv[i],"-i_dir") == 0)
+    {
+      if ((i+1) >= argc)
+      {
+        fprintf(stderr,"ERROR: '%s' needs 1 argument: directory\n", argv[i]);
+        usage(LAS_VALIDATE_WRONG_COMMAND_LINE_SYNTAX);
+      }
+      i++;
+      directories.push_back(argv[i]);
+    }
+    else if (strcmp(argv[i],"-recursive") == 0)
+    {
+      recursive = TRUE;
+    }
+    else if (strcmp(argv[i],"-ext") == 0)
+    {
+      if ((i+1) >= argc)
+      {
+        fprintf(stderr,"ERROR: '%s' needs 1 argument: extensions (e.g. las,laz)\n", argv[i]);
+        usage(LAS_VALIDATE_WRONG_COMMAND_LINE_SYNTAX);
+      }
+      i++;
+      lasreadopener.set_extensions(argv[i]);
+      filtered = TRUE;
+    }
+    else if (strcmp(argv[i],"-exclude") == 0)
+    {
+      if ((i+1) >= argc)
+      {
+        fprintf(stderr,"ERROR: '%s' needs 1 argument: wild_card\n", argv[i]);
+        usage(LAS_VALIDATE_WRONG_COMMAND_LINE_SYNTAX);
+      }
+      i++;
+      lasreadopener.add_exclude(argv[i]);
+      filtered = TRUE;
+    }
+    else if (strcmp(argv[i],"-o") == 0)
+    {
+      if ((i+1) >= argc)
+      {
+        fprintf(stderr,"ERROR: '%s' needs 1 argument: file_name\n", argv[i]);
+        usage(LAS_VALIDATE_WRONG_COMMAND_LINE_SYNTAX);
+      }
+      i++;
+      xml_file_name = argv[i];
+    }
+    else if (strcmp(argv[i],"-json") == 0)
+    {
+      if ((i+1) >= argc)
+      {
+        fprintf(stderr,"ERROR: '%s' needs 1 argument: file_name\n", argv[i]);
+        usage(LAS_VALIDATE_WRONG_COMMAND_LINE_SYNTAX);
+      }
+      i++;
+      json_file_name = argv[i];
+    }
+    else if (strcmp(argv[i],"-timing_csv") == 0)
+    {
+      if ((i+1) >= argc)
+      {
+        fprintf(stderr,"ERROR: '%s' needs 1 argument: file_name\n", argv[i]);
+        usage(LAS_VALIDATE_WRONG_COMMAND_LINE_SYNTAX);
+      }
+      i++;
+      timing_file_name = argv[i];
+    }
     else if (strcmp(argv[i],"-no_CRS_fail") == 0)
     {
       no_CRS_fail = TRUE;
@@ -142,10 +808,65 @@ int main(int argc, char *argv[])
       i++;
       cores = stoi(argv[i]);
     }
+    else if (strcmp(argv[i],"-mmap") == 0)
+    {
+      lasreadopener.set_mmap(TRUE);
+    }
     else if (strcmp(argv[i],"-repair_unbuffered") == 0)
     {
       repair = TRUE;
     }
+    else if (strcmp(argv[i],"-header_only") == 0)
+    {
+      header_only = TRUE;
+    }
+    else if (strcmp(argv[i],"-chunks_only") == 0)
+    {
+      chunks_only = TRUE;
+    }
+    else if (strcmp(argv[i],"-cache") == 0)
+    {
+      if ((i+1) >= argc)
+      {
+        fprintf(stderr,"ERROR: '%s' needs 1 argument: file_name\n", argv[i]);
+        usage(LAS_VALIDATE_WRONG_COMMAND_LINE_SYNTAX);
+      }
+      i++;
+      cache_file_name = argv[i];
+    }
+    else if (strcmp(argv[i],"-rebuild_cache") == 0)
+    {
+      rebuild_cache = TRUE;
+    }
+    else if (strcmp(argv[i],"-sample_chunks") == 0)
+    {
+      if ((i+1) >= argc)
+      {
+        fprintf(stderr,"ERROR: '%s' needs 1 argument: percentage (e.g. 5%%) or number of chunks\n", argv[i]);
+        usage(LAS_VALIDATE_WRONG_COMMAND_LINE_SYNTAX);
+      }
+      i++;
+      sample.chunks = atof(argv[i]);
+      if (sample.chunks <= 0.0)
+      {
+        fprintf(stderr,"ERROR: cannot sample '%s' chunks\n", argv[i]);
+        usage(LAS_VALIDATE_WRONG_COMMAND_LINE_SYNTAX);
+      }
+      if (argv[i][strlen(argv[i])-1] == '%')
+      {
+        sample.chunks = -sample.chunks;
+      }
+    }
+    else if (strcmp(argv[i],"-sample_seed") == 0)
+    {
+      if ((i+1) >= argc)
+      {
+        fprintf(stderr,"ERROR: '%s' needs 1 argument: seed\n", argv[i]);
+        usage(LAS_VALIDATE_WRONG_COMMAND_LINE_SYNTAX);
+      }
+      i++;
+      sample.seed = (U64)strtoull(argv[i], 0, 10);
+    }
     else
     {
       fprintf(stderr, "ERROR: cannot understand argument '%s'\n", argv[i]);
@@ -157,6 +878,22 @@ int main(int argc, char *argv[])
 
   if (verbose) full_start_time = taketime();
 
+  // directories are walked once all options are known. their files start largest first
+
+  for (i = 0; i < (int)directories.size(); i++)
+  {
+    if (!lasreadopener.add_directory(directories[i], recursive))
+    {
+      byebye(LAS_VALIDATE_INPUT_FILE_NOT_FOUND);
+    }
+  }
+
+  if (directories.size() == 0)
+  {
+    if (recursive) fprintf(stderr,"WARNING: '-recursive' is ignored without '-i_dir'\n");
+    if (filtered) fprintf(stderr,"WARNING: '-ext' and '-exclude' are ignored without '-i_dir'\n");
+  }
+
   // check input
 
   if (!lasreadopener.is_active())
@@ -165,101 +902,296 @@ int main(int argc, char *argv[])
     byebye(LAS_VALIDATE_NO_INPUT_SPECIFIED);
   }
 
-  // accumulated pass
-
-  U32 total_pass = VALIDATE_PASS;
+  // without the inventory of the points there is nothing to repair the header with
 
-  // loop over files
+  if (header_only && chunks_only)
+  {
+    chunks_only = FALSE;
+  }
 
-  for (i = 0; i < lasreadopener.get_file_name_number(); i++)
+  if ((header_only || chunks_only) && repair)
+  {
+    fprintf(stderr,"WARNING: '-repair_unbuffered' is ignored with '%s'\n", (header_only ? "-header_only" : "-chunks_only"));
+    repair = FALSE;
+  }
+  else if ((sample.chunks != 0.0) && repair)
   {
-    // in very verbose mode we measure the time for each file
+    fprintf(stderr,"WARNING: '-repair_unbuffered' is ignored with '-sample_chunks'\n");
+    repair = FALSE;
+  }
 
-    if (verbose) start_time = taketime();
+  // the verdicts of earlier runs. entries from other versions of LAScheck are discarded
 
-    // open lasreader
+  LAScache* lascache = 0;
 
-    LASreader* lasreader = lasreadopener.open(i);
-    if (!lasreader)
+  if (cache_file_name)
+  {
+    lascache = new LAScache();
+    if (!lascache->open(cache_file_name, rebuild_cache))
     {
-      fprintf(stderr, "ERROR: could not open lasreader\n");
-      byebye(LAS_VALIDATE_INPUT_FILE_NOT_FOUND);
+      delete lascache;
+      lascache = 0;
     }
+  }
+  else if (rebuild_cache)
+  {
+    fprintf(stderr,"WARNING: '-rebuild_cache' is ignored without '-cache'\n");
+  }
 
-    // get a pointer to the header
-    LASheader* lasheader = &lasreader->header;
+  // one line with the time of each phase per file
 
-    CHAR crsdescription[512];
-    strcpy(crsdescription, "not valid or not specified");
+  FILE* timing_file = 0;
 
-    if (!lasheader->fails)
+  if (timing_file_name)
+  {
+    timing_file = fopen(timing_file_name, "w");
+    if (timing_file == 0)
     {
-      // header was loaded. now parse and check.
+      fprintf(stderr,"ERROR: cannot open '%s' for writing\n", timing_file_name);
+      byebye(LAS_VALIDATE_UNKNOWN_ERROR);
+    }
+    fprintf(timing_file, "file,verdict,cached,sampled,points,total");
+    for (i = 0; i < VALIDATE_PHASES; i++) fprintf(timing_file, ",%s", validate_phase_names[i]);
+    fprintf(timing_file, "\n");
+  }
 
-      LAScheck lascheck(lasheader);
+  LASvalidateTiming total_timing;
 
-      while (lasreader->read_point())
-      {
-        lascheck.parse(&lasreader->point);
-      }
+  // the reports are written by a thread of their own
 
-      // check header and points and get CRS description
+  LASreport* lasreport = 0;
 
-      lascheck.check(lasheader, crsdescription, no_CRS_fail);
+  if (xml_file_name || json_file_name)
+  {
+    lasreport = new LASreport();
+    if ((xml_file_name && !lasreport->open_xml(xml_file_name)) || (json_file_name && !lasreport->open_json(json_file_name)))
+    {
+      byebye(LAS_VALIDATE_UNKNOWN_ERROR);
     }
+    lasreport->start();
+  }
+
+  // LAZ decoders can skip the layers of LAS 1.4 points that the checks do not look at
+
+  lasreadopener.set_decompress_selective(LAScheck::get_decompress_selective());
+
+  // accumulated pass
+
+  U32 total_pass = VALIDATE_PASS;
+
+  // per-file outcomes are collected here so that they can be reported in input
+  // order. file i uses entry i % VALIDATE_REPORT_WINDOW, which is free again
+  // once file i - VALIDATE_REPORT_WINDOW was reported
+
+  U32 file_number = lasreadopener.get_file_name_number();
+  std::vector<LASvalidateFile> files(file_number < VALIDATE_REPORT_WINDOW ? file_number : VALIDATE_REPORT_WINDOW);
+  U32 next_report = 0;
+  U32 reported = 0;
+  U32 missing_file = U32_MAX;
+
+  if (cores < 1) cores = 1;
+  I32 file_cores = cores;
+  if ((U32)file_cores > file_number) file_cores = (file_number ? file_number : 1);
+
+  // cores not needed for the files read the points of each file in parallel
+
+  I32 point_cores = cores / file_cores;
+#ifdef _OPENMP
+  if (point_cores > 1) omp_set_max_active_levels(2);
+#endif
+
+  // loop over files. each worker owns its own LASreader, LAScheck, and LASrepair
+  // and idle workers pick up the next queued file as soon as they are done
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(file_cores)
+  for (i = 0; i < (int)file_number; i++)
+  {
+    // no worker runs too far ahead of the first file that is not reported yet
+    // so that its entry of the ring is free. the worker of that file is never
+    // waiting
+
+    U32 first;
+    do
+    {
+#pragma omp atomic read
+      first = reported;
+      if ((U32)i < first + VALIDATE_REPORT_WINDOW) break;
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    } while (TRUE);
+
+    U32 missing;
+#pragma omp atomic read
+    missing = missing_file;
+
+    // after a file could not be opened no further files are started. the
+    // reports end with that file so nothing is noted for them
 
-    // report the verdict
+    if ((U32)i >= missing)
+    {
+      continue;
+    }
 
-    U32 pass = (lasheader->fails ? VALIDATE_FAIL : VALIDATE_PASS);
-    if (lasheader->warnings) pass |= VALIDATE_WARNING;
+    LASvalidateFile& slot = files[i % VALIDATE_REPORT_WINDOW];
+    validate_file(lasreadopener, i, slot, no_CRS_fail, header_only, chunks_only, sample, repair, (verbose || timing_file), point_cores, lascache, lasreport);
 
-    if (pass != VALIDATE_PASS)
+#pragma omp critical (report)
     {
-      BOOL success;
-      total_pass |= pass;
-      if (pass & VALIDATE_FAIL)
+      slot.done = TRUE;
+      if (slot.missing && ((U32)i < missing_file))
       {
-        if (repair)
-        {
-          LASrepair lasrepair;
-          success = lasrepair.repair_header(lasreader, lasreadopener.get_file_name());
-        }
-        if (success == 0) {num_fail++;};
+#pragma omp atomic write
+        missing_file = i;
       }
-      else
+
+      // report all consecutive files that are done
+
+      while ((next_report < file_number) && files[next_report % VALIDATE_REPORT_WINDOW].done)
       {
-        if (repair)
+        LASvalidateFile* file = &files[next_report % VALIDATE_REPORT_WINDOW];
+        if (file->missing)
+        {
+          fprintf(stderr, "ERROR: could not open lasreader\n");
+          next_report = file_number;
+          break;
+        }
+        if (file->pass != VALIDATE_PASS)
+        {
+          total_pass |= file->pass;
+          if (!file->repaired)
+          {
+            if (file->pass & VALIDATE_FAIL)
+            {
+              num_fail++;
+            }
+            else
+            {
+              num_warning++;
+            }
+          }
+        }
+        else
+        {
+          num_pass++;
+        }
+
+        // the writer thread takes over the report
+
+        if (file->record)
+        {
+          lasreport->write(file->record);
+          file->record = 0;
+        }
+
+        total_timing.add(file->timing);
+
+        if (timing_file)
+        {
+          // the path is quoted for CSV
+          fprintf(timing_file, "\"");
+          const CHAR* c;
+          for (c = lasreadopener.get_path(next_report); *c; c++)
+          {
+            if (*c == '"') fputc('"', timing_file);
+            fputc(*c, timing_file);
+          }
+#ifdef _WIN32
+          fprintf(timing_file, "\",%s,%d,%d,%I64d,%.6f", verdict(file->pass), (file->cached ? 1 : 0), (file->sampled ? 1 : 0), file->timing.points, file->time);
+#else
+          fprintf(timing_file, "\",%s,%d,%d,%lld,%.6f", verdict(file->pass), (file->cached ? 1 : 0), (file->sampled ? 1 : 0), file->timing.points, file->time);
+#endif
+          I32 p;
+          for (p = 0; p < VALIDATE_PHASES; p++) fprintf(timing_file, ",%.6f", file->timing.seconds[p]);
+          fprintf(timing_file, "\n");
+        }
+
+        // in verbose mode we report the time for each file
+
+        if (verbose)
         {
-          LASrepair lasrepair;
-          success = lasrepair.repair_header(lasreader, lasreadopener.get_file_name());
+          fprintf(stdout,"done with '%s'. took %.2f sec. : %s%s%s%s\n", lasreadopener.get_file_name(next_report), file->time, verdict(file->pass), ((header_only || chunks_only) ? " (points not evaluated)" : ""), (file->sampled ? " (sampled chunks)" : ""), (file->cached ? " (cached)" : ""));
         }
-        if (success == 0) {num_warning++;};
+
+        // the entry is reused by file next_report + VALIDATE_REPORT_WINDOW
+
+        *file = LASvalidateFile();
+        next_report++;
       }
+#pragma omp atomic write
+      reported = next_report;
     }
-    else
-    {
-      num_pass++;
-    }
+  }
+
+  if (lascache)
+  {
+    lascache->close();
+    delete lascache;
+  }
 
-    lasreader->close();
-    delete lasreader;
+  if (timing_file)
+  {
+    fclose(timing_file);
+  }
 
-    // in verbose mode we report the time for each file
+  // totals, version, and command line end the report
 
-    if (verbose)
+  if (lasreport)
+  {
+    CHAR version[256];
+    sprintf(version, "%d built with LASread version %d.%d (%d) and LAScheck version %d.%d (%d)", VALIDATE_VERSION, LASREAD_VERSION_MAJOR, LASREAD_VERSION_MINOR, LASREAD_BUILD_DATE, LASCHECK_VERSION_MAJOR, LASCHECK_VERSION_MINOR, LASCHECK_BUILD_DATE);
+    std::string command_line;
+    for (i = 0; i < argc; i++)
+    {
+      if (i) command_line.push_back(' ');
+      command_line.append(argv[i]);
+    }
+    lasreport->close(verdict(total_pass), num_pass, num_warning, num_fail, version, command_line.c_str());
+    delete lasreport;
+    // the files validated after one that could not be opened are not reported
+    for (i = 0; i < (int)files.size(); i++)
     {
-      fprintf(stdout,"done with '%s'. took %.2f sec. : %s\n", lasreadopener.get_file_name(), taketime()-start_time, (pass == VALIDATE_PASS ? "pass" : ((pass & VALIDATE_FAIL) ? "fail" : "warning")));
-      start_time = taketime();
+      if (files[i].record) delete files[i].record;
     }
   }
 
+  if (missing_file != U32_MAX)
+  {
+    byebye(LAS_VALIDATE_INPUT_FILE_NOT_FOUND);
+  }
+
   // in verbose mode we report the total time
 
-  if (verbose && (lasreadopener.get_file_name_number() > 1))
+  if (verbose && (file_number > 1))
   {
     fprintf(stdout,"done. total time %.2f sec. total %s (pass=%d, warning=%d, fail=%d)\n", taketime()-full_start_time, (total_pass == 0 ? "pass" : ((total_pass & 1) ? "fail" : "warning")), num_pass, num_warning, num_fail);
   }
 
+  // in verbose mode we report where the time went. the phases are summed over
+  // all files and threads and can therefore add up to more than the total time
+
+  if (verbose)
+  {
+    fprintf(stdout,"phases:");
+    for (i = 0; i < VALIDATE_PHASES; i++) fprintf(stdout," %s %.2f", validate_phase_names[i], total_timing.seconds[i]);
+    fprintf(stdout," sec.\n");
+    if (total_timing.points)
+    {
+      F64 wall = taketime()-full_start_time;
+#ifdef _WIN32
+      fprintf(stdout,"points: %I64d read at %.2f million points/sec. decoding and %.2f million points/sec. overall\n", total_timing.points, (total_timing.seconds[VALIDATE_PHASE_DECODE] > 0.0 ? total_timing.points/total_timing.seconds[VALIDATE_PHASE_DECODE]/1e6 : 0.0), (wall > 0.0 ? total_timing.points/wall/1e6 : 0.0));
+#else
+      fprintf(stdout,"points: %lld read at %.2f million points/sec. decoding and %.2f million points/sec. overall\n", total_timing.points, (total_timing.seconds[VALIDATE_PHASE_DECODE] > 0.0 ? total_timing.points/total_timing.seconds[VALIDATE_PHASE_DECODE]/1e6 : 0.0), (wall > 0.0 ? total_timing.points/wall/1e6 : 0.0));
+#endif
+    }
+    if (CRScache::get_lookups())
+    {
+#ifdef _WIN32
+      fprintf(stdout,"CRS: %I64d of %I64d checks replayed from earlier files with identical GeoKeys and OGC WKT (%.1f%% hit rate)\n", (I64)CRScache::get_hits(), (I64)CRScache::get_lookups(), 100.0*CRScache::get_hits()/CRScache::get_lookups());
+#else
+      fprintf(stdout,"CRS: %lld of %lld checks replayed from earlier files with identical GeoKeys and OGC WKT (%.1f%% hit rate)\n", (I64)CRScache::get_hits(), (I64)CRScache::get_lookups(), 100.0*CRScache::get_hits()/CRScache::get_lookups());
+#endif
+    }
+  }
+
   byebye(LAS_VALIDATE_SUCCESS, FALSE);
 
   return 0;
@@ -99,10 +99,22 @@ SOURCE=.\crscheck.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\crswkt.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\lascache.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\lascheck.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\lasreport.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\lasvalidate.cpp
 # End Source File
 # Begin Source File
@@ -119,10 +131,26 @@ SOURCE=.\crscheck.hpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\crsepsg.hpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\crswkt.hpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\lascache.hpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\lascheck.hpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\lasreport.hpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\lasread\inc\lasdefinitions.hpp
 # End Source File
 # Begin Source File
@@ -30,10 +30,14 @@
 */
 #include "xmlwriter.hpp"
 
+#include <stdarg.h>
+#include <string.h>
+
 XMLwriter::XMLwriter()
 {
   sub = FALSE;
   file = 0;
+  buffer = 0;
 }
 
 XMLwriter::~XMLwriter()
@@ -43,7 +47,88 @@ XMLwriter::~XMLwriter()
 
 BOOL XMLwriter::is_open() const
 {
-  return (BOOL)(file != 0);
+  return (BOOL)((file != 0) || (buffer != 0));
+}
+
+void XMLwriter::print(const CHAR* format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  if (buffer)
+  {
+    CHAR line[1024];
+    I32 len = vsnprintf(line, 1024, format, args);
+    if (len >= 1024)
+    {
+      // a long note or path
+      va_end(args);
+      va_start(args, format);
+      std::string longer(len + 1, '\0');
+      vsnprintf(&longer[0], len + 1, format, args);
+      buffer->append(longer.c_str(), len);
+    }
+    else if (len > 0)
+    {
+      buffer->append(line, len);
+    }
+  }
+  else
+  {
+    vfprintf(file, format, args);
+  }
+  va_end(args);
+}
+
+const CHAR* XMLwriter::escape(const CHAR* value)
+{
+  // file names, header strings, and notes may contain markup characters. they
+  // may also contain control characters (not allowed in XML 1.0, replaced by
+  // '?') and bytes above 0x7F (taken as Latin-1, like for the JSON report, and
+  // encoded in UTF-8)
+  const CHAR* c;
+  for (c = value; *c; c++)
+  {
+    if (((U8)*c < 0x20) || ((U8)*c > 0x7E) || strchr("<>&\"", *c)) break;
+  }
+  if (*c == '\0')
+  {
+    return value;
+  }
+  escaped.clear();
+  for (; *value; value++)
+  {
+    U8 v = (U8)*value;
+    switch (v)
+    {
+    case '<':
+      escaped.append("&lt;");
+      break;
+    case '>':
+      escaped.append("&gt;");
+      break;
+    case '&':
+      escaped.append("&amp;");
+      break;
+    case '"':
+      escaped.append("&quot;");
+      break;
+    default:
+      if ((v < 0x20) || (v == 0x7F))
+      {
+        escaped.push_back('?');
+      }
+      else if (v > 0x7F)
+      {
+        escaped.push_back((CHAR)(0xC0 | (v >> 6)));
+        escaped.push_back((CHAR)(0x80 | (v & 0x3F)));
+      }
+      else
+      {
+        escaped.push_back((CHAR)v);
+      }
+    }
+  }
+  return escaped.c_str();
 }
 
 BOOL XMLwriter::open(const CHAR* file_name, const CHAR* key)
@@ -56,19 +141,44 @@ BOOL XMLwriter::open(const CHAR* file_name, const CHAR* key)
       fprintf(stderr,"ERROR: cannot open XML file '%s'\n", file_name);
       return FALSE;
     }
+    // reports of large batches are written in big blocks
+    setvbuf(file, 0, _IOFBF, 1 << 20);
   }
   else
   {
     file = stdout;
   }
-  fprintf(file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\012");
-  fprintf(file, "<%s>\012", key);
+  print("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\012");
+  print("<%s>\012", key);
+  return TRUE;
+}
+
+BOOL XMLwriter::open(std::string* buffer)
+{
+  if (buffer == 0)
+  {
+    return FALSE;
+  }
+  this->buffer = buffer;
+  return TRUE;
+}
+
+BOOL XMLwriter::insert(const std::string& buffer)
+{
+  if (this->buffer)
+  {
+    this->buffer->append(buffer);
+  }
+  else
+  {
+    fwrite(buffer.c_str(), 1, buffer.size(), file);
+  }
   return TRUE;
 }
 
 BOOL XMLwriter::begin(const CHAR* key)
 {
-  fprintf(file, "  <%s>\012", key);
+  print("  <%s>\012", key);
   return TRUE;
 }
 
@@ -79,7 +189,7 @@ BOOL XMLwriter::beginsub(const CHAR* key)
     return FALSE;
   }
   sub = TRUE;
-  fprintf(file, "    <%s>\012", key);
+  print("    <%s>\012", key);
   return TRUE;
 }
 
@@ -87,11 +197,11 @@ BOOL XMLwriter::write(const CHAR* value)
 {
   if (sub)
   {
-    fprintf(file, "      %s\012", value);
+    print("      %s\012", escape(value));
   }
   else
   {
-    fprintf(file, "    %s\012", value);
+    print("    %s\012", escape(value));
   }
   return TRUE;
 }
@@ -100,11 +210,11 @@ BOOL XMLwriter::write(int value)
 {
   if (sub)
   {
-    fprintf(file, "      %d\012", value);
+    print("      %d\012", value);
   }
   else
   {
-    fprintf(file, "    %d\012", value);
+    print("    %d\012", value);
   }
   return TRUE;
 }
@@ -113,11 +223,11 @@ BOOL XMLwriter::write(const CHAR* key, const CHAR* value)
 {
   if (sub)
   {
-    fprintf(file, "      <%s>%s</%s>\012", key, value, key);
+    print("      <%s>%s</%s>\012", key, escape(value), key);
   }
   else
   {
-    fprintf(file, "    <%s>%s</%s>\012", key, value, key);
+    print("    <%s>%s</%s>\012", key, escape(value), key);
   }
   return TRUE;
 }
@@ -126,11 +236,11 @@ BOOL XMLwriter::write(const CHAR* key, I32 value)
 {
   if (sub)
   {
-    fprintf(file, "      <%s>%d</%s>\012", key, value, key);
+    print("      <%s>%d</%s>\012", key, value, key);
   }
   else
   {
-    fprintf(file, "    <%s>%d</%s>\012", key, value, key);
+    print("    <%s>%d</%s>\012", key, value, key);
   }
   return TRUE;
 }
@@ -139,23 +249,23 @@ BOOL XMLwriter::write(const CHAR* variable, const CHAR* key, const CHAR* note)
 {
   if (sub)
   {
-    fprintf(file, "      <%s>\012", key);
-    fprintf(file, "        <variable>%s</variable>\012", variable);
+    print("      <%s>\012", key);
+    print("        <variable>%s</variable>\012", escape(variable));
     if (note)
     {
-      fprintf(file, "        <note>%s</note>\012", note);
+      print("        <note>%s</note>\012", escape(note));
     }
-    fprintf(file, "      </%s>\012", key);
+    print("      </%s>\012", key);
   }
   else
   {
-    fprintf(file, "    <%s>\012", key);
-    fprintf(file, "      <variable>%s</variable>\012", variable);
+    print("    <%s>\012", key);
+    print("      <variable>%s</variable>\012", escape(variable));
     if (note)
     {
-      fprintf(file, "      <note>%s</note>\012", note);
+      print("      <note>%s</note>\012", escape(note));
     }
-    fprintf(file, "    </%s>\012", key);
+    print("    </%s>\012", key);
   }
   return TRUE;
 }
@@ -167,19 +277,24 @@ BOOL XMLwriter::endsub(const CHAR* key)
     return FALSE;
   }
   sub = FALSE;
-  fprintf(file, "    </%s>\012", key);
+  print("    </%s>\012", key);
   return TRUE;
 }
 
 BOOL XMLwriter::end(const CHAR* key)
 {
-  fprintf(file, "  </%s>\012", key);
+  print("  </%s>\012", key);
   return TRUE;
 }
 
 BOOL XMLwriter::close(const CHAR* key)
 {
-  fprintf(file, "</%s>\012", key);
+  if (buffer)
+  {
+    buffer = 0;
+    return TRUE;
+  }
+  print("</%s>\012", key);
   if (file != stdout) fclose(file);
   file = 0;
   return TRUE;
@@ -24,6 +24,8 @@
   
   CHANGE HISTORY:
   
+    18 October 2026 -- escapes control characters and encodes Latin-1 in UTF-8
+    18 October 2026 -- can write into a memory buffer and escapes values
     1 April 2013 -- on Easter Monday all-nighting in Perth airport for PER->SYD
 
 ===============================================================================
@@ -34,6 +36,7 @@
 #include "mydefs.hpp"
 
 #include <stdio.h>
+#include <string>
 
 class XMLwriter
 {
@@ -41,6 +44,10 @@ public:
 
   BOOL is_open() const;
   BOOL open(const CHAR* file_name, const CHAR* key);
+  // writes elements into a buffer (without the XML declaration) that is later
+  // inserted into a file with insert()
+  BOOL open(std::string* buffer);
+  BOOL insert(const std::string& buffer);
   BOOL begin(const CHAR* key);
   BOOL beginsub(const CHAR* key);
   BOOL write(I32 value);
@@ -56,8 +63,12 @@ public:
   ~XMLwriter();
 
 private:
+  void print(const CHAR* format, ...);
+  const CHAR* escape(const CHAR* value);
   BOOL sub;
   FILE* file;
+  std::string* buffer;
+  std::string escaped;
 };
 
 #endif
@@ -0,0 +1,170 @@
+/*
+===============================================================================
+
+  FILE:  bench_decode.cpp
+
+  CONTENTS:
+
+    Times decoding LAZ files whose chunks hold a single point so that most of
+    the time goes into restarting the decoder at each chunk, which resets all
+    arithmetic models of the point. the chunks of the layered test files are
+    repeated to make a file of the requested number of chunks. its chunk
+    table is missing, as if the compressor was interrupted, so the reader
+    builds it while reading. every decoded point is compared with the point
+    that its chunk holds.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created for timing the restart of the decoder at each chunk
+
+===============================================================================
+*/
+#include "lasbench.hpp"
+#include "lasreader.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// the layout of the layered files (see test/data/README.txt)
+
+#define BENCH_DECODE_LAYERED_POINTS 5
+#define BENCH_DECODE_CHUNK_BYTES 74
+
+static const CHAR* bench_decode_files[] = { "layered_v3.laz", "layered_v4.laz" };
+
+static BOOL bench_decode_load(const CHAR* name, std::string& bytes)
+{
+  std::string file_name = std::string(LASBENCH_DATA_DIR) + "/" + name;
+  FILE* file = fopen(file_name.c_str(), "rb");
+  if (file == 0)
+  {
+    fprintf(stderr, "cannot open '%s'\n", file_name.c_str());
+    return FALSE;
+  }
+  CHAR buffer[4096];
+  size_t size;
+  bytes.clear();
+  while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0)
+  {
+    bytes.append(buffer, size);
+  }
+  fclose(file);
+  return TRUE;
+}
+
+// the header and the VLRs of the layered file followed by number of its chunks
+
+static BOOL bench_decode_file(const CHAR* name, const U32 number, std::string& bytes)
+{
+  std::string layered;
+  if (!bench_decode_load(name, layered))
+  {
+    return FALSE;
+  }
+  U32 offset_to_point_data;
+  memcpy(&offset_to_point_data, &layered[96], 4);
+  const size_t chunks_start = (size_t)offset_to_point_data + 8;
+  if (layered.size() < chunks_start + BENCH_DECODE_LAYERED_POINTS*BENCH_DECODE_CHUNK_BYTES)
+  {
+    fprintf(stderr, "'%s' is too short\n", name);
+    return FALSE;
+  }
+  bytes.assign(layered, 0, chunks_start);
+  bytes.reserve(chunks_start + (size_t)number*BENCH_DECODE_CHUNK_BYTES);
+  U32 i;
+  for (i = 0; i < number; i++)
+  {
+    bytes.append(layered, chunks_start + (i % BENCH_DECODE_LAYERED_POINTS)*BENCH_DECODE_CHUNK_BYTES, BENCH_DECODE_CHUNK_BYTES);
+  }
+  // no chunk table and the number of points of LAS 1.4
+  I64 chunk_table_start = (I64)offset_to_point_data;
+  memcpy(&bytes[offset_to_point_data], &chunk_table_start, 8);
+  U64 number_of_point_records = number;
+  memcpy(&bytes[247], &number_of_point_records, 8);
+  return TRUE;
+}
+
+// decodes all points once. returns the number of points that were decoded
+// and were equal to the uncompressed point of their chunk
+
+static U32 bench_decode_read(const std::string& bytes, const std::string& layered)
+{
+  std::istringstream stream(bytes);
+  LASreader lasreader;
+  if (!lasreader.open(stream))
+  {
+    return 0;
+  }
+  U32 offset_to_point_data;
+  memcpy(&offset_to_point_data, &layered[96], 4);
+  const size_t chunks_start = (size_t)offset_to_point_data + 8;
+  U32 count = 0;
+  while (lasreader.read_point())
+  {
+    I32 X;
+    memcpy(&X, &layered[chunks_start + (count % BENCH_DECODE_LAYERED_POINTS)*BENCH_DECODE_CHUNK_BYTES], 4);
+    if (lasreader.point.get_X() != X)
+    {
+      break;
+    }
+    count++;
+  }
+  lasreader.close();
+  return count;
+}
+
+BOOL bench_decode(const U32 number, const U32 repeats)
+{
+  U32 f, r;
+  BOOL success = TRUE;
+  fprintf(stderr, "%u chunks of one point decoded %u times (microseconds per chunk)\n", number, repeats);
+  fprintf(stderr, "%-16s %9s %9s %9s\n", "file", "min", "median", "max");
+  for (f = 0; f < sizeof(bench_decode_files)/sizeof(bench_decode_files[0]); f++)
+  {
+    std::string layered, bytes;
+    if (!bench_decode_load(bench_decode_files[f], layered) || !bench_decode_file(bench_decode_files[f], number, bytes))
+    {
+      return FALSE;
+    }
+    std::vector<F64> seconds(repeats);
+    for (r = 0; r < repeats; r++)
+    {
+      F64 start = lasbench_taketime();
+      U32 count = bench_decode_read(bytes, layered);
+      seconds[r] = lasbench_taketime() - start;
+      if (count != number)
+      {
+        fprintf(stderr, "%-16s decoded %u of %u points correctly\n", bench_decode_files[f], count, number);
+        success = FALSE;
+        break;
+      }
+    }
+    if (r < repeats)
+    {
+      continue;
+    }
+    std::sort(seconds.begin(), seconds.end());
+    fprintf(stderr, "%-16s %9.3f %9.3f %9.3f\n", bench_decode_files[f], 1e6 * seconds[0] / number, 1e6 * seconds[repeats/2] / number, 1e6 * seconds[repeats-1] / number);
+  }
+  return success;
+}
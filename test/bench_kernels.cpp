@@ -0,0 +1,176 @@
+/*
+===============================================================================
+
+  FILE:  bench_kernels.cpp
+
+  CONTENTS:
+
+    Times the column kernels of LASinventory::add() for each instruction set
+    that the CPU supports. The columns are processed in blocks of 4096 values
+    as lasvalidate reads them. Every ISA must give the results of the scalar
+    kernels.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created for timing the column kernels of each ISA
+
+===============================================================================
+*/
+#include "lasbench.hpp"
+#include "lastest.hpp"
+#include "laskernels.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#define BENCH_KERNELS_BLOCK 4096
+
+static const CHAR* bench_kernels_isas[] = { "scalar", "sse41", "avx2", "avx512" };
+
+struct BenchKernelsColumns
+{
+  std::vector<I32> X;
+  std::vector<U16> intensity;
+  std::vector<I16> scan_angle;
+  std::vector<I8> scan_angle_rank;
+  std::vector<F64> gps_time;
+};
+
+struct BenchKernelsResult
+{
+  I32 min_X, max_X;
+  U16 min_intensity, max_intensity;
+  I16 min_scan_angle, max_scan_angle;
+  I8 min_scan_angle_rank, max_scan_angle_rank;
+  F64 min_gps_time, max_gps_time;
+  I64 fluff_10, fluff_100, fluff_1000;
+  F64 seconds[6];
+};
+
+// each kernel runs over all blocks before the next one so that its time
+// does not include the others. the first block initializes min and max
+
+template<class T>
+static F64 time_range(void (*range)(const T*, const U32, T*, T*), const std::vector<T>& values, const U32 repeats, T* min, T* max)
+{
+  U32 r, i;
+  const U32 number = (U32)values.size();
+  F64 start = lasbench_taketime();
+  for (r = 0; r < repeats; r++)
+  {
+    *min = *max = values[0];
+    for (i = 0; i < number; i += BENCH_KERNELS_BLOCK)
+    {
+      range(&values[i], ((number - i) < BENCH_KERNELS_BLOCK ? (number - i) : BENCH_KERNELS_BLOCK), min, max);
+    }
+  }
+  return lasbench_taketime() - start;
+}
+
+static F64 time_fluff(const std::vector<I32>& values, const U32 repeats, I64* fluff_10, I64* fluff_100, I64* fluff_1000)
+{
+  U32 r, i;
+  const U32 number = (U32)values.size();
+  F64 start = lasbench_taketime();
+  for (r = 0; r < repeats; r++)
+  {
+    *fluff_10 = *fluff_100 = *fluff_1000 = 0;
+    for (i = 0; i < number; i += BENCH_KERNELS_BLOCK)
+    {
+      laskernels.fluff(&values[i], ((number - i) < BENCH_KERNELS_BLOCK ? (number - i) : BENCH_KERNELS_BLOCK), fluff_10, fluff_100, fluff_1000);
+    }
+  }
+  return lasbench_taketime() - start;
+}
+
+static void run_kernels(const BenchKernelsColumns& columns, const U32 repeats, BenchKernelsResult* result)
+{
+  result->seconds[0] = time_range(laskernels.range_I32, columns.X, repeats, &result->min_X, &result->max_X);
+  result->seconds[1] = time_range(laskernels.range_U16, columns.intensity, repeats, &result->min_intensity, &result->max_intensity);
+  result->seconds[2] = time_range(laskernels.range_I16, columns.scan_angle, repeats, &result->min_scan_angle, &result->max_scan_angle);
+  result->seconds[3] = time_range(laskernels.range_I8, columns.scan_angle_rank, repeats, &result->min_scan_angle_rank, &result->max_scan_angle_rank);
+  result->seconds[4] = time_range(laskernels.range_F64, columns.gps_time, repeats, &result->min_gps_time, &result->max_gps_time);
+  result->seconds[5] = time_fluff(columns.X, repeats, &result->fluff_10, &result->fluff_100, &result->fluff_1000);
+}
+
+static BOOL same_result(const BenchKernelsResult& a, const BenchKernelsResult& b)
+{
+  return (a.min_X == b.min_X) && (a.max_X == b.max_X) &&
+         (a.min_intensity == b.min_intensity) && (a.max_intensity == b.max_intensity) &&
+         (a.min_scan_angle == b.min_scan_angle) && (a.max_scan_angle == b.max_scan_angle) &&
+         (a.min_scan_angle_rank == b.min_scan_angle_rank) && (a.max_scan_angle_rank == b.max_scan_angle_rank) &&
+         (memcmp(&a.min_gps_time, &b.min_gps_time, sizeof(F64)) == 0) && (memcmp(&a.max_gps_time, &b.max_gps_time, sizeof(F64)) == 0) &&
+         (a.fluff_10 == b.fluff_10) && (a.fluff_100 == b.fluff_100) && (a.fluff_1000 == b.fluff_1000);
+}
+
+BOOL bench_kernels(const U32 number, const U32 repeats)
+{
+  // coordinates of a tile in millimeters with some fluff, and attributes
+  // with the value ranges that LAS files typically have
+
+  U64 state = 20261018;
+  U32 i;
+  BenchKernelsColumns columns;
+  columns.X.resize(number);
+  columns.intensity.resize(number);
+  columns.scan_angle.resize(number);
+  columns.scan_angle_rank.resize(number);
+  columns.gps_time.resize(number);
+  for (i = 0; i < number; i++)
+  {
+    columns.X[i] = 600000000 + (I32)(lastest_random(state) % 1000000) * ((i & 3) ? 1 : 10);
+    columns.intensity[i] = (U16)(lastest_random(state) % 4096);
+    columns.scan_angle[i] = (I16)(lastest_random(state) % 6001) - 3000;
+    columns.scan_angle_rank[i] = (I8)(lastest_random(state) % 41) - 20;
+    columns.gps_time[i] = 3e8 + 1e-5 * i;
+  }
+
+  const CHAR* selected = laskernels.get_isa();
+  BenchKernelsResult reference;
+  BenchKernelsResult result;
+  BOOL same = TRUE;
+  U32 k;
+
+  fprintf(stderr, "%u values in blocks of %u repeated %u times (million values per second)\n", number, BENCH_KERNELS_BLOCK, repeats);
+  fprintf(stderr, "%-8s %9s %9s %9s %9s %9s %9s\n", "isa", "I32", "U16", "I16", "I8", "F64", "fluff");
+  for (i = 0; i < sizeof(bench_kernels_isas)/sizeof(CHAR*); i++)
+  {
+    if (!laskernels.select(bench_kernels_isas[i]))
+    {
+      fprintf(stderr, "%-8s not supported by this CPU\n", bench_kernels_isas[i]);
+      continue;
+    }
+    run_kernels(columns, repeats, (i == 0 ? &reference : &result));
+    const BenchKernelsResult& timed = (i == 0 ? reference : result);
+    fprintf(stderr, "%-8s", bench_kernels_isas[i]);
+    for (k = 0; k < 6; k++)
+    {
+      fprintf(stderr, " %9.1f", (timed.seconds[k] > 0.0 ? 1e-6 * number * repeats / timed.seconds[k] : 0.0));
+    }
+    if ((i != 0) && !same_result(reference, result))
+    {
+      fprintf(stderr, "  differs from scalar");
+      same = FALSE;
+    }
+    fprintf(stderr, "\n");
+  }
+  laskernels.select(selected);
+  return same;
+}
@@ -0,0 +1,128 @@
+/*
+===============================================================================
+
+  FILE:  bench_projection.cpp
+
+  CONTENTS:
+
+    Times GeoProjectionConverter::from_lat_long() and to_lat_long() against
+    the scalar code that converts one point at a time on a grid of +-3 degrees
+    around the origin of each projection that the 'projection' test uses.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created for timing the array projection conversions
+
+===============================================================================
+*/
+#include "lasbench.hpp"
+#include "lastest.hpp"
+#include "geoprojectionconverter.hpp"
+
+#include <stdio.h>
+#include <math.h>
+
+#include <vector>
+
+static BOOL bench_projection_grid(const U32 projection, const U32 S, const U32 repeats)
+{
+  GeoProjectionConverter projected;
+  GeoProjectionConverter longlat;
+  F64 center_latitude, center_longitude;
+  const CHAR* name = lastest_projection(projection, &projected, &longlat, &center_latitude, &center_longitude);
+
+  const size_t n = (size_t)S*S;
+  std::vector<F64> latitude(n), longitude(n), x(n), y(n);
+  U32 i, j, r;
+  for (i = 0; i < S; i++)
+  {
+    for (j = 0; j < S; j++)
+    {
+      latitude[i*S+j] = center_latitude - 3.0 + 6.0*i/S;
+      longitude[i*S+j] = center_longitude - 3.0 + 6.0*j/S;
+    }
+  }
+
+  size_t k;
+  F64 seconds[4];
+  F64 start = lasbench_taketime();
+  for (r = 0; r < repeats; r++)
+  {
+    for (k = 0; k < n; k++)
+    {
+      double point[3] = { longitude[k], latitude[k], 0.0 };
+      double elevation;
+      longlat.to_target(point, x[k], y[k], elevation);
+    }
+  }
+  seconds[0] = lasbench_taketime() - start;
+  start = lasbench_taketime();
+  for (r = 0; r < repeats; r++)
+  {
+    if (!projected.from_lat_long(&latitude[0], &longitude[0], n, &x[0], &y[0]))
+    {
+      fprintf(stderr, "%s: from_lat_long() failed\n", name);
+      return FALSE;
+    }
+  }
+  seconds[1] = lasbench_taketime() - start;
+  start = lasbench_taketime();
+  for (r = 0; r < repeats; r++)
+  {
+    for (k = 0; k < n; k++)
+    {
+      double point[3] = { x[k], y[k], 0.0 };
+      double elevation;
+      projected.to_lon_lat_ele(point, longitude[k], latitude[k], elevation);
+    }
+  }
+  seconds[2] = lasbench_taketime() - start;
+  start = lasbench_taketime();
+  for (r = 0; r < repeats; r++)
+  {
+    if (!projected.to_lat_long(&x[0], &y[0], n, &latitude[0], &longitude[0]))
+    {
+      fprintf(stderr, "%s: to_lat_long() failed\n", name);
+      return FALSE;
+    }
+  }
+  seconds[3] = lasbench_taketime() - start;
+
+  fprintf(stderr, "%-8s %-4s %9.1f %9.1f %6.2fx %9.1f %9.1f %6.2fx\n", name, ((projection & 1) ? "ftUS" : "m"),
+    1e3*seconds[0], 1e3*seconds[1], (seconds[1] > 0.0 ? seconds[0]/seconds[1] : 0.0),
+    1e3*seconds[2], 1e3*seconds[3], (seconds[3] > 0.0 ? seconds[2]/seconds[3] : 0.0));
+  return TRUE;
+}
+
+BOOL bench_projection(const U32 number, const U32 repeats)
+{
+  U32 S = (U32)sqrt((F64)number);
+  if (S == 0) S = 1;
+  U32 projection;
+  BOOL success = TRUE;
+  fprintf(stderr, "grid of %u x %u points repeated %u times (milliseconds)\n", S, S, repeats);
+  fprintf(stderr, "%-13s %9s %9s %7s %9s %9s %7s\n", "projection", "forward", "array", "", "inverse", "array", "");
+  for (projection = 0; projection < LASTEST_PROJECTIONS; projection++)
+  {
+    if (!bench_projection_grid(projection, S, repeats))
+    {
+      success = FALSE;
+    }
+  }
+  return success;
+}
@@ -0,0 +1,124 @@
+/*
+===============================================================================
+
+  FILE:  lasbench.cpp
+
+  CONTENTS:
+
+    see corresponding header file
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    see corresponding header file
+
+===============================================================================
+*/
+#include "lasbench.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef BOOL (*LASbenchFunction)(const U32 number, const U32 repeats);
+
+struct LASbench
+{
+  const CHAR* name;
+  LASbenchFunction function;
+};
+
+static const LASbench lasbenches[] =
+{
+  { "decode", bench_decode },
+  { "kernels", bench_kernels },
+  { "projection", bench_projection },
+};
+
+static const U32 lasbenches_num = sizeof(lasbenches)/sizeof(LASbench);
+
+static void usage()
+{
+  U32 i;
+  fprintf(stderr,"usage:\n");
+  fprintf(stderr,"lasbench                     (runs all benchmarks)\n");
+  fprintf(stderr,"lasbench kernels             (runs one benchmark)\n");
+  fprintf(stderr,"lasbench kernels -n 1000000  (values per repeat)\n");
+  fprintf(stderr,"lasbench -r 100              (repeats)\n");
+  fprintf(stderr,"benchmarks:\n");
+  for (i = 0; i < lasbenches_num; i++)
+  {
+    fprintf(stderr,"  %s\n", lasbenches[i].name);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  int i;
+  U32 b;
+  const CHAR* name = 0;
+  U32 number = 10000000;
+  U32 repeats = 20;
+  for (i = 1; i < argc; i++)
+  {
+    if ((strcmp(argv[i],"-n") == 0) && ((i+1) < argc))
+    {
+      number = (U32)atoi(argv[++i]);
+    }
+    else if ((strcmp(argv[i],"-r") == 0) && ((i+1) < argc))
+    {
+      repeats = (U32)atoi(argv[++i]);
+    }
+    else if ((argv[i][0] != '-') && (name == 0))
+    {
+      name = argv[i];
+    }
+    else
+    {
+      fprintf(stderr,"ERROR: cannot understand argument '%s'\n", argv[i]);
+      usage();
+      return 1;
+    }
+  }
+  if ((number == 0) || (repeats == 0))
+  {
+    fprintf(stderr,"ERROR: need at least one value and one repeat\n");
+    return 1;
+  }
+  U32 failed = 0;
+  U32 run = 0;
+  for (b = 0; b < lasbenches_num; b++)
+  {
+    if (name && (strcmp(name, lasbenches[b].name) != 0))
+    {
+      continue;
+    }
+    run++;
+    if (!lasbenches[b].function(number, repeats))
+    {
+      fprintf(stderr,"FAILED: %s\n", lasbenches[b].name);
+      failed++;
+    }
+  }
+  if (run == 0)
+  {
+    fprintf(stderr,"ERROR: no benchmark called '%s'\n", name);
+    usage();
+    return 1;
+  }
+  return (failed ? 1 : 0);
+}
@@ -0,0 +1,53 @@
+/*
+===============================================================================
+
+  FILE:  lasbench.hpp
+
+  CONTENTS:
+
+    The microbenchmarks of lasvalidate. Each benchmark is a function that
+    prints its timings to stderr and returns FALSE when the variants that it
+    compares do not give the same results. lasbench runs them by name.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- added timing the decoding of chunks of one point
+    18 October 2026 -- added timing the array projection conversions
+    18 October 2026 -- created for timing the column kernels of each ISA
+
+===============================================================================
+*/
+#ifndef LAS_BENCH_HPP
+#define LAS_BENCH_HPP
+
+#include "mydefs.hpp"
+
+#include <chrono>
+
+// number is how many values (points) each benchmark processes per repeat
+
+BOOL bench_decode(const U32 number, const U32 repeats);
+BOOL bench_kernels(const U32 number, const U32 repeats);
+BOOL bench_projection(const U32 number, const U32 repeats);
+
+static inline F64 lasbench_taketime()
+{
+  return std::chrono::duration<F64>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#endif
@@ -0,0 +1,103 @@
+/*
+===============================================================================
+
+  FILE:  lastest.cpp
+
+  CONTENTS:
+
+    see corresponding header file
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    see corresponding header file
+
+===============================================================================
+*/
+#include "lastest.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+typedef BOOL (*LAStestFunction)();
+
+struct LAStest
+{
+  const CHAR* name;
+  LAStestFunction function;
+};
+
+static const LAStest lastests[] =
+{
+  { "bounding_box", test_bounding_box },
+  { "chunks", test_chunks },
+  { "crs_cache", test_crs_cache },
+  { "directory", test_directory },
+  { "epsg", test_epsg },
+  { "list", test_list },
+  { "merge", test_merge },
+  { "point", test_point },
+  { "projection", test_projection },
+  { "raw", test_raw },
+  { "wkt", test_wkt },
+};
+
+static const U32 lastests_num = sizeof(lastests)/sizeof(LAStest);
+
+static void usage()
+{
+  U32 i;
+  fprintf(stderr,"usage:\n");
+  fprintf(stderr,"lastest            (runs all tests)\n");
+  fprintf(stderr,"lastest name       (runs one test)\n");
+  fprintf(stderr,"tests:\n");
+  for (i = 0; i < lastests_num; i++)
+  {
+    fprintf(stderr,"  %s\n", lastests[i].name);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  U32 i;
+  U32 failed = 0;
+  U32 run = 0;
+  for (i = 0; i < lastests_num; i++)
+  {
+    if ((argc > 1) && (strcmp(argv[1], lastests[i].name) != 0))
+    {
+      continue;
+    }
+    run++;
+    if (lastests[i].function())
+    {
+      fprintf(stderr,"passed: %s\n", lastests[i].name);
+    }
+    else
+    {
+      fprintf(stderr,"FAILED: %s\n", lastests[i].name);
+      failed++;
+    }
+  }
+  if (run == 0)
+  {
+    fprintf(stderr,"ERROR: no test called '%s'\n", argv[1]);
+    usage();
+    return 1;
+  }
+  return (failed ? 1 : 0);
+}
@@ -0,0 +1,89 @@
+/*
+===============================================================================
+
+  FILE:  lastest.hpp
+
+  CONTENTS:
+
+    The unit tests of lasvalidate. Each test is a function that returns TRUE
+    when it passed and otherwise prints to stderr what failed. lastest runs
+    them by name so that ctest can list and run each on its own.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- added the test of the table of EPSG codes
+    18 October 2026 -- added the test of the CRS cache
+    18 October 2026 -- added the test of the listing of directories
+    18 October 2026 -- added the test of the lists of files
+    18 October 2026 -- added the test of the chunks of LAZ files
+    18 October 2026 -- added the test of the fused raw point readers
+    18 October 2026 -- added the test of the OGC WKT parser
+    18 October 2026 -- added the test of the LASpoint field layout
+    18 October 2026 -- added the test of the array projection conversions
+    18 October 2026 -- added the test of merging sharded summaries
+    18 October 2026 -- created for the test of the integer bounding box
+
+===============================================================================
+*/
+#ifndef LAS_TEST_HPP
+#define LAS_TEST_HPP
+
+#include "mydefs.hpp"
+
+BOOL test_bounding_box();
+BOOL test_chunks();
+BOOL test_crs_cache();
+BOOL test_directory();
+BOOL test_epsg();
+BOOL test_list();
+BOOL test_merge();
+BOOL test_point();
+BOOL test_projection();
+BOOL test_raw();
+BOOL test_wkt();
+
+// the projections of the conversion test and benchmark: UTM 10N, UTM 56S, TM
+// Arizona, LCC California III, and TM Ireland, each in meters and in US
+// survey feet. sets up converters from and to the projected coordinates and
+// returns the name and the origin
+
+#define LASTEST_PROJECTIONS 10
+
+class GeoProjectionConverter;
+
+const CHAR* lastest_projection(const U32 projection, GeoProjectionConverter* projected, GeoProjectionConverter* longlat, F64* latitude, F64* longitude);
+
+// a deterministic random number generator (splitmix64) so that every run
+// tests the same cases
+
+static inline U64 lastest_random(U64& state)
+{
+  U64 z = (state += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+// uniform in [0,1)
+
+static inline F64 lastest_uniform(U64& state)
+{
+  return (F64)(lastest_random(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+#endif
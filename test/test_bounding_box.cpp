@@ -0,0 +1,164 @@
+/*
+===============================================================================
+
+  FILE:  test_bounding_box.cpp
+
+  CONTENTS:
+
+    LAScheck counts the points outside of the header bounding box with ranges
+    of integer coordinates. this compares that with the rule it replaced (the
+    coordinates as doubles against the bounding box widened by one scale
+    factor) for integers at the ends of the ranges and at the I32 limits.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created to keep the integer bounding box exact
+
+===============================================================================
+*/
+#include "lastest.hpp"
+#include "lascheck.hpp"
+
+#include <stdio.h>
+#include <math.h>
+
+#include <vector>
+
+#define TEST_BOUNDING_BOX_CASES 2000
+
+static const F64 test_scales[] = { 0.01, 0.001, 0.0001, 1.0, 0.5, 0.25, 0.1, 0.3, 1e-7 };
+static const F64 test_offsets[] = { 0.0, 500000.0, 5400000.0, -1234567.89, 1e7, 0.005 };
+
+static I32 clamp_to_I32(const F64 value)
+{
+  if (!(value > (F64)I32_MIN)) return I32_MIN;
+  if (!(value < (F64)I32_MAX)) return I32_MAX;
+  return (I32)value;
+}
+
+// integers around where scale*X+offset crosses the bound
+
+static void add_candidates(std::vector<I32>& candidates, const F64 scale, const F64 offset, const F64 bound)
+{
+  I32 center = clamp_to_I32(floor((bound - offset) / scale));
+  I64 d;
+  for (d = -3; d <= 3; d++)
+  {
+    I64 X = (I64)center + d;
+    if ((X >= I32_MIN) && (X <= I32_MAX)) candidates.push_back((I32)X);
+  }
+}
+
+static BOOL test_bounding_box_case(const F64 scale, const F64 offset, const F64 min_x, const F64 max_x, U32 number)
+{
+  LASheader lasheader;
+  lasheader.x_scale_factor = scale;
+  lasheader.x_offset = offset;
+  lasheader.min_x = min_x;
+  lasheader.max_x = max_x;
+  // all Y and Z are inside
+  lasheader.y_scale_factor = lasheader.z_scale_factor = 1.0;
+  lasheader.y_offset = lasheader.z_offset = 0.0;
+  lasheader.min_y = lasheader.min_z = -3e9;
+  lasheader.max_y = lasheader.max_z = 3e9;
+
+  std::vector<I32> candidates;
+  add_candidates(candidates, scale, offset, min_x - scale);
+  add_candidates(candidates, scale, offset, max_x + scale);
+  candidates.push_back(I32_MIN);
+  candidates.push_back(I32_MIN + 1);
+  candidates.push_back(0);
+  candidates.push_back(I32_MAX - 1);
+  candidates.push_back(I32_MAX);
+
+  LASpoint laspoint;
+  laspoint.init(&lasheader, 0, 20);
+  LASpointBatch laspointbatch;
+  laspointbatch.init(&laspoint, (U32)candidates.size());
+  LAScheck batchcheck(&lasheader);
+
+  U32 i;
+  I64 outside = 0;
+  for (i = 0; i < candidates.size(); i++)
+  {
+    laspoint.X = candidates[i];
+    laspoint.Y = 0;
+    laspoint.Z = 0;
+    BOOL expected = !laspoint.inside_bounding_box(min_x - scale, lasheader.min_y - 1.0, lasheader.min_z - 1.0, max_x + scale, lasheader.max_y + 1.0, lasheader.max_z + 1.0);
+    LAScheck lascheck(&lasheader);
+    lascheck.parse(&laspoint);
+    if ((lascheck.get_points_outside_bounding_box() != 0) != expected)
+    {
+      fprintf(stderr, "case %u: X %d with scale %.17g offset %.17g and bounds [%.17g, %.17g] is %s but parse() says %s\n", number, laspoint.X, scale, offset, min_x, max_x, (expected ? "outside" : "inside"), (expected ? "inside" : "outside"));
+      return FALSE;
+    }
+    if (expected) outside++;
+    laspointbatch.add(&laspoint);
+  }
+  batchcheck.parse_batch(&laspointbatch);
+  if (batchcheck.get_points_outside_bounding_box() != outside)
+  {
+    fprintf(stderr, "case %u: parse_batch() counts %d and not %d points outside\n", number, (I32)batchcheck.get_points_outside_bounding_box(), (I32)outside);
+    return FALSE;
+  }
+  return TRUE;
+}
+
+BOOL test_bounding_box()
+{
+  U64 state = 20261018;
+  U32 number;
+  for (number = 0; number < TEST_BOUNDING_BOX_CASES; number++)
+  {
+    F64 scale, offset;
+    if (number & 1)
+    {
+      scale = pow(10.0, -8.0 + 8.0*lastest_uniform(state));
+      offset = (lastest_uniform(state) - 0.5) * 2e7;
+    }
+    else
+    {
+      scale = test_scales[lastest_random(state) % (sizeof(test_scales)/sizeof(F64))];
+      offset = test_offsets[lastest_random(state) % (sizeof(test_offsets)/sizeof(F64))];
+    }
+    // bounds on an integer coordinate, between two, or (rarely) beyond the I32 range
+    F64 min_x = offset + scale * (F64)(I64)(lastest_random(state) % 4000000001ull - 2000000000ll);
+    F64 max_x = min_x + scale * (F64)(lastest_random(state) % 1000000);
+    U32 kind = (U32)(lastest_random(state) % 4);
+    if (kind == 1)
+    {
+      min_x += scale * lastest_uniform(state);
+      max_x += scale * lastest_uniform(state);
+    }
+    else if (kind == 2)
+    {
+      min_x = nextafter(min_x, -1e300);
+      max_x = nextafter(max_x, 1e300);
+    }
+    else if (kind == 3)
+    {
+      min_x = offset + scale * (F64)I32_MIN * (1.0 + lastest_uniform(state));
+      max_x = offset + scale * (F64)I32_MAX * (1.0 + lastest_uniform(state));
+    }
+    if (!test_bounding_box_case(scale, offset, min_x, max_x, number))
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
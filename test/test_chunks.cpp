@@ -0,0 +1,216 @@
+/*
+===============================================================================
+
+  FILE:  test_chunks.cpp
+
+  CONTENTS:
+
+    The structural checks of LAZ files (check_chunk_table() and check_chunks()
+    of LASreader) on the files in test/data: layered LAS 1.4 files whose chunk
+    headers must pass and then fail once their point count or a layer size is
+    corrupted, and a pointwise compressed file that has no chunk table to
+    check. the points of each file must also decode to the known values.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created to check the chunks of layered and pointwise LAZ files
+
+===============================================================================
+*/
+#include "lastest.hpp"
+#include "lasreader.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <sstream>
+#include <string>
+
+// the layout of the layered files (see test/data/README.txt)
+
+#define TEST_CHUNKS_LAYERED_POINTS 5
+#define TEST_CHUNKS_CHUNK_BYTES 74
+#define TEST_CHUNKS_POINT14_BYTES 30
+
+static BOOL load_file(const CHAR* name, std::string& bytes)
+{
+  std::string file_name = std::string(LASTEST_DATA_DIR) + "/" + name;
+  FILE* file = fopen(file_name.c_str(), "rb");
+  if (file == 0)
+  {
+    fprintf(stderr, "cannot open '%s'\n", file_name.c_str());
+    return FALSE;
+  }
+  CHAR buffer[4096];
+  size_t size;
+  bytes.clear();
+  while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0)
+  {
+    bytes.append(buffer, size);
+  }
+  fclose(file);
+  return TRUE;
+}
+
+// runs the structural checks on the bytes of a file. returns whether both
+// passed and the error otherwise
+
+static BOOL check_chunks(const std::string& bytes, U32* number_chunks, std::string& error)
+{
+  std::istringstream stream(bytes);
+  LASreader lasreader;
+  if (!lasreader.open(stream))
+  {
+    error = "cannot open";
+    return FALSE;
+  }
+  BOOL passed = lasreader.check_chunk_table();
+  *number_chunks = lasreader.get_number_chunks();
+  if (passed)
+  {
+    passed = lasreader.check_chunks(0, *number_chunks);
+  }
+  if (!passed)
+  {
+    error = (lasreader.get_error() ? lasreader.get_error() : "no error");
+  }
+  lasreader.close();
+  return passed;
+}
+
+static BOOL check_points(const CHAR* name, const std::string& bytes, const U32 number)
+{
+  std::istringstream stream(bytes);
+  LASreader lasreader;
+  if (!lasreader.open(stream))
+  {
+    fprintf(stderr, "%s: cannot open\n", name);
+    return FALSE;
+  }
+  BOOL extended = lasreader.point.is_las14();
+  U32 i = 0;
+  while (lasreader.read_point())
+  {
+    const LASpoint& p = lasreader.point;
+    BOOL same = (p.get_X() == (I32)(1003 + 1001*i)) && (p.get_Y() == (I32)(2007 + 503*i)) && (p.get_Z() == (I32)(-99 + 7*i)) &&
+                (p.get_intensity() == (U16)(100*i + 5)) &&
+                (p.get_return_number() == (i % 3) + 1) && (p.get_number_of_returns() == 3) &&
+                (p.get_classification() == 2 + i) && (p.get_user_data() == 10*i) && (p.get_point_source_ID() == 7 + i);
+    if (extended)
+    {
+      same = same && (p.get_extended_return_number() == (i % 3) + 1) && (p.get_extended_number_of_returns() == 3) &&
+                     (p.get_scan_direction_flag() == (i & 1)) && (p.get_scan_angle() == (I16)(-2000 + 1000*(I32)i)) &&
+                     (p.get_gps_time() == 1000.5 + i);
+    }
+    else
+    {
+      same = same && (p.get_scan_angle_rank() == (I8)(-20 + 10*(I32)i));
+    }
+    if (!same)
+    {
+      fprintf(stderr, "%s: point %u does not decode to the values it was written with\n", name, i);
+      lasreader.close();
+      return FALSE;
+    }
+    i++;
+  }
+  lasreader.close();
+  if (i != number)
+  {
+    fprintf(stderr, "%s: decoded %u and not %u points\n", name, i, number);
+    return FALSE;
+  }
+  return TRUE;
+}
+
+static BOOL test_layered(const CHAR* name)
+{
+  std::string bytes;
+  if (!load_file(name, bytes))
+  {
+    return FALSE;
+  }
+  U32 number_chunks;
+  std::string error;
+  if (!check_chunks(bytes, &number_chunks, error))
+  {
+    fprintf(stderr, "%s: %s\n", name, error.c_str());
+    return FALSE;
+  }
+  if (number_chunks != TEST_CHUNKS_LAYERED_POINTS)
+  {
+    fprintf(stderr, "%s: %u and not %u chunks\n", name, number_chunks, TEST_CHUNKS_LAYERED_POINTS);
+    return FALSE;
+  }
+  if (!check_points(name, bytes, TEST_CHUNKS_LAYERED_POINTS))
+  {
+    return FALSE;
+  }
+
+  // the point count and the size of the Z layer that follow the first point of chunk 2
+
+  U32 offset_to_point_data;
+  memcpy(&offset_to_point_data, &bytes[96], 4);
+  size_t chunk = (size_t)offset_to_point_data + 8 + 2*TEST_CHUNKS_CHUNK_BYTES;
+  const size_t corrupt[2] = { chunk + TEST_CHUNKS_POINT14_BYTES, chunk + TEST_CHUNKS_POINT14_BYTES + 4 + 4 };
+  const CHAR* expected[2] = { "chunk 2 has 2 points and not 1", "chunk 2 has layers for 75 bytes and not 74" };
+  U32 c;
+  for (c = 0; c < 2; c++)
+  {
+    std::string corrupted = bytes;
+    corrupted[corrupt[c]]++;
+    if (check_chunks(corrupted, &number_chunks, error))
+    {
+      fprintf(stderr, "%s: corrupted chunk 2 passes\n", name);
+      return FALSE;
+    }
+    if (error != expected[c])
+    {
+      fprintf(stderr, "%s: corrupted chunk 2 fails with '%s' and not '%s'\n", name, error.c_str(), expected[c]);
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+static BOOL test_pointwise(const CHAR* name)
+{
+  std::string bytes;
+  if (!load_file(name, bytes))
+  {
+    return FALSE;
+  }
+  U32 number_chunks;
+  std::string error;
+  if (!check_chunks(bytes, &number_chunks, error))
+  {
+    fprintf(stderr, "%s: %s\n", name, error.c_str());
+    return FALSE;
+  }
+  if (number_chunks != 0)
+  {
+    fprintf(stderr, "%s: %u and not 0 chunks\n", name, number_chunks);
+    return FALSE;
+  }
+  return check_points(name, bytes, 3);
+}
+
+BOOL test_chunks()
+{
+  return test_layered("layered_v3.laz") && test_layered("layered_v4.laz") && test_pointwise("pointwise.laz");
+}
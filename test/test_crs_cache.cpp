@@ -0,0 +1,200 @@
+/*
+===============================================================================
+
+  FILE:  test_crs_cache.cpp
+
+  CONTENTS:
+
+    The CRScache checks the CRS of the first of many headers with identical
+    GeoKeys and OGC WKT and replays the fails, warnings, description, and
+    location for the others. this checks headers whose CRS differs only in
+    no_CRS_fail, in an empty, a missing, or a malformed OGC WKT, or in one
+    GeoKey. each must be checked once and then replayed exactly as CRScheck
+    reports it without the cache.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created to check that cached CRS checks are replayed exactly
+
+===============================================================================
+*/
+#include "lastest.hpp"
+#include "crscheck.hpp"
+#include "lasheader.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_CRS_CACHE_WKT_NONE 0
+#define TEST_CRS_CACHE_WKT_EMPTY 1
+#define TEST_CRS_CACHE_WKT_BROKEN 2
+
+// the GeoKeys of NAD83 / UTM zone 10N and 11N in meter
+
+static U16 test_crs_cache_utm10[] = { 1, 1, 0, 4, 1024, 0, 1, 1, 1025, 0, 1, 1, 3072, 0, 1, 26910, 3076, 0, 1, 9001 };
+static U16 test_crs_cache_utm11[] = { 1, 1, 0, 4, 1024, 0, 1, 1, 1025, 0, 1, 1, 3072, 0, 1, 26911, 3076, 0, 1, 9001 };
+
+static const CHAR* test_crs_cache_broken = "PROJCS[\"broken\",GEOGCS[";
+
+struct TestCRScache
+{
+  const CHAR* name;
+  U16* geokeys;
+  U32 wkt;
+  BOOL no_CRS_fail;
+};
+
+static const TestCRScache test_crs_cache_headers[] =
+{
+  { "GeoKeys of UTM 10N", test_crs_cache_utm10, TEST_CRS_CACHE_WKT_NONE, FALSE },
+  { "GeoKeys of UTM 10N with no_CRS_fail", test_crs_cache_utm10, TEST_CRS_CACHE_WKT_NONE, TRUE },
+  { "GeoKeys of UTM 11N", test_crs_cache_utm11, TEST_CRS_CACHE_WKT_NONE, FALSE },
+  { "GeoKeys of UTM 10N and empty WKT", test_crs_cache_utm10, TEST_CRS_CACHE_WKT_EMPTY, FALSE },
+  { "GeoKeys of UTM 10N and empty WKT with no_CRS_fail", test_crs_cache_utm10, TEST_CRS_CACHE_WKT_EMPTY, TRUE },
+  { "GeoKeys of UTM 10N and malformed WKT", test_crs_cache_utm10, TEST_CRS_CACHE_WKT_BROKEN, FALSE },
+  { "no CRS", 0, TEST_CRS_CACHE_WKT_NONE, FALSE },
+  { "no CRS with no_CRS_fail", 0, TEST_CRS_CACHE_WKT_NONE, TRUE },
+  { "empty WKT", 0, TEST_CRS_CACHE_WKT_EMPTY, FALSE },
+};
+
+class TestCRScacheResult
+{
+public:
+  LASheader lasheader;
+  CHAR description[512];
+  CRSlocation location;
+
+  // the pointers are not owned by the header
+  ~TestCRScacheResult() { lasheader.geokeys = 0; lasheader.geokey_entries = 0; lasheader.ogc_wkt = 0; };
+};
+
+static void test_crs_cache_header(const TestCRScache& test, TestCRScacheResult& result)
+{
+  result.lasheader.version_minor = 4;
+  result.lasheader.point_data_format = 6;
+  if (test.geokeys)
+  {
+    result.lasheader.geokeys = (LASgeokeys*)&test.geokeys[0];
+    result.lasheader.geokey_entries = (LASgeokey_entry*)&test.geokeys[4];
+  }
+  if (test.wkt == TEST_CRS_CACHE_WKT_EMPTY)
+  {
+    // how the reader marks an empty OGC WKT
+    result.lasheader.ogc_wkt = result.lasheader.file_signature;
+    result.lasheader.ogc_wkt_num = 0;
+  }
+  else if (test.wkt == TEST_CRS_CACHE_WKT_BROKEN)
+  {
+    result.lasheader.ogc_wkt = (CHAR*)test_crs_cache_broken;
+    result.lasheader.ogc_wkt_num = (U32)strlen(test_crs_cache_broken) + 1;
+  }
+  strcpy(result.description, "not described");
+}
+
+static BOOL test_crs_cache_same_notes(const U32 num, CHAR** notes, const U32 expected_num, CHAR** expected)
+{
+  if (num != expected_num)
+  {
+    return FALSE;
+  }
+  U32 i;
+  for (i = 0; i < num; i++)
+  {
+    if (strcmp(notes[i], expected[i]) != 0) return FALSE;
+  }
+  return TRUE;
+}
+
+static BOOL test_crs_cache_same(const CHAR* name, const CHAR* what, const TestCRScacheResult& result, const TestCRScacheResult& expected)
+{
+  const CRSlocation& a = result.location;
+  const CRSlocation& b = expected.location;
+  if (!test_crs_cache_same_notes(result.lasheader.fail_num, result.lasheader.fails, expected.lasheader.fail_num, expected.lasheader.fails))
+  {
+    fprintf(stderr, "%s: the %s gives %u fails and not the %u of CRScheck\n", name, what, result.lasheader.fail_num/2, expected.lasheader.fail_num/2);
+    return FALSE;
+  }
+  if (!test_crs_cache_same_notes(result.lasheader.warning_num, result.lasheader.warnings, expected.lasheader.warning_num, expected.lasheader.warnings))
+  {
+    fprintf(stderr, "%s: the %s gives %u warnings and not the %u of CRScheck\n", name, what, result.lasheader.warning_num/2, expected.lasheader.warning_num/2);
+    return FALSE;
+  }
+  if (strcmp(result.description, expected.description) != 0)
+  {
+    fprintf(stderr, "%s: the %s describes '%s' and not '%s'\n", name, what, result.description, expected.description);
+    return FALSE;
+  }
+  if ((a.type != b.type) || (a.ellipsoid != b.ellipsoid) || (a.coordinates2meter != b.coordinates2meter) || (a.utm_zone != b.utm_zone) || (a.utm_northern != b.utm_northern) || (memcmp(a.parameters, b.parameters, sizeof(a.parameters)) != 0))
+  {
+    fprintf(stderr, "%s: the %s gives location type %d zone %d and not type %d zone %d\n", name, what, a.type, a.utm_zone, b.type, b.utm_zone);
+    return FALSE;
+  }
+  return TRUE;
+}
+
+BOOL test_crs_cache()
+{
+  U32 i;
+  for (i = 0; i < sizeof(test_crs_cache_headers)/sizeof(TestCRScache); i++)
+  {
+    const TestCRScache& test = test_crs_cache_headers[i];
+
+    TestCRScacheResult expected;
+    test_crs_cache_header(test, expected);
+    CRScheck crscheck;
+    crscheck.check(&expected.lasheader, expected.description, test.no_CRS_fail, &expected.location);
+    if ((expected.lasheader.fail_num + expected.lasheader.warning_num == 0) && (strcmp(expected.description, "not described") == 0))
+    {
+      fprintf(stderr, "%s: CRScheck gives nothing to replay\n", test.name);
+      return FALSE;
+    }
+
+    // the first header of each kind must be checked and not replay another
+
+    U64 lookups = CRScache::get_lookups();
+    U64 hits = CRScache::get_hits();
+    TestCRScacheResult first;
+    test_crs_cache_header(test, first);
+    CRScache::check(&first.lasheader, first.description, test.no_CRS_fail, &first.location);
+    if ((CRScache::get_lookups() != lookups + 1) || (CRScache::get_hits() != hits))
+    {
+      fprintf(stderr, "%s: the first check replays an earlier CRS\n", test.name);
+      return FALSE;
+    }
+    if (!test_crs_cache_same(test.name, "first check", first, expected))
+    {
+      return FALSE;
+    }
+
+    // the second is replayed
+
+    TestCRScacheResult second;
+    test_crs_cache_header(test, second);
+    CRScache::check(&second.lasheader, second.description, test.no_CRS_fail, &second.location);
+    if ((CRScache::get_lookups() != lookups + 2) || (CRScache::get_hits() != hits + 1))
+    {
+      fprintf(stderr, "%s: the second check is not replayed\n", test.name);
+      return FALSE;
+    }
+    if (!test_crs_cache_same(test.name, "replayed check", second, expected))
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
@@ -0,0 +1,249 @@
+/*
+===============================================================================
+
+  FILE:  test_directory.cpp
+
+  CONTENTS:
+
+    The LASreadOpener lists a directory (recursively with '-recursive'),
+    keeps the files whose extension is one of '-ext' without case, drops
+    those matched by an '-exclude' wild card (against the name or, when the
+    pattern has a slash, against the path), and adds the largest files
+    first. this builds a temporary tree with nested directories and files
+    of known sizes and checks the added paths and their order.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created to check the listing, filtering, and order of directories
+
+===============================================================================
+*/
+#include "lastest.hpp"
+#include "lasreadopener.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#define TEST_DIRECTORY_SLASH "\\"
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#define TEST_DIRECTORY_SLASH "/"
+#endif
+
+#define TEST_DIRECTORY_ROOT "lastest_directory"
+
+// the directories and the files of the tree with their sizes in bytes. two
+// files have the same size and are added in the order of their paths
+
+static const CHAR* test_directory_directories[] = { "sub", "sub/deep", "old" };
+
+struct TestDirectoryFile
+{
+  const CHAR* path;
+  U32 size;
+};
+
+static const TestDirectoryFile test_directory_files[] =
+{
+  { "a.las", 300 },
+  { "B.LAZ", 500 },
+  { "c.txt", 100 },
+  { "noext", 50 },
+  { "las", 60 },
+  { "skip_me.las", 1000 },
+  { "sub/d.laz", 700 },
+  { "sub/E.Las", 200 },
+  { "sub/x.las", 500 },
+  { "sub/deep/f.las", 900 },
+  { "sub/deep/g.laz", 400 },
+  { "old/h.las", 800 },
+};
+
+static std::string test_directory_path(const CHAR* path)
+{
+  std::string full = std::string(TEST_DIRECTORY_ROOT) + TEST_DIRECTORY_SLASH + path;
+  size_t i;
+  for (i = 0; i < full.size(); i++)
+  {
+    if (full[i] == '/') full[i] = TEST_DIRECTORY_SLASH[0];
+  }
+  return full;
+}
+
+static BOOL test_directory_make(const std::string& path)
+{
+#ifdef _WIN32
+  return (_mkdir(path.c_str()) == 0);
+#else
+  return (mkdir(path.c_str(), 0755) == 0);
+#endif
+}
+
+static void test_directory_remove(const std::string& path)
+{
+#ifdef _WIN32
+  _rmdir(path.c_str());
+#else
+  rmdir(path.c_str());
+#endif
+}
+
+static void test_directory_clean()
+{
+  U32 i;
+  for (i = 0; i < sizeof(test_directory_files)/sizeof(TestDirectoryFile); i++)
+  {
+    remove(test_directory_path(test_directory_files[i].path).c_str());
+  }
+#ifndef _WIN32
+  unlink(test_directory_path("dangling.las").c_str());
+  unlink(test_directory_path("sub/loop").c_str());
+#endif
+  for (i = sizeof(test_directory_directories)/sizeof(CHAR*); i > 0; i--)
+  {
+    test_directory_remove(test_directory_path(test_directory_directories[i-1]));
+  }
+  test_directory_remove(TEST_DIRECTORY_ROOT);
+}
+
+static BOOL test_directory_build()
+{
+  test_directory_clean();
+  if (!test_directory_make(TEST_DIRECTORY_ROOT))
+  {
+    fprintf(stderr, "cannot create directory '%s'\n", TEST_DIRECTORY_ROOT);
+    return FALSE;
+  }
+  U32 i;
+  for (i = 0; i < sizeof(test_directory_directories)/sizeof(CHAR*); i++)
+  {
+    if (!test_directory_make(test_directory_path(test_directory_directories[i])))
+    {
+      fprintf(stderr, "cannot create directory '%s'\n", test_directory_path(test_directory_directories[i]).c_str());
+      return FALSE;
+    }
+  }
+  for (i = 0; i < sizeof(test_directory_files)/sizeof(TestDirectoryFile); i++)
+  {
+    FILE* file = fopen(test_directory_path(test_directory_files[i].path).c_str(), "wb");
+    if (file == 0)
+    {
+      fprintf(stderr, "cannot create file '%s'\n", test_directory_path(test_directory_files[i].path).c_str());
+      return FALSE;
+    }
+    std::vector<U8> bytes(test_directory_files[i].size, 'x');
+    fwrite(&bytes[0], 1, bytes.size(), file);
+    fclose(file);
+  }
+#ifndef _WIN32
+  // a dangling link is skipped and a link to a directory is not followed
+  if ((symlink("missing.las", test_directory_path("dangling.las").c_str()) != 0) || (symlink("..", test_directory_path("sub/loop").c_str()) != 0))
+  {
+    fprintf(stderr, "cannot create symbolic links in '%s'\n", TEST_DIRECTORY_ROOT);
+    return FALSE;
+  }
+#endif
+  return TRUE;
+}
+
+// adds the directory with the extensions and the exclude patterns (separated
+// by blanks) and compares with the expected paths (also separated by blanks)
+
+static BOOL test_directory_check(const CHAR* name, const BOOL recursive, const CHAR* extensions, const CHAR* excludes, const CHAR* expected)
+{
+  U32 i;
+  LASreadOpener lasreadopener;
+  lasreadopener.set_extensions(extensions);
+  const CHAR* p = excludes;
+  while (p && *p)
+  {
+    const CHAR* end = strchr(p, ' ');
+    if (end == 0) end = p + strlen(p);
+    // a pattern with a slash is matched against the path
+    std::string pattern(p, end - p);
+    for (i = 0; i < pattern.size(); i++)
+    {
+      if (pattern[i] == '/') pattern[i] = TEST_DIRECTORY_SLASH[0];
+    }
+    lasreadopener.add_exclude(pattern.c_str());
+    p = (*end ? end + 1 : end);
+  }
+  if (!lasreadopener.add_directory(TEST_DIRECTORY_ROOT, recursive))
+  {
+    fprintf(stderr, "%s: cannot add directory '%s'\n", name, TEST_DIRECTORY_ROOT);
+    return FALSE;
+  }
+  // adding the same directory again adds no file twice
+  if (!lasreadopener.add_directory(TEST_DIRECTORY_ROOT TEST_DIRECTORY_SLASH, recursive))
+  {
+    fprintf(stderr, "%s: cannot add directory '%s' again\n", name, TEST_DIRECTORY_ROOT TEST_DIRECTORY_SLASH);
+    return FALSE;
+  }
+  std::string paths;
+  for (i = 0; i < lasreadopener.get_file_name_number(); i++)
+  {
+    if (i) paths += " ";
+    paths += lasreadopener.get_path(i) + strlen(TEST_DIRECTORY_ROOT TEST_DIRECTORY_SLASH);
+  }
+  std::string wanted = expected;
+  for (i = 0; i < wanted.size(); i++)
+  {
+    if (wanted[i] == '/') wanted[i] = TEST_DIRECTORY_SLASH[0];
+  }
+  if (paths != wanted)
+  {
+    fprintf(stderr, "%s: added '%s' and not '%s'\n", name, paths.c_str(), wanted.c_str());
+    return FALSE;
+  }
+  return TRUE;
+}
+
+BOOL test_directory()
+{
+  if (!test_directory_build())
+  {
+    test_directory_clean();
+    return FALSE;
+  }
+  BOOL success = TRUE;
+  if (!test_directory_check("directory", FALSE, 0, 0, "skip_me.las B.LAZ a.las") ||
+      !test_directory_check("recursive", TRUE, 0, 0, "skip_me.las sub/deep/f.las old/h.las sub/d.laz B.LAZ sub/x.las sub/deep/g.laz a.las sub/E.Las") ||
+      !test_directory_check("exclude name", TRUE, 0, "skip_* ?.laz", "sub/deep/f.las old/h.las B.LAZ sub/x.las a.las sub/E.Las") ||
+      !test_directory_check("exclude path", TRUE, 0, "*/old */deep/*", "skip_me.las sub/d.laz B.LAZ sub/x.las a.las sub/E.Las") ||
+      !test_directory_check("exclude path not name", FALSE, 0, "*/a.las lastest_*", "skip_me.las B.LAZ") ||
+      !test_directory_check("ext", TRUE, "LAZ", "skip_*", "sub/d.laz B.LAZ sub/deep/g.laz") ||
+      !test_directory_check("ext list", TRUE, ".txt,las", "skip_* */old", "sub/deep/f.las sub/x.las a.las sub/E.Las c.txt") ||
+      !test_directory_check("ext not part", FALSE, "la,s,laz.", 0, ""))
+  {
+    success = FALSE;
+  }
+  LASreadOpener lasreadopener;
+  if (lasreadopener.add_directory(TEST_DIRECTORY_ROOT TEST_DIRECTORY_SLASH "missing", TRUE))
+  {
+    fprintf(stderr, "a missing directory can be added\n");
+    success = FALSE;
+  }
+  test_directory_clean();
+  return success;
+}
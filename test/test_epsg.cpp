@@ -0,0 +1,132 @@
+/*
+===============================================================================
+
+  FILE:  test_epsg.cpp
+
+  CONTENTS:
+
+    CRScheck looks up the EPSG code of the ProjectedCSTypeGeoKey with a
+    binary search in the table that crsepsg.py generates. this checks that
+    the table is strictly sorted by code, that every code of it is found,
+    and that codes between, before, and after its codes are not. a small
+    table with codes above 32767 checks the search on the full range of the
+    unsigned GeoKey.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created to check the generated table of EPSG codes
+
+===============================================================================
+*/
+#include "lastest.hpp"
+#include "crscheck.hpp"
+#include "crsepsg.hpp"
+
+#include <stdio.h>
+
+static const CRSepsg test_epsg_high[] =
+{
+  { 1, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "one" },
+  { 2000, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "low" },
+  { 32767, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "largest signed" },
+  { 32768, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "smallest negative if signed" },
+  { 40000, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "high" },
+  { 65535, CRS_EPSG_NAME, CRS_EPSG_UNITS_NONE, -1, 0, -1, 0, "largest" },
+};
+
+static const U32 test_epsg_high_number = sizeof(test_epsg_high)/sizeof(CRSepsg);
+
+// codes that are in neither table
+
+static const U16 test_epsg_missing[] = { 0, 2, 1999, 32766, 32769, 39999, 40001, 65534 };
+
+static BOOL test_epsg_table()
+{
+  U32 i;
+  if (crs_epsg_number == 0)
+  {
+    fprintf(stderr, "the table of EPSG codes is empty\n");
+    return FALSE;
+  }
+  for (i = 0; i < crs_epsg_number; i++)
+  {
+    const U16 code = crs_epsg_table[i].code;
+    if ((i == 0) ? (code == 0) : (crs_epsg_table[i-1].code >= code))
+    {
+      fprintf(stderr, "EPSG code %u at %u does not follow %u\n", code, i, (i ? crs_epsg_table[i-1].code : 0));
+      return FALSE;
+    }
+    if (crs_epsg_find(code) != &crs_epsg_table[i])
+    {
+      fprintf(stderr, "EPSG code %u at %u is not found\n", code, i);
+      return FALSE;
+    }
+    // the codes between this one and the next
+    const U32 next = ((i + 1) < crs_epsg_number ? crs_epsg_table[i+1].code : 65536);
+    if (((code + 1) < next) && (crs_epsg_find((U16)(code + 1)) || crs_epsg_find((U16)(next - 1))))
+    {
+      fprintf(stderr, "EPSG code %u or %u between %u and %u is found\n", code + 1, next - 1, code, next);
+      return FALSE;
+    }
+  }
+  if (crs_epsg_find(0) || crs_epsg_find((U16)(crs_epsg_table[0].code - 1)) || crs_epsg_find(32767) || crs_epsg_find(32768) || crs_epsg_find(65535))
+  {
+    fprintf(stderr, "an EPSG code outside the table is found\n");
+    return FALSE;
+  }
+  return TRUE;
+}
+
+static BOOL test_epsg_search()
+{
+  U32 i, n;
+  for (i = 0; i < test_epsg_high_number; i++)
+  {
+    if (crs_epsg_search(test_epsg_high, test_epsg_high_number, test_epsg_high[i].code) != &test_epsg_high[i])
+    {
+      fprintf(stderr, "code %u at %u is not found\n", test_epsg_high[i].code, i);
+      return FALSE;
+    }
+  }
+  for (i = 0; i < sizeof(test_epsg_missing)/sizeof(U16); i++)
+  {
+    for (n = 0; n <= test_epsg_high_number; n++)
+    {
+      if (crs_epsg_search(test_epsg_high, n, test_epsg_missing[i]))
+      {
+        fprintf(stderr, "missing code %u is found in the first %u codes\n", test_epsg_missing[i], n);
+        return FALSE;
+      }
+    }
+  }
+  // the codes that lie beyond a shorter table
+  for (n = 0; n < test_epsg_high_number; n++)
+  {
+    if (crs_epsg_search(test_epsg_high, n, test_epsg_high[n].code))
+    {
+      fprintf(stderr, "code %u is found in the first %u codes\n", test_epsg_high[n].code, n);
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+BOOL test_epsg()
+{
+  return test_epsg_table() && test_epsg_search();
+}
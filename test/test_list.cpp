@@ -0,0 +1,186 @@
+/*
+===============================================================================
+
+  FILE:  test_list.cpp
+
+  CONTENTS:
+
+    The LASreadOpener splits a list of files in large blocks into lines and
+    keeps the names in one arena that a hash set makes unique. this writes a
+    list with carriage returns, trailing blanks, empty lines, duplicates,
+    names longer than the block, and enough names to grow the hash set past
+    its load factor several times, and checks which names are added in which
+    order with and without unique.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created to check the splitting and the deduplication of lists of files
+
+===============================================================================
+*/
+#include "lastest.hpp"
+#include "lasreadopener.hpp"
+
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#define TEST_LIST_FILE "lastest_list.txt"
+
+// more than the 512 names that fill the first hash set of 1024 to its half
+
+#define TEST_LIST_NAMES 3000
+
+// longer than the first and the doubled block of 65536 bytes
+
+#define TEST_LIST_LONG 200000
+
+static std::string test_list_name(const U32 i)
+{
+  CHAR name[32];
+  sprintf(name, "tiles/tile_%05u.laz", i);
+  return name;
+}
+
+// writes the list and returns the names that are added with unique and
+// without it
+
+static BOOL test_list_write(std::vector<std::string>& unique, std::vector<std::string>& all)
+{
+  FILE* file = fopen(TEST_LIST_FILE, "wb");
+  if (file == 0)
+  {
+    fprintf(stderr, "cannot create '%s'\n", TEST_LIST_FILE);
+    return FALSE;
+  }
+  const std::string long_name = "long/" + std::string(TEST_LIST_LONG, 'x') + ".las";
+  fprintf(file, "a.las\r\n");
+  fprintf(file, "b.laz  \t\r\n");
+  fprintf(file, "\r\n");
+  fprintf(file, " \t \n");
+  fprintf(file, "\n");
+  fprintf(file, "a.las\n");
+  fprintf(file, "with blank.las \n");
+  fprintf(file, "%s\r\n", long_name.c_str());
+  fprintf(file, "b.laz\n");
+  const CHAR* first[] = { "a.las", "b.laz", "a.las", "with blank.las", 0, "b.laz" };
+  U32 i;
+  for (i = 0; i < 6; i++)
+  {
+    all.push_back(first[i] ? first[i] : long_name);
+  }
+  unique.push_back("a.las");
+  unique.push_back("b.laz");
+  unique.push_back("with blank.las");
+  unique.push_back(long_name);
+  // every name twice, the second time after the next one and with CRLF
+  for (i = 0; i < TEST_LIST_NAMES; i++)
+  {
+    fprintf(file, "%s\n", test_list_name(i).c_str());
+    all.push_back(test_list_name(i));
+    unique.push_back(test_list_name(i));
+    if (i)
+    {
+      fprintf(file, "%s\r\n", test_list_name(i-1).c_str());
+      all.push_back(test_list_name(i-1));
+    }
+  }
+  fprintf(file, "%s\r\n", long_name.c_str());
+  all.push_back(long_name);
+  // the last line does not end with a new line
+  fprintf(file, "last.las  ");
+  all.push_back("last.las");
+  unique.push_back("last.las");
+  fclose(file);
+  return TRUE;
+}
+
+static BOOL test_list_check(const CHAR* name, const LASreadOpener& lasreadopener, const std::vector<std::string>& expected)
+{
+  if (lasreadopener.get_file_name_number() != expected.size())
+  {
+    fprintf(stderr, "%s: %u and not %u file names\n", name, lasreadopener.get_file_name_number(), (U32)expected.size());
+    return FALSE;
+  }
+  U32 i;
+  for (i = 0; i < expected.size(); i++)
+  {
+    if (expected[i] != lasreadopener.get_path(i))
+    {
+      fprintf(stderr, "%s: file name %u is '%.40s' and not '%.40s'\n", name, i, lasreadopener.get_path(i), expected[i].c_str());
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+BOOL test_list()
+{
+  std::vector<std::string> unique, all;
+  if (!test_list_write(unique, all))
+  {
+    return FALSE;
+  }
+  BOOL success = TRUE;
+
+  // all lines that are not empty
+
+  {
+    LASreadOpener lasreadopener;
+    if (!lasreadopener.add_list_of_files(TEST_LIST_FILE, FALSE) || !test_list_check("list", lasreadopener, all))
+    {
+      success = FALSE;
+    }
+  }
+
+  // each name once
+
+  {
+    LASreadOpener lasreadopener;
+    if (!lasreadopener.add_list_of_files(TEST_LIST_FILE, TRUE) || !test_list_check("unique list", lasreadopener, unique))
+    {
+      success = FALSE;
+    }
+  }
+
+  // the hash set is built only when the first unique name is added and must
+  // then also know the names that were added before
+
+  {
+    LASreadOpener lasreadopener;
+    if (!lasreadopener.add_list_of_files(TEST_LIST_FILE, FALSE) || !lasreadopener.add_list_of_files(TEST_LIST_FILE, TRUE) || !test_list_check("unique list after the list", lasreadopener, all))
+    {
+      success = FALSE;
+    }
+  }
+
+  // a list that does not exist
+
+  {
+    LASreadOpener lasreadopener;
+    if (lasreadopener.add_list_of_files(TEST_LIST_FILE ".missing", TRUE) || lasreadopener.get_file_name_number())
+    {
+      fprintf(stderr, "a missing list adds %u file names\n", lasreadopener.get_file_name_number());
+      success = FALSE;
+    }
+  }
+
+  remove(TEST_LIST_FILE);
+  return success;
+}
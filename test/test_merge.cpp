@@ -0,0 +1,247 @@
+/*
+===============================================================================
+
+  FILE:  test_merge.cpp
+
+  CONTENTS:
+
+    The points of a file that are read in parallel are added to one inventory
+    and one summary per shard that are then merged. this splits random points
+    of several point types into random shards (some of them empty), merges
+    them in random order of neighbours, and compares the result with that of
+    adding all points sequentially.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created to keep merged summaries equal to sequential ones
+
+===============================================================================
+*/
+#include "lastest.hpp"
+#include "lasheader.hpp"
+#include "laspoint.hpp"
+#include "lasutility.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#define TEST_MERGE_POINTS 5000
+#define TEST_MERGE_SPLITS 50
+#define TEST_MERGE_MAX_SHARDS 16
+
+static const U8 test_merge_types[] = { 1, 5, 6, 8, 10 };
+static const U16 test_merge_sizes[] = { 28, 63, 30, 38, 67 };
+
+// random attributes with some runs of equal values and coordinates that are
+// often multiples of 10 so that also the fluff counts differ between shards
+
+static void random_point(LASpoint* laspoint, const BOOL extended, U64& state)
+{
+  I32 fluff = ((lastest_random(state) % 4) ? 10 : 1);
+  laspoint->X = (I32)(lastest_random(state) % 2000000) * fluff - 10000000;
+  laspoint->Y = (I32)(lastest_random(state) % 2000000) * fluff + 5000;
+  laspoint->Z = (I32)(lastest_random(state) % 100000) - 50000;
+  laspoint->intensity = (U16)lastest_random(state);
+  laspoint->number_of_returns = (U8)(1 + lastest_random(state) % (extended ? 15 : 7));
+  laspoint->return_number = (U8)(lastest_random(state) % (laspoint->number_of_returns + 2));
+  laspoint->classification_flags = (U8)(lastest_random(state) % 16);
+  laspoint->scan_direction_flag = (U8)(lastest_random(state) % 2);
+  laspoint->edge_of_flight_line = (U8)(lastest_random(state) % 2);
+  laspoint->classification = (U8)(lastest_random(state) % (extended ? 256 : 32));
+  laspoint->user_data = (U8)lastest_random(state);
+  laspoint->scan_angle = (I16)(lastest_random(state) % 30001) - 15000;
+  laspoint->scan_angle_rank = (I8)(lastest_random(state) % 181 - 90);
+  laspoint->point_source_ID = (U16)(lastest_random(state) % 1000);
+  // like a reader this leaves the attributes that the point type does not have zero
+  if (laspoint->have_gps_time)
+  {
+    laspoint->gps_time = 1e8 + 1e5 * lastest_uniform(state);
+  }
+  if (laspoint->have_rgb)
+  {
+    laspoint->rgbi[0] = (U16)lastest_random(state);
+    laspoint->rgbi[1] = (U16)lastest_random(state);
+    laspoint->rgbi[2] = (U16)lastest_random(state);
+  }
+  if (laspoint->have_nir)
+  {
+    laspoint->rgbi[3] = (U16)lastest_random(state);
+  }
+  if (laspoint->have_wave_packet)
+  {
+    *((U8*)&laspoint->wave_packet) = (U8)(lastest_random(state) % 256);
+  }
+}
+
+#define SAME(field) if (memcmp(&a.field, &b.field, sizeof(a.field)) != 0) { fprintf(stderr, "%s differs\n", #field); return FALSE; }
+
+static BOOL same_inventory(const LASinventory& a, const LASinventory& b)
+{
+  if (a.is_active() != b.is_active()) { fprintf(stderr, "activity differs\n"); return FALSE; }
+  SAME(number_of_point_records);
+  SAME(number_of_points_by_return);
+  SAME(number_of_returns_of_given_pulse);
+  SAME(return_count_for_return_number);
+  SAME(min_X); SAME(max_X); SAME(min_Y); SAME(max_Y); SAME(min_Z); SAME(max_Z);
+  SAME(min_intensity); SAME(max_intensity);
+  SAME(min_point_source_ID); SAME(max_point_source_ID);
+  SAME(min_scan_angle_rank); SAME(max_scan_angle_rank);
+  SAME(min_scan_angle); SAME(max_scan_angle);
+  SAME(min_gps_time); SAME(max_gps_time);
+  SAME(min_R); SAME(max_R); SAME(min_G); SAME(max_G); SAME(min_B); SAME(max_B); SAME(min_I); SAME(max_I);
+  SAME(xyz_fluff_10); SAME(xyz_fluff_100); SAME(xyz_fluff_1000);
+  SAME(wave_packet_index_mask);
+  return TRUE;
+}
+
+static BOOL same_summary(const LASsummary& a, const LASsummary& b)
+{
+  if (a.active() != b.active()) { fprintf(stderr, "activity differs\n"); return FALSE; }
+  SAME(number_of_point_records);
+  SAME(number_of_points_by_return);
+  SAME(number_of_returns);
+  SAME(classification);
+  SAME(extended_classification);
+  SAME(flagged_synthetic); SAME(flagged_synthetic_classification);
+  SAME(flagged_keypoint); SAME(flagged_keypoint_classification);
+  SAME(flagged_withheld); SAME(flagged_withheld_classification);
+  SAME(flagged_extended_overlap); SAME(flagged_extended_overlap_classification);
+  SAME(xyz_low_digits_10); SAME(xyz_low_digits_100); SAME(xyz_low_digits_1000); SAME(xyz_low_digits_10000);
+  SAME(xyz_fluff_10); SAME(xyz_fluff_100); SAME(xyz_fluff_1000); SAME(xyz_fluff_10000);
+  // the attributes that add() keeps the minimum and maximum of
+  SAME(min.X); SAME(max.X); SAME(min.Y); SAME(max.Y); SAME(min.Z); SAME(max.Z);
+  SAME(min.intensity); SAME(max.intensity);
+  SAME(min.point_source_ID); SAME(max.point_source_ID);
+  SAME(min.scan_angle_rank); SAME(max.scan_angle_rank);
+  SAME(min.classification); SAME(max.classification);
+  SAME(min.user_data); SAME(max.user_data);
+  if ((a.min.return_number != b.min.return_number) || (a.max.return_number != b.max.return_number)) { fprintf(stderr, "return_number differs\n"); return FALSE; }
+  if ((a.min.number_of_returns != b.min.number_of_returns) || (a.max.number_of_returns != b.max.number_of_returns)) { fprintf(stderr, "number_of_returns differs\n"); return FALSE; }
+  if ((a.min.scan_direction_flag != b.min.scan_direction_flag) || (a.max.scan_direction_flag != b.max.scan_direction_flag)) { fprintf(stderr, "scan_direction_flag differs\n"); return FALSE; }
+  if ((a.min.edge_of_flight_line != b.min.edge_of_flight_line) || (a.max.edge_of_flight_line != b.max.edge_of_flight_line)) { fprintf(stderr, "edge_of_flight_line differs\n"); return FALSE; }
+  return TRUE;
+}
+
+#undef SAME
+
+static BOOL test_merge_type(const U8 point_type, const U16 point_size, U64& state)
+{
+  LASheader lasheader;
+  std::vector<LASpoint> laspoints(TEST_MERGE_POINTS);
+  U32 i, j;
+  for (i = 0; i < TEST_MERGE_POINTS; i++)
+  {
+    laspoints[i].init(&lasheader, point_type, point_size);
+    random_point(&laspoints[i], (point_type >= 6), state);
+  }
+
+  LASinventory sequential_inventory;
+  LASsummary sequential_summary;
+  for (i = 0; i < TEST_MERGE_POINTS; i++)
+  {
+    sequential_inventory.add(&laspoints[i]);
+    sequential_summary.add(&laspoints[i]);
+  }
+
+  LASpointBatch laspointbatch;
+  laspointbatch.init(&laspoints[0], TEST_MERGE_POINTS);
+
+  U32 split;
+  for (split = 0; split < TEST_MERGE_SPLITS; split++)
+  {
+    // the shards are ranges between random cuts. equal cuts make empty shards
+
+    U32 shards = 1 + (U32)(lastest_random(state) % TEST_MERGE_MAX_SHARDS);
+    std::vector<U32> cuts;
+    cuts.push_back(0);
+    for (j = 1; j < shards; j++)
+    {
+      cuts.push_back((U32)(lastest_random(state) % (TEST_MERGE_POINTS + 1)));
+    }
+    cuts.push_back(TEST_MERGE_POINTS);
+    std::sort(cuts.begin(), cuts.end());
+
+    // the inventories add single points or batches as lasvalidate does
+
+    std::vector<LASinventory*> inventories(shards);
+    std::vector<LASsummary*> summaries(shards);
+    for (j = 0; j < shards; j++)
+    {
+      inventories[j] = new LASinventory();
+      summaries[j] = new LASsummary();
+      BOOL batched = (BOOL)(lastest_random(state) % 2);
+      laspointbatch.number = 0;
+      for (i = cuts[j]; i < cuts[j+1]; i++)
+      {
+        if (batched)
+        {
+          laspointbatch.add(&laspoints[i]);
+        }
+        else
+        {
+          inventories[j]->add(&laspoints[i]);
+        }
+        summaries[j]->add(&laspoints[i]);
+      }
+      if (batched && laspointbatch.number)
+      {
+        inventories[j]->add(&laspointbatch);
+      }
+    }
+
+    // merge random neighbours until one is left
+
+    while (inventories.size() > 1)
+    {
+      j = (U32)(lastest_random(state) % (inventories.size() - 1));
+      inventories[j]->merge(*inventories[j+1]);
+      summaries[j]->merge(*summaries[j+1]);
+      delete inventories[j+1];
+      delete summaries[j+1];
+      inventories.erase(inventories.begin() + j + 1);
+      summaries.erase(summaries.begin() + j + 1);
+    }
+
+    BOOL same = same_inventory(*inventories[0], sequential_inventory) && same_summary(*summaries[0], sequential_summary);
+    delete inventories[0];
+    delete summaries[0];
+    if (!same)
+    {
+      fprintf(stderr, "point type %d split %u into %u shards merges differently than sequential\n", point_type, split, shards);
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+BOOL test_merge()
+{
+  U64 state = 20261018;
+  U32 t;
+  for (t = 0; t < sizeof(test_merge_types); t++)
+  {
+    if (!test_merge_type(test_merge_types[t], test_merge_sizes[t], state))
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
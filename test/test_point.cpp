@@ -0,0 +1,268 @@
+/*
+===============================================================================
+
+  FILE:  test_point.cpp
+
+  CONTENTS:
+
+    The item readers write every point into the LAS 1.4 field layout of the
+    LASpoint. this reads a LAS 1.2 file with point data format 1 and a LAS 1.4
+    file with point data format 6 from memory and checks that the getters
+    (including the extended ones) and the columns that read_points() fills
+    return the return numbers, numbers of returns, flags, classifications,
+    and scan angles that the points were written with.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created to keep the bitfields of LASpoint in the LAS 1.4 layout
+
+===============================================================================
+*/
+#include "lastest.hpp"
+#include "lasreader.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <sstream>
+#include <string>
+
+#define TEST_POINT_NUMBER 5
+
+// the attributes of point i. the LAS 1.4 values use all 4 bits of the return
+// fields, all 8 bits of the classification, and the scanner channel
+
+struct TestPoint
+{
+  U8 return_number;
+  U8 number_of_returns;
+  U8 classification;
+  U8 classification_flags;
+  U8 scanner_channel;
+  U8 scan_direction_flag;
+  U8 edge_of_flight_line;
+  I8 scan_angle_rank;
+  I16 scan_angle;
+  F64 gps_time;
+};
+
+static TestPoint test_point_values(const U32 i, const BOOL las14)
+{
+  TestPoint point;
+  if (las14)
+  {
+    point.return_number = (U8)(11 + i);
+    point.number_of_returns = 15;
+    point.classification = (U8)(200 + i);
+    point.classification_flags = (U8)(15 - 3*i);
+    point.scanner_channel = (U8)(i & 3);
+    point.scan_angle_rank = 0;
+    point.scan_angle = (I16)(-15000 + 7000*(I32)i);
+  }
+  else
+  {
+    point.return_number = (U8)(3 + i);
+    point.number_of_returns = 7;
+    point.classification = (U8)(27 + i);
+    point.classification_flags = (U8)(7 - i);
+    point.scanner_channel = 0;
+    point.scan_angle_rank = (I8)(-90 + 45*(I32)i);
+    // the reader converts the scan angle rank
+    point.scan_angle = I16_QUANTIZE(166.6666666f * point.scan_angle_rank);
+  }
+  point.scan_direction_flag = (U8)(i & 1);
+  point.edge_of_flight_line = (U8)((i >> 1) & 1);
+  point.gps_time = 1000.25 + 3*i;
+  return point;
+}
+
+static void put_bytes(std::string& bytes, const size_t offset, const void* value, const size_t size)
+{
+  if (bytes.size() < offset + size) bytes.resize(offset + size, '\0');
+  memcpy(&bytes[offset], value, size);
+}
+
+static void put_U8(std::string& bytes, const size_t offset, const U8 value) { put_bytes(bytes, offset, &value, 1); }
+static void put_U16(std::string& bytes, const size_t offset, const U16 value) { put_bytes(bytes, offset, &value, 2); }
+static void put_U32(std::string& bytes, const size_t offset, const U32 value) { put_bytes(bytes, offset, &value, 4); }
+static void put_U64(std::string& bytes, const size_t offset, const U64 value) { put_bytes(bytes, offset, &value, 8); }
+static void put_F64(std::string& bytes, const size_t offset, const F64 value) { put_bytes(bytes, offset, &value, 8); }
+
+// a file without VLRs whose points lie on the diagonal from (0,0,0) to (4,4,4)
+
+static std::string test_point_file(const BOOL las14)
+{
+  const U16 header_size = (las14 ? 375 : 227);
+  const U16 point_size = (las14 ? 30 : 28);
+  std::string bytes;
+  put_bytes(bytes, 0, "LASF", 4);
+  put_U8(bytes, 24, 1);
+  put_U8(bytes, 25, (las14 ? 4 : 2));
+  put_bytes(bytes, 26, "lastest", 7);
+  put_bytes(bytes, 58, "test_point", 10);
+  put_U16(bytes, 92, 2026);
+  put_U16(bytes, 94, header_size);
+  put_U32(bytes, 96, header_size);
+  put_U8(bytes, 104, (las14 ? 6 : 1));
+  put_U16(bytes, 105, point_size);
+  put_U32(bytes, 107, (las14 ? 0 : TEST_POINT_NUMBER));
+  U32 i;
+  for (i = 0; i < 3; i++)
+  {
+    put_F64(bytes, 131 + 8*i, 0.01);
+    put_F64(bytes, 179 + 16*i, 0.01*100*(TEST_POINT_NUMBER-1));
+  }
+  if (las14)
+  {
+    put_U64(bytes, 235, 0);
+    put_U32(bytes, 243, 0);
+    put_U64(bytes, 247, TEST_POINT_NUMBER);
+    put_U64(bytes, 255 + 8*(11-1), 1);
+    put_U64(bytes, 255 + 8*(12-1), 1);
+    put_U64(bytes, 255 + 8*(13-1), 1);
+    put_U64(bytes, 255 + 8*(14-1), 1);
+    put_U64(bytes, 255 + 8*(15-1), 1);
+  }
+  else
+  {
+    put_U32(bytes, 111 + 4*(3-1), 1);
+    put_U32(bytes, 111 + 4*(4-1), 1);
+    put_U32(bytes, 111 + 4*(5-1), 1);
+  }
+  for (i = 0; i < TEST_POINT_NUMBER; i++)
+  {
+    const TestPoint point = test_point_values(i, las14);
+    size_t offset = (size_t)header_size + (size_t)i*point_size;
+    put_U32(bytes, offset + 0, 100*i);
+    put_U32(bytes, offset + 4, 100*i);
+    put_U32(bytes, offset + 8, 100*i);
+    put_U16(bytes, offset + 12, (U16)(10*i));
+    if (las14)
+    {
+      put_U8(bytes, offset + 14, (U8)(point.return_number | (point.number_of_returns << 4)));
+      put_U8(bytes, offset + 15, (U8)(point.classification_flags | (point.scanner_channel << 4) | (point.scan_direction_flag << 6) | (point.edge_of_flight_line << 7)));
+      put_U8(bytes, offset + 16, point.classification);
+      put_U8(bytes, offset + 17, (U8)i);
+      put_U16(bytes, offset + 18, (U16)point.scan_angle);
+      put_U16(bytes, offset + 20, (U16)(7 + i));
+      put_F64(bytes, offset + 22, point.gps_time);
+    }
+    else
+    {
+      put_U8(bytes, offset + 14, (U8)(point.return_number | (point.number_of_returns << 3) | (point.scan_direction_flag << 6) | (point.edge_of_flight_line << 7)));
+      put_U8(bytes, offset + 15, (U8)(point.classification | (point.classification_flags << 5)));
+      put_U8(bytes, offset + 16, (U8)point.scan_angle_rank);
+      put_U8(bytes, offset + 17, (U8)i);
+      put_U16(bytes, offset + 18, (U16)(7 + i));
+      put_F64(bytes, offset + 20, point.gps_time);
+    }
+  }
+  return bytes;
+}
+
+static BOOL test_point_getters(const CHAR* name, const LASpoint& p, const U32 i, const BOOL las14)
+{
+  const TestPoint point = test_point_values(i, las14);
+  BOOL same = (p.get_X() == (I32)(100*i)) && (p.get_intensity() == (U16)(10*i)) && (p.get_user_data() == i) && (p.get_point_source_ID() == 7 + i) &&
+              (p.get_return_number() == point.return_number) && (p.get_number_of_returns() == point.number_of_returns) &&
+              (p.get_extended_return_number() == point.return_number) && (p.get_extended_number_of_returns() == point.number_of_returns) &&
+              (p.get_number_of_returns_of_given_pulse() == point.number_of_returns) &&
+              (p.get_classification() == point.classification) && (p.get_extended_classification() == point.classification) &&
+              (p.get_classification_flags() == point.classification_flags) && (p.get_scanner_channel() == point.scanner_channel) &&
+              (p.get_scan_direction_flag() == point.scan_direction_flag) && (p.get_edge_of_flight_line() == point.edge_of_flight_line) &&
+              (p.get_scan_angle() == point.scan_angle) && (p.get_gps_time() == point.gps_time);
+  if (!las14)
+  {
+    same = same && (p.get_scan_angle_rank() == point.scan_angle_rank);
+  }
+  if (!same)
+  {
+    fprintf(stderr, "%s: point %u has return %u of %u, classification %u with flags %u, channel %u, flags %u/%u, scan angle %d (rank %d) and not return %u of %u, classification %u with flags %u, channel %u, flags %u/%u, scan angle %d (rank %d)\n", name, i,
+      p.get_return_number(), p.get_number_of_returns(), p.get_classification(), p.get_classification_flags(), p.get_scanner_channel(), p.get_scan_direction_flag(), p.get_edge_of_flight_line(), p.get_scan_angle(), p.get_scan_angle_rank(),
+      point.return_number, point.number_of_returns, point.classification, point.classification_flags, point.scanner_channel, point.scan_direction_flag, point.edge_of_flight_line, point.scan_angle, point.scan_angle_rank);
+  }
+  return same;
+}
+
+static BOOL test_point_format(const BOOL las14)
+{
+  const CHAR* name = (las14 ? "LAS 1.4 point data format 6" : "LAS 1.2 point data format 1");
+  const std::string bytes = test_point_file(las14);
+
+  // one point at a time
+
+  std::istringstream stream(bytes);
+  LASreader lasreader;
+  if (!lasreader.open(stream))
+  {
+    fprintf(stderr, "%s: cannot open\n", name);
+    return FALSE;
+  }
+  U32 i = 0;
+  while (lasreader.read_point())
+  {
+    if ((i >= TEST_POINT_NUMBER) || !test_point_getters(name, lasreader.point, i, las14))
+    {
+      lasreader.close();
+      return FALSE;
+    }
+    i++;
+  }
+  lasreader.close();
+  if (i != TEST_POINT_NUMBER)
+  {
+    fprintf(stderr, "%s: read %u and not %u points\n", name, i, TEST_POINT_NUMBER);
+    return FALSE;
+  }
+
+  // the columns of a batch
+
+  std::istringstream batchstream(bytes);
+  if (!lasreader.open(batchstream))
+  {
+    fprintf(stderr, "%s: cannot open again\n", name);
+    return FALSE;
+  }
+  LASpointBatch laspointbatch;
+  if (!laspointbatch.init(&lasreader.point, TEST_POINT_NUMBER) || (lasreader.read_points(TEST_POINT_NUMBER, &laspointbatch) != TEST_POINT_NUMBER))
+  {
+    fprintf(stderr, "%s: cannot read a batch of %u points\n", name, TEST_POINT_NUMBER);
+    lasreader.close();
+    return FALSE;
+  }
+  lasreader.close();
+  for (i = 0; i < TEST_POINT_NUMBER; i++)
+  {
+    const TestPoint point = test_point_values(i, las14);
+    if ((laspointbatch.return_number[i] != point.return_number) || (laspointbatch.number_of_returns[i] != point.number_of_returns) ||
+        (laspointbatch.classification[i] != point.classification) || (laspointbatch.scan_angle[i] != point.scan_angle) ||
+        (!las14 && (laspointbatch.scan_angle_rank[i] != point.scan_angle_rank)) || (laspointbatch.gps_time[i] != point.gps_time))
+    {
+      fprintf(stderr, "%s: point %u of the batch has return %u of %u, classification %u, scan angle %d and not return %u of %u, classification %u, scan angle %d\n", name, i,
+        laspointbatch.return_number[i], laspointbatch.number_of_returns[i], laspointbatch.classification[i], laspointbatch.scan_angle[i],
+        point.return_number, point.number_of_returns, point.classification, point.scan_angle);
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+BOOL test_point()
+{
+  return test_point_format(FALSE) && test_point_format(TRUE);
+}
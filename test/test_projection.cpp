@@ -0,0 +1,184 @@
+/*
+===============================================================================
+
+  FILE:  test_projection.cpp
+
+  CONTENTS:
+
+    GeoProjectionConverter::to_lat_long() and from_lat_long() convert arrays
+    of coordinates with constants that are precomputed once per call. this
+    compares them on a grid of +-3 degrees around the origin of UTM, TM, and
+    LCC projections in meters and in US survey feet with the scalar code that
+    converts one point at a time.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created to keep the array conversions as exact as the scalar ones
+
+===============================================================================
+*/
+#include "lastest.hpp"
+#include "geoprojectionconverter.hpp"
+
+#include <stdio.h>
+#include <math.h>
+
+#include <vector>
+
+#define TEST_PROJECTION_GRID 200
+
+// the inverse must agree to 1e-9 degrees (about 0.1 millimeters). the forward
+// result is a coordinate of up to 10^7 units whose last bits differ when the
+// series is evaluated in another order, so it must agree to 1e-7 units
+
+#define TEST_PROJECTION_MAX_DEGREES 1e-9
+#define TEST_PROJECTION_MAX_UNITS 1e-7
+
+static const CHAR* test_projection_names[] = { "UTM 10N", "UTM 56S", "TM AZ", "LCC CA3", "TM IE" };
+static const F64 test_projection_latitudes[] = { 47.0, -33.0, 33.0, 37.5, 53.5 };
+static const F64 test_projection_longitudes[] = { -123.0, 153.0, -110.17, -120.5, -8.0 };
+
+static void set_projection(GeoProjectionConverter* converter, const U32 which, const BOOL source)
+{
+  switch (which)
+  {
+  case 0:
+    converter->set_utm_projection(10, true, 0, source);
+    break;
+  case 1:
+    converter->set_utm_projection(56, false, 0, source);
+    break;
+  case 2:
+    converter->set_transverse_mercator_projection(500000.0, 0.0, 31.0, -110.1666667, 0.9999, 0, source);
+    break;
+  case 3:
+    converter->set_lambert_conformal_conic_projection(2000000.0, 500000.0, 36.5, -120.5, 38.43333333, 37.06666667, 0, source);
+    break;
+  default:
+    converter->set_transverse_mercator_projection(200000.0, 750000.0, 53.5, -8.0, 1.000035, 0, source);
+    break;
+  }
+}
+
+const CHAR* lastest_projection(const U32 projection, GeoProjectionConverter* projected, GeoProjectionConverter* longlat, F64* latitude, F64* longitude)
+{
+  U32 which = projection / 2;
+  BOOL feet = (projection & 1);
+  int ellipsoid = (which == 4 ? GEO_ELLIPSOID_AIRY : GEO_ELLIPSOID_WGS84);
+  projected->set_reference_ellipsoid(ellipsoid);
+  set_projection(projected, which, TRUE);
+  if (feet) projected->set_coordinates_in_survey_feet(); else projected->set_coordinates_in_meter();
+  longlat->set_reference_ellipsoid(ellipsoid);
+  longlat->set_longlat_projection(0, true);
+  set_projection(longlat, which, FALSE);
+  if (feet) longlat->set_coordinates_in_survey_feet(false); else longlat->set_coordinates_in_meter(false);
+  *latitude = test_projection_latitudes[which];
+  *longitude = test_projection_longitudes[which];
+  return test_projection_names[which];
+}
+
+static BOOL test_projection_grid(const U32 projection)
+{
+  GeoProjectionConverter projected;
+  GeoProjectionConverter longlat;
+  F64 center_latitude, center_longitude;
+  const CHAR* name = lastest_projection(projection, &projected, &longlat, &center_latitude, &center_longitude);
+  const CHAR* unit = ((projection & 1) ? "US survey feet" : "meters");
+
+  const U32 S = TEST_PROJECTION_GRID;
+  const size_t n = (size_t)S*S;
+  std::vector<F64> latitude(n), longitude(n);
+  U32 i, j;
+  for (i = 0; i < S; i++)
+  {
+    for (j = 0; j < S; j++)
+    {
+      latitude[i*S+j] = center_latitude - 3.0 + 6.0*i/S;
+      longitude[i*S+j] = center_longitude - 3.0 + 6.0*j/S;
+    }
+  }
+
+  // forward
+
+  size_t k;
+  std::vector<F64> x(n), y(n), scalar_x(n), scalar_y(n);
+  for (k = 0; k < n; k++)
+  {
+    double point[3] = { longitude[k], latitude[k], 0.0 };
+    double elevation;
+    if (!longlat.to_target(point, scalar_x[k], scalar_y[k], elevation))
+    {
+      fprintf(stderr, "%s in %s: scalar code cannot project (%.9g, %.9g)\n", name, unit, latitude[k], longitude[k]);
+      return FALSE;
+    }
+  }
+  if (!projected.from_lat_long(&latitude[0], &longitude[0], n, &x[0], &y[0]))
+  {
+    fprintf(stderr, "%s in %s: from_lat_long() failed\n", name, unit);
+    return FALSE;
+  }
+  for (k = 0; k < n; k++)
+  {
+    if (!(fabs(x[k] - scalar_x[k]) <= TEST_PROJECTION_MAX_UNITS) || !(fabs(y[k] - scalar_y[k]) <= TEST_PROJECTION_MAX_UNITS))
+    {
+      fprintf(stderr, "%s in %s: from_lat_long() gives (%.17g, %.17g) and not (%.17g, %.17g) for (%.9g, %.9g)\n", name, unit, x[k], y[k], scalar_x[k], scalar_y[k], latitude[k], longitude[k]);
+      return FALSE;
+    }
+  }
+
+  // inverse of the projected grid
+
+  std::vector<F64> scalar_latitude(n), scalar_longitude(n);
+  for (k = 0; k < n; k++)
+  {
+    double point[3] = { scalar_x[k], scalar_y[k], 0.0 };
+    double elevation;
+    if (!projected.to_lon_lat_ele(point, scalar_longitude[k], scalar_latitude[k], elevation))
+    {
+      fprintf(stderr, "%s in %s: scalar code cannot unproject (%.17g, %.17g)\n", name, unit, scalar_x[k], scalar_y[k]);
+      return FALSE;
+    }
+  }
+  if (!projected.to_lat_long(&scalar_x[0], &scalar_y[0], n, &latitude[0], &longitude[0]))
+  {
+    fprintf(stderr, "%s in %s: to_lat_long() failed\n", name, unit);
+    return FALSE;
+  }
+  for (k = 0; k < n; k++)
+  {
+    if (!(fabs(latitude[k] - scalar_latitude[k]) <= TEST_PROJECTION_MAX_DEGREES) || !(fabs(longitude[k] - scalar_longitude[k]) <= TEST_PROJECTION_MAX_DEGREES))
+    {
+      fprintf(stderr, "%s in %s: to_lat_long() gives (%.17g, %.17g) and not (%.17g, %.17g) for (%.17g, %.17g)\n", name, unit, latitude[k], longitude[k], scalar_latitude[k], scalar_longitude[k], scalar_x[k], scalar_y[k]);
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+BOOL test_projection()
+{
+  U32 projection;
+  for (projection = 0; projection < LASTEST_PROJECTIONS; projection++)
+  {
+    if (!test_projection_grid(projection))
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
@@ -0,0 +1,230 @@
+/*
+===============================================================================
+
+  FILE:  test_raw.cpp
+
+  CONTENTS:
+
+    Uncompressed points of the standard types 0 to 10 are read by the fused
+    readers LASreadPointRaw_LE<FORMAT> instead of by a chain of raw item
+    readers. this writes records of every type with and without extra bytes
+    whose bitfields and scan angle ranks are saturated or random, reads them
+    with LASreadPoint (which picks the fused reader), with the fused reader
+    alone, and with the chain of LASreadItemRaw readers, and compares the
+    resulting LASpoints byte by byte.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created to keep the fused raw readers identical to the item readers
+
+===============================================================================
+*/
+#include "lastest.hpp"
+#include "laspoint.hpp"
+#include "lasreadpoint.hpp"
+#include "lasreaditemraw.hpp"
+#include "bytestreamin_array.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#define TEST_RAW_RANDOM 1000
+
+static const U16 test_raw_sizes[11] = { 20, 28, 26, 34, 57, 63, 30, 36, 38, 59, 67 };
+
+// the bytes of the returns, the classification, and the scan angle rank of a
+// POINT10 record or of the returns, the flags, and the classification of a
+// POINT14 record that are written before the random records
+
+static const U8 test_raw_bitfields[][3] =
+{
+  { 0x00, 0x00, 0x00 },
+  { 0xFF, 0xFF, 0xFF },
+  { 0x07, 0x1F, 0x7F },   // largest return number, classification, and scan angle rank
+  { 0x38, 0xE0, 0x80 },   // largest number of returns, classification flags, and smallest scan angle rank
+  { 0xC0, 0x00, 0x5A },   // scan direction and edge of flight line, scan angle rank 90
+  { 0x3F, 0x1F, 0xA6 },   // scan angle rank -90
+  { 0x0F, 0x30, 0x01 },
+  { 0xF0, 0xC0, 0xFE },
+};
+
+static BOOL test_raw_readers(const U32 num_items, const LASitem* items, std::vector<LASreadItem*>& readers)
+{
+  U32 i;
+  for (i = 0; i < num_items; i++)
+  {
+    switch (items[i].type)
+    {
+    case LASitem::POINT10:
+      readers.push_back(new LASreadItemRaw_POINT10_LE());
+      break;
+    case LASitem::GPSTIME11:
+      readers.push_back(new LASreadItemRaw_GPSTIME11_LE());
+      break;
+    case LASitem::RGB12:
+    case LASitem::RGB14:
+      readers.push_back(new LASreadItemRaw_RGB12_LE());
+      break;
+    case LASitem::BYTE:
+    case LASitem::BYTE14:
+      readers.push_back(new LASreadItemRaw_BYTE(items[i].size));
+      break;
+    case LASitem::POINT14:
+      readers.push_back(new LASreadItemRaw_POINT14_LE());
+      break;
+    case LASitem::RGBNIR14:
+      readers.push_back(new LASreadItemRaw_RGBNIR14_LE());
+      break;
+    case LASitem::WAVEPACKET13:
+    case LASitem::WAVEPACKET14:
+      readers.push_back(new LASreadItemRaw_WAVEPACKET13_LE());
+      break;
+    default:
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+static LASreadPointRaw test_raw_fused(const U8 format)
+{
+  switch (format)
+  {
+  case 0: return LASreadPointRaw_LE<0>;
+  case 1: return LASreadPointRaw_LE<1>;
+  case 2: return LASreadPointRaw_LE<2>;
+  case 3: return LASreadPointRaw_LE<3>;
+  case 4: return LASreadPointRaw_LE<4>;
+  case 5: return LASreadPointRaw_LE<5>;
+  case 6: return LASreadPointRaw_LE<6>;
+  case 7: return LASreadPointRaw_LE<7>;
+  case 8: return LASreadPointRaw_LE<8>;
+  case 9: return LASreadPointRaw_LE<9>;
+  default: return LASreadPointRaw_LE<10>;
+  }
+}
+
+// the fields that the item readers write: the first 32 bytes (including the
+// gps_time), the RGB and NIR, the wave packet, and the extra bytes
+
+static BOOL test_raw_same(const LASpoint& a, const LASpoint& b)
+{
+  return (memcmp(&a.X, &b.X, 32) == 0) && (memcmp(a.rgbi, b.rgbi, sizeof(a.rgbi)) == 0) &&
+         (memcmp(&a.wave_packet, &b.wave_packet, sizeof(LASwavepacket)) == 0) &&
+         ((a.number_of_extra_bytes == 0) || (memcmp(a.extra_bytes, b.extra_bytes, a.number_of_extra_bytes) == 0));
+}
+
+static BOOL test_raw_format(const U8 format, const U16 number_extra_bytes)
+{
+  const U16 point_size = test_raw_sizes[format] + number_extra_bytes;
+  const U32 number_bitfields = sizeof(test_raw_bitfields)/sizeof(test_raw_bitfields[0]);
+  const U32 number = number_bitfields + TEST_RAW_RANDOM;
+
+  // the records
+
+  U64 state = 1000*format + number_extra_bytes;
+  std::vector<U8> records((size_t)number*point_size);
+  U32 i, j;
+  for (i = 0; i < records.size(); i++)
+  {
+    records[i] = (U8)lastest_random(state);
+  }
+  for (i = 0; i < number_bitfields; i++)
+  {
+    memcpy(&records[(size_t)i*point_size + 14], test_raw_bitfields[i], 3);
+  }
+
+  // three points that are all set to the same garbage before each read
+
+  LASquantizer quantizer;
+  LASpoint points[3];
+  for (j = 0; j < 3; j++)
+  {
+    if (!points[j].init(&quantizer, format, point_size))
+    {
+      fprintf(stderr, "type %u with %u extra bytes: cannot init point\n", format, number_extra_bytes);
+      return FALSE;
+    }
+  }
+
+  LASreadPoint lasreadpoint;
+  ByteStreamInArrayLE stream(&records[0], (I64)records.size());
+  if (!lasreadpoint.setup(points[0].num_items, points[0].items) || !lasreadpoint.init(&stream))
+  {
+    fprintf(stderr, "type %u with %u extra bytes: cannot set up LASreadPoint\n", format, number_extra_bytes);
+    return FALSE;
+  }
+
+  std::vector<LASreadItem*> readers;
+  ByteStreamInArrayLE chainstream(&records[0], (I64)records.size());
+  BOOL success = test_raw_readers(points[2].num_items, points[2].items, readers);
+  for (j = 0; j < readers.size(); j++)
+  {
+    ((LASreadItemRaw*)readers[j])->init(&chainstream);
+  }
+  LASreadPointRaw fused = test_raw_fused(format);
+
+  for (i = 0; success && (i < number); i++)
+  {
+    for (j = 0; j < 3; j++)
+    {
+      memset(&points[j].X, 0xA5, 32);
+      memset(points[j].rgbi, 0xA5, sizeof(points[j].rgbi));
+      memset(&points[j].wave_packet, 0xA5, sizeof(LASwavepacket));
+      if (number_extra_bytes) memset(points[j].extra_bytes, 0xA5, number_extra_bytes);
+    }
+    if (!lasreadpoint.read(points[0].point))
+    {
+      fprintf(stderr, "type %u with %u extra bytes: LASreadPoint cannot read record %u\n", format, number_extra_bytes, i);
+      success = FALSE;
+      break;
+    }
+    fused(&records[(size_t)i*point_size], points[1].point, number_extra_bytes);
+    U32 context = 0;
+    for (j = 0; j < readers.size(); j++)
+    {
+      readers[j]->read(points[2].point[j], context);
+    }
+    if (!test_raw_same(points[0], points[2]) || !test_raw_same(points[1], points[2]))
+    {
+      fprintf(stderr, "type %u with %u extra bytes: record %u is read differently by the %s reader than by the item readers\n", format, number_extra_bytes, i, (test_raw_same(points[1], points[2]) ? "LASreadPoint" : "fused"));
+      success = FALSE;
+    }
+  }
+
+  for (j = 0; j < readers.size(); j++)
+  {
+    delete readers[j];
+  }
+  return success;
+}
+
+BOOL test_raw()
+{
+  U8 format;
+  for (format = 0; format <= 10; format++)
+  {
+    if (!test_raw_format(format, 0) || !test_raw_format(format, 3))
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
@@ -0,0 +1,364 @@
+/*
+===============================================================================
+
+  FILE:  test_wkt.cpp
+
+  CONTENTS:
+
+    The OGC WKT parser of CRScheck on the dialects found in LAS 1.4 files:
+    WKT1, ESRI WKT with US survey feet, WKT2 with ENSEMBLE, USAGE, and ID,
+    compound CRSs of WKT1 and WKT2, BOUNDCRS, and a vertical CRS alone. the
+    extracted parameters must be converted to meter and degree, malformed
+    strings must fail with the right position, and GEOTIFF tags that agree or
+    disagree with the OGC WKT must pass or fail the CRS check.
+
+  PROGRAMMERS:
+
+    martin.isenburg@rapidlasso.com  -  http://rapidlasso.com
+
+  COPYRIGHT:
+
+    (c) 2007-2020, martin isenburg, rapidlasso - fast tools to catch reality
+
+    This is free software; you can redistribute and/or modify it under the
+    terms of the GNU Lesser General Licence as published by the Free Software
+    Foundation. See the COPYING.txt file for more information.
+
+    This software is distributed WITHOUT ANY WARRANTY and without even the
+    implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  CHANGE HISTORY:
+
+    18 October 2026 -- created to test the OGC WKT parser and its cross-checks
+
+===============================================================================
+*/
+#include "lastest.hpp"
+#include "crswkt.hpp"
+#include "crscheck.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <string>
+
+#define TEST_WKT_METER 1e-6
+#define TEST_WKT_DEGREE 1e-9
+
+static const CHAR* test_wkt_utm10 =
+  "PROJCS[\"NAD83 / UTM zone 10N\","
+    "GEOGCS[\"NAD83\","
+      "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6269\"]],"
+      "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+      "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],"
+      "AUTHORITY[\"EPSG\",\"4269\"]],"
+    "PROJECTION[\"Transverse_Mercator\"],"
+    "PARAMETER[\"latitude_of_origin\",0],"
+    "PARAMETER[\"central_meridian\",-123],"
+    "PARAMETER[\"scale_factor\",0.9996],"
+    "PARAMETER[\"false_easting\",500000],"
+    "PARAMETER[\"false_northing\",0],"
+    "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+    "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],"
+    "AUTHORITY[\"EPSG\",\"26910\"]]";
+
+static const CHAR* test_wkt_esri =
+  "PROJCS[\"NAD_1983_StatePlane_California_III_FIPS_0403_Feet\","
+    "GEOGCS[\"GCS_North_American_1983\",DATUM[\"D_North_American_1983\",SPHEROID[\"GRS_1980\",6378137.0,298.257222101]],PRIMEM[\"Greenwich\",0.0],UNIT[\"Degree\",0.0174532925199433]],"
+    "PROJECTION[\"Lambert_Conformal_Conic\"],"
+    "PARAMETER[\"False_Easting\",6561666.666666666],"
+    "PARAMETER[\"False_Northing\",1640416.666666667],"
+    "PARAMETER[\"Central_Meridian\",-120.5],"
+    "PARAMETER[\"Standard_Parallel_1\",37.06666666666667],"
+    "PARAMETER[\"Standard_Parallel_2\",38.43333333333333],"
+    "PARAMETER[\"Latitude_Of_Origin\",36.5],"
+    "UNIT[\"Foot_US\",0.3048006096012192]]";
+
+static const CHAR* test_wkt_wkt2 =
+  "PROJCRS[\"WGS 84 / UTM zone 33N\",\n"
+  "  BASEGEOGCRS[\"WGS 84\",\n"
+  "    ENSEMBLE[\"World Geodetic System 1984 ensemble\",\n"
+  "      MEMBER[\"World Geodetic System 1984 (Transit)\"],\n"
+  "      MEMBER[\"World Geodetic System 1984 (G2139)\"],\n"
+  "      ELLIPSOID[\"WGS 84\",6378137,298.257223563,LENGTHUNIT[\"metre\",1]],\n"
+  "      ENSEMBLEACCURACY[2.0]],\n"
+  "    PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],\n"
+  "    ID[\"EPSG\",4326]],\n"
+  "  CONVERSION[\"UTM zone 33N\",\n"
+  "    METHOD[\"Transverse Mercator\",ID[\"EPSG\",9807]],\n"
+  "    PARAMETER[\"Latitude of natural origin\",0,ANGLEUNIT[\"degree\",0.0174532925199433],ID[\"EPSG\",8801]],\n"
+  "    PARAMETER[\"Longitude of natural origin\",15,ANGLEUNIT[\"degree\",0.0174532925199433],ID[\"EPSG\",8802]],\n"
+  "    PARAMETER[\"Scale factor at natural origin\",0.9996,SCALEUNIT[\"unity\",1],ID[\"EPSG\",8805]],\n"
+  "    PARAMETER[\"False easting\",500000,LENGTHUNIT[\"metre\",1],ID[\"EPSG\",8806]],\n"
+  "    PARAMETER[\"False northing\",0,LENGTHUNIT[\"metre\",1],ID[\"EPSG\",8807]]],\n"
+  "  CS[Cartesian,2],\n"
+  "    AXIS[\"(E)\",east,ORDER[1],LENGTHUNIT[\"metre\",1]],\n"
+  "    AXIS[\"(N)\",north,ORDER[2],LENGTHUNIT[\"metre\",1]],\n"
+  "  USAGE[SCOPE[\"Engineering survey, topographic mapping.\"],AREA[\"Between 12E and 18E, northern hemisphere\"],BBOX[0,12,84,18],TIMEEXTENT[2013-01-01,2013-12-31T23:59:59Z]],\n"
+  "  ID[\"EPSG\",32633]]";
+
+static const CHAR* test_wkt_compd_cs =
+  "COMPD_CS[\"NAD83 / UTM zone 10N + NAVD88 height\","
+    "PROJCS[\"NAD83 / UTM zone 10N\",GEOGCS[\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378137,298.257222101]],PRIMEM[\"Greenwich\",0],UNIT[\"degree\",0.0174532925199433]],"
+      "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\",-123],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_northing\",0],"
+      "UNIT[\"metre\",1],AUTHORITY[\"EPSG\",\"26910\"]],"
+    "VERT_CS[\"NAVD88 height (ftUS)\",VERT_DATUM[\"North American Vertical Datum 1988\",2005,AUTHORITY[\"EPSG\",\"5103\"]],UNIT[\"US survey foot\",0.304800609601219],AXIS[\"Gravity-related height\",UP],AUTHORITY[\"EPSG\",\"6360\"]]]";
+
+static const CHAR* test_wkt_compoundcrs =
+  "COMPOUNDCRS[\"ETRS89 / UTM zone 32N + DHHN2016 height\","
+    "PROJCRS[\"ETRS89 / UTM zone 32N\",BASEGEOGCRS[\"ETRS89\",DATUM[\"European Terrestrial Reference System 1989\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101]],ID[\"EPSG\",4258]],"
+      "CONVERSION[\"UTM zone 32N\",METHOD[\"Transverse Mercator\"],PARAMETER[\"Latitude of natural origin\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],PARAMETER[\"Longitude of natural origin\",9,ANGLEUNIT[\"degree\",0.0174532925199433]],"
+        "PARAMETER[\"Scale factor at natural origin\",0.9996,SCALEUNIT[\"unity\",1]],PARAMETER[\"False easting\",500000,LENGTHUNIT[\"metre\",1]],PARAMETER[\"False northing\",0,LENGTHUNIT[\"metre\",1]]],"
+      "CS[Cartesian,2],AXIS[\"easting (E)\",east],AXIS[\"northing (N)\",north],LENGTHUNIT[\"metre\",1],ID[\"EPSG\",25832]],"
+    "VERTCRS[\"DHHN2016 height\",VDATUM[\"Deutsches Haupthoehennetz 2016\"],CS[vertical,1],AXIS[\"gravity-related height (H)\",up],LENGTHUNIT[\"metre\",1],ID[\"EPSG\",7837]],"
+    "ID[\"EPSG\",9784]]";
+
+static const CHAR* test_wkt_boundcrs =
+  "BOUNDCRS["
+    "SOURCECRS[PROJCRS[\"NAD27 / UTM zone 17N\",BASEGEOGCRS[\"NAD27\",DATUM[\"North American Datum 1927\",ELLIPSOID[\"Clarke 1866\",6378206.4,294.978698213898]]],"
+      "CONVERSION[\"UTM zone 17N\",METHOD[\"Transverse Mercator\",ID[\"EPSG\",9807]],PARAMETER[\"Latitude of natural origin\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],PARAMETER[\"Longitude of natural origin\",-81,ANGLEUNIT[\"degree\",0.0174532925199433]],"
+        "PARAMETER[\"Scale factor at natural origin\",0.9996,SCALEUNIT[\"unity\",1]],PARAMETER[\"False easting\",500000,LENGTHUNIT[\"metre\",1]],PARAMETER[\"False northing\",0,LENGTHUNIT[\"metre\",1]]],"
+      "CS[Cartesian,2],AXIS[\"(E)\",east],AXIS[\"(N)\",north],LENGTHUNIT[\"metre\",1],ID[\"EPSG\",26717]]],"
+    "TARGETCRS[GEOGCRS[\"WGS 84\",DATUM[\"World Geodetic System 1984\",ELLIPSOID[\"WGS 84\",6378137,298.257223563]],CS[ellipsoidal,2],AXIS[\"latitude\",north],AXIS[\"longitude\",east],ANGLEUNIT[\"degree\",0.0174532925199433],ID[\"EPSG\",4326]]],"
+    "ABRIDGEDTRANSFORMATION[\"NAD27 to WGS 84\",METHOD[\"Geocentric translations\"],PARAMETER[\"X-axis translation\",-8],PARAMETER[\"Y-axis translation\",160],PARAMETER[\"Z-axis translation\",176]]]";
+
+static const CHAR* test_wkt_vertical =
+  "VERT_CS[\"NAVD88 height\",VERT_DATUM[\"North American Vertical Datum 1988\",2005],UNIT[\"metre\",1],AXIS[\"Up\",UP],AUTHORITY[\"EPSG\",\"5703\"]]";
+
+static BOOL parse(const CHAR* name, const CHAR* wkt, CRSwkt& crswkt)
+{
+  if (!crswkt.parse(wkt, (U32)strlen(wkt)))
+  {
+    fprintf(stderr, "%s: %s\n", name, crswkt.get_error());
+    return FALSE;
+  }
+  return TRUE;
+}
+
+static BOOL expect(const CHAR* name, const BOOL condition, const CHAR* what)
+{
+  if (!condition)
+  {
+    fprintf(stderr, "%s: wrong %s\n", name, what);
+  }
+  return condition;
+}
+
+static BOOL same_string(const CHAR* string, const U32 length, const CHAR* literal)
+{
+  return (string != 0) && (length == strlen(literal)) && (strncmp(string, literal, length) == 0);
+}
+
+static BOOL same_value(const F64 value, const F64 expected, const F64 tolerance)
+{
+  return (fabs(value - expected) <= tolerance);
+}
+
+// checks the parameters of a Transverse Mercator projection in meter and degree
+
+static BOOL expect_tm(const CHAR* name, const CRSwkt& crswkt, const F64 central_meridian)
+{
+  return expect(name, crswkt.method == CRS_WKT_METHOD_TM, "method") &&
+         expect(name, crswkt.has_parameter == 0x1F, "parameters given") &&
+         expect(name, same_value(crswkt.parameters[CRS_WKT_FALSE_EASTING], 500000.0, TEST_WKT_METER), "false easting") &&
+         expect(name, same_value(crswkt.parameters[CRS_WKT_FALSE_NORTHING], 0.0, TEST_WKT_METER), "false northing") &&
+         expect(name, same_value(crswkt.parameters[CRS_WKT_LATITUDE_OF_ORIGIN], 0.0, TEST_WKT_DEGREE), "latitude of origin") &&
+         expect(name, same_value(crswkt.parameters[CRS_WKT_CENTRAL_MERIDIAN], central_meridian, TEST_WKT_DEGREE), "central meridian") &&
+         expect(name, same_value(crswkt.parameters[CRS_WKT_SCALE_FACTOR], 0.9996, 1e-12), "scale factor");
+}
+
+static BOOL test_wkt1()
+{
+  const CHAR* name = "WKT1";
+  CRSwkt crswkt;
+  return parse(name, test_wkt_utm10, crswkt) &&
+         expect(name, crswkt.type == CRS_WKT_PROJECTED, "type") &&
+         expect(name, same_string(crswkt.name, crswkt.name_length, "NAD83 / UTM zone 10N"), "name") &&
+         expect(name, crswkt.epsg == 26910, "EPSG code") &&
+         expect(name, crswkt.geographic_epsg == 4269, "geographic EPSG code") &&
+         expect(name, crswkt.datum_epsg == 6269, "datum EPSG code") &&
+         expect(name, crswkt.ellipsoid_epsg == 7019, "ellipsoid EPSG code") &&
+         expect(name, (crswkt.semi_major_axis == 6378137.0) && (crswkt.inverse_flattening == 298.257222101), "ellipsoid") &&
+         expect(name, crswkt.linear_unit == 1.0, "linear unit") &&
+         expect_tm(name, crswkt, -123.0) &&
+         expect(name, !crswkt.vertical, "vertical CRS");
+}
+
+// the false easting and northing are in US survey feet and must come out in meter
+
+static BOOL test_wkt_esri_feet()
+{
+  const CHAR* name = "ESRI WKT";
+  CRSwkt crswkt;
+  return parse(name, test_wkt_esri, crswkt) &&
+         expect(name, crswkt.type == CRS_WKT_PROJECTED, "type") &&
+         expect(name, crswkt.epsg == 0, "EPSG code") &&
+         expect(name, crswkt.method == CRS_WKT_METHOD_LCC_2SP, "method") &&
+         expect(name, same_value(crswkt.linear_unit, 1200.0/3937.0, 1e-15), "linear unit") &&
+         expect(name, same_value(crswkt.parameters[CRS_WKT_FALSE_EASTING], 2000000.0, TEST_WKT_METER), "false easting") &&
+         expect(name, same_value(crswkt.parameters[CRS_WKT_FALSE_NORTHING], 500000.0, TEST_WKT_METER), "false northing") &&
+         expect(name, same_value(crswkt.parameters[CRS_WKT_LATITUDE_OF_ORIGIN], 36.5, TEST_WKT_DEGREE), "latitude of origin") &&
+         expect(name, same_value(crswkt.parameters[CRS_WKT_CENTRAL_MERIDIAN], -120.5, TEST_WKT_DEGREE), "central meridian") &&
+         expect(name, same_value(crswkt.parameters[CRS_WKT_STANDARD_PARALLEL_1], 37.06666666666667, TEST_WKT_DEGREE), "first standard parallel") &&
+         expect(name, same_value(crswkt.parameters[CRS_WKT_STANDARD_PARALLEL_2], 38.43333333333333, TEST_WKT_DEGREE), "second standard parallel");
+}
+
+static BOOL test_wkt2()
+{
+  const CHAR* name = "WKT2";
+  CRSwkt crswkt;
+  return parse(name, test_wkt_wkt2, crswkt) &&
+         expect(name, crswkt.type == CRS_WKT_PROJECTED, "type") &&
+         expect(name, same_string(crswkt.name, crswkt.name_length, "WGS 84 / UTM zone 33N"), "name") &&
+         expect(name, crswkt.epsg == 32633, "EPSG code") &&
+         expect(name, crswkt.geographic_epsg == 4326, "geographic EPSG code") &&
+         expect(name, (crswkt.semi_major_axis == 6378137.0) && (crswkt.inverse_flattening == 298.257223563), "ellipsoid of the ensemble") &&
+         expect(name, crswkt.linear_unit == 1.0, "linear unit of the axes") &&
+         expect_tm(name, crswkt, 15.0);
+}
+
+static BOOL test_wkt_compound()
+{
+  CRSwkt crswkt;
+  const CHAR* name = "COMPD_CS";
+  if (!parse(name, test_wkt_compd_cs, crswkt) ||
+      !expect(name, crswkt.type == CRS_WKT_PROJECTED, "type") ||
+      !expect(name, same_string(crswkt.name, crswkt.name_length, "NAD83 / UTM zone 10N"), "name of the horizontal CRS") ||
+      !expect(name, crswkt.epsg == 26910, "EPSG code") ||
+      !expect_tm(name, crswkt, -123.0) ||
+      !expect(name, crswkt.vertical, "vertical CRS") ||
+      !expect(name, same_string(crswkt.vertical_name, crswkt.vertical_name_length, "NAVD88 height (ftUS)"), "vertical name") ||
+      !expect(name, crswkt.vertical_epsg == 6360, "vertical EPSG code") ||
+      !expect(name, same_value(crswkt.vertical_unit, 1200.0/3937.0, 1e-15), "vertical unit"))
+  {
+    return FALSE;
+  }
+  name = "COMPOUNDCRS";
+  return parse(name, test_wkt_compoundcrs, crswkt) &&
+         expect(name, crswkt.type == CRS_WKT_PROJECTED, "type") &&
+         expect(name, crswkt.epsg == 25832, "EPSG code of the horizontal CRS") &&
+         expect_tm(name, crswkt, 9.0) &&
+         expect(name, crswkt.vertical, "vertical CRS") &&
+         expect(name, crswkt.vertical_epsg == 7837, "vertical EPSG code") &&
+         expect(name, crswkt.vertical_unit == 1.0, "vertical unit");
+}
+
+// the source CRS is the CRS of the points. the target CRS and the
+// transformation must not overwrite it
+
+static BOOL test_wkt_bound()
+{
+  const CHAR* name = "BOUNDCRS";
+  CRSwkt crswkt;
+  return parse(name, test_wkt_boundcrs, crswkt) &&
+         expect(name, crswkt.type == CRS_WKT_PROJECTED, "type") &&
+         expect(name, same_string(crswkt.name, crswkt.name_length, "NAD27 / UTM zone 17N"), "name") &&
+         expect(name, crswkt.epsg == 26717, "EPSG code") &&
+         expect(name, (crswkt.semi_major_axis == 6378206.4) && (crswkt.inverse_flattening == 294.978698213898), "ellipsoid") &&
+         expect_tm(name, crswkt, -81.0);
+}
+
+static BOOL test_wkt_vertical_only()
+{
+  const CHAR* name = "VERT_CS";
+  CRSwkt crswkt;
+  return parse(name, test_wkt_vertical, crswkt) &&
+         expect(name, crswkt.type == CRS_WKT_NONE, "type") &&
+         expect(name, crswkt.name == 0, "name") &&
+         expect(name, crswkt.vertical, "vertical CRS") &&
+         expect(name, same_string(crswkt.vertical_name, crswkt.vertical_name_length, "NAVD88 height"), "vertical name") &&
+         expect(name, crswkt.vertical_epsg == 5703, "vertical EPSG code") &&
+         expect(name, crswkt.vertical_unit == 1.0, "vertical unit");
+}
+
+// malformed strings and the errors they must fail with
+
+static const CHAR* test_wkt_malformed[][2] =
+{
+  { "", "expected keyword at character 0" },
+  { "  DATUM[\"D\",SPHEROID[\"S\",6378137,298.257]]", "not a coordinate reference system at character 2" },
+  { "GEOGCS[\"x\",DATUM[\"d\",SPHEROID[\"s\",6378137,298.257]],UNIT[\"degree\",0.0174532925199433]", "unexpected end of string at character 85" },
+  { "GEOGCS[\"x\" DATUM[\"d\",SPHEROID[\"s\",6378137,298.257]]]", "expected ',' or closing bracket at character 11" },
+  { "GEOGCS[\"x\",DATUM[\"d\",SPHEROID[\"s\",6378.137.1,298.257]]]", "malformed number at character 34" },
+  { "GEOGCS[\"x,DATUM[\"d\"]]", "expected ',' or closing bracket at character 17" },
+  { "GEOGCS[\"x\",DATUM[\"d\",SPHEROID[\"s\",-6378137,298.257]]]", "ellipsoid without positive semi-major axis and inverse flattening at character 51" },
+  { "GEOGCS[\"x\",DATUM[\"d\",SPHEROID[\"s\",6378137,298.257]],UNIT[\"degree\",0]]", "unit without positive conversion factor at character 68" },
+  { "GEOGCS[DATUM[\"d\",SPHEROID[\"s\",6378137,298.257]]]", "coordinate reference system without name at character 48" },
+  { "GEOGCS[\"x\",DATUM[\"d\",SPHEROID[\"s\",6378137,298.257]]] x", "unexpected characters after the end at character 53" },
+  { "PROJCS[\"p\",GEOGCS[\"x\",DATUM[\"d\",SPHEROID[\"s\",6378137,298.257]]],UNIT[\"metre\",1]]", "projected coordinate reference system without projection at character 80" },
+  { "GEOGCS[\"x\",DATUM[\"d\",SPHEROID[\"s\",6378137,298.257]],USAGE[TIMEEXTENT[2013-01-01,?]]]", "unexpected character at character 80" },
+};
+
+static BOOL test_wkt_errors()
+{
+  U32 i;
+  for (i = 0; i < sizeof(test_wkt_malformed)/sizeof(test_wkt_malformed[0]); i++)
+  {
+    CRSwkt crswkt;
+    if (crswkt.parse(test_wkt_malformed[i][0], (U32)strlen(test_wkt_malformed[i][0])))
+    {
+      fprintf(stderr, "malformed WKT '%s' parses\n", test_wkt_malformed[i][0]);
+      return FALSE;
+    }
+    if (strcmp(crswkt.get_error(), test_wkt_malformed[i][1]) != 0)
+    {
+      fprintf(stderr, "malformed WKT '%s' fails with '%s' and not '%s'\n", test_wkt_malformed[i][0], crswkt.get_error(), test_wkt_malformed[i][1]);
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+// the GeoKeys of NAD83 / UTM zone 10N in meter: GTModelTypeGeoKey,
+// GTRasterTypeGeoKey, ProjectedCSTypeGeoKey, and ProjLinearUnitsGeoKey
+
+static U16 test_wkt_geokeys[] = { 1, 1, 0, 4, 1024, 0, 1, 1, 1025, 0, 1, 1, 3072, 0, 1, 26910, 3076, 0, 1, 9001 };
+
+static BOOL test_wkt_with_geokeys(const CHAR* name, const CHAR* wkt, const CHAR* inconsistency)
+{
+  LASheader lasheader;
+  lasheader.version_minor = 4;
+  lasheader.point_data_format = 6;
+  lasheader.geokeys = (LASgeokeys*)&test_wkt_geokeys[0];
+  lasheader.geokey_entries = (LASgeokey_entry*)&test_wkt_geokeys[4];
+  lasheader.ogc_wkt = (CHAR*)wkt;
+  lasheader.ogc_wkt_num = (U32)strlen(wkt) + 1;
+
+  CRScheck crscheck;
+  CHAR description[512];
+  crscheck.check(&lasheader, description);
+
+  BOOL success = TRUE;
+  if ((inconsistency == 0) && (lasheader.fail_num || lasheader.warning_num))
+  {
+    fprintf(stderr, "%s: GEOTIFF tags and OGC WKT that agree give '%s'\n", name, (lasheader.fail_num ? lasheader.fails[1] : lasheader.warnings[1]));
+    success = FALSE;
+  }
+  else if (inconsistency && ((lasheader.fail_num != 2) || (strcmp(lasheader.fails[1], inconsistency) != 0)))
+  {
+    fprintf(stderr, "%s: GEOTIFF tags and OGC WKT that disagree give %u fails and not '%s'\n", name, lasheader.fail_num/2, inconsistency);
+    success = FALSE;
+  }
+
+  // the pointers are not owned by the header
+  lasheader.geokeys = 0;
+  lasheader.geokey_entries = 0;
+  lasheader.ogc_wkt = 0;
+  return success;
+}
+
+BOOL test_wkt()
+{
+  if (!test_wkt1() || !test_wkt_esri_feet() || !test_wkt2() || !test_wkt_compound() || !test_wkt_bound() || !test_wkt_vertical_only() || !test_wkt_errors())
+  {
+    return FALSE;
+  }
+
+  // the same projection but the central meridian of zone 11
+
+  std::string zone11(test_wkt_utm10);
+  zone11.replace(zone11.find("-123"), 4, "-117");
+  return test_wkt_with_geokeys("GeoKeys and WKT1 of UTM 10N", test_wkt_utm10, 0) &&
+         test_wkt_with_geokeys("GeoKeys of UTM 10N and WKT1 of UTM 11N", zone11.c_str(), "inconsistency. GEOTIFF tags and OGC WKT differ in the central meridian (-123 versus -117)");
+}